@@ -73,7 +73,7 @@ gs_hw_fix_ranges = {
     "deinterlace": (0, 7),
     "cpuSpriteRenderBW": (1, 10),
 }
-allowed_speed_hacks = ["mvuFlagSpeedHack", "InstantVU1SpeedHack", "MTVUSpeedHack"]
+allowed_speed_hacks = ["mvuFlagSpeedHack", "InstantVU1SpeedHack", "MTVUSpeedHack", "InstantVU0SpeedHack"]
 # Patches are allowed to have a 'default' key or a crc-32 key, followed by
 allowed_patch_options = ["author", "content"]
 
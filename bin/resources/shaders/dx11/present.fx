@@ -143,6 +143,33 @@ PS_OUTPUT ps_filter_complex(PS_INPUT input) // triangular
 	return output;
 }
 
+// Contrast adaptive sharpening (after AMD FidelityFX CAS). Sharpens less where the
+// neighbourhood is already contrasty, so a low internal resolution can be restored
+// at present time without haloing.
+PS_OUTPUT ps_filter_sharpen(PS_INPUT input)
+{
+	PS_OUTPUT output;
+
+	float2 texdim;
+	Texture.GetDimensions(texdim.x, texdim.y);
+	float2 texel = 1.0f / texdim;
+
+	float4 c = sample_c(input.t);
+	float3 n = sample_c(input.t + float2(0.0f, -texel.y)).rgb;
+	float3 w = sample_c(input.t + float2(-texel.x, 0.0f)).rgb;
+	float3 e = sample_c(input.t + float2(texel.x, 0.0f)).rgb;
+	float3 s = sample_c(input.t + float2(0.0f, texel.y)).rgb;
+
+	float3 mn = min(c.rgb, min(min(n, w), min(e, s)));
+	float3 mx = max(c.rgb, max(max(n, w), max(e, s)));
+	float3 amp = sqrt(saturate(min(mn, 2.0f - mx) / max(mx, 1.0f / 256.0f)));
+	float3 wt = amp * (-1.0f / 6.5f);
+
+	output.c = float4(saturate(((n + w + e + s) * wt + c.rgb) / (1.0f + 4.0f * wt)), c.a);
+
+	return output;
+}
+
 //Lottes CRT
 #define MaskingType 4                      //[1|2|3|4] The type of CRT shadow masking used. 1: compressed TV style, 2: Aperture-grille, 3: Stretched VGA style, 4: VGA style.
 #define ScanBrightness -8.00               //[-16.0 to 1.0] The overall brightness of the scanline effect. Lower for darker, higher for brighter.
@@ -125,6 +125,28 @@ void ps_filter_complex()
 }
 #endif
 
+#ifdef ps_filter_sharpen
+// Contrast adaptive sharpening (after AMD FidelityFX CAS). Sharpens less where the
+// neighbourhood is already contrasty, so a low internal resolution can be restored
+// at present time without haloing.
+void ps_filter_sharpen()
+{
+	vec2 texel = 1.0f / vec2(textureSize(TextureSampler, 0));
+	vec4 c = texture(TextureSampler, PSin_t);
+	vec3 n = texture(TextureSampler, PSin_t + vec2(0.0f, -texel.y)).rgb;
+	vec3 w = texture(TextureSampler, PSin_t + vec2(-texel.x, 0.0f)).rgb;
+	vec3 e = texture(TextureSampler, PSin_t + vec2(texel.x, 0.0f)).rgb;
+	vec3 s = texture(TextureSampler, PSin_t + vec2(0.0f, texel.y)).rgb;
+
+	vec3 mn = min(c.rgb, min(min(n, w), min(e, s)));
+	vec3 mx = max(c.rgb, max(max(n, w), max(e, s)));
+	vec3 amp = sqrt(clamp(min(mn, 2.0f - mx) / max(mx, vec3(1.0f / 256.0f)), 0.0f, 1.0f));
+	vec3 wt = amp * (-1.0f / 6.5f);
+
+	SV_Target0 = vec4(clamp(((n + w + e + s) * wt + c.rgb) / (1.0f + 4.0f * wt), 0.0f, 1.0f), c.a);
+}
+#endif
+
 #ifdef ps_filter_lottes
 
 #define MaskingType 4                      //[1|2|3|4] The type of CRT shadow masking used. 1: compressed TV style, 2: Aperture-grille, 3: Stretched VGA style, 4: VGA style.
@@ -392,6 +392,20 @@ bool Context::CreateTextureStreamBuffer()
 	return m_texture_stream_buffer.Create(TEXTURE_UPLOAD_BUFFER_SIZE);
 }
 
+bool Context::GrowTextureStreamBuffer()
+{
+	const u32 new_size = m_texture_stream_buffer.GetSize() * 2;
+	if (new_size > MAX_TEXTURE_UPLOAD_BUFFER_SIZE)
+		return false;
+
+	// The old buffer is destroyed once the GPU is done with it.
+	if (!m_texture_stream_buffer.Create(new_size))
+		return false;
+
+	DevCon.WriteLn("D3D12: Texture upload buffer grown to %u MB", new_size / 1048576);
+	return true;
+}
+
 void Context::MoveToNextCommandList()
 {
 	m_current_command_list = (m_current_command_list + 1) % NUM_COMMAND_LISTS;
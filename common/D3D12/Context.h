@@ -50,6 +50,9 @@ namespace D3D12
 			/// Textures that don't fit into this buffer will be uploaded with a staging buffer.
 			TEXTURE_UPLOAD_BUFFER_SIZE = 64 * 1024 * 1024,
 
+			/// The upload buffer grows up to this size if a command list fills it.
+			MAX_TEXTURE_UPLOAD_BUFFER_SIZE = 256 * 1024 * 1024,
+
 			/// Maximum number of samples in a single allocation group.
 			SAMPLER_GROUP_SIZE = 2,
 
@@ -106,6 +109,10 @@ namespace D3D12
 		const DescriptorHandle& GetNullSRVDescriptor() const { return m_null_srv_descriptor; }
 		StreamBuffer& GetTextureStreamBuffer() { return m_texture_stream_buffer; }
 
+		/// Doubles the texture upload buffer, up to MAX_TEXTURE_UPLOAD_BUFFER_SIZE. Called when the buffer is full of
+		/// data for the current command list, so we can keep recording rather than submitting mid-frame.
+		bool GrowTextureStreamBuffer();
+
 		// Root signature access.
 		ComPtr<ID3DBlob> SerializeRootSignature(const D3D12_ROOT_SIGNATURE_DESC* desc);
 		ComPtr<ID3D12RootSignature> CreateRootSignature(const D3D12_ROOT_SIGNATURE_DESC* desc);
@@ -23,6 +23,8 @@
 
 #include <d3dcompiler.h>
 
+#include "zstd.h"
+
 #ifdef _UWP
 #include <winrt/Windows.System.Profile.h>
 #endif
@@ -38,13 +40,48 @@ struct CacheIndexEntry
 	u64 macro_hash_high;
 	u64 entry_point_low;
 	u64 entry_point_high;
+	u64 blob_hash;
 	u32 source_length;
 	u32 shader_type;
 	u32 file_offset;
+	u32 compressed_size;
 	u32 blob_size;
 };
 #pragma pack(pop)
 
+// Hash of the compiled blob, used to store identical blobs only once in the blob file.
+static u64 GetBlobHash(const void* data, u32 size)
+{
+	union
+	{
+		u64 hash_low;
+		u8 hash[16];
+	};
+
+	MD5Digest digest;
+	digest.Update(data, size);
+	digest.Final(hash);
+	return hash_low;
+}
+
+static ShaderCache::ComPtr<ID3DBlob> ReadCompressedBlob(std::FILE* fp, u32 file_offset, u32 compressed_size, u32 blob_size)
+{
+	std::vector<u8> compressed(compressed_size);
+	if (std::fseek(fp, file_offset, SEEK_SET) != 0 || std::fread(compressed.data(), 1, compressed_size, fp) != compressed_size)
+		return {};
+
+	ShaderCache::ComPtr<ID3DBlob> blob;
+	HRESULT hr = D3DCreateBlob(blob_size, blob.put());
+	if (FAILED(hr))
+		return {};
+
+	const size_t result = ZSTD_decompress(blob->GetBufferPointer(), blob_size, compressed.data(), compressed_size);
+	if (ZSTD_isError(result) || result != blob_size)
+		return {};
+
+	return blob;
+}
+
 static bool CanUsePipelineCache()
 {
 #ifdef _UWP
@@ -106,7 +143,7 @@ bool ShaderCache::Open(std::string_view base_path, D3D_FEATURE_LEVEL feature_lev
 		const std::string shader_blob_filename = base_shader_filename + ".bin";
 
 		if (!ReadExisting(shader_index_filename, shader_blob_filename, m_shader_index_file, m_shader_blob_file,
-				m_shader_index))
+				m_shader_index, m_shader_blob_index))
 		{
 			result = CreateNew(shader_index_filename, shader_blob_filename, m_shader_index_file, m_shader_blob_file);
 		}
@@ -118,7 +155,7 @@ bool ShaderCache::Open(std::string_view base_path, D3D_FEATURE_LEVEL feature_lev
 			const std::string pipelines_blob_filename = base_pipelines_filename + ".bin";
 
 			if (!ReadExisting(pipelines_index_filename, pipelines_blob_filename, m_pipeline_index_file, m_pipeline_blob_file,
-					m_pipeline_index))
+					m_pipeline_index, m_pipeline_blob_index))
 			{
 				result = CreateNew(pipelines_index_filename, pipelines_blob_filename, m_pipeline_index_file, m_pipeline_blob_file);
 			}
@@ -131,6 +168,7 @@ bool ShaderCache::Open(std::string_view base_path, D3D_FEATURE_LEVEL feature_lev
 void ShaderCache::InvalidatePipelineCache()
 {
 	m_pipeline_index.clear();
+	m_pipeline_blob_index.clear();
 	if (m_pipeline_blob_file)
 	{
 		std::fclose(m_pipeline_blob_file);
@@ -199,7 +237,7 @@ bool ShaderCache::CreateNew(const std::string& index_filename, const std::string
 }
 
 bool ShaderCache::ReadExisting(const std::string& index_filename, const std::string& blob_filename,
-	std::FILE*& index_file, std::FILE*& blob_file, CacheIndex& index)
+	std::FILE*& index_file, std::FILE*& blob_file, CacheIndex& index, BlobIndex& blob_index)
 {
 	index_file = FileSystem::OpenCFile(index_filename.c_str(), "r+b");
 	if (!index_file)
@@ -237,17 +275,28 @@ bool ShaderCache::ReadExisting(const std::string& index_filename, const std::str
 
 	std::fseek(blob_file, 0, SEEK_END);
 	const u32 blob_file_size = static_cast<u32>(std::ftell(blob_file));
+	if (blob_file_size > MAX_BLOB_FILE_SIZE)
+	{
+		Console.Warning("Blob file '%s' is over the size limit (%u bytes), rebuilding cache", blob_filename.c_str(),
+			blob_file_size);
+		std::fclose(blob_file);
+		blob_file = nullptr;
+		std::fclose(index_file);
+		index_file = nullptr;
+		return false;
+	}
 
 	for (;;)
 	{
 		CacheIndexEntry entry;
-		if (std::fread(&entry, sizeof(entry), 1, index_file) != 1 || (entry.file_offset + entry.blob_size) > blob_file_size)
+		if (std::fread(&entry, sizeof(entry), 1, index_file) != 1 || (entry.file_offset + entry.compressed_size) > blob_file_size)
 		{
 			if (std::feof(index_file))
 				break;
 
 			Console.Error("Failed to read entry from '%s', corrupt file?", index_filename.c_str());
 			index.clear();
+			blob_index.clear();
 			std::fclose(blob_file);
 			blob_file = nullptr;
 			std::fclose(index_file);
@@ -260,14 +309,15 @@ bool ShaderCache::ReadExisting(const std::string& index_filename, const std::str
 			entry.macro_hash_low, entry.macro_hash_high,
 			entry.entry_point_low, entry.entry_point_high,
 			entry.source_length, static_cast<EntryType>(entry.shader_type)};
-		const CacheIndexData data{entry.file_offset, entry.blob_size};
+		const CacheIndexData data{entry.file_offset, entry.compressed_size, entry.blob_size};
 		index.emplace(key, data);
+		blob_index.emplace(entry.blob_hash, data);
 	}
 
 	// ensure we don't write before seeking
 	std::fseek(index_file, 0, SEEK_END);
 
-	DevCon.WriteLn("Read %zu entries from '%s'", index.size(), index_filename.c_str());
+	DevCon.WriteLn("Read %zu entries (%zu unique blobs) from '%s'", index.size(), blob_index.size(), index_filename.c_str());
 	return true;
 }
 
@@ -417,10 +467,9 @@ ShaderCache::ComPtr<ID3DBlob> ShaderCache::GetShaderBlob(EntryType type, std::st
 	if (iter == m_shader_index.end())
 		return CompileAndAddShaderBlob(key, shader_code, macros, entry_point);
 
-	ComPtr<ID3DBlob> blob;
-	HRESULT hr = D3DCreateBlob(iter->second.blob_size, blob.put());
-	if (FAILED(hr) || std::fseek(m_shader_blob_file, iter->second.file_offset, SEEK_SET) != 0 ||
-		std::fread(blob->GetBufferPointer(), 1, iter->second.blob_size, m_shader_blob_file) != iter->second.blob_size)
+	ComPtr<ID3DBlob> blob =
+		ReadCompressedBlob(m_shader_blob_file, iter->second.file_offset, iter->second.compressed_size, iter->second.blob_size);
+	if (!blob)
 	{
 		Console.Error("Read blob from file failed");
 		return {};
@@ -438,10 +487,9 @@ ShaderCache::ComPtr<ID3D12PipelineState> ShaderCache::GetPipelineState(ID3D12Dev
 	if (iter == m_pipeline_index.end())
 		return CompileAndAddPipeline(device, key, desc);
 
-	ComPtr<ID3DBlob> blob;
-	HRESULT hr = D3DCreateBlob(iter->second.blob_size, blob.put());
-	if (FAILED(hr) || std::fseek(m_pipeline_blob_file, iter->second.file_offset, SEEK_SET) != 0 ||
-		std::fread(blob->GetBufferPointer(), 1, iter->second.blob_size, m_pipeline_blob_file) != iter->second.blob_size)
+	ComPtr<ID3DBlob> blob = ReadCompressedBlob(
+		m_pipeline_blob_file, iter->second.file_offset, iter->second.compressed_size, iter->second.blob_size);
+	if (!blob)
 	{
 		Console.Error("Read blob from file failed");
 		return {};
@@ -452,7 +500,7 @@ ShaderCache::ComPtr<ID3D12PipelineState> ShaderCache::GetPipelineState(ID3D12Dev
 	desc_with_blob.CachedPSO.CachedBlobSizeInBytes = blob->GetBufferSize();
 
 	ComPtr<ID3D12PipelineState> pso;
-	hr = device->CreateGraphicsPipelineState(&desc_with_blob, IID_PPV_ARGS(pso.put()));
+	HRESULT hr = device->CreateGraphicsPipelineState(&desc_with_blob, IID_PPV_ARGS(pso.put()));
 	if (FAILED(hr))
 	{
 		Console.Warning("Creating cached PSO failed: %08X. Invalidating cache.", hr);
@@ -489,31 +537,7 @@ ShaderCache::ComPtr<ID3DBlob> ShaderCache::CompileAndAddShaderBlob(const CacheIn
 	if (!m_shader_blob_file || std::fseek(m_shader_blob_file, 0, SEEK_END) != 0)
 		return blob;
 
-	CacheIndexData data;
-	data.file_offset = static_cast<u32>(std::ftell(m_shader_blob_file));
-	data.blob_size = static_cast<u32>(blob->GetBufferSize());
-
-	CacheIndexEntry entry = {};
-	entry.source_hash_low = key.source_hash_low;
-	entry.source_hash_high = key.source_hash_high;
-	entry.macro_hash_low = key.macro_hash_low;
-	entry.macro_hash_high = key.macro_hash_high;
-	entry.entry_point_low = key.entry_point_low;
-	entry.entry_point_high = key.entry_point_high;
-	entry.source_length = key.source_length;
-	entry.shader_type = static_cast<u32>(key.type);
-	entry.blob_size = data.blob_size;
-	entry.file_offset = data.file_offset;
-
-	if (std::fwrite(blob->GetBufferPointer(), 1, entry.blob_size, m_shader_blob_file) != entry.blob_size ||
-		std::fflush(m_shader_blob_file) != 0 || std::fwrite(&entry, sizeof(entry), 1, m_shader_index_file) != 1 ||
-		std::fflush(m_shader_index_file) != 0)
-	{
-		Console.Error("Failed to write shader blob to file");
-		return blob;
-	}
-
-	m_shader_index.emplace(key, data);
+	WriteBlob(m_shader_index_file, m_shader_blob_file, m_shader_index, m_shader_blob_index, key, blob.get());
 	return blob;
 }
 
@@ -540,26 +564,72 @@ ShaderCache::CompileAndAddPipeline(ID3D12Device* device, const CacheIndexKey& ke
 		return pso;
 	}
 
+	WriteBlob(m_pipeline_index_file, m_pipeline_blob_file, m_pipeline_index, m_pipeline_blob_index, key, blob.get());
+	return pso;
+}
+
+bool ShaderCache::WriteBlob(std::FILE* index_file, std::FILE* blob_file, CacheIndex& index, BlobIndex& blob_index,
+	const CacheIndexKey& key, ID3DBlob* blob)
+{
+	const u32 blob_size = static_cast<u32>(blob->GetBufferSize());
+	const u64 blob_hash = GetBlobHash(blob->GetBufferPointer(), blob_size);
+
+	// Different sources (e.g. unused defines) frequently compile to the same bytecode, reuse the stored copy.
 	CacheIndexData data;
-	data.file_offset = static_cast<u32>(std::ftell(m_pipeline_blob_file));
-	data.blob_size = static_cast<u32>(blob->GetBufferSize());
+	auto blob_iter = blob_index.find(blob_hash);
+	if (blob_iter != blob_index.end() && blob_iter->second.blob_size == blob_size)
+	{
+		data = blob_iter->second;
+	}
+	else
+	{
+		std::vector<u8> compressed(ZSTD_compressBound(blob_size));
+		const size_t compressed_size = ZSTD_compress(
+			compressed.data(), compressed.size(), blob->GetBufferPointer(), blob_size, ZSTD_CLEVEL_DEFAULT);
+		if (ZSTD_isError(compressed_size))
+		{
+			Console.Error("Failed to compress blob: %s", ZSTD_getErrorName(compressed_size));
+			return false;
+		}
+
+		const u32 file_offset = static_cast<u32>(std::ftell(blob_file));
+		if ((static_cast<u64>(file_offset) + compressed_size) > MAX_BLOB_FILE_SIZE)
+			return false;
+
+		data.file_offset = file_offset;
+		data.compressed_size = static_cast<u32>(compressed_size);
+		data.blob_size = blob_size;
+
+		if (std::fwrite(compressed.data(), 1, compressed_size, blob_file) != compressed_size ||
+			std::fflush(blob_file) != 0)
+		{
+			Console.Error("Failed to write blob to file");
+			return false;
+		}
+
+		blob_index.emplace(blob_hash, data);
+	}
 
 	CacheIndexEntry entry = {};
 	entry.source_hash_low = key.source_hash_low;
 	entry.source_hash_high = key.source_hash_high;
+	entry.macro_hash_low = key.macro_hash_low;
+	entry.macro_hash_high = key.macro_hash_high;
+	entry.entry_point_low = key.entry_point_low;
+	entry.entry_point_high = key.entry_point_high;
+	entry.blob_hash = blob_hash;
 	entry.source_length = key.source_length;
 	entry.shader_type = static_cast<u32>(key.type);
-	entry.blob_size = data.blob_size;
 	entry.file_offset = data.file_offset;
+	entry.compressed_size = data.compressed_size;
+	entry.blob_size = data.blob_size;
 
-	if (std::fwrite(blob->GetBufferPointer(), 1, entry.blob_size, m_pipeline_blob_file) != entry.blob_size ||
-		std::fflush(m_pipeline_blob_file) != 0 || std::fwrite(&entry, sizeof(entry), 1, m_pipeline_index_file) != 1 ||
-		std::fflush(m_pipeline_index_file) != 0)
+	if (std::fwrite(&entry, sizeof(entry), 1, index_file) != 1 || std::fflush(index_file) != 0)
 	{
-		Console.Error("Failed to write pipeline blob to file");
-		return pso;
+		Console.Error("Failed to write index entry to file");
+		return false;
 	}
 
-	m_shader_index.emplace(key, data);
-	return pso;
+	index.emplace(key, data);
+	return true;
 }
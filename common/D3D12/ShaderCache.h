@@ -80,7 +80,10 @@ namespace D3D12
 		ComPtr<ID3D12PipelineState> GetPipelineState(ID3D12Device* device, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
 
 	private:
-		static constexpr u32 FILE_VERSION = 1;
+		static constexpr u32 FILE_VERSION = 2;
+
+		/// Once a blob file grows past this, no more entries are added and it's rebuilt on the next start.
+		static constexpr u32 MAX_BLOB_FILE_SIZE = 128 * 1024 * 1024;
 
 		struct CacheIndexKey
 		{
@@ -111,10 +114,12 @@ namespace D3D12
 		struct CacheIndexData
 		{
 			u32 file_offset;
+			u32 compressed_size;
 			u32 blob_size;
 		};
 
 		using CacheIndex = std::unordered_map<CacheIndexKey, CacheIndexData, CacheIndexEntryHasher>;
+		using BlobIndex = std::unordered_map<u64, CacheIndexData>;
 
 		static std::string GetCacheBaseFileName(const std::string_view& base_path, const std::string_view& type,
 			D3D_FEATURE_LEVEL feature_level, bool debug);
@@ -125,7 +130,7 @@ namespace D3D12
 		bool CreateNew(const std::string& index_filename, const std::string& blob_filename, std::FILE*& index_file,
 			std::FILE*& blob_file);
 		bool ReadExisting(const std::string& index_filename, const std::string& blob_filename, std::FILE*& index_file,
-			std::FILE*& blob_file, CacheIndex& index);
+			std::FILE*& blob_file, CacheIndex& index, BlobIndex& blob_index);
 		void InvalidatePipelineCache();
 		void Close();
 
@@ -133,16 +138,20 @@ namespace D3D12
 			const D3D_SHADER_MACRO* macros, const char* entry_point);
 		ComPtr<ID3D12PipelineState> CompileAndAddPipeline(ID3D12Device* device, const CacheIndexKey& key,
 			const D3D12_GRAPHICS_PIPELINE_STATE_DESC& gpdesc);
+		bool WriteBlob(std::FILE* index_file, std::FILE* blob_file, CacheIndex& index, BlobIndex& blob_index,
+			const CacheIndexKey& key, ID3DBlob* blob);
 
 		std::string m_base_path;
 
 		std::FILE* m_shader_index_file = nullptr;
 		std::FILE* m_shader_blob_file = nullptr;
 		CacheIndex m_shader_index;
+		BlobIndex m_shader_blob_index;
 
 		std::FILE* m_pipeline_index_file = nullptr;
 		std::FILE* m_pipeline_blob_file = nullptr;
 		CacheIndex m_pipeline_index;
+		BlobIndex m_pipeline_blob_index;
 
 		D3D_FEATURE_LEVEL m_feature_level = D3D_FEATURE_LEVEL_11_0;
 		u32 m_data_version = 0;
@@ -275,6 +275,17 @@ void Texture::TransitionToState(ID3D12GraphicsCommandList* cmdlist, D3D12_RESOUR
 	m_state = state;
 }
 
+bool Texture::GetTransitionBarrier(D3D12_RESOURCE_STATES state, D3D12_RESOURCE_BARRIER* barrier)
+{
+	if (m_state == state)
+		return false;
+
+	*barrier = {D3D12_RESOURCE_BARRIER_TYPE_TRANSITION, D3D12_RESOURCE_BARRIER_FLAG_NONE,
+		{{m_resource.get(), D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES, m_state, state}}};
+	m_state = state;
+	return true;
+}
+
 void Texture::TransitionSubresourceToState(ID3D12GraphicsCommandList* cmdlist, u32 level,
 	D3D12_RESOURCE_STATES before_state, D3D12_RESOURCE_STATES after_state) const
 {
@@ -67,6 +67,10 @@ namespace D3D12
 		void Destroy(bool defer = true);
 
 		void TransitionToState(ID3D12GraphicsCommandList* cmdlist, D3D12_RESOURCE_STATES state);
+
+		/// Fills in a whole-resource transition barrier to state, and assumes the caller will submit it.
+		/// Returns false if the texture is already in the requested state.
+		bool GetTransitionBarrier(D3D12_RESOURCE_STATES state, D3D12_RESOURCE_BARRIER* barrier);
 		void TransitionSubresourceToState(ID3D12GraphicsCommandList* cmdlist, u32 level,
 			D3D12_RESOURCE_STATES before_state, D3D12_RESOURCE_STATES after_state) const;
 
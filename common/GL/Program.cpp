@@ -137,21 +137,35 @@ namespace GL
 		return true;
 	}
 
-	bool Program::CreateFromBinary(const void* data, u32 data_length, u32 data_format)
+	bool Program::CreateFromBinary(const void* data, u32 data_length, u32 data_format, bool wait)
 	{
-		GLuint prog = glCreateProgram();
-		glProgramBinary(prog, static_cast<GLenum>(data_format), data, data_length);
+		m_program_id = glCreateProgram();
+		glProgramBinary(m_program_id, static_cast<GLenum>(data_format), data, data_length);
+		return !wait || CheckLinkStatus();
+	}
 
+	bool Program::IsLinkComplete() const
+	{
+		if (!GLAD_GL_KHR_parallel_shader_compile && !GLAD_GL_ARB_parallel_shader_compile)
+			return true;
+
+		GLint completed = GL_TRUE;
+		glGetProgramiv(m_program_id, GL_COMPLETION_STATUS_KHR, &completed);
+		return (completed == GL_TRUE);
+	}
+
+	bool Program::CheckLinkStatus()
+	{
 		GLint link_status;
-		glGetProgramiv(prog, GL_LINK_STATUS, &link_status);
+		glGetProgramiv(m_program_id, GL_LINK_STATUS, &link_status);
 		if (link_status != GL_TRUE)
 		{
 			Console.Error("Failed to create GL program from binary: status %d", link_status);
-			glDeleteProgram(prog);
+			glDeleteProgram(m_program_id);
+			m_program_id = 0;
 			return false;
 		}
 
-		m_program_id = prog;
 		return true;
 	}
 
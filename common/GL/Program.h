@@ -37,7 +37,10 @@ namespace GL
 		bool Compile(const std::string_view vertex_shader, const std::string_view geometry_shader,
 			const std::string_view fragment_shader);
 
-		bool CreateFromBinary(const void* data, u32 data_length, u32 data_format);
+		// Without wait, the driver can keep linking in the background; call CheckLinkStatus() before use.
+		bool CreateFromBinary(const void* data, u32 data_length, u32 data_format, bool wait = true);
+		bool IsLinkComplete() const;
+		bool CheckLinkStatus();
 
 		bool GetBinary(std::vector<u8>* out_data, u32* out_data_format);
 		void SetBinaryRetrievableHint();
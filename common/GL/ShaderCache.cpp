@@ -290,6 +290,13 @@ namespace GL
 	std::optional<Program> ShaderCache::GetProgram(const std::string_view vertex_shader,
 		const std::string_view geometry_shader,
 		const std::string_view fragment_shader, const PreLinkCallback& callback)
+	{
+		return LookupProgram(vertex_shader, geometry_shader, fragment_shader, callback, true);
+	}
+
+	std::optional<Program> ShaderCache::LookupProgram(const std::string_view& vertex_shader,
+		const std::string_view& geometry_shader,
+		const std::string_view& fragment_shader, const PreLinkCallback& callback, bool wait)
 	{
 		if (!m_program_binary_supported || !m_blob_file)
 		{
@@ -323,7 +330,7 @@ namespace GL
 #endif
 
 		Program prog;
-		if (prog.CreateFromBinary(data.data(), static_cast<u32>(data.size()), iter->second.blob_format))
+		if (prog.CreateFromBinary(data.data(), static_cast<u32>(data.size()), iter->second.blob_format, wait))
 		{
 #ifdef PCSX2_DEVBUILD
 			Console.WriteLn("Time to create program from binary: %.2fms", timer.GetTimeMilliseconds());
@@ -352,6 +359,17 @@ namespace GL
 		return true;
 	}
 
+	bool ShaderCache::GetProgramAsync(Program* out_program, const std::string_view vertex_shader,
+		const std::string_view geometry_shader, const std::string_view fragment_shader)
+	{
+		auto prog = LookupProgram(vertex_shader, geometry_shader, fragment_shader, {}, false);
+		if (!prog)
+			return false;
+
+		*out_program = std::move(*prog);
+		return true;
+	}
+
 	std::optional<Program> ShaderCache::CompileProgram(const std::string_view& vertex_shader,
 		const std::string_view& geometry_shader,
 		const std::string_view& fragment_shader,
@@ -42,6 +42,10 @@ namespace GL
 		bool GetProgram(Program* out_program, const std::string_view vertex_shader, const std::string_view geometry_shader,
 			const std::string_view fragment_shader, const PreLinkCallback& callback = {});
 
+		// Programs loaded from the cache may still be linking on return, see Program::IsLinkComplete().
+		bool GetProgramAsync(Program* out_program, const std::string_view vertex_shader, const std::string_view geometry_shader,
+			const std::string_view fragment_shader);
+
 	private:
 		static constexpr u32 FILE_VERSION = 1;
 
@@ -94,6 +98,8 @@ namespace GL
 		void Close();
 		bool Recreate();
 
+		std::optional<Program> LookupProgram(const std::string_view& vertex_shader, const std::string_view& geometry_shader,
+			const std::string_view& fragment_shader, const PreLinkCallback& callback, bool wait);
 		std::optional<Program> CompileProgram(const std::string_view& vertex_shader, const std::string_view& geometry_shader,
 			const std::string_view& fragment_shader, const PreLinkCallback& callback,
 			bool set_retrievable);
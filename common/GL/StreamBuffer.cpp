@@ -233,6 +233,72 @@ namespace GL
 			std::array<GLsync, NUM_SYNC_POINTS> m_sync_objects{};
 		};
 
+		// Uses unsynchronized glMapBufferRange() with fences, for drivers without buffer storage. Plain
+		// glBufferSubData()/glMapBufferRange() has the driver wait for the GPU to be done with
+		// the buffer, and the fences let us only wait for the part we're about to overwrite.
+		class MapAndSyncStreamBuffer final : public SyncingStreamBuffer
+		{
+		public:
+			~MapAndSyncStreamBuffer() override = default;
+
+			MappingResult Map(u32 alignment, u32 min_size) override
+			{
+				if (m_position > 0)
+					m_position = Common::AlignUp(m_position, alignment);
+
+				AllocateSpace(min_size);
+				pxAssert((m_position + min_size) <= (m_available_block_index * m_bytes_per_block));
+
+				const u32 free_space_in_block =
+					std::min(m_available_block_index * m_bytes_per_block, m_size) - m_position;
+
+				Bind();
+				void* mapped_ptr = glMapBufferRange(m_target, m_position, free_space_in_block,
+					GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
+				pxAssertRel(mapped_ptr, "Stream buffer was mapped");
+
+				return MappingResult{mapped_ptr, m_position, m_position / alignment, free_space_in_block / alignment};
+			}
+
+			void Unmap(u32 used_size) override
+			{
+				pxAssert((m_position + used_size) <= m_size);
+
+				Bind();
+				if (used_size > 0)
+					glFlushMappedBufferRange(m_target, 0, used_size);
+				glUnmapBuffer(m_target);
+
+				m_position += used_size;
+			}
+
+			static std::unique_ptr<StreamBuffer> Create(GLenum target, u32 size)
+			{
+				glGetError();
+
+				GLuint buffer_id;
+				glGenBuffers(1, &buffer_id);
+				glBindBuffer(target, buffer_id);
+				glBufferData(target, size, nullptr, GL_STREAM_DRAW);
+
+				GLenum err = glGetError();
+				if (err != GL_NO_ERROR)
+				{
+					glBindBuffer(target, 0);
+					glDeleteBuffers(1, &buffer_id);
+					return {};
+				}
+
+				return std::unique_ptr<StreamBuffer>(new MapAndSyncStreamBuffer(target, buffer_id, size));
+			}
+
+		private:
+			MapAndSyncStreamBuffer(GLenum target, GLuint buffer_id, u32 size)
+				: SyncingStreamBuffer(target, buffer_id, size)
+			{
+			}
+		};
+
 		class BufferStorageStreamBuffer : public SyncingStreamBuffer
 		{
 		public:
@@ -325,7 +391,15 @@ namespace GL
 		const char* vendor = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
 		if (std::strstr(vendor, "NVIDIA"))
 			return detail::BufferSubDataStreamBuffer::Create(target, size);
-		else
-			return detail::BufferDataStreamBuffer::Create(target, size);
+
+		// Mali syncs on any update to a buffer in use, orphaning is the only way around it.
+		if (!std::strstr(vendor, "ARM"))
+		{
+			buf = detail::MapAndSyncStreamBuffer::Create(target, size);
+			if (buf)
+				return buf;
+		}
+
+		return detail::BufferDataStreamBuffer::Create(target, size);
 	}
 } // namespace GL
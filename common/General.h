@@ -140,6 +140,10 @@ namespace HostSys
 
 	extern void Munmap(void* base, size_t size);
 
+	/// Asks the OS to back the range with huge pages where it can, to cut TLB misses on large
+	/// regions like guest RAM and the recompiler caches. Purely advisory, returns false if unsupported.
+	extern bool AdviseHugePages(void* base, size_t size);
+
 	template <uint size>
 	void MemProtectStatic(u8 (&arr)[size], const PageProtectionMode& mode)
 	{
@@ -15,17 +15,20 @@
 
 #pragma once
 #include <cstdint>
+#include <list>
 #include <map>
 
 template <class K, class V>
 class LRUCache
 {
-	using CounterType = std::uint64_t;
+	/// Keys in access order, most recently used at the front. Eviction takes from the back, so it
+	/// doesn't have to scan every item for the oldest one.
+	using ListType = std::list<K>;
 
 	struct Item
 	{
 		V value;
-		CounterType last_access;
+		typename ListType::iterator lru_pos;
 	};
 
 	using MapType = std::map<K, Item>;
@@ -41,7 +44,11 @@ public:
 	std::size_t GetSize() const { return m_items.size(); }
 	std::size_t GetMaxCapacity() const { return m_max_capacity; }
 
-	void Clear() { m_items.clear(); }
+	void Clear()
+	{
+		m_items.clear();
+		m_lru.clear();
+	}
 
 	void SetMaxCapacity(std::size_t capacity)
 	{
@@ -57,42 +64,37 @@ public:
 		if (iter == m_items.end())
 			return nullptr;
 
-		iter->second.last_access = ++m_last_counter;
+		Touch(iter->second);
 		return &iter->second.value;
 	}
 
 	V* Insert(K key, V value)
 	{
-		ShrinkForNewItem();
-
 		auto iter = m_items.find(key);
 		if (iter != m_items.end())
 		{
 			iter->second.value = std::move(value);
-			iter->second.last_access = ++m_last_counter;
+			Touch(iter->second);
 			return &iter->second.value;
 		}
-		else
-		{
-			Item it;
-			it.last_access = ++m_last_counter;
-			it.value = std::move(value);
-			auto ip = m_items.emplace(std::move(key), std::move(it));
-			return &ip.first->second.value;
-		}
+
+		ShrinkForNewItem();
+
+		m_lru.push_front(key);
+		Item it;
+		it.value = std::move(value);
+		it.lru_pos = m_lru.begin();
+		auto ip = m_items.emplace(std::move(key), std::move(it));
+		return &ip.first->second.value;
 	}
 
 	void Evict(std::size_t count = 1)
 	{
-		while (m_items.size() >= count)
+		while (count > 0 && !m_lru.empty())
 		{
-			typename MapType::iterator lowest = m_items.end();
-			for (auto iter = m_items.begin(); iter != m_items.end(); ++iter)
-			{
-				if (lowest == m_items.end() || iter->second.last_access < lowest->second.last_access)
-					lowest = iter;
-			}
-			m_items.erase(lowest);
+			m_items.erase(m_lru.back());
+			m_lru.pop_back();
+			count--;
 		}
 	}
 
@@ -103,6 +105,7 @@ public:
 		if (iter == m_items.end())
 			return false;
 
+		m_lru.erase(iter->second.lru_pos);
 		m_items.erase(iter);
 		return true;
 	}
@@ -117,11 +120,16 @@ public:
 	void ManualEvict()
 	{
 		// evict if we went over
-		while (m_items.size() > m_max_capacity)
-			Evict(m_items.size() - (m_max_capacity - 1));
+		if (m_items.size() > m_max_capacity)
+			Evict(m_items.size() - m_max_capacity);
 	}
 
 private:
+	void Touch(Item& item)
+	{
+		m_lru.splice(m_lru.begin(), m_lru, item.lru_pos);
+	}
+
 	void ShrinkForNewItem()
 	{
 		if (m_items.size() < m_max_capacity)
@@ -131,7 +139,7 @@ private:
 	}
 
 	MapType m_items;
-	CounterType m_last_counter = 0;
+	ListType m_lru;
 	std::size_t m_max_capacity = 0;
 	bool m_manual_evict = false;
-};
\ No newline at end of file
+};
@@ -35,7 +35,6 @@
 
 extern void SignalExit(int sig);
 
-static const uptr m_pagemask = getpagesize() - 1;
 
 // Linux implementation of SIGSEGV handler.  Bind it using sigaction().
 static void SysPageFaultSignalFilter(int signal, siginfo_t* siginfo, void*)
@@ -62,7 +61,7 @@ static void SysPageFaultSignalFilter(int signal, siginfo_t* siginfo, void*)
 	// so for now we lock this exception code unless someone can fix this better...
 	std::unique_lock lock(PageFault_Mutex);
 
-	Source_PageFault->Dispatch(PageFaultInfo((uptr)siginfo->si_addr & ~m_pagemask));
+	Source_PageFault->Dispatch(PageFaultInfo((uptr)siginfo->si_addr));
 
 	// resumes execution right where we left off (re-executes instruction that
 	// caused the SIGSEGV).
@@ -143,8 +142,9 @@ void* HostSys::MmapReservePtr(void* base, size_t size)
 	// On linux a reserve-without-commit is performed by using mmap on a read-only
 	// or anonymous source, with PROT_NONE (no-access) permission.  Since the mapping
 	// is completely inaccessible, the OS will simply reserve it and will not put it
-	// against the commit table.
-	void* result = mmap(base, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+	// against the commit table. Without a base, let the OS pick (MAP_FIXED at 0 would fail).
+	const int flags = MAP_PRIVATE | MAP_ANONYMOUS | (base ? MAP_FIXED : 0);
+	void* result = mmap(base, size, PROT_NONE, flags, -1, 0);
 
 	if (result == MAP_FAILED)
 		result = nullptr;
@@ -208,6 +208,17 @@ void HostSys::Munmap(uptr base, size_t size)
 	munmap((void*)base, size);
 }
 
+bool HostSys::AdviseHugePages(void* base, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+	// Transparent huge pages; the kernel falls back to normal pages when it can't find a 2MB one,
+	// and splits a huge page again if part of it gets protected.
+	return (madvise(base, size, MADV_HUGEPAGE) == 0);
+#else
+	return false;
+#endif
+}
+
 void HostSys::MemProtect(void* baseaddr, size_t size, const PageProtectionMode& mode)
 {
 	if (!_memprotect(baseaddr, size, mode))
@@ -15,14 +15,24 @@
 
 #include "common/Perf.h"
 #include "common/Pcsx2Defs.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
 #ifdef __unix__
 #include <unistd.h>
 #endif
+#ifdef __linux__
+#include <ctime>
+#include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
 #ifdef ENABLE_VTUNE
 #include "jitprofiling.h"
 #endif
 
-//#define ProfileWithPerf
 #define MERGE_BLOCK_RESULT
 
 #ifdef ENABLE_VTUNE
@@ -41,31 +51,177 @@ namespace Perf
 	InfoVector vif("VIF");
 
 // Perf is only supported on linux
-#if defined(__linux__) && (defined(ProfileWithPerf) || defined(ENABLE_VTUNE))
+#if defined(__linux__) || defined(ENABLE_VTUNE)
+
+	// Code is registered from the EE, IOP, VU and GS threads.
+	static std::mutex s_lock;
 
+	// Anything bigger is a whole reservation (merged results) rather than generated code,
+	// and may not even be committed, so its bytes can't be copied into a jitdump.
+	static constexpr u32 MAX_CODE_SIZE = 16 * _1kb;
+
+#ifdef __linux__
 	////////////////////////////////////////////////////////////////////////////////
-	// Implementation of the Info object
+	// Linux perf output
 	////////////////////////////////////////////////////////////////////////////////
 
-	Info::Info(uptr x86, u32 size, const char* symbol)
-		: m_x86(x86)
-		, m_size(size)
-		, m_dynamic(false)
+	enum class Mode
+	{
+		None,
+		Map,
+		JitDump,
+	};
+
+	static Mode GetMode()
 	{
-		strncpy(m_symbol, symbol, sizeof(m_symbol));
+		static const Mode mode = []() {
+			const char* env = std::getenv("PCSX2_PERF");
+			if (!env)
+				return Mode::None;
+			else if (std::strcmp(env, "jitdump") == 0)
+				return Mode::JitDump;
+			else if (std::strcmp(env, "map") == 0)
+				return Mode::Map;
+			else
+				return Mode::None;
+		}();
+		return mode;
 	}
 
-	Info::Info(uptr x86, u32 size, const char* symbol, u32 pc)
+	// See tools/perf/Documentation/jitdump-specification.txt in the kernel tree.
+	namespace JitDump
+	{
+		static constexpr u32 MAGIC = 0x4A695444;
+		static constexpr u32 VERSION = 1;
+		static constexpr u32 CODE_LOAD = 0;
+
+		struct FileHeader
+		{
+			u32 magic;
+			u32 version;
+			u32 total_size;
+			u32 elf_mach;
+			u32 pad1;
+			u32 pid;
+			u64 timestamp;
+			u64 flags;
+		};
+
+		struct RecordHeader
+		{
+			u32 id;
+			u32 total_size;
+			u64 timestamp;
+		};
+
+		struct CodeLoad
+		{
+			RecordHeader header;
+			u32 pid;
+			u32 tid;
+			u64 vma;
+			u64 code_addr;
+			u64 code_size;
+			u64 code_index;
+		};
+
+		static FILE* s_file = nullptr;
+		static void* s_marker = nullptr;
+		static bool s_failed = false;
+		static u64 s_code_index = 0;
+
+		// perf record has to run with -k mono for the timestamps to line up.
+		static u64 GetTimestamp()
+		{
+			struct timespec ts;
+			clock_gettime(CLOCK_MONOTONIC, &ts);
+			return static_cast<u64>(ts.tv_sec) * 1000000000ULL + static_cast<u64>(ts.tv_nsec);
+		}
+
+		static bool Open()
+		{
+			if (s_file || s_failed)
+				return s_file != nullptr;
+
+			s_failed = true;
+
+			char filename[64];
+			std::snprintf(filename, sizeof(filename), "/tmp/jit-%d.dump", getpid());
+			const int fd = open(filename, O_CREAT | O_TRUNC | O_RDWR, 0666);
+			if (fd < 0)
+				return false;
+
+			// perf finds the dump through the mmap event of an executable mapping of it.
+			s_marker = mmap(nullptr, sysconf(_SC_PAGESIZE), PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+			if (s_marker == MAP_FAILED)
+			{
+				s_marker = nullptr;
+				close(fd);
+				return false;
+			}
+
+			s_file = fdopen(fd, "wb");
+			if (!s_file)
+			{
+				close(fd);
+				return false;
+			}
+
+			FileHeader header = {};
+			header.magic = MAGIC;
+			header.version = VERSION;
+			header.total_size = sizeof(header);
+#ifdef _M_X86
+			header.elf_mach = EM_X86_64;
+#endif
+			header.pid = static_cast<u32>(getpid());
+			header.timestamp = GetTimestamp();
+			std::fwrite(&header, sizeof(header), 1, s_file);
+			std::fflush(s_file);
+
+			s_failed = false;
+			return true;
+		}
+
+		static void WriteCodeLoad(uptr x86, u32 size, const std::string& name)
+		{
+			if (size == 0 || size > MAX_CODE_SIZE || !Open())
+				return;
+
+			CodeLoad record = {};
+			record.header.id = CODE_LOAD;
+			record.header.total_size = static_cast<u32>(sizeof(record) + name.size() + 1 + size);
+			record.header.timestamp = GetTimestamp();
+			record.pid = static_cast<u32>(getpid());
+			record.tid = static_cast<u32>(syscall(SYS_gettid));
+			record.vma = x86;
+			record.code_addr = x86;
+			record.code_size = size;
+			record.code_index = s_code_index++;
+
+			std::fwrite(&record, sizeof(record), 1, s_file);
+			std::fwrite(name.c_str(), name.size() + 1, 1, s_file);
+			std::fwrite(reinterpret_cast<const void*>(x86), size, 1, s_file);
+			std::fflush(s_file);
+		}
+	} // namespace JitDump
+#endif
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Implementation of the Info object
+	////////////////////////////////////////////////////////////////////////////////
+
+	Info::Info(uptr x86, u32 size, std::string symbol, bool dynamic)
 		: m_x86(x86)
 		, m_size(size)
-		, m_dynamic(true)
+		, m_symbol(std::move(symbol))
+		, m_dynamic(dynamic)
 	{
-		snprintf(m_symbol, sizeof(m_symbol), "%s_0x%08x", symbol, pc);
 	}
 
 	void Info::Print(FILE* fp)
 	{
-		fprintf(fp, "%x %x %s\n", m_x86, m_size, m_symbol);
+		fprintf(fp, "%zx %x %s\n", static_cast<size_t>(m_x86), m_size, m_symbol.c_str());
 	}
 
 	////////////////////////////////////////////////////////////////////////////////
@@ -73,6 +229,7 @@ namespace Perf
 	////////////////////////////////////////////////////////////////////////////////
 
 	InfoVector::InfoVector(const char* prefix)
+		: m_symbolizer(nullptr)
 	{
 		strncpy(m_prefix, prefix, sizeof(m_prefix));
 #ifdef ENABLE_VTUNE
@@ -82,6 +239,25 @@ namespace Perf
 #endif
 	}
 
+	std::string InfoVector::blockName(u32 pc) const
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "%s_0x%08x", m_prefix, pc);
+
+		std::string ret(name);
+		if (m_symbolizer)
+		{
+			const std::string symbol = m_symbolizer(pc);
+			if (!symbol.empty())
+			{
+				ret += '_';
+				ret += symbol;
+			}
+		}
+
+		return ret;
+	}
+
 	void InfoVector::print(FILE* fp)
 	{
 		for (auto&& it : m_v)
@@ -95,14 +271,26 @@ namespace Perf
 // Recompilers are much bigger (TODO check VIF) and are only
 // useful when MERGE_BLOCK_RESULT is defined
 #if defined(ENABLE_VTUNE) || !defined(MERGE_BLOCK_RESULT)
-		u32 max_code_size = 16 * _1kb;
+		u32 max_code_size = MAX_CODE_SIZE;
 #else
 		u32 max_code_size = _1gb;
 #endif
 
+#if defined(__linux__) && !defined(ENABLE_VTUNE)
+		if (GetMode() == Mode::None)
+			return;
+#endif
+
+		std::unique_lock lock(s_lock);
+
+#ifdef __linux__
+		if (GetMode() == Mode::JitDump)
+			JitDump::WriteCodeLoad(x86, size, symbol);
+#endif
+
 		if (size < max_code_size)
 		{
-			m_v.emplace_back(x86, size, symbol);
+			m_v.emplace_back(x86, size, symbol, false);
 
 #ifdef ENABLE_VTUNE
 			std::string name = std::string(symbol);
@@ -125,8 +313,26 @@ namespace Perf
 
 	void InfoVector::map(uptr x86, u32 size, u32 pc)
 	{
+#if defined(__linux__) && !defined(ENABLE_VTUNE)
+#ifdef MERGE_BLOCK_RESULT
+		// The map only carries the whole code cache, jitdump still wants every block.
+		if (GetMode() != Mode::JitDump)
+			return;
+#else
+		if (GetMode() == Mode::None)
+			return;
+#endif
+#endif
+
+		std::unique_lock lock(s_lock);
+
+#ifdef __linux__
+		if (GetMode() == Mode::JitDump)
+			JitDump::WriteCodeLoad(x86, size, blockName(pc));
+#endif
+
 #ifndef MERGE_BLOCK_RESULT
-		m_v.emplace_back(x86, size, m_prefix, pc);
+		m_v.emplace_back(x86, size, blockName(pc), true);
 #endif
 
 #ifdef ENABLE_VTUNE
@@ -138,7 +344,7 @@ namespace Perf
 		ml.method_id = m_vtune_id;
 		ml.method_name = m_prefix;
 #else
-		std::string name = std::string(m_prefix) + "_" + std::to_string(pc);
+		std::string name = blockName(pc);
 		ml.method_id = iJIT_GetNewMethodID();
 		ml.method_name = (char*)name.c_str();
 #endif
@@ -153,27 +359,43 @@ namespace Perf
 
 	void InfoVector::reset()
 	{
-		auto dynamic = std::remove_if(m_v.begin(), m_v.end(), [](Info i) { return i.m_dynamic; });
+		std::unique_lock lock(s_lock);
+		auto dynamic = std::remove_if(m_v.begin(), m_v.end(), [](const Info& i) { return i.m_dynamic; });
 		m_v.erase(dynamic, m_v.end());
 	}
 
+	void InfoVector::setSymbolizer(SymbolizerFn symbolizer)
+	{
+		std::unique_lock lock(s_lock);
+		m_symbolizer = symbolizer;
+	}
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Global function
 	////////////////////////////////////////////////////////////////////////////////
 
 	void dump()
 	{
+#ifdef __linux__
+		// The jitdump is written as code is generated, only the map is a snapshot.
+		if (GetMode() != Mode::Map)
+			return;
+
 		char file[256];
 		snprintf(file, 250, "/tmp/perf-%d.map", getpid());
 		FILE* fp = fopen(file, "w");
+		if (!fp)
+			return;
 
+		std::unique_lock lock(s_lock);
 		any.print(fp);
 		ee.print(fp);
 		iop.print(fp);
 		vu.print(fp);
+		vif.print(fp);
 
-		if (fp)
-			fclose(fp);
+		fclose(fp);
+#endif
 	}
 
 	void dump_and_reset()
@@ -184,6 +406,7 @@ namespace Perf
 		ee.reset();
 		iop.reset();
 		vu.reset();
+		vif.reset();
 	}
 
 #else
@@ -194,11 +417,13 @@ namespace Perf
 
 	InfoVector::InfoVector(const char* prefix)
 		: m_vtune_id(0)
+		, m_symbolizer(nullptr)
 	{
 	}
 	void InfoVector::map(uptr x86, u32 size, const char* symbol) {}
 	void InfoVector::map(uptr x86, u32 size, u32 pc) {}
 	void InfoVector::reset() {}
+	void InfoVector::setSymbolizer(SymbolizerFn symbolizer) {}
 
 	void dump() {}
 	void dump_and_reset() {}
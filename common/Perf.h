@@ -17,22 +17,28 @@
 
 #include <vector>
 #include <cstdio>
+#include <string>
 #include "common/Pcsx2Types.h"
 
+// Registers JIT code with external profilers. On Linux, setting PCSX2_PERF in the environment
+// selects the output: "map" writes /tmp/perf-<pid>.map for perf report, "jitdump" writes
+// jit-<pid>.dump records (including the code bytes) for perf inject --jit. Builds with
+// ENABLE_VTUNE additionally notify VTune through the JIT API.
 namespace Perf
 {
+	// Resolves a guest pc to a symbol name, or returns an empty string when there isn't one.
+	using SymbolizerFn = std::string (*)(u32 pc);
 
 	struct Info
 	{
 		uptr m_x86;
 		u32 m_size;
-		char m_symbol[20];
+		std::string m_symbol;
 		// The idea is to keep static zones that are set only
 		// once.
 		bool m_dynamic;
 
-		Info(uptr x86, u32 size, const char* symbol);
-		Info(uptr x86, u32 size, const char* symbol, u32 pc);
+		Info(uptr x86, u32 size, std::string symbol, bool dynamic);
 		void Print(FILE* fp);
 	};
 
@@ -41,6 +47,9 @@ namespace Perf
 		std::vector<Info> m_v;
 		char m_prefix[20];
 		unsigned int m_vtune_id;
+		SymbolizerFn m_symbolizer;
+
+		std::string blockName(u32 pc) const;
 
 	public:
 		InfoVector(const char* prefix);
@@ -49,6 +58,9 @@ namespace Perf
 		void map(uptr x86, u32 size, const char* symbol);
 		void map(uptr x86, u32 size, u32 pc);
 		void reset();
+
+		// Optional, used to name blocks after the guest function they were compiled from.
+		void setSymbolizer(SymbolizerFn symbolizer);
 	};
 
 	void dump();
@@ -18,6 +18,8 @@
 
 #ifdef _WIN32
 #include "common/RedtapeWindows.h"
+#include <synchapi.h>
+#pragma comment(lib, "Synchronization.lib") // for WaitOnAddress
 #endif
 
 #include <limits>
@@ -126,49 +128,80 @@ void Threading::WorkSema::Reset()
 
 #if !defined(__APPLE__) // macOS implementations are in DarwinSemaphore
 
-Threading::KernelSemaphore::KernelSemaphore()
-{
 #ifdef _WIN32
-	m_sema = CreateSemaphore(nullptr, 0, LONG_MAX, nullptr);
+
+// Semaphore objects are kernel handles, so every post and wait was a system call even when the
+// count was already positive. glibc's sem_t already has a futex fast path, this gives Windows the same.
+
+Threading::KernelSemaphore::KernelSemaphore() = default;
+
+Threading::KernelSemaphore::~KernelSemaphore() = default;
+
+void Threading::KernelSemaphore::Post()
+{
+	m_count.fetch_add(1, std::memory_order_release);
+	// Doesn't enter the kernel unless a thread is waiting on the address.
+	WakeByAddressSingle(&m_count);
+}
+
+void Threading::KernelSemaphore::Wait()
+{
+	s32 value = m_count.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		if (value > 0)
+		{
+			if (m_count.compare_exchange_weak(value, value - 1, std::memory_order_acquire, std::memory_order_relaxed))
+				return;
+
+			continue;
+		}
+
+		// Returns immediately if the count changed since we read it, and may wake spuriously.
+		WaitOnAddress(&m_count, &value, sizeof(value), INFINITE);
+		value = m_count.load(std::memory_order_relaxed);
+	}
+}
+
+bool Threading::KernelSemaphore::TryWait()
+{
+	s32 value = m_count.load(std::memory_order_relaxed);
+	while (value > 0)
+	{
+		if (m_count.compare_exchange_weak(value, value - 1, std::memory_order_acquire, std::memory_order_relaxed))
+			return true;
+	}
+
+	return false;
+}
+
 #else
+
+Threading::KernelSemaphore::KernelSemaphore()
+{
 	sem_init(&m_sema, false, 0);
-#endif
 }
 
 Threading::KernelSemaphore::~KernelSemaphore()
 {
-#ifdef _WIN32
-	CloseHandle(m_sema);
-#else
 	sem_destroy(&m_sema);
-#endif
 }
 
 void Threading::KernelSemaphore::Post()
 {
-#ifdef _WIN32
-	ReleaseSemaphore(m_sema, 1, nullptr);
-#else
 	sem_post(&m_sema);
-#endif
 }
 
 void Threading::KernelSemaphore::Wait()
 {
-#ifdef _WIN32
-	WaitForSingleObject(m_sema, INFINITE);
-#else
 	sem_wait(&m_sema);
-#endif
 }
 
 bool Threading::KernelSemaphore::TryWait()
 {
-#ifdef _WIN32
-	return WaitForSingleObject(m_sema, 0) == WAIT_OBJECT_0;
-#else
 	return sem_trywait(&m_sema) == 0;
-#endif
 }
 
 #endif
+
+#endif
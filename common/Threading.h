@@ -139,7 +139,8 @@ namespace Threading
 	class KernelSemaphore
 	{
 #if defined(_WIN32)
-		void* m_sema;
+		// WaitOnAddress() based, so only waits which actually need to sleep enter the kernel
+		std::atomic<s32> m_count{0};
 #elif defined(__APPLE__)
 		semaphore_t m_sema;
 #else
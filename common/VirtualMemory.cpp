@@ -294,8 +294,11 @@ void* VirtualMemoryReserve::Assign(VirtualMemoryManagerPtr allocator, void* base
 	else
 		mbkb = fmt::format("[{}kb]", reserved_bytes / 1024);
 
-	DevCon.WriteLn(Color_Gray, "%-32s @ 0x%016" PRIXPTR " -> 0x%016" PRIXPTR " %s", m_name.c_str(),
-		m_baseptr, (uptr)m_baseptr + reserved_bytes, mbkb.c_str());
+	// Guest RAM and the recompiler caches are large and accessed all over, so 4KB pages cost a lot of TLB misses.
+	const bool huge_pages = HostSys::AdviseHugePages(m_baseptr, reserved_bytes);
+
+	DevCon.WriteLn(Color_Gray, "%-32s @ 0x%016" PRIXPTR " -> 0x%016" PRIXPTR " %s%s", m_name.c_str(),
+		m_baseptr, (uptr)m_baseptr + reserved_bytes, mbkb.c_str(), huge_pages ? " (huge pages)" : "");
 
 	return m_baseptr;
 }
@@ -335,6 +338,9 @@ bool VirtualMemoryReserve::Commit()
 		return true;
 
 	m_pages_commited = m_pages_reserved;
+
+	// Reset() maps fresh pages over the range, which drops the advice, so it has to be given again.
+	HostSys::AdviseHugePages(m_baseptr, m_pages_reserved * __pagesize);
 	return HostSys::MmapCommitPtr(m_baseptr, m_pages_reserved * __pagesize, m_prot_mode);
 }
 
@@ -361,8 +361,10 @@ namespace Vulkan
 			return false;
 		}
 
-		if (threaded_presentation)
-			g_vulkan_context->StartPresentThread();
+		// The worker always takes mid-frame submits, so vkQueueSubmit() doesn't stall the GS thread.
+		// Presents are only handed over when threaded presentation is enabled.
+		g_vulkan_context->m_threaded_presentation = threaded_presentation;
+		g_vulkan_context->StartPresentThread();
 
 		return true;
 	}
@@ -448,7 +450,10 @@ namespace Vulkan
 			SupportsExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, false);
 		m_optional_extensions.vk_khr_driver_properties =
 			SupportsExtension(VK_KHR_DRIVER_PROPERTIES_EXTENSION_NAME, false);
-		m_optional_extensions.vk_arm_rasterization_order_attachment_access =
+		// The EXT version is the ARM extension promoted, with identical structures and flag values, so we can keep
+		// using the ARM enums regardless of which one the driver exposes.
+		m_optional_extensions.vk_ext_rasterization_order_attachment_access =
+			SupportsExtension("VK_EXT_rasterization_order_attachment_access", false) ||
 			SupportsExtension(VK_ARM_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_EXTENSION_NAME, false);
 
 		return true;
@@ -610,7 +615,7 @@ namespace Vulkan
 			provoking_vertex_feature.provokingVertexLast = VK_TRUE;
 			Util::AddPointerToChain(&device_info, &provoking_vertex_feature);
 		}
-		if (m_optional_extensions.vk_arm_rasterization_order_attachment_access)
+		if (m_optional_extensions.vk_ext_rasterization_order_attachment_access)
 		{
 			rasterization_order_access_feature.rasterizationOrderColorAttachmentAccess = VK_TRUE;
 			Util::AddPointerToChain(&device_info, &rasterization_order_access_feature);
@@ -659,7 +664,7 @@ namespace Vulkan
 		// add in optional feature structs
 		if (m_optional_extensions.vk_ext_provoking_vertex)
 			Util::AddPointerToChain(&features2, &provoking_vertex_features);
-		if (m_optional_extensions.vk_arm_rasterization_order_attachment_access)
+		if (m_optional_extensions.vk_ext_rasterization_order_attachment_access)
 			Util::AddPointerToChain(&features2, &rasterization_order_access_feature);
 
 		// query
@@ -667,7 +672,7 @@ namespace Vulkan
 
 		// confirm we actually support it
 		m_optional_extensions.vk_ext_provoking_vertex &= (provoking_vertex_features.provokingVertexLast == VK_TRUE);
-		m_optional_extensions.vk_arm_rasterization_order_attachment_access &= (rasterization_order_access_feature.rasterizationOrderColorAttachmentAccess == VK_TRUE);
+		m_optional_extensions.vk_ext_rasterization_order_attachment_access &= (rasterization_order_access_feature.rasterizationOrderColorAttachmentAccess == VK_TRUE);
 
 		VkPhysicalDeviceProperties2 properties2 = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2};
 		void** pNext = &properties2.pNext;
@@ -684,8 +689,8 @@ namespace Vulkan
 
 		Console.WriteLn("VK_EXT_provoking_vertex is %s",
 			m_optional_extensions.vk_ext_provoking_vertex ? "supported" : "NOT supported");
-		Console.WriteLn("VK_ARM_rasterization_order_attachment_access is %s",
-			m_optional_extensions.vk_arm_rasterization_order_attachment_access ? "supported" : "NOT supported");
+		Console.WriteLn("VK_EXT_rasterization_order_attachment_access is %s",
+			m_optional_extensions.vk_ext_rasterization_order_attachment_access ? "supported" : "NOT supported");
 	}
 
 	bool Context::CreateAllocator()
@@ -885,6 +890,20 @@ namespace Vulkan
 		return true;
 	}
 
+	bool Context::GrowTextureUploadBuffer()
+	{
+		const u32 new_size = m_texture_upload_buffer.GetCurrentSize() * 2;
+		if (new_size > MAX_TEXTURE_BUFFER_SIZE)
+			return false;
+
+		// The old buffer is destroyed once the GPU is done with it.
+		if (!m_texture_upload_buffer.Create(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, new_size))
+			return false;
+
+		DevCon.WriteLn("Vulkan: Texture upload buffer grown to %u MB", new_size / 1048576);
+		return true;
+	}
+
 	VkCommandBuffer Context::GetCurrentInitCommandBuffer()
 	{
 		FrameResources& res = m_frame_resources[m_current_frame];
@@ -974,6 +993,10 @@ namespace Vulkan
 
 	void Context::WaitForCommandBufferCompletion(u32 index)
 	{
+		// The submit may still be sitting with the present thread.
+		if (!m_present_done.load() && m_queued_present.command_buffer_index == index)
+			WaitForPresentComplete();
+
 		// Wait for this command buffer to be completed.
 		VkResult res = vkWaitForFences(m_device, 1, &m_frame_resources[index].fence, VK_TRUE, UINT64_MAX);
 		if (res != VK_SUCCESS)
@@ -1038,7 +1061,8 @@ namespace Vulkan
 		std::unique_lock<std::mutex> lock(m_present_mutex);
 		WaitForPresentComplete(lock);
 
-		if (!submit_on_thread || !m_present_thread.joinable())
+		if (!submit_on_thread || !m_present_thread.joinable() ||
+			(present_swap_chain != VK_NULL_HANDLE && !m_threaded_presentation))
 		{
 			DoSubmitCommandBuffer(m_current_frame, wait_semaphore, signal_semaphore);
 			if (present_swap_chain != VK_NULL_HANDLE)
@@ -1131,8 +1155,11 @@ namespace Vulkan
 
 			DoSubmitCommandBuffer(m_queued_present.command_buffer_index, m_queued_present.wait_semaphore,
 				m_queued_present.signal_semaphore);
-			DoPresent(m_queued_present.signal_semaphore, m_queued_present.present_swap_chain,
-				m_queued_present.present_image_index);
+			if (m_queued_present.present_swap_chain != VK_NULL_HANDLE)
+			{
+				DoPresent(m_queued_present.signal_semaphore, m_queued_present.present_swap_chain,
+					m_queued_present.present_image_index);
+			}
 			m_present_done.store(true);
 			m_present_done_cv.notify_one();
 		}
@@ -1234,9 +1261,10 @@ namespace Vulkan
 
 	void Context::ExecuteCommandBuffer(bool wait_for_completion)
 	{
-		// If we're waiting for completion, don't bother waking the worker thread.
+		// If we're waiting for completion, don't bother waking the worker thread. Otherwise the
+		// submit overlaps with recording the next command buffer, same as for presents.
 		const u32 current_frame = m_current_frame;
-		SubmitCommandBuffer();
+		SubmitCommandBuffer(VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, 0xFFFFFFFF, !wait_for_completion);
 		MoveToNextCommandBuffer();
 
 		if (wait_for_completion)
@@ -1411,7 +1439,7 @@ namespace Vulkan
 				input_reference.layout = VK_IMAGE_LAYOUT_GENERAL;
 				input_reference_ptr = &input_reference;
 
-				if (!g_vulkan_context->GetOptionalExtensions().vk_arm_rasterization_order_attachment_access)
+				if (!g_vulkan_context->GetOptionalExtensions().vk_ext_rasterization_order_attachment_access)
 				{
 					// don't need the framebuffer-local dependency when we have rasterization order attachment access
 					subpass_dependency.srcSubpass = 0;
@@ -1443,7 +1471,7 @@ namespace Vulkan
 		}
 
 		const VkSubpassDescriptionFlags subpass_flags =
-			(key.color_feedback_loop && g_vulkan_context->GetOptionalExtensions().vk_arm_rasterization_order_attachment_access)
+			(key.color_feedback_loop && g_vulkan_context->GetOptionalExtensions().vk_ext_rasterization_order_attachment_access)
 			? VK_SUBPASS_DESCRIPTION_RASTERIZATION_ORDER_ATTACHMENT_COLOR_ACCESS_BIT_ARM : 0;
 		const VkSubpassDescription subpass = {subpass_flags, VK_PIPELINE_BIND_POINT_GRAPHICS, input_reference_ptr ? 1u : 0u,
 			input_reference_ptr ? input_reference_ptr : nullptr, color_reference_ptr ? 1u : 0u,
@@ -44,6 +44,7 @@ namespace Vulkan
 		{
 			NUM_COMMAND_BUFFERS = 3,
 			TEXTURE_BUFFER_SIZE = 64 * 1024 * 1024,
+			MAX_TEXTURE_BUFFER_SIZE = 256 * 1024 * 1024,
 		};
 
 		struct OptionalExtensions
@@ -51,7 +52,7 @@ namespace Vulkan
 			bool vk_ext_provoking_vertex : 1;
 			bool vk_ext_memory_budget : 1;
 			bool vk_khr_driver_properties : 1;
-			bool vk_arm_rasterization_order_attachment_access : 1;
+			bool vk_ext_rasterization_order_attachment_access : 1;
 		};
 
 		~Context();
@@ -161,6 +162,10 @@ namespace Vulkan
 		__fi VkDescriptorPool GetGlobalDescriptorPool() const { return m_global_descriptor_pool; }
 		__fi VkCommandBuffer GetCurrentCommandBuffer() const { return m_current_command_buffer; }
 		__fi StreamBuffer& GetTextureUploadBuffer() { return m_texture_upload_buffer; }
+
+		// Doubles the texture upload buffer, up to MAX_TEXTURE_BUFFER_SIZE. Called when the buffer is full of data for
+		// the current command buffer, so we can keep recording rather than submitting mid-frame.
+		bool GrowTextureUploadBuffer();
 		__fi VkDescriptorPool GetCurrentDescriptorPool() const
 		{
 			return m_frame_resources[m_current_frame].descriptor_pool;
@@ -323,6 +328,7 @@ namespace Vulkan
 		std::condition_variable m_present_done_cv;
 		std::thread m_present_thread;
 		std::atomic_bool m_present_thread_done{false};
+		bool m_threaded_presentation = false;
 
 		struct QueuedPresent
 		{
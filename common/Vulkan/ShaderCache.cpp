@@ -22,6 +22,8 @@
 #include "common/FileSystem.h"
 #include "common/MD5Digest.h"
 
+#include "zstd.h"
+
 // TODO: store the driver version and stuff in the shader header
 
 std::unique_ptr<Vulkan::ShaderCache> g_vulkan_shader_cache;
@@ -45,13 +47,57 @@ namespace Vulkan
 	{
 		u64 source_hash_low;
 		u64 source_hash_high;
+		u64 blob_hash;
 		u32 source_length;
 		u32 shader_type;
 		u32 file_offset;
+		u32 compressed_size;
 		u32 blob_size;
 	};
 #pragma pack(pop)
 
+	// Hash of the compiled SPIR-V, used to store identical modules only once in the blob file.
+	static u64 GetBlobHash(const void* data, u32 size)
+	{
+		union
+		{
+			u64 hash_low;
+			u8 hash[16];
+		};
+
+		MD5Digest digest;
+		digest.Update(data, size);
+		digest.Final(hash);
+		return hash_low;
+	}
+
+	static bool CompressBlob(const void* data, size_t size, std::vector<u8>* compressed)
+	{
+		compressed->resize(ZSTD_compressBound(size));
+		const size_t result = ZSTD_compress(compressed->data(), compressed->size(), data, size, ZSTD_CLEVEL_DEFAULT);
+		if (ZSTD_isError(result))
+		{
+			Console.Error("Failed to compress shader blob: %s", ZSTD_getErrorName(result));
+			return false;
+		}
+
+		compressed->resize(result);
+		return true;
+	}
+
+	static bool ReadCompressedBlob(std::FILE* fp, u32 file_offset, u32 compressed_size, void* data, size_t size)
+	{
+		std::vector<u8> compressed(compressed_size);
+		if (std::fseek(fp, file_offset, SEEK_SET) != 0 ||
+			std::fread(compressed.data(), 1, compressed_size, fp) != compressed_size)
+		{
+			return false;
+		}
+
+		const size_t result = ZSTD_decompress(data, size, compressed.data(), compressed_size);
+		return (!ZSTD_isError(result) && result == size);
+	}
+
 	static bool ValidatePipelineCacheHeader(const VK_PIPELINE_CACHE_HEADER& header)
 	{
 		if (header.header_length < sizeof(VK_PIPELINE_CACHE_HEADER))
@@ -257,18 +303,29 @@ namespace Vulkan
 
 		std::fseek(m_blob_file, 0, SEEK_END);
 		const u32 blob_file_size = static_cast<u32>(std::ftell(m_blob_file));
+		if (blob_file_size > MAX_BLOB_FILE_SIZE)
+		{
+			Console.Warning("Blob file '%s' is over the size limit (%u bytes), rebuilding cache", blob_filename.c_str(),
+				blob_file_size);
+			std::fclose(m_blob_file);
+			m_blob_file = nullptr;
+			std::fclose(m_index_file);
+			m_index_file = nullptr;
+			return false;
+		}
 
 		for (;;)
 		{
 			CacheIndexEntry entry;
 			if (std::fread(&entry, sizeof(entry), 1, m_index_file) != 1 ||
-				(entry.file_offset + entry.blob_size) > blob_file_size)
+				(entry.file_offset + entry.compressed_size) > blob_file_size)
 			{
 				if (std::feof(m_index_file))
 					break;
 
 				Console.Error("Failed to read entry from '%s', corrupt file?", index_filename.c_str());
 				m_index.clear();
+				m_blob_index.clear();
 				std::fclose(m_blob_file);
 				m_blob_file = nullptr;
 				std::fclose(m_index_file);
@@ -278,14 +335,16 @@ namespace Vulkan
 
 			const CacheIndexKey key{entry.source_hash_low, entry.source_hash_high, entry.source_length,
 				static_cast<ShaderCompiler::Type>(entry.shader_type)};
-			const CacheIndexData data{entry.file_offset, entry.blob_size};
+			const CacheIndexData data{entry.file_offset, entry.compressed_size, entry.blob_size};
 			m_index.emplace(key, data);
+			m_blob_index.emplace(entry.blob_hash, data);
 		}
 
 		// ensure we don't write before seeking
 		std::fseek(m_index_file, 0, SEEK_END);
 
-		Console.WriteLn("Read %zu entries from '%s'", m_index.size(), index_filename.c_str());
+		Console.WriteLn("Read %zu entries (%zu unique blobs) from '%s'", m_index.size(), m_blob_index.size(),
+			index_filename.c_str());
 		return true;
 	}
 
@@ -457,9 +516,8 @@ namespace Vulkan
 			return CompileAndAddShaderSPV(key, shader_code);
 
 		SPIRVCodeVector spv(iter->second.blob_size);
-		if (std::fseek(m_blob_file, iter->second.file_offset, SEEK_SET) != 0 ||
-			std::fread(spv.data(), sizeof(SPIRVCodeType), iter->second.blob_size, m_blob_file) !=
-				iter->second.blob_size)
+		if (!ReadCompressedBlob(m_blob_file, iter->second.file_offset, iter->second.compressed_size, spv.data(),
+				spv.size() * sizeof(SPIRVCodeType)))
 		{
 			Console.Error("Read blob from file failed, recompiling");
 			return ShaderCompiler::CompileShader(type, shader_code, m_debug);
@@ -518,23 +576,53 @@ namespace Vulkan
 		if (!m_blob_file || std::fseek(m_blob_file, 0, SEEK_END) != 0)
 			return spv;
 
+		const u32 blob_bytes = static_cast<u32>(spv->size() * sizeof(SPIRVCodeType));
+		const u64 blob_hash = GetBlobHash(spv->data(), blob_bytes);
+
+		// Different sources (e.g. unused defines) frequently compile to the same module, reuse the stored copy.
 		CacheIndexData data;
-		data.file_offset = static_cast<u32>(std::ftell(m_blob_file));
-		data.blob_size = static_cast<u32>(spv->size());
+		auto blob_iter = m_blob_index.find(blob_hash);
+		if (blob_iter != m_blob_index.end() && blob_iter->second.blob_size == spv->size())
+		{
+			data = blob_iter->second;
+		}
+		else
+		{
+			std::vector<u8> compressed;
+			if (!CompressBlob(spv->data(), blob_bytes, &compressed))
+				return spv;
+
+			const u32 file_offset = static_cast<u32>(std::ftell(m_blob_file));
+			if ((static_cast<u64>(file_offset) + compressed.size()) > MAX_BLOB_FILE_SIZE)
+				return spv;
+
+			data.file_offset = file_offset;
+			data.compressed_size = static_cast<u32>(compressed.size());
+			data.blob_size = static_cast<u32>(spv->size());
+
+			if (std::fwrite(compressed.data(), 1, compressed.size(), m_blob_file) != compressed.size() ||
+				std::fflush(m_blob_file) != 0)
+			{
+				Console.Error("Failed to write shader blob to file");
+				return spv;
+			}
+
+			m_blob_index.emplace(blob_hash, data);
+		}
 
 		CacheIndexEntry entry = {};
 		entry.source_hash_low = key.source_hash_low;
 		entry.source_hash_high = key.source_hash_high;
+		entry.blob_hash = blob_hash;
 		entry.source_length = key.source_length;
 		entry.shader_type = static_cast<u32>(key.shader_type);
-		entry.blob_size = data.blob_size;
 		entry.file_offset = data.file_offset;
+		entry.compressed_size = data.compressed_size;
+		entry.blob_size = data.blob_size;
 
-		if (std::fwrite(spv->data(), sizeof(SPIRVCodeType), entry.blob_size, m_blob_file) != entry.blob_size ||
-			std::fflush(m_blob_file) != 0 || std::fwrite(&entry, sizeof(entry), 1, m_index_file) != 1 ||
-			std::fflush(m_index_file) != 0)
+		if (std::fwrite(&entry, sizeof(entry), 1, m_index_file) != 1 || std::fflush(m_index_file) != 0)
 		{
-			Console.Error("Failed to write shader blob to file");
+			Console.Error("Failed to write shader index entry to file");
 			return spv;
 		}
 
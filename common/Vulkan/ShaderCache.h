@@ -52,7 +52,10 @@ namespace Vulkan
 		VkShaderModule GetComputeShader(std::string_view shader_code);
 
 	private:
-		static constexpr u32 FILE_VERSION = 2;
+		static constexpr u32 FILE_VERSION = 3;
+
+		/// Once the blob file grows past this, no more entries are added and it's rebuilt on the next start.
+		static constexpr u32 MAX_BLOB_FILE_SIZE = 128 * 1024 * 1024;
 
 		struct CacheIndexKey
 		{
@@ -78,10 +81,12 @@ namespace Vulkan
 		struct CacheIndexData
 		{
 			u32 file_offset;
+			u32 compressed_size;
 			u32 blob_size;
 		};
 
 		using CacheIndex = std::unordered_map<CacheIndexKey, CacheIndexData, CacheIndexEntryHasher>;
+		using BlobIndex = std::unordered_map<u64, CacheIndexData>;
 
 		ShaderCache();
 
@@ -107,6 +112,7 @@ namespace Vulkan
 		std::string m_pipeline_cache_filename;
 
 		CacheIndex m_index;
+		BlobIndex m_blob_index;
 
 		VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
 		u32 m_version = 0;
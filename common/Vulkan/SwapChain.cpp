@@ -536,6 +536,10 @@ namespace Vulkan
 		// Select number of images in swap chain, we prefer one buffer in the background to work on
 		u32 image_count = std::max(surface_capabilities.minImageCount + 1u, 2u);
 
+		// Mailbox needs a spare image to replace, otherwise it degrades to blocking on acquire like FIFO.
+		if (m_present_mode == VK_PRESENT_MODE_MAILBOX_KHR)
+			image_count = std::max(image_count, 3u);
+
 		// maxImageCount can be zero, in which case there isn't an upper limit on the number of buffers.
 		if (surface_capabilities.maxImageCount > 0)
 			image_count = std::min(image_count, surface_capabilities.maxImageCount);
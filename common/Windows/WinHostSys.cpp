@@ -142,6 +142,13 @@ void HostSys::Munmap(uptr base, size_t size)
 	VirtualFree((void*)base, 0, MEM_RELEASE);
 }
 
+bool HostSys::AdviseHugePages(void* base, size_t size)
+{
+	// Large pages have to be requested when committing, need SeLockMemoryPrivilege, and can't be
+	// protected at 4KB granularity, which our reserve/commit and page protection schemes rely on.
+	return false;
+}
+
 void HostSys::MemProtect(void* baseaddr, size_t size, const PageProtectionMode& mode)
 {
 	pxAssert((size & (__pagesize - 1)) == 0);
@@ -18,6 +18,8 @@
 #include "common/emitter/x86types.h"
 #include "common/emitter/instructions.h"
 
+#include <type_traits>
+
 namespace x86Emitter
 {
 
@@ -47,16 +49,78 @@ namespace x86Emitter
 		x86Ptr += sizeof(T);
 	}
 
+	//////////////////////////////////////////////////////////////////////////////////////////
+	// Register-direct forms (reg,reg and /digit,reg) are the bulk of what the recompilers emit,
+	// so the writers below encode those straight into the buffer and advance x86Ptr once,
+	// instead of going through the generic EmitRex/EmitSibMagic helpers.
+	//
+	template <typename T>
+	static constexpr bool IsDirectRegOperand = std::is_base_of_v<xRegisterBase, T>;
+
+	template <typename T>
+	static constexpr bool IsDirectRegField = std::is_integral_v<T> || std::is_enum_v<T>;
+
 	template <typename T1, typename T2>
-	__emitinline void xOpWrite(u8 prefix, u8 opcode, const T1& param1, const T2& param2, int extraRIPOffset = 0)
+	static constexpr bool IsDirectForm = IsDirectRegOperand<T2> && (IsDirectRegOperand<T1> || IsDirectRegField<T1>);
+
+	// Writes [prefix] [REX] into p and returns the new position, for a direct form with the given operands.
+	template <typename T1, typename T2>
+	__fi u8* EncodeDirectPrefixes(u8* p, u8 prefix, const T1& param1, const T2& param2)
 	{
 		if (prefix != 0)
-			xWrite8(prefix);
-		EmitRex(param1, param2);
+			*p++ = prefix;
+
+		bool w, r;
+		if constexpr (IsDirectRegOperand<T1>)
+		{
+			w = param1.IsWide();
+			r = param1.IsExtended();
+		}
+		else
+		{
+			w = param2.IsWide();
+			r = false;
+		}
+
+		const u8 rex = 0x40 | (w << 3) | (r << 2) | static_cast<u8>(param2.IsExtended());
+		if (rex != 0x40)
+			*p++ = rex;
+
+		return p;
+	}
 
-		xWrite8(opcode);
+	template <typename T1, typename T2>
+	__fi u8 EncodeDirectModRM(const T1& param1, const T2& param2)
+	{
+		uint regfield;
+		if constexpr (IsDirectRegOperand<T1>)
+			regfield = param1.Id & 7;
+		else
+			regfield = static_cast<uint>(param1);
+
+		return static_cast<u8>((Mod_Direct << 6) | (regfield << 3) | (param2.Id & 7));
+	}
 
-		EmitSibMagic(param1, param2, extraRIPOffset);
+	template <typename T1, typename T2>
+	__emitinline void xOpWrite(u8 prefix, u8 opcode, const T1& param1, const T2& param2, int extraRIPOffset = 0)
+	{
+		if constexpr (IsDirectForm<T1, T2>)
+		{
+			u8* p = EncodeDirectPrefixes(x86Ptr, prefix, param1, param2);
+			p[0] = opcode;
+			p[1] = EncodeDirectModRM(param1, param2);
+			x86Ptr = p + 2;
+		}
+		else
+		{
+			if (prefix != 0)
+				xWrite8(prefix);
+			EmitRex(param1, param2);
+
+			xWrite8(opcode);
+
+			EmitSibMagic(param1, param2, extraRIPOffset);
+		}
 	}
 
 	template <typename T1, typename T2>
@@ -80,29 +144,66 @@ namespace x86Emitter
 	// Prefixes are typically 0x66, 0xf2, or 0xf3.  OpcodePrefixes are either 0x38 or
 	// 0x3a [and other value will result in assertion failue].
 	//
+	// Writes 0F [38|3A] opcode for a direct form, see SimdPrefix().
+	static __fi u8* EncodeDirectOpcode0F(u8* p, u16 opcode)
+	{
+		*p++ = 0x0f;
+		if ((opcode & 0xff) == 0x38 || (opcode & 0xff) == 0x3a)
+		{
+			*p++ = static_cast<u8>(opcode);
+			*p++ = static_cast<u8>(opcode >> 8);
+		}
+		else
+		{
+			pxAssert((opcode >> 8) == 0);
+			*p++ = static_cast<u8>(opcode);
+		}
+
+		return p;
+	}
+
 	template <typename T1, typename T2>
 	__emitinline void xOpWrite0F(u8 prefix, u16 opcode, const T1& param1, const T2& param2)
 	{
-		if (prefix != 0)
-			xWrite8(prefix);
-		EmitRex(param1, param2);
-
-		SimdPrefix(0, opcode);
-
-		EmitSibMagic(param1, param2);
+		if constexpr (IsDirectForm<T1, T2>)
+		{
+			u8* p = EncodeDirectOpcode0F(EncodeDirectPrefixes(x86Ptr, prefix, param1, param2), opcode);
+			*p = EncodeDirectModRM(param1, param2);
+			x86Ptr = p + 1;
+		}
+		else
+		{
+			if (prefix != 0)
+				xWrite8(prefix);
+			EmitRex(param1, param2);
+
+			SimdPrefix(0, opcode);
+
+			EmitSibMagic(param1, param2);
+		}
 	}
 
 	template <typename T1, typename T2>
 	__emitinline void xOpWrite0F(u8 prefix, u16 opcode, const T1& param1, const T2& param2, u8 imm8)
 	{
-		if (prefix != 0)
-			xWrite8(prefix);
-		EmitRex(param1, param2);
-
-		SimdPrefix(0, opcode);
-
-		EmitSibMagic(param1, param2, 1);
-		xWrite8(imm8);
+		if constexpr (IsDirectForm<T1, T2>)
+		{
+			u8* p = EncodeDirectOpcode0F(EncodeDirectPrefixes(x86Ptr, prefix, param1, param2), opcode);
+			p[0] = EncodeDirectModRM(param1, param2);
+			p[1] = imm8;
+			x86Ptr = p + 2;
+		}
+		else
+		{
+			if (prefix != 0)
+				xWrite8(prefix);
+			EmitRex(param1, param2);
+
+			SimdPrefix(0, opcode);
+
+			EmitSibMagic(param1, param2, 1);
+			xWrite8(imm8);
+		}
 	}
 
 	template <typename T1, typename T2>
@@ -73,26 +73,6 @@ namespace x86Emitter
 	template void xWrite<u64>(u64 val);
 	template void xWrite<u128>(u128 val);
 
-	__fi void xWrite8(u8 val)
-	{
-		xWrite(val);
-	}
-
-	__fi void xWrite16(u16 val)
-	{
-		xWrite(val);
-	}
-
-	__fi void xWrite32(u32 val)
-	{
-		xWrite(val);
-	}
-
-	__fi void xWrite64(u64 val)
-	{
-		xWrite(val);
-	}
-
 	// Empty initializers are due to frivolously pointless GCC errors (it demands the
 	// objects be initialized even though they have no actual variable members).
 
@@ -19,6 +19,8 @@
 #include "common/Assertions.h"
 #include "common/Pcsx2Defs.h"
 
+#include <cstring>
+
 static const uint iREGCNT_XMM = 16;
 static const uint iREGCNT_GPR = 16;
 
@@ -35,10 +37,30 @@ extern thread_local XMMSSEType g_xmmtypes[iREGCNT_XMM];
 namespace x86Emitter
 {
 
-	extern void xWrite8(u8 val);
-	extern void xWrite16(u16 val);
-	extern void xWrite32(u32 val);
-	extern void xWrite64(u64 val);
+	// Inline, since nearly every emitted byte goes through these. Out of line, each one was a call
+	// plus a TLS load and store of x86Ptr.
+	static __fi void xWrite8(u8 val)
+	{
+		*x86Ptr++ = val;
+	}
+
+	static __fi void xWrite16(u16 val)
+	{
+		std::memcpy(x86Ptr, &val, sizeof(val));
+		x86Ptr += sizeof(val);
+	}
+
+	static __fi void xWrite32(u32 val)
+	{
+		std::memcpy(x86Ptr, &val, sizeof(val));
+		x86Ptr += sizeof(val);
+	}
+
+	static __fi void xWrite64(u64 val)
+	{
+		std::memcpy(x86Ptr, &val, sizeof(val));
+		x86Ptr += sizeof(val);
+	}
 
 	extern const char* xGetRegName(int regid, int operandSize);
 
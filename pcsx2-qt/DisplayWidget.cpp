@@ -319,8 +319,8 @@ bool DisplayWidget::event(QEvent* event)
 			// don't toggle fullscreen when we're bound.. that wouldn't end well.
 			if (event->type() == QEvent::MouseButtonDblClick &&
 				static_cast<const QMouseEvent*>(event)->button() == Qt::LeftButton &&
-				!InputManager::HasAnyBindingsForKey(InputManager::MakePointerButtonKey(0, 0)) &&
-				Host::GetBoolSettingValue("UI", "DoubleClickTogglesFullscreen", true))
+				m_double_click_toggles_fullscreen &&
+				!InputManager::HasAnyBindingsForKey(InputManager::MakePointerButtonKey(0, 0)))
 			{
 				g_emu_thread->toggleFullscreen();
 			}
@@ -31,6 +31,7 @@ public:
 	QPaintEngine* paintEngine() const override;
 
 	__fi void setShouldHideCursor(bool hide) { m_should_hide_cursor = hide; }
+	__fi void setDoubleClickTogglesFullscreen(bool enabled) { m_double_click_toggles_fullscreen = enabled; }
 
 	int scaledWindowWidth() const;
 	int scaledWindowHeight() const;
@@ -59,6 +60,7 @@ private:
 #endif
 	bool m_should_hide_cursor = false;
 	bool m_cursor_hidden = false;
+	bool m_double_click_toggles_fullscreen = true;
 
 	std::vector<int> m_keys_pressed_with_modifiers;
 
@@ -22,6 +22,7 @@
 #include "common/Path.h"
 #include "common/StringUtil.h"
 #include "fmt/format.h"
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QDate>
 #include <QtCore/QDateTime>
 #include <QtCore/QFuture>
@@ -29,6 +30,7 @@
 #include <QtConcurrent/QtConcurrent>
 #include <QtGui/QGuiApplication>
 #include <QtGui/QIcon>
+#include <QtGui/QImage>
 #include <QtGui/QPainter>
 
 static constexpr std::array<const char*, GameListModel::Column_Count> s_column_names = {
@@ -39,6 +41,9 @@ static constexpr int COVER_ART_HEIGHT = 512;
 static constexpr int COVER_ART_SPACING = 32;
 static constexpr int MIN_COVER_CACHE_SIZE = 256;
 
+// Covers are all padded to the same size, so the byte budget turns into an item count.
+static constexpr qsizetype COVER_CACHE_BYTES = 256 * 1024 * 1024;
+
 static int DPRScale(int size, float dpr)
 {
 	return static_cast<int>(static_cast<float>(size) * dpr);
@@ -49,53 +54,54 @@ static int DPRUnscale(int size, float dpr)
 	return static_cast<int>(static_cast<float>(size) / dpr);
 }
 
-static void resizeAndPadPixmap(QPixmap* pm, int expected_width, int expected_height, float dpr)
+// QPixmap can only be used on the UI thread, so the loaders work with QImage and convert at the end.
+static void resizeAndPadImage(QImage* image, int expected_width, int expected_height, float dpr)
 {
 	const int dpr_expected_width = DPRScale(expected_width, dpr);
 	const int dpr_expected_height = DPRScale(expected_height, dpr);
-	if (pm->width() == dpr_expected_width && pm->height() == dpr_expected_height)
+	if (image->width() == dpr_expected_width && image->height() == dpr_expected_height)
 		return;
 
-	*pm = pm->scaled(dpr_expected_width, dpr_expected_height, Qt::KeepAspectRatio, Qt::SmoothTransformation);
-	if (pm->width() == dpr_expected_width && pm->height() == dpr_expected_height)
+	*image = image->scaled(dpr_expected_width, dpr_expected_height, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+	if (image->width() == dpr_expected_width && image->height() == dpr_expected_height)
 		return;
 
 	// QPainter works in unscaled coordinates.
 	int xoffs = 0;
 	int yoffs = 0;
-	if (pm->width() < dpr_expected_width)
-		xoffs = DPRUnscale((dpr_expected_width - pm->width()) / 2, dpr);
-	if (pm->height() < dpr_expected_height)
-		yoffs = DPRUnscale((dpr_expected_height - pm->height()) / 2, dpr);
+	if (image->width() < dpr_expected_width)
+		xoffs = DPRUnscale((dpr_expected_width - image->width()) / 2, dpr);
+	if (image->height() < dpr_expected_height)
+		yoffs = DPRUnscale((dpr_expected_height - image->height()) / 2, dpr);
 
-	QPixmap padded_image(dpr_expected_width, dpr_expected_height);
+	QImage padded_image(dpr_expected_width, dpr_expected_height, QImage::Format_ARGB32_Premultiplied);
 	padded_image.setDevicePixelRatio(dpr);
 	padded_image.fill(Qt::transparent);
 	QPainter painter;
 	if (painter.begin(&padded_image))
 	{
 		painter.setCompositionMode(QPainter::CompositionMode_Source);
-		painter.drawPixmap(xoffs, yoffs, *pm);
+		painter.drawImage(xoffs, yoffs, *image);
 		painter.setCompositionMode(QPainter::CompositionMode_Destination);
 		painter.fillRect(padded_image.rect(), QColor(0, 0, 0, 0));
 		painter.end();
 	}
 
-	*pm = padded_image;
+	*image = std::move(padded_image);
 }
 
-static QPixmap createPlaceholderImage(const QPixmap& placeholder_pixmap, int width, int height, float scale,
+static QImage createPlaceholderImage(const QImage& placeholder_image, int width, int height, float scale,
 	const std::string& title)
 {
 	const float dpr = qApp->devicePixelRatio();
-	QPixmap pm(placeholder_pixmap.copy());
-	pm.setDevicePixelRatio(dpr);
-	if (pm.isNull())
-		return QPixmap();
+	QImage image(placeholder_image.copy());
+	image.setDevicePixelRatio(dpr);
+	if (image.isNull())
+		return QImage();
 
-	resizeAndPadPixmap(&pm, width, height, dpr);
+	resizeAndPadImage(&image, width, height, dpr);
 	QPainter painter;
-	if (painter.begin(&pm))
+	if (painter.begin(&image))
 	{
 		QFont font;
 		font.setPointSize(std::max(static_cast<int>(32.0f * scale), 1));
@@ -108,7 +114,50 @@ static QPixmap createPlaceholderImage(const QPixmap& placeholder_pixmap, int wid
 		painter.end();
 	}
 
-	return pm;
+	return image;
+}
+
+static std::string getCoverThumbnailPath(const std::string& cover_path, const FILESYSTEM_STAT_DATA& sd, int width, int height)
+{
+	// Keyed on the source's timestamp and size as well, so replacing a cover regenerates its thumbnail.
+	const QByteArray key(QByteArray::fromStdString(fmt::format("{}|{}|{}", cover_path, sd.ModificationTime, sd.Size)));
+	const QByteArray hash(QCryptographicHash::hash(key, QCryptographicHash::Md5).toHex());
+	return Path::Combine(Path::Combine(EmuFolders::Cache, "covers"),
+		fmt::format("{}_{}x{}.png", std::string_view(hash.constData(), hash.size()), width, height));
+}
+
+static QImage loadCoverImage(const std::string& cover_path, int width, int height, float dpr)
+{
+	// Decoding and scaling full size covers is most of the cost, so keep a copy at the size it's shown at.
+	FILESYSTEM_STAT_DATA sd;
+	std::string thumbnail_path;
+	if (!EmuFolders::Cache.empty() && FileSystem::StatFile(cover_path.c_str(), &sd))
+	{
+		thumbnail_path = getCoverThumbnailPath(cover_path, sd, DPRScale(width, dpr), DPRScale(height, dpr));
+
+		QImage image(QString::fromStdString(thumbnail_path));
+		if (image.width() == DPRScale(width, dpr) && image.height() == DPRScale(height, dpr))
+		{
+			image.setDevicePixelRatio(dpr);
+			return image;
+		}
+	}
+
+	QImage image(QString::fromStdString(cover_path));
+	if (image.isNull())
+		return image;
+
+	image.setDevicePixelRatio(dpr);
+	resizeAndPadImage(&image, width, height, dpr);
+
+	if (!thumbnail_path.empty())
+	{
+		const std::string dir(Path::GetDirectory(thumbnail_path));
+		if (FileSystem::EnsureDirectoryExists(dir.c_str(), false))
+			image.save(QString::fromStdString(thumbnail_path), "PNG");
+	}
+
+	return image;
 }
 
 std::optional<GameListModel::Column> GameListModel::getColumnIdForName(std::string_view name)
@@ -131,10 +180,25 @@ GameListModel::GameListModel(QObject* parent /* = nullptr */)
 	: QAbstractTableModel(parent)
 	, m_cover_pixmap_cache(MIN_COVER_CACHE_SIZE)
 {
+	// Own pool, so a page of covers doesn't queue up behind (or starve) everything else on the global one.
+	// Leave a core free for the UI thread, which has to convert and draw the results.
+	m_cover_loader_pool.setMaxThreadCount(std::max(QThread::idealThreadCount() - 1, 1));
+
+	{
+		auto lock = GameList::GetLock();
+		m_row_count = static_cast<int>(GameList::GetEntryCount());
+	}
+
 	loadCommonImages();
 	setColumnDisplayNames();
 }
-GameListModel::~GameListModel() = default;
+GameListModel::~GameListModel()
+{
+	// Loaders reference the model, don't let them outlive it.
+	m_cover_scale_counter.fetch_add(1, std::memory_order_release);
+	m_cover_loader_pool.clear();
+	m_cover_loader_pool.waitForDone();
+}
 
 void GameListModel::refreshImages()
 {
@@ -167,7 +231,12 @@ void GameListModel::updateCacheSize(int width, int height)
 	const int cover_height = getCoverArtHeight();
 	const int num_columns = ((width + (cover_width - 1)) / cover_width);
 	const int num_rows = ((height + (cover_height - 1)) / cover_height);
-	m_cover_pixmap_cache.SetMaxCapacity(static_cast<int>(std::max(num_columns * num_rows, MIN_COVER_CACHE_SIZE)));
+
+	// Hold as many covers as fit in the byte budget, but never fewer than what's on screen, or we'd thrash.
+	const float dpr = qApp->devicePixelRatio();
+	const qsizetype cover_bytes = static_cast<qsizetype>(DPRScale(cover_width, dpr)) * DPRScale(cover_height, dpr) * 4;
+	const int budget_count = static_cast<int>(std::max<qsizetype>(COVER_CACHE_BYTES / cover_bytes, 1));
+	m_cover_pixmap_cache.SetMaxCapacity(static_cast<int>(std::max(num_columns * num_rows, budget_count)));
 }
 
 void GameListModel::loadOrGenerateCover(const GameList::Entry* ge)
@@ -176,25 +245,17 @@ void GameListModel::loadOrGenerateCover(const GameList::Entry* ge)
 	// while there's outstanding jobs, the old jobs won't proceed (at the wrong size), or get added into the grid.
 	const u32 counter = m_cover_scale_counter.load(std::memory_order_acquire);
 
-	QFuture<QPixmap> future = QtConcurrent::run([this, path = ge->path, title = ge->title, serial = ge->serial, counter]()->QPixmap {
-		QPixmap image;
-		if (m_cover_scale_counter.load(std::memory_order_acquire) == counter)
-		{
-			const std::string cover_path(GameList::GetCoverImagePath(path, serial, title));
-			if (!cover_path.empty())
-			{
-				const float dpr = qApp->devicePixelRatio();
-				image = QPixmap(QString::fromStdString(cover_path));
-				if (!image.isNull())
-				{
-					image.setDevicePixelRatio(dpr);
-					resizeAndPadPixmap(&image, getCoverArtWidth(), getCoverArtHeight(), dpr);
-				}
-			}
-		}
+	QFuture<QImage> future = QtConcurrent::run(&m_cover_loader_pool, [this, path = ge->path, title = ge->title, serial = ge->serial, counter]()->QImage {
+		QImage image;
+		if (m_cover_scale_counter.load(std::memory_order_acquire) != counter)
+			return image;
+
+		const std::string cover_path(GameList::GetCoverImagePath(path, serial, title));
+		if (!cover_path.empty())
+			image = loadCoverImage(cover_path, getCoverArtWidth(), getCoverArtHeight(), qApp->devicePixelRatio());
 
 		if (image.isNull())
-			image = createPlaceholderImage(m_placeholder_pixmap, getCoverArtWidth(), getCoverArtHeight(), m_cover_scale, title);
+			image = createPlaceholderImage(m_placeholder_image, getCoverArtWidth(), getCoverArtHeight(), m_cover_scale, title);
 
 		if (m_cover_scale_counter.load(std::memory_order_acquire) != counter)
 			image = {};
@@ -202,12 +263,12 @@ void GameListModel::loadOrGenerateCover(const GameList::Entry* ge)
 		return image;
 	});
 
-	// Context must be 'this' so we run on the UI thread.
-	future.then(this, [this, path = ge->path, counter](QPixmap pm) {
+	// Context must be 'this' so we run on the UI thread. Until then, the cache holds the loading pixmap.
+	future.then(this, [this, path = ge->path, counter](QImage image) {
 		if (m_cover_scale_counter.load(std::memory_order_acquire) != counter)
 			return;
 
-		m_cover_pixmap_cache.Insert(std::move(path), std::move(pm));
+		m_cover_pixmap_cache.Insert(path, QPixmap::fromImage(std::move(image)));
 		invalidateCoverForPath(path);
 	});
 }
@@ -226,9 +287,9 @@ void GameListModel::invalidateCoverForPath(const std::string& path)
 			break;
 		}
 	}
-	if (!row.has_value())
+	if (!row.has_value() || static_cast<int>(row.value()) >= m_row_count)
 	{
-		// Game removed?
+		// Game removed, or not added to the model yet?
 		return;
 	}
 
@@ -256,7 +317,7 @@ int GameListModel::rowCount(const QModelIndex& parent) const
 	if (parent.isValid())
 		return 0;
 
-	return static_cast<int>(GameList::GetEntryCount());
+	return m_row_count;
 }
 
 int GameListModel::columnCount(const QModelIndex& parent) const
@@ -405,9 +466,38 @@ QVariant GameListModel::headerData(int section, Qt::Orientation orientation, int
 void GameListModel::refresh()
 {
 	beginResetModel();
+	{
+		auto lock = GameList::GetLock();
+		m_row_count = static_cast<int>(GameList::GetEntryCount());
+	}
 	endResetModel();
 }
 
+void GameListModel::updateEntries(bool refresh_existing)
+{
+	// While scanning, the game list only grows (or replaces entries in place), so new rows can be inserted
+	// without resetting the views. It only shrinks when starting from scratch or removing missing files.
+	auto lock = GameList::GetLock();
+	const int count = static_cast<int>(GameList::GetEntryCount());
+	if (count < m_row_count)
+	{
+		lock.unlock();
+		refresh();
+		return;
+	}
+
+	const int old_count = m_row_count;
+	if (count > old_count)
+	{
+		beginInsertRows(QModelIndex(), old_count, count - 1);
+		m_row_count = count;
+		endInsertRows();
+	}
+
+	if (refresh_existing && old_count > 0)
+		emit dataChanged(index(0, 0), index(old_count - 1, Column_Count - 1));
+}
+
 bool GameListModel::titlesLessThan(int left_row, int right_row) const
 {
 	if (left_row < 0 || left_row >= static_cast<int>(GameList::GetEntryCount()) || right_row < 0 ||
@@ -544,7 +634,7 @@ void GameListModel::loadCommonImages()
 	for (u32 i = 1; i < GameList::CompatibilityRatingCount; i++)
 		m_compatibility_pixmaps[i].load(QStringLiteral("%1/icons/star-%2.png").arg(base_path).arg(i - 1));
 
-	m_placeholder_pixmap.load(QStringLiteral("%1/cover-placeholder.png").arg(base_path));
+	m_placeholder_image.load(QStringLiteral("%1/cover-placeholder.png").arg(base_path));
 	setCoverScale(1.0f);
 }
 
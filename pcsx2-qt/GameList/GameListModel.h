@@ -17,6 +17,8 @@
 #include "pcsx2/Frontend/GameList.h"
 #include "common/LRUCache.h"
 #include <QtCore/QAbstractTableModel>
+#include <QtCore/QThreadPool>
+#include <QtGui/QImage>
 #include <QtGui/QPixmap>
 #include <algorithm>
 #include <atomic>
@@ -63,6 +65,10 @@ public:
 	void refresh();
 	void refreshImages();
 
+	/// Picks up entries added by a refresh in progress, without resetting the model where possible.
+	/// refresh_existing should be set once it completes, since entries may have been updated in place.
+	void updateEntries(bool refresh_existing);
+
 	bool titlesLessThan(int left_row, int right_row) const;
 
 	bool lessThan(const QModelIndex& left_index, const QModelIndex& right_index, int column) const;
@@ -84,6 +90,9 @@ private:
 	void loadOrGenerateCover(const GameList::Entry* ge);
 	void invalidateCoverForPath(const std::string& path);
 
+	// Rows the views have been told about, the game list can be ahead of this while it's being refreshed.
+	int m_row_count = 0;
+
 	float m_cover_scale = 0.0f;
 	std::atomic<u32> m_cover_scale_counter{0};
 	bool m_show_titles_for_covers = false;
@@ -91,9 +100,10 @@ private:
 	std::array<QString, Column_Count> m_column_display_names;
 	std::array<QPixmap, static_cast<u32>(GameList::EntryType::Count)> m_type_pixmaps;
 	std::array<QPixmap, static_cast<u32>(GameList::Region::Count)> m_region_pixmaps;
-	QPixmap m_placeholder_pixmap;
+	QImage m_placeholder_image;
 	QPixmap m_loading_pixmap;
 
 	std::array<QPixmap, static_cast<int>(GameList::CompatibilityRatingCount)> m_compatibility_pixmaps;
 	mutable LRUCache<std::string, QPixmap> m_cover_pixmap_cache;
+	QThreadPool m_cover_loader_pool;
 };
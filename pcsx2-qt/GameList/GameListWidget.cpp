@@ -38,6 +38,7 @@ static const char* SUPPORTED_FORMATS_STRING = QT_TRANSLATE_NOOP(GameListWidget,
 	".bin/.iso (ISO Disc Images)\n"
 	".chd (Compressed Hunks of Data)\n"
 	".cso (Compressed ISO)\n"
+	".zso (LZ4 Compressed ISO)\n"
 	".gz (Gzip Compressed ISO)");
 
 static constexpr float MIN_SCALE = 0.1f;
@@ -261,13 +262,13 @@ void GameListWidget::onRefreshProgress(const QString& status, int current, int t
 	if (m_ui.stack->currentIndex() == 2)
 		m_ui.stack->setCurrentIndex(Host::GetBaseBoolSettingValue("UI", "GameListGridView", false) ? 1 : 0);
 
-	m_model->refresh();
+	m_model->updateEntries(false);
 	emit refreshProgress(status, current, total);
 }
 
 void GameListWidget::onRefreshComplete()
 {
-	m_model->refresh();
+	m_model->updateEntries(true);
 	emit refreshComplete();
 
 	pxAssertRel(m_refresh_thread, "Has a refresh thread");
@@ -56,11 +56,11 @@
 
 
 static constexpr char OPEN_FILE_FILTER[] =
-	QT_TRANSLATE_NOOP("MainWindow", "All File Types (*.bin *.iso *.cue *.chd *.cso *.gz *.elf *.irx *.m3u *.gs *.gs.xz *.gs.zst *.dump);;"
+	QT_TRANSLATE_NOOP("MainWindow", "All File Types (*.bin *.iso *.cue *.chd *.cso *.zso *.gz *.elf *.irx *.m3u *.gs *.gs.xz *.gs.zst *.dump);;"
 									"Single-Track Raw Images (*.bin *.iso);;"
 									"Cue Sheets (*.cue);;"
 									"MAME CHD Images (*.chd);;"
-									"CSO Images (*.cso);;"
+									"CSO/ZSO Images (*.cso *.zso);;"
 									"GZ Images (*.gz);;"
 									"ELF Executables (*.elf);;"
 									"IRX Executables (*.irx);;"
@@ -69,11 +69,11 @@ static constexpr char OPEN_FILE_FILTER[] =
 									"Block Dumps (*.dump)");
 
 static constexpr char DISC_IMAGE_FILTER[] =
-	QT_TRANSLATE_NOOP("MainWindow", "All File Types (*.bin *.iso *.cue *.chd *.cso *.gz *.dump);;"
+	QT_TRANSLATE_NOOP("MainWindow", "All File Types (*.bin *.iso *.cue *.chd *.cso *.zso *.gz *.dump);;"
 									"Single-Track Raw Images (*.bin *.iso);;"
 									"Cue Sheets (*.cue);;"
 									"MAME CHD Images (*.chd);;"
-									"CSO Images (*.cso);;"
+									"CSO/ZSO Images (*.cso *.zso);;"
 									"GZ Images (*.gz);;"
 									"Block Dumps (*.dump)");
 
@@ -1085,7 +1085,10 @@ void MainWindow::requestExit()
 void MainWindow::checkForSettingChanges()
 {
 	if (m_display_widget)
+	{
 		m_display_widget->updateRelativeMode(s_vm_valid && !s_vm_paused);
+		m_display_widget->setDoubleClickTogglesFullscreen(Host::GetBoolSettingValue("UI", "DoubleClickTogglesFullscreen", true));
+	}
 
 	updateWindowState();
 }
@@ -1864,6 +1867,9 @@ void MainWindow::createDisplayWidget(bool fullscreen, bool render_to_main, bool
 		container = m_display_widget;
 	}
 
+	// read here rather than on every mouse event, checkForSettingChanges() keeps it up to date
+	m_display_widget->setDoubleClickTogglesFullscreen(Host::GetBoolSettingValue("UI", "DoubleClickTogglesFullscreen", true));
+
 	if (fullscreen || !render_to_main)
 	{
 		container->setWindowTitle(windowTitle());
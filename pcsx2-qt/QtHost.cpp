@@ -506,6 +506,28 @@ void QtHost::PrintCommandLineHelp(const char* progname)
 	std::fprintf(stderr, "  -fullscreen: Enters fullscreen mode immediately after starting.\n");
 	std::fprintf(stderr, "  -nofullscreen: Prevents fullscreen mode from triggering if enabled.\n");
 	std::fprintf(stderr, "  -earlyconsolelog: Forces logging of early console messages to console.\n");
+	std::fprintf(stderr, "  -renderer <name>: Overrides the renderer for this session (auto, dx11, dx12,\n"
+						 "    opengl, vulkan, metal, software, null).\n");
+	std::fprintf(stderr, "  -gsbench <loops>: Replays the GS dump <loops> times unthrottled and exits,\n"
+						 "    writing per-frame timings (combine with -nogui for unattended runs).\n");
+	std::fprintf(stderr, "  -gsbenchout <filename>: Writes the -gsbench trace to the specified filename,\n"
+						 "    as JSON if it ends in .json, otherwise as CSV.\n");
+	std::fprintf(stderr, "  -gsdumpframe <frame>: Starts replaying the GS dump at the specified frame.\n");
+	std::fprintf(stderr, "  -benchframes <frames>: Runs the game or GS dump unthrottled for <frames> frames\n"
+						 "    and exits, writing per-frame timings (combine with -nogui and -renderer).\n");
+	std::fprintf(stderr, "  -benchout <filename>: Writes the -benchframes trace to the specified filename,\n"
+						 "    as JSON if it ends in .json, otherwise as CSV.\n");
+	std::fprintf(stderr, "  -hwprofile <filename>: Counts EE hardware register accesses by register and\n"
+						 "    guest PC, and writes a report to the specified filename on shutdown.\n");
+	std::fprintf(stderr, "  -replay <filename>: Replays a power-on input recording unthrottled and exits\n"
+						 "    when it ends.\n");
+	std::fprintf(stderr, "  -hashinterval <frames>: Hashes EE RAM every <frames> frames, and reports the\n"
+						 "    run's frame rate and hash mismatches on exit.\n");
+	std::fprintf(stderr, "  -hashout <filename>: Writes the -hashinterval hashes to the specified filename.\n");
+	std::fprintf(stderr, "  -hashref <filename>: Compares the -hashinterval hashes against a previous\n"
+						 "    -hashout file.\n");
+	std::fprintf(stderr, "  -tune: Reruns -replay (or -benchframes) once per candidate speedhack, and saves\n"
+						 "    the fastest set that keeps the EE RAM hashes unchanged to the game settings.\n");
 	std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
 						 "    parameters make up the filename. Use when the filename contains\n"
 						 "    spaces or starts with a dash.\n");
@@ -520,6 +542,28 @@ std::shared_ptr<VMBootParameters>& QtHost::AutoBoot(std::shared_ptr<VMBootParame
 	return autoboot;
 }
 
+static std::optional<GSRendererType> ParseRendererName(const char* name)
+{
+	static constexpr const std::pair<const char*, GSRendererType> names[] = {
+		{"auto", GSRendererType::Auto},
+		{"dx11", GSRendererType::DX11},
+		{"dx12", GSRendererType::DX12},
+		{"opengl", GSRendererType::OGL},
+		{"vulkan", GSRendererType::VK},
+		{"metal", GSRendererType::Metal},
+		{"software", GSRendererType::SW},
+		{"null", GSRendererType::Null},
+	};
+
+	for (const auto& [renderer_name, renderer] : names)
+	{
+		if (StringUtil::Strcasecmp(name, renderer_name) == 0)
+			return renderer;
+	}
+
+	return std::nullopt;
+}
+
 bool QtHost::ParseCommandLineOptions(int argc, char* argv[], std::shared_ptr<VMBootParameters>& autoboot)
 {
 	bool no_more_args = false;
@@ -603,6 +647,75 @@ bool QtHost::ParseCommandLineOptions(int argc, char* argv[], std::shared_ptr<VMB
 				Host::InitializeEarlyConsole();
 				continue;
 			}
+			else if (CHECK_ARG_PARAM("-renderer"))
+			{
+				const char* name = argv[++i];
+				const std::optional<GSRendererType> renderer = ParseRendererName(name);
+				if (!renderer.has_value())
+				{
+					Host::InitializeEarlyConsole();
+					std::fprintf(stderr, "Unknown renderer: '%s'\n", name);
+					return false;
+				}
+
+				AutoBoot(autoboot)->renderer = renderer;
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-gsbench"))
+			{
+				AutoBoot(autoboot)->gs_dump_benchmark_loops = static_cast<u32>(std::max(std::atoi(argv[++i]), 1));
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-gsbenchout"))
+			{
+				AutoBoot(autoboot)->gs_dump_benchmark_output = argv[++i];
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-gsdumpframe"))
+			{
+				AutoBoot(autoboot)->gs_dump_start_frame = static_cast<u32>(std::max(std::atoi(argv[++i]), 0));
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-benchframes"))
+			{
+				AutoBoot(autoboot)->benchmark_frames = static_cast<u32>(std::max(std::atoi(argv[++i]), 1));
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-benchout"))
+			{
+				AutoBoot(autoboot)->benchmark_output = argv[++i];
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-hwprofile"))
+			{
+				AutoBoot(autoboot)->hw_profile_output = argv[++i];
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-replay"))
+			{
+				AutoBoot(autoboot)->input_recording = argv[++i];
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-hashinterval"))
+			{
+				AutoBoot(autoboot)->hash_interval = static_cast<u32>(std::max(std::atoi(argv[++i]), 1));
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-hashout"))
+			{
+				AutoBoot(autoboot)->hash_output = argv[++i];
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-hashref"))
+			{
+				AutoBoot(autoboot)->hash_reference = argv[++i];
+				continue;
+			}
+			else if (CHECK_ARG("-tune"))
+			{
+				AutoBoot(autoboot)->tune_settings = true;
+				continue;
+			}
 			else if (CHECK_ARG("--"))
 			{
 				no_more_args = true;
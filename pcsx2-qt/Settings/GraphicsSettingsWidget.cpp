@@ -187,6 +187,7 @@ GraphicsSettingsWidget::GraphicsSettingsWidget(SettingsDialog* dialog, QWidget*
 	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.blending, "EmuCore/GS", "accurate_blending_unit", static_cast<int>(AccBlendLevel::Basic));
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.accurateDATE, "EmuCore/GS", "accurate_date", true);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.gpuPaletteConversion, "EmuCore/GS", "paltex", false);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.dynamicResolution, "EmuCore/GS", "DynamicResolution", false);
 	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.texturePreloading, "EmuCore/GS", "texture_preloading",
 		static_cast<int>(TexturePreloadingLevel::Off));
 
@@ -240,6 +241,8 @@ GraphicsSettingsWidget::GraphicsSettingsWidget(SettingsDialog* dialog, QWidget*
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.useBlitSwapChain, "EmuCore/GS", "UseBlitSwapChain", false);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.useDebugDevice, "EmuCore/GS", "UseDebugDevice", false);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.skipPresentingDuplicateFrames, "EmuCore/GS", "SkipDuplicateFrames", false);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.frameLimiterLowLatency, "EmuCore/GS", "FrameLimiterLowLatency", false);
+	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.frameSkip, "EmuCore/GS", "FrameSkip", 0);
 	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.overrideTextureBarriers, "EmuCore/GS", "OverrideTextureBarriers", -1, -1);
 	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.overrideGeometryShader, "EmuCore/GS", "OverrideGeometryShaders", -1, -1);
 	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.gsDumpCompression, "EmuCore/GS", "GSDumpCompression", static_cast<int>(GSDumpCompressionMethod::LZMA));
@@ -375,6 +378,10 @@ GraphicsSettingsWidget::GraphicsSettingsWidget(SettingsDialog* dialog, QWidget*
 			tr("When enabled GPU converts colormap-textures, otherwise the CPU will. "
 			   "It is a trade-off between GPU and CPU."));
 
+		dialog->registerWidgetHelp(m_ui.dynamicResolution, tr("Dynamic Resolution"), tr("Unchecked"),
+			tr("Steps the internal resolution down when the GPU can't keep up with the frame rate, and back up "
+			   "to the selected value when it can. Each step reloads the renderer, causing a brief stutter."));
+
 		dialog->registerWidgetHelp(m_ui.enableHWFixes, tr("Manual Hardware Renderer Fixes"), tr("Unchecked"),
 			tr("Enabling this option gives you the ability to change the renderer and upscaling fixes "
 			   "to your games. However IF you have ENABLED this, you WILL DISABLE AUTOMATIC "
@@ -481,6 +488,16 @@ GraphicsSettingsWidget::GraphicsSettingsWidget(SettingsDialog* dialog, QWidget*
 			   "the GPU has more time to complete it (this is NOT frame skipping). Can smooth our frame time fluctuations when the CPU/GPU are near maximum "
 			   "utilization, but makes frame pacing more inconsistent and can increase input lag."));
 
+		dialog->registerWidgetHelp(m_ui.frameLimiterLowLatency, tr("Low Latency Frame Limiter"), tr("Unchecked"),
+			tr("Sends each frame to the GS as soon as the EE finishes it, and sleeps off the remaining frame time before polling input "
+			   "for the next one. Reduces input lag by up to a frame when the host is faster than the PS2, at the cost of less even "
+			   "frame pacing. Only useful when the frame limiter sleeps, not when syncing to the host refresh rate."));
+
+		dialog->registerWidgetHelp(m_ui.frameSkip, tr("Frame Skip"), tr("Disabled"),
+			tr("Skips drawing this many frames after each one that's drawn, when using a hardware renderer. Only draws to the "
+			   "screen are skipped, effects which later frames depend on are still rendered. Lowers the GPU load a lot, but "
+			   "makes motion choppy."));
+
 		dialog->registerWidgetHelp(m_ui.disableHardwareReadbacks, tr("Disable Hardware Readbacks"), tr("Unchecked"),
 			tr("Skips synchronizing with the GS thread and host GPU for GS downloads. "
 			   "Can result in a large speed boost on slower systems, at the cost of many broken graphical effects. "
@@ -756,6 +773,8 @@ void GraphicsSettingsWidget::updateRendererDependentOptions()
 	}
 
 	m_ui.enableHWFixes->setEnabled(is_hardware);
+	m_ui.dynamicResolution->setEnabled(is_hardware);
+	m_ui.frameSkip->setEnabled(is_hardware);
 	if (is_hardware)
 		onEnableHardwareFixesChanged();
 }
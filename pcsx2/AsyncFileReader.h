@@ -23,6 +23,7 @@
 #elif defined(__POSIX__)
 #	include <aio.h>
 #endif
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -54,6 +55,11 @@ public:
 	virtual void SetBlockSize(uint bytes) {}
 	virtual void SetDataOffset(int bytes) {}
 
+	// Returns a pointer to count blocks starting at sector, for readers which can serve
+	// them without copying (memory mapped files), or nullptr if the data must be read
+	// through BeginRead/FinishRead. The pointer stays valid until the reader is closed.
+	virtual const u8* GetBlockPointer(uint sector, uint count) { return nullptr; }
+
 	uint GetBlockSize() const { return m_blocksize; }
 
 	const std::string& GetFilename() const
@@ -66,17 +72,31 @@ class FlatFileReader : public AsyncFileReader
 {
 	DeclareNoncopyableObject( FlatFileReader );
 
+	// Large reads are split into several requests which are all in flight at once, which
+	// hides most of the per-request latency of network storage.
+	static constexpr uint MaxSegments = 8;
+	static constexpr uint MinSegmentBlocks = 16;
+
+	static uint GetSegmentBlocks(uint count)
+	{
+		const uint segments = std::clamp(count / MinSegmentBlocks, 1u, MaxSegments);
+		return (count + segments - 1) / segments;
+	}
+
 #ifdef _WIN32
 	HANDLE hOverlappedFile;
 
-	OVERLAPPED asyncOperationContext;
+	OVERLAPPED asyncOperationContext[MaxSegments];
+
+	HANDLE hEvent[MaxSegments];
 
-	HANDLE hEvent;
+	uint asyncSegments;
 
 	bool asyncInProgress;
 #elif defined(__linux__)
 	int m_fd; // FIXME don't know if overlap as an equivalent on linux
 	io_context_t m_aio_context;
+	int m_aio_pending;
 #elif defined(__POSIX__)
 	int m_fd; // TODO OSX don't know if overlap as an equivalent on OSX
 	struct aiocb m_aiocb;
@@ -105,63 +125,28 @@ public:
 	virtual void SetDataOffset(int bytes) override { m_dataoffset = bytes; }
 };
 
-class MultipartFileReader : public AsyncFileReader
-{
-	DeclareNoncopyableObject( MultipartFileReader );
-
-	static const int MaxParts = 8;
-
-	struct Part {
-		uint start;
-		uint end; // exclusive
-		bool isReading;
-		AsyncFileReader* reader;
-	} m_parts[MaxParts];
-	uint m_numparts;
-
-	uint GetFirstPart(uint lsn);
-	void FindParts();
-
-public:
-	MultipartFileReader(AsyncFileReader* firstPart);
-	virtual ~MultipartFileReader() override;
-
-	virtual bool Open(std::string fileName) override;
-
-	virtual int ReadSync(void* pBuffer, uint sector, uint count) override;
-
-	virtual void BeginRead(void* pBuffer, uint sector, uint count) override;
-	virtual int FinishRead(void) override;
-	virtual void CancelRead(void) override;
-
-	virtual void Close(void) override;
-
-	virtual uint GetBlockCount(void) const override;
-
-	virtual void SetBlockSize(uint bytes) override;
-
-	static AsyncFileReader* DetectMultipart(AsyncFileReader* reader);
-};
-
-class BlockdumpFileReader : public AsyncFileReader
+#ifndef _WIN32
+// Maps the whole image into memory, so sectors are copied straight out of the page
+// cache. Not used when write sharing is enabled, since a mapping of a file which is
+// truncated by another process faults on access.
+class MappedFileReader : public AsyncFileReader
 {
-	DeclareNoncopyableObject( BlockdumpFileReader );
+	DeclareNoncopyableObject( MappedFileReader );
 
-	std::FILE* m_file;
+	int m_fd;
+	u8* m_data;
+	s64 m_size;
 
-	// total number of blocks in the ISO image (including all parts)
-	u32 m_blocks;
-	s32 m_blockofs;
+	void* m_async_buffer;
+	uint m_async_sector;
+	uint m_async_count;
 
-	// index table
-	std::unique_ptr<u32[]> m_dtable;
-	int m_dtablesize;
-
-	int m_lresult;
+	void Prefetch(s64 offset, s64 length);
+	int CopyBlocks(void* pBuffer, uint sector, uint count);
 
 public:
-	BlockdumpFileReader();
-	virtual ~BlockdumpFileReader() override;
+	MappedFileReader();
+	virtual ~MappedFileReader() override;
 
 	virtual bool Open(std::string fileName) override;
 
@@ -175,7 +160,9 @@ public:
 
 	virtual uint GetBlockCount(void) const override;
 
-	static bool DetectBlockdump(AsyncFileReader* reader);
+	virtual void SetBlockSize(uint bytes) override { m_blocksize = bytes; }
+	virtual void SetDataOffset(int bytes) override { m_dataoffset = bytes; }
 
-	int GetBlockOffset() { return m_blockofs; }
+	virtual const u8* GetBlockPointer(uint sector, uint count) override;
 };
+#endif
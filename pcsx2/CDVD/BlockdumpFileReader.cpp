@@ -14,8 +14,7 @@
  */
 
 #include "PrecompiledHeader.h"
-#include "AsyncFileReader.h"
-#include "IsoFileFormats.h"
+#include "BlockdumpFileReader.h"
 #include "common/Assertions.h"
 #include "common/FileSystem.h"
 
@@ -49,8 +48,6 @@ BlockdumpFileReader::BlockdumpFileReader(void)
 	: m_file(NULL)
 	, m_blocks(0)
 	, m_blockofs(0)
-	, m_dtablesize(0)
-	, m_lresult(0)
 {
 }
 
@@ -59,7 +56,7 @@ BlockdumpFileReader::~BlockdumpFileReader(void)
 	Close();
 }
 
-bool BlockdumpFileReader::Open(std::string fileName)
+bool BlockdumpFileReader::Open2(std::string fileName)
 {
 	char signature[4];
 
@@ -83,8 +80,9 @@ bool BlockdumpFileReader::Open(std::string fileName)
 
 	pxAssert((datalen % (m_blocksize + 4)) == 0);
 
-	m_dtablesize = datalen / (m_blocksize + 4);
-	m_dtable = std::make_unique<u32[]>(m_dtablesize);
+	const u32 dtablesize = static_cast<u32>(datalen / (m_blocksize + 4));
+	m_dtable.clear();
+	m_dtable.reserve(dtablesize);
 
 	if (FileSystem::FSeek64(m_file, BlockDumpHeaderSize, SEEK_SET) != 0)
 		return false;
@@ -92,15 +90,16 @@ bool BlockdumpFileReader::Open(std::string fileName)
 	u32 bs = 1024 * 1024;
 	u32 off = 0;
 	u32 has = 0;
-	int i = 0;
+	u32 i = 0;
 
 	std::unique_ptr<u8[]> buffer = std::make_unique<u8[]>(bs);
 	do
 	{
 		has = static_cast<u32>(std::fread(buffer.get(), 1, bs, m_file));
-		while (i < m_dtablesize && off < has)
+		while (i < dtablesize && off < has)
 		{
-			m_dtable[i++] = *reinterpret_cast<u32*>(buffer.get() + off);
+			// Keep the first copy if a block was dumped more than once.
+			m_dtable.emplace(*reinterpret_cast<u32*>(buffer.get() + off), i++);
 			off += 4;
 			off += m_blocksize;
 		}
@@ -112,74 +111,64 @@ bool BlockdumpFileReader::Open(std::string fileName)
 	return true;
 }
 
-int BlockdumpFileReader::ReadSync(void* pBuffer, uint lsn, uint count)
+ThreadedFileReader::Chunk BlockdumpFileReader::ChunkForOffset(u64 offset)
 {
-	u8* dst = (u8*)pBuffer;
-	//	Console.WriteLn("_isoReadBlockD %u, blocksize=%u, blockofs=%u\n", lsn, iso->blocksize, iso->blockofs);
+	Chunk chunk = {0};
+	const u64 lsn = offset / m_blocksize;
+	if (lsn >= m_blocks)
+	{
+		chunk.chunkID = -1;
+	}
+	else
+	{
+		chunk.chunkID = lsn;
+		chunk.length = m_blocksize;
+		chunk.offset = lsn * m_blocksize;
+	}
+	return chunk;
+}
+
+int BlockdumpFileReader::ReadChunk(void* dst, s64 chunkID)
+{
+	if (chunkID < 0)
+		return -1;
 
-	while (count > 0)
+	const u32 lsn = static_cast<u32>(chunkID);
+	const auto it = m_dtable.find(lsn);
+	if (it == m_dtable.end())
 	{
-		bool ok = false;
-		for (int i = 0; i < m_dtablesize; ++i)
-		{
-			if (m_dtable[i] != lsn)
-				continue;
+		DevCon.WriteLn("Block %u not found in dump", lsn);
+		return -1;
+	}
 
-				// We store the LSN (u32) along with each block inside of blockdumps, so the
-				// seek position ends up being based on (m_blocksize + 4) instead of just m_blocksize.
+	// We store the LSN (u32) along with each block inside of blockdumps, so the
+	// seek position ends up being based on (m_blocksize + 4) instead of just m_blocksize.
+	const s64 pos = BlockDumpHeaderSize + static_cast<s64>(it->second) * (m_blocksize + 4);
 
 #ifdef PCSX2_DEBUG
-			u32 check_lsn = 0;
-			FileSystem::FSeek64(m_file, BlockDumpHeaderSize + (i * (m_blocksize + 4)), SEEK_SET);
-			std::fread(&check_lsn, sizeof(check_lsn), 1, m_file);
-			pxAssert(check_lsn == lsn);
+	u32 check_lsn = 0;
+	FileSystem::FSeek64(m_file, pos, SEEK_SET);
+	std::fread(&check_lsn, sizeof(check_lsn), 1, m_file);
+	pxAssert(check_lsn == lsn);
 #else
-			if (FileSystem::FSeek64(m_file, BlockDumpHeaderSize + (i * (m_blocksize + 4)) + 4, SEEK_SET) != 0)
-				break;
+	if (FileSystem::FSeek64(m_file, pos + 4, SEEK_SET) != 0)
+		return -1;
 #endif
 
-			if (std::fread(dst, m_blocksize, 1, m_file) != 1)
-				break;
-
-			ok = true;
-			break;
-		}
+	if (std::fread(dst, m_blocksize, 1, m_file) != 1)
+		return -1;
 
-		if (!ok)
-		{
-			Console.WriteLn("Block %u not found in dump", lsn);
-			return -1;
-		}
-
-		count--;
-		lsn++;
-		dst += m_blocksize;
-	}
-
-	return 0;
-}
-
-void BlockdumpFileReader::BeginRead(void* pBuffer, uint sector, uint count)
-{
-	m_lresult = ReadSync(pBuffer, sector, count);
-}
-
-int BlockdumpFileReader::FinishRead(void)
-{
-	return m_lresult;
-}
-
-void BlockdumpFileReader::CancelRead(void)
-{
+	return static_cast<int>(m_blocksize);
 }
 
-void BlockdumpFileReader::Close(void)
+void BlockdumpFileReader::Close2(void)
 {
 	if (m_file)
 	{
 		std::fclose(m_file);
 		m_file = NULL;
 	}
+	m_dtable.clear();
 }
 
 uint BlockdumpFileReader::GetBlockCount(void) const
@@ -0,0 +1,58 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "ThreadedFileReader.h"
+
+#include <cstdio>
+#include <unordered_map>
+
+// Blockdumps store each block with its LSN in front, in the order they were read. Every block
+// is one chunk of the ThreadedFileReader, so sequential reads get read ahead like other images.
+class BlockdumpFileReader : public ThreadedFileReader
+{
+	DeclareNoncopyableObject(BlockdumpFileReader);
+
+	std::FILE* m_file;
+
+	// total number of blocks in the ISO image (including all parts)
+	u32 m_blocks;
+	s32 m_blockofs;
+
+	// LSN to position of the block in the dump
+	std::unordered_map<u32, u32> m_dtable;
+
+public:
+	BlockdumpFileReader();
+	~BlockdumpFileReader() override;
+
+	bool Open2(std::string fileName) override;
+
+	Chunk ChunkForOffset(u64 offset) override;
+	int ReadChunk(void* dst, s64 chunkID) override;
+
+	void Close2(void) override;
+
+	uint GetBlockCount(void) const override;
+
+	// The block size and data offset come from the dump header, and don't change with the detected image type.
+	void SetBlockSize(uint bytes) override {}
+	void SetDataOffset(int bytes) override {}
+
+	static bool DetectBlockdump(AsyncFileReader* reader);
+
+	int GetBlockOffset() { return m_blockofs; }
+};
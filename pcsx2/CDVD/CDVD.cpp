@@ -822,21 +822,8 @@ static uint cdvdBlockReadTime(CDVD_MODE_TYPE mode)
 	return (PSXCLK / (((mode == MODE_CDROM) ? CD_SECTORS_PERSECOND : DVD_SECTORS_PERSECOND) * cdvd.Speed));
 }
 
-void cdvdReset()
+void cdvdResetRTC()
 {
-	memzero(cdvd);
-
-	cdvd.Type = CDVD_TYPE_NODISC;
-	cdvd.Spinning = false;
-
-	cdvd.sDataIn = 0x40;
-	cdvdUpdateReady(CDVD_DRIVE_READY);
-	cdvdUpdateStatus(CDVD_STATUS_PAUSE);
-	cdvd.Speed = 4;
-	cdvd.BlockSize = 2064;
-	cdvd.Action = cdvdAction_None;
-	cdvd.ReadTime = cdvdBlockReadTime(MODE_DVDROM);
-
 	// If we are recording, always use the same RTC setting
 	// for games that use the RTC to seed their RNG -- this is very important to be the same everytime!
 #ifndef DISABLE_RECORDING
@@ -872,6 +859,24 @@ void cdvdReset()
 		cdvd.RTC.month = (u8)curtime.tm_mon + 1; // WX returns Jan as "0"
 		cdvd.RTC.year = (u8)(curtime.tm_year - 100); // offset from 2000
 	}
+}
+
+void cdvdReset()
+{
+	memzero(cdvd);
+
+	cdvd.Type = CDVD_TYPE_NODISC;
+	cdvd.Spinning = false;
+
+	cdvd.sDataIn = 0x40;
+	cdvdUpdateReady(CDVD_DRIVE_READY);
+	cdvdUpdateStatus(CDVD_STATUS_PAUSE);
+	cdvd.Speed = 4;
+	cdvd.BlockSize = 2064;
+	cdvd.Action = cdvdAction_None;
+	cdvd.ReadTime = cdvdBlockReadTime(MODE_DVDROM);
+
+	cdvdResetRTC();
 
 	g_GameStarted = false;
 	g_GameLoading = false;
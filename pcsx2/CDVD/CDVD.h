@@ -165,6 +165,7 @@ extern cdvdStruct cdvd;
 extern void cdvdReadLanguageParams(u8* config);
 
 extern void cdvdReset();
+extern void cdvdResetRTC();
 extern void cdvdVsync();
 extern void cdvdActionInterrupt();
 extern void cdvdSectorReady();
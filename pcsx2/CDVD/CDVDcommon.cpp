@@ -357,6 +357,7 @@ bool DoCDVDopen()
 {
 	CheckNullCDVD();
 
+	IsoFSCDVD::ClearDirectoryCache();
 	CDVD->newDiskCB(cdvdNewDiskCB);
 
 	// Win32 Fail: the old CDVD api expects MBCS on Win32 platforms, but generating a MBCS
@@ -547,6 +548,7 @@ s32 DoCDVDdetectDiskType()
 void DoCDVDresetDiskTypeCache()
 {
 	diskTypeCached = -1;
+	IsoFSCDVD::ClearDirectoryCache();
 }
 
 ////////////////////////////////////////////////////////
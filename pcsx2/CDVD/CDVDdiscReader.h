@@ -22,6 +22,9 @@
 
 #include <mutex>
 #include <array>
+#include <string>
+
+class ProgressCallback;
 
 struct track
 {
@@ -99,3 +102,6 @@ s32 cdvdDirectReadSector(u32 sector, s32 mode, u8* buffer);
 s32 cdvdGetMediaType();
 s32 cdvdRefreshData();
 void cdvdParseTOC();
+
+// Copies the disc in the given drive to an ISO: 2048 byte sectors for DVDs, 2352 for CDs.
+bool cdvdDumpDisc(const std::string& drive, const std::string& filename, ProgressCallback* progress);
@@ -17,8 +17,12 @@
 #include "CDVDdiscReader.h"
 #include "CDVD/CDVD.h"
 
+#include "common/FileSystem.h"
+#include "common/ProgressCallback.h"
+
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <limits>
 #include <queue>
 #include <thread>
@@ -448,3 +452,169 @@ s32 cdvdRefreshData()
 
 	return 0;
 }
+
+// Dumping reads much larger runs than emulation does, and hands them to a write-behind
+// thread so the drive never waits on the output file.
+const u32 dump_sectors_per_read = 64;
+const u32 dump_queue_depth = 8;
+const u32 dump_retries = 4;
+
+struct DumpBlock
+{
+	u32 lsn;
+	std::vector<u8> data;
+};
+
+bool cdvdDumpDisc(const std::string& drive, const std::string& filename, ProgressCallback* progress)
+{
+	if (!progress)
+		progress = ProgressCallback::NullProgressCallback;
+
+	std::unique_ptr<IOCtlSrc> disc;
+	try
+	{
+		disc = std::make_unique<IOCtlSrc>(drive);
+	}
+	catch (std::runtime_error&)
+	{
+		progress->DisplayFormattedError("Failed to open drive '%s'.", drive.c_str());
+		return false;
+	}
+
+	if (!disc->DiscReady() || disc->GetSectorCount() == 0)
+	{
+		progress->DisplayFormattedError("No disc in drive '%s'.", drive.c_str());
+		return false;
+	}
+
+	// Opening the drive limits it to PS2 speeds, which is what emulation wants, but not dumping.
+	disc->SetSpindleSpeed(true);
+
+	const u32 sectors = disc->GetSectorCount();
+	const bool is_dvd = disc->GetMediaType() >= 0;
+	const u32 sector_size = is_dvd ? 2048 : 2352;
+	const auto read_sectors = [&disc, is_dvd](u32 lsn, u32 count, u8* buffer) {
+		return is_dvd ? disc->ReadSectors2048(lsn, count, buffer) : disc->ReadSectors2352(lsn, count, buffer);
+	};
+
+	auto fp = FileSystem::OpenManagedCFile(filename.c_str(), "wb");
+	if (!fp)
+	{
+		progress->DisplayFormattedError("Failed to create '%s'.", filename.c_str());
+		return false;
+	}
+
+	std::mutex queue_lock;
+	std::condition_variable queue_cv;
+	std::deque<DumpBlock> queue;
+	bool reading_done = false;
+	bool write_error = false;
+
+	std::thread writer([&]() {
+		std::unique_lock<std::mutex> guard(queue_lock);
+		for (;;)
+		{
+			queue_cv.wait(guard, [&]() { return !queue.empty() || reading_done; });
+			if (queue.empty())
+				break;
+
+			DumpBlock block = std::move(queue.front());
+			queue.pop_front();
+			queue_cv.notify_all();
+
+			guard.unlock();
+			const bool written = std::fwrite(block.data.data(), block.data.size(), 1, fp.get()) == 1;
+			guard.lock();
+
+			write_error |= !written;
+		}
+	});
+
+	progress->SetProgressRange(sectors);
+	progress->SetProgressValue(0);
+	progress->SetFormattedStatusText("Dumping %u sectors...", sectors);
+
+	// Unreadable blocks are zero-filled and retried one sector at a time once the rest is done,
+	// rather than stalling the sequential pass in a scratched area.
+	std::vector<u32> bad_blocks;
+	for (u32 lsn = 0; lsn < sectors && !progress->IsCancelled(); lsn += dump_sectors_per_read)
+	{
+		const u32 count = std::min(dump_sectors_per_read, sectors - lsn);
+		DumpBlock block{lsn, std::vector<u8>(count * sector_size)};
+		if (!read_sectors(lsn, count, block.data.data()))
+		{
+			std::fill(block.data.begin(), block.data.end(), 0);
+			bad_blocks.push_back(lsn);
+		}
+
+		{
+			std::unique_lock<std::mutex> guard(queue_lock);
+			queue_cv.wait(guard, [&]() { return queue.size() < dump_queue_depth; });
+			if (write_error)
+				break;
+
+			queue.push_back(std::move(block));
+		}
+		queue_cv.notify_all();
+
+		progress->SetProgressValue(lsn + count);
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(queue_lock);
+		reading_done = true;
+	}
+	queue_cv.notify_all();
+	writer.join();
+
+	if (write_error)
+	{
+		progress->DisplayFormattedError("Failed to write to '%s'.", filename.c_str());
+		return false;
+	}
+
+	if (progress->IsCancelled())
+		return false;
+
+	u32 unreadable = 0;
+	if (!bad_blocks.empty())
+	{
+		progress->SetFormattedStatusText("Retrying %zu unreadable blocks...", bad_blocks.size());
+
+		std::vector<u8> sector(sector_size);
+		for (const u32 block_lsn : bad_blocks)
+		{
+			const u32 count = std::min(dump_sectors_per_read, sectors - block_lsn);
+			for (u32 lsn = block_lsn; lsn < block_lsn + count; lsn++)
+			{
+				bool read = false;
+				for (u32 tries = 0; tries < dump_retries && !read; tries++)
+					read = read_sectors(lsn, 1, sector.data());
+
+				if (!read)
+				{
+					unreadable++;
+					continue;
+				}
+
+				if (FileSystem::FSeek64(fp.get(), static_cast<s64>(lsn) * sector_size, SEEK_SET) != 0 ||
+					std::fwrite(sector.data(), sector_size, 1, fp.get()) != 1)
+				{
+					progress->DisplayFormattedError("Failed to write to '%s'.", filename.c_str());
+					return false;
+				}
+			}
+		}
+	}
+
+	if (std::fflush(fp.get()) != 0)
+	{
+		progress->DisplayFormattedError("Failed to write to '%s'.", filename.c_str());
+		return false;
+	}
+
+	if (unreadable > 0)
+		progress->DisplayFormattedWarning("%u sectors could not be read and were zero-filled.", unreadable);
+
+	return true;
+}
@@ -21,6 +21,80 @@
 #include "common/Path.h"
 #include "common/StringUtil.h"
 
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+	/// Decoded hunks, shared by all open CHDs and kept across reopening the same image.
+	/// Reopening happens a lot: the game list scan, booting, resets and disc swaps all
+	/// read the same hunks of the filesystem and boot ELF.
+	class ChdHunkCache
+	{
+	public:
+		using Key = std::pair<std::array<u8, CHD_SHA1_BYTES>, u32>;
+
+		bool Lookup(const Key& key, void* dst, u32 size)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto it = m_map.find(key);
+			if (it == m_map.end() || it->second->size != size)
+				return false;
+
+			m_lru.splice(m_lru.begin(), m_lru, it->second);
+			std::memcpy(dst, it->second->data.get(), size);
+			return true;
+		}
+
+		void Insert(const Key& key, const void* src, u32 size)
+		{
+			if (size > MAX_SIZE)
+				return;
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_map.find(key) != m_map.end())
+				return;
+
+			while (!m_lru.empty() && m_size + size > MAX_SIZE)
+			{
+				m_size -= m_lru.back().size;
+				m_map.erase(m_lru.back().key);
+				m_lru.pop_back();
+			}
+
+			Entry entry;
+			entry.key = key;
+			entry.size = size;
+			entry.data = std::make_unique<u8[]>(size);
+			std::memcpy(entry.data.get(), src, size);
+			m_lru.push_front(std::move(entry));
+			m_map.emplace(key, m_lru.begin());
+			m_size += size;
+		}
+
+	private:
+		static constexpr u32 MAX_SIZE = 16 * 1024 * 1024;
+
+		struct Entry
+		{
+			Key key;
+			u32 size;
+			std::unique_ptr<u8[]> data;
+		};
+
+		std::mutex m_mutex;
+		std::list<Entry> m_lru;
+		std::map<Key, std::list<Entry>::iterator> m_map;
+		u32 m_size = 0;
+	};
+} // namespace
+
+static ChdHunkCache s_hunk_cache;
+
 ChdFileReader::~ChdFileReader()
 {
 	Close();
@@ -150,6 +224,10 @@ bool ChdFileReader::Open2(std::string fileName)
 	// The rest of PCSX2 likes to use 2448 byte buffers, which can't fit that so trim blocks instead
 	m_internalBlockSize = chd_header->unitbytes;
 
+	// Old CHD versions only have an MD5, don't share hunks between those.
+	std::memcpy(m_sha1.data(), chd_header->sha1, m_sha1.size());
+	m_hunk_cacheable = std::any_of(m_sha1.begin(), m_sha1.end(), [](u8 b) { return b != 0; });
+
 	return true;
 }
 
@@ -174,6 +252,10 @@ int ChdFileReader::ReadChunk(void* dst, s64 chunkID)
 	if (chunkID < 0)
 		return -1;
 
+	const ChdHunkCache::Key key(m_sha1, static_cast<u32>(chunkID));
+	if (m_hunk_cacheable && s_hunk_cache.Lookup(key, dst, hunk_size))
+		return hunk_size;
+
 	chd_error error = chd_read(ChdFile, chunkID, dst);
 	if (error != CHDERR_NONE)
 	{
@@ -181,6 +263,9 @@ int ChdFileReader::ReadChunk(void* dst, s64 chunkID)
 		return 0;
 	}
 
+	if (m_hunk_cacheable)
+		s_hunk_cache.Insert(key, dst, hunk_size);
+
 	return hunk_size;
 }
 
@@ -201,4 +286,6 @@ ChdFileReader::ChdFileReader(void)
 {
 	m_blocksize = 2048;
 	ChdFile = NULL;
+	m_sha1 = {};
+	m_hunk_cacheable = false;
 };
@@ -16,6 +16,7 @@
 #pragma once
 #include "ThreadedFileReader.h"
 #include "libchdr/chd.h"
+#include <array>
 #include <vector>
 
 class ChdFileReader : public ThreadedFileReader
@@ -40,4 +41,8 @@ private:
 	u64 file_size;
 	u32 hunk_size;
 	std::vector<std::FILE*> m_files;
+	/// SHA1 of the image's data, used as the key into the decoded hunk cache, which is
+	/// shared by every CHD reader in the process. Zero when the image has no SHA1.
+	std::array<u8, CHD_SHA1_BYTES> m_sha1;
+	bool m_hunk_cacheable;
 };
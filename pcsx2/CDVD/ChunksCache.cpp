@@ -24,19 +24,23 @@ void ChunksCache::SetLimit(uint megabytes)
 
 void ChunksCache::MatchLimit(bool removeAll)
 {
-	std::list<CacheEntry*>::reverse_iterator rit;
 	while (!m_entries.empty() && (removeAll || m_size > m_limit))
 	{
-		rit = m_entries.rbegin();
-		m_size -= (*rit)->size;
-		delete (*rit);
+		CacheEntry& e = m_entries.back();
+		m_size -= e.size;
+		m_index.erase(e.index);
 		m_entries.pop_back();
 	}
+
+	if (m_entries.empty())
+		m_maxCoverage = 0;
 }
 
 void ChunksCache::Take(void* pMallocedSrc, s64 offset, int length, int coverage)
 {
-	m_entries.push_front(new CacheEntry(pMallocedSrc, offset, length, coverage));
+	m_entries.emplace_front(pMallocedSrc, offset, length, coverage);
+	m_entries.front().index = m_index.emplace(offset, m_entries.begin());
+	m_maxCoverage = std::max(m_maxCoverage, coverage);
 	m_size += length;
 	MatchLimit();
 }
@@ -44,15 +48,25 @@ void ChunksCache::Take(void* pMallocedSrc, s64 offset, int length, int coverage)
 // By design, succeed only if the entire request is in a single cached chunk
 int ChunksCache::Read(void* pDest, s64 offset, int length)
 {
-	for (auto it = m_entries.begin(); it != m_entries.end(); it++)
+	// Only entries starting at most m_maxCoverage bytes before the request can contain it.
+	const s64 earliest = offset + length - m_maxCoverage;
+	for (auto it = m_index.upper_bound(offset); it != m_index.begin();)
 	{
-		CacheEntry* e = *it;
-		if (e && offset >= e->offset && (offset + length) <= (e->offset + e->coverage))
+		--it;
+		if (it->first < earliest)
+			break;
+
+		const EntryList::iterator entry = it->second;
+		CacheEntry& e = *entry;
+		if ((offset + length) <= (e.offset + e.coverage))
 		{
-			if (it != m_entries.begin())
-				m_entries.splice(m_entries.begin(), m_entries, it); // Move to top (MRU)
-			return CopyAvailable(e->data, e->offset, e->size, pDest, offset, length);
+			if (entry != m_entries.begin())
+				m_entries.splice(m_entries.begin(), m_entries, entry); // Move to top (MRU)
+			m_hits++;
+			return CopyAvailable(e.data, e.offset, e.size, pDest, offset, length);
 		}
 	}
+
+	m_misses++;
 	return -1;
 }
@@ -17,20 +17,30 @@
 
 #include "zlib_indexed.h"
 
+#include <list>
+#include <map>
+
 class ChunksCache
 {
 public:
 	ChunksCache(uint initialLimitMb)
-		: m_entries(0)
-		, m_size(0)
+		: m_size(0)
 		, m_limit(initialLimitMb * 1024 * 1024){};
 	~ChunksCache() { Clear(); };
 	void SetLimit(uint megabytes);
-	void Clear() { MatchLimit(true); };
+	void Clear()
+	{
+		MatchLimit(true);
+		m_hits = 0;
+		m_misses = 0;
+	};
 
 	void Take(void* pMallocedSrc, s64 offset, int length, int coverage);
 	int Read(void* pDest, s64 offset, int length);
 
+	u64 GetHits() const { return m_hits; }
+	u64 GetMisses() const { return m_misses; }
+
 	static int CopyAvailable(void* pSrc, s64 srcOffset, int srcSize,
 							 void* pDst, s64 dstOffset, int maxCopySize)
 	{
@@ -40,6 +50,10 @@ public:
 	};
 
 private:
+	class CacheEntry;
+	using EntryList = std::list<CacheEntry>;
+	using OffsetIndex = std::multimap<s64, EntryList::iterator>;
+
 	class CacheEntry
 	{
 	public:
@@ -49,6 +63,9 @@ private:
 			, coverage(coverage)
 			, size(length){};
 
+		CacheEntry(const CacheEntry&) = delete;
+		CacheEntry& operator=(const CacheEntry&) = delete;
+
 		~CacheEntry()
 		{
 			if (data)
@@ -59,10 +76,20 @@ private:
 		s64 offset;
 		int coverage;
 		int size;
+		OffsetIndex::iterator index;
 	};
 
-	std::list<CacheEntry*> m_entries;
+	/// Most recently used entry first
+	EntryList m_entries;
+	/// Entries keyed by start offset, for lookups without walking the LRU list
+	OffsetIndex m_index;
+	/// Largest coverage of any entry taken so far, bounds how far back a lookup has to look
+	int m_maxCoverage = 0;
+
 	void MatchLimit(bool removeAll = false);
 	s64 m_size;
 	s64 m_limit;
+
+	u64 m_hits = 0;
+	u64 m_misses = 0;
 };
@@ -27,23 +27,93 @@
 
 // Implementation of CSO compressed ISO reading, based on:
 // https://github.com/unknownbrackets/maxcso/blob/master/README_CSO.md
-struct CsoHeader
-{
-	u8 magic[4];
-	u32 header_size;
-	u64 total_bytes;
-	u32 frame_size;
-	u8 ver;
-	u8 align;
-	u8 reserved[2];
-};
+// ZSO uses the same container with raw LZ4 blocks instead of deflate:
+// https://github.com/unknownbrackets/maxcso/blob/master/README_ZSO.md
 
 static const u32 CSO_READ_BUFFER_SIZE = 256 * 1024;
 
+static bool IsZsoMagic(const u8* magic)
+{
+	return magic[0] == 'Z' && magic[1] == 'I' && magic[2] == 'S' && magic[3] == 'O';
+}
+
+// Decompresses a raw LZ4 block (no frame header) until `dst` is full.
+// ZSO frames are padded to the index alignment, so the end of the input can't be used as a terminator.
+static int LZ4DecompressFrame(const u8* src, u32 srcSize, u8* dst, u32 dstSize)
+{
+	const u8* ip = src;
+	const u8* const iend = src + srcSize;
+	u8* op = dst;
+	u8* const oend = dst + dstSize;
+
+	while (op < oend)
+	{
+		if (ip >= iend)
+			return -1;
+
+		const u8 token = *ip++;
+
+		u32 literals = token >> 4;
+		if (literals == 15)
+		{
+			u8 b;
+			do
+			{
+				if (ip >= iend)
+					return -1;
+				b = *ip++;
+				literals += b;
+			} while (b == 255);
+		}
+
+		if (literals > static_cast<u32>(iend - ip) || literals > static_cast<u32>(oend - op))
+			return -1;
+		std::memcpy(op, ip, literals);
+		ip += literals;
+		op += literals;
+
+		// The last sequence is literals only.
+		if (op == oend)
+			break;
+
+		if (iend - ip < 2)
+			return -1;
+		const u32 offset = ip[0] | (static_cast<u32>(ip[1]) << 8);
+		ip += 2;
+		if (offset == 0 || offset > static_cast<u32>(op - dst))
+			return -1;
+
+		u32 length = token & 15;
+		if (length == 15)
+		{
+			u8 b;
+			do
+			{
+				if (ip >= iend)
+					return -1;
+				b = *ip++;
+				length += b;
+			} while (b == 255);
+		}
+		length += 4;
+
+		if (length > static_cast<u32>(oend - op))
+			return -1;
+
+		// Matches may overlap the output, so this has to go byte by byte.
+		const u8* match = op - offset;
+		for (u32 i = 0; i < length; i++)
+			op[i] = match[i];
+		op += length;
+	}
+
+	return static_cast<int>(op - dst);
+}
+
 bool CsoFileReader::CanHandle(const std::string& fileName, const std::string& displayName)
 {
 	bool supported = false;
-	if (StringUtil::EndsWith(displayName, ".cso"))
+	if (StringUtil::EndsWith(displayName, ".cso") || StringUtil::EndsWith(displayName, ".zso"))
 	{
 		FILE* fp = FileSystem::OpenCFile(fileName.c_str(), "rb");
 		CsoHeader hdr;
@@ -61,7 +131,8 @@ bool CsoFileReader::CanHandle(const std::string& fileName, const std::string& di
 
 bool CsoFileReader::ValidateHeader(const CsoHeader& hdr)
 {
-	if (hdr.magic[0] != 'C' || hdr.magic[1] != 'I' || hdr.magic[2] != 'S' || hdr.magic[3] != 'O')
+	const bool is_cso = (hdr.magic[0] == 'C' && hdr.magic[1] == 'I' && hdr.magic[2] == 'S' && hdr.magic[3] == 'O');
+	if (!is_cso && !IsZsoMagic(hdr.magic))
 	{
 		// Invalid magic, definitely a bad file.
 		return false;
@@ -122,6 +193,7 @@ bool CsoFileReader::ReadFileHeader()
 		return false;
 	}
 
+	m_useLZ4 = IsZsoMagic(hdr.magic);
 	m_frameSize = hdr.frame_size;
 	// Determine the translation from bytes to frame.
 	m_frameShift = 0;
@@ -160,6 +232,9 @@ bool CsoFileReader::InitializeBuffers()
 		return false;
 	}
 
+	if (m_useLZ4)
+		return true;
+
 	m_z_stream = new z_stream;
 	m_z_stream->zalloc = Z_NULL;
 	m_z_stream->zfree = Z_NULL;
@@ -176,6 +251,7 @@ bool CsoFileReader::InitializeBuffers()
 void CsoFileReader::Close2()
 {
 	m_filename.clear();
+	m_useLZ4 = false;
 
 	if (m_src)
 	{
@@ -253,6 +329,17 @@ int CsoFileReader::ReadChunk(void *dst, s64 chunkID)
 		// This is because the index positions must be aligned.
 		const u32 readRawBytes = fread(m_readBuffer, 1, frameRawSize, m_src);
 
+		if (m_useLZ4)
+		{
+			const int decompressed = LZ4DecompressFrame(m_readBuffer, readRawBytes, static_cast<u8*>(dst), m_frameSize);
+			if (decompressed != static_cast<int>(m_frameSize))
+			{
+				Console.Error("Unable to decompress ZSO frame using LZ4.");
+				return 0;
+			}
+			return m_frameSize;
+		}
+
 		m_z_stream->next_in = m_readBuffer;
 		m_z_stream->avail_in = readRawBytes;
 		m_z_stream->next_out = static_cast<Bytef*>(dst);
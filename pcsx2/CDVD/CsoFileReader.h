@@ -27,7 +27,17 @@
 #include "ThreadedFileReader.h"
 #include "ChunksCache.h"
 
-struct CsoHeader;
+struct CsoHeader
+{
+	u8 magic[4];
+	u32 header_size;
+	u64 total_bytes;
+	u32 frame_size;
+	u8 ver;
+	u8 align;
+	u8 reserved[2];
+};
+
 typedef struct z_stream_s z_stream;
 
 static const uint CSO_CHUNKCACHE_SIZE_MB = 200;
@@ -46,6 +56,7 @@ public:
 		, m_totalSize(0)
 		, m_src(0)
 		, m_z_stream(0)
+		, m_useLZ4(false)
 	{
 		m_blocksize = 2048;
 	};
@@ -82,4 +93,6 @@ private:
 	// The actual source cso file handle.
 	FILE* m_src;
 	z_stream* m_z_stream;
+	// True for ZSO images, which use LZ4 instead of deflate.
+	bool m_useLZ4;
 };
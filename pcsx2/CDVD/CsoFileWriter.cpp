@@ -0,0 +1,222 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "CsoFileWriter.h"
+#include "CsoFileReader.h"
+
+#include "common/Align.h"
+#include "common/FileSystem.h"
+#include "common/ProgressCallback.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#ifdef __POSIX__
+#include <zlib.h>
+#else
+#include <zlib/zlib.h>
+#endif
+
+// Frames handed to each thread per batch. Keeps the batch buffer at a few MB per core.
+static constexpr u32 CSO_FRAMES_PER_THREAD = 16;
+
+// Returns false when the frame doesn't shrink, in which case it's stored uncompressed.
+static bool DeflateFrame(z_stream* zs, const u8* src, u32 size, std::vector<u8>& dst)
+{
+	dst.resize(size);
+
+	deflateReset(zs);
+	zs->next_in = const_cast<Bytef*>(src);
+	zs->avail_in = size;
+	zs->next_out = dst.data();
+	zs->avail_out = size;
+
+	if (deflate(zs, Z_FINISH) != Z_STREAM_END || zs->total_out >= size)
+		return false;
+
+	dst.resize(zs->total_out);
+	return true;
+}
+
+bool CsoFileWriter::CompressIso(const std::string& input, const std::string& output, u32 frame_size, int level, ProgressCallback* progress)
+{
+	if (!progress)
+		progress = ProgressCallback::NullProgressCallback;
+
+	if (frame_size < 2048 || (frame_size & (frame_size - 1)) != 0)
+	{
+		progress->DisplayFormattedError("Invalid CSO frame size %u.", frame_size);
+		return false;
+	}
+
+	auto in = FileSystem::OpenManagedCFile(input.c_str(), "rb");
+	if (!in)
+	{
+		progress->DisplayFormattedError("Failed to open '%s'.", input.c_str());
+		return false;
+	}
+
+	const s64 input_size = FileSystem::FSize64(in.get());
+	if (input_size <= 0)
+	{
+		progress->DisplayFormattedError("'%s' is empty.", input.c_str());
+		return false;
+	}
+
+	const u32 num_frames = static_cast<u32>((input_size + frame_size - 1) / frame_size);
+	const u64 data_start = sizeof(CsoHeader) + (static_cast<u64>(num_frames) + 1) * sizeof(u32);
+
+	// Index entries only have 31 bits, so shift them until the worst case (nothing compresses,
+	// plus alignment padding after every frame) still fits.
+	u8 align = 0;
+	while (((data_start + static_cast<u64>(num_frames) * frame_size + (static_cast<u64>(num_frames) << align)) >> align) >= 0x80000000u)
+		align++;
+
+	auto out = FileSystem::OpenManagedCFile(output.c_str(), "wb");
+	if (!out)
+	{
+		progress->DisplayFormattedError("Failed to create '%s'.", output.c_str());
+		return false;
+	}
+
+	CsoHeader hdr = {};
+	std::memcpy(hdr.magic, "CISO", sizeof(hdr.magic));
+	hdr.header_size = sizeof(CsoHeader);
+	hdr.total_bytes = static_cast<u64>(input_size);
+	hdr.frame_size = frame_size;
+	hdr.ver = 1;
+	hdr.align = align;
+
+	// The index is written again once the frame positions are known.
+	std::vector<u32> index(num_frames + 1);
+	if (std::fwrite(&hdr, sizeof(hdr), 1, out.get()) != 1 ||
+		std::fwrite(index.data(), sizeof(u32), index.size(), out.get()) != index.size())
+	{
+		progress->DisplayFormattedError("Failed to write to '%s'.", output.c_str());
+		return false;
+	}
+
+	const u32 alignment = 1u << align;
+	static constexpr u8 padding[2048] = {};
+	const auto write_padding = [&out](u64 bytes) {
+		while (bytes > 0)
+		{
+			const size_t count = static_cast<size_t>(std::min<u64>(bytes, sizeof(padding)));
+			if (std::fwrite(padding, count, 1, out.get()) != 1)
+				return false;
+			bytes -= count;
+		}
+		return true;
+	};
+
+	u64 pos = Common::AlignUp(data_start, alignment);
+	if (!write_padding(pos - data_start))
+	{
+		progress->DisplayFormattedError("Failed to write to '%s'.", output.c_str());
+		return false;
+	}
+
+	const u32 thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+	const u32 batch_frames = thread_count * CSO_FRAMES_PER_THREAD;
+
+	std::vector<z_stream> streams(thread_count);
+	for (z_stream& zs : streams)
+	{
+		zs = {};
+		deflateInit2(&zs, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+	}
+
+	std::vector<u8> raw(static_cast<size_t>(batch_frames) * frame_size);
+	std::vector<std::vector<u8>> packed(batch_frames);
+	std::vector<u8> is_packed(batch_frames);
+
+	progress->SetProgressRange(num_frames);
+	progress->SetProgressValue(0);
+
+	bool result = true;
+	for (u32 first = 0; first < num_frames && result; first += batch_frames)
+	{
+		if (progress->IsCancelled())
+		{
+			result = false;
+			break;
+		}
+
+		const u32 count = std::min(batch_frames, num_frames - first);
+		const size_t batch_bytes = static_cast<size_t>(count) * frame_size;
+		const size_t expected = static_cast<size_t>(std::min<u64>(batch_bytes, input_size - static_cast<u64>(first) * frame_size));
+		if (std::fread(raw.data(), 1, expected, in.get()) != expected)
+		{
+			progress->DisplayFormattedError("Failed to read from '%s'.", input.c_str());
+			result = false;
+			break;
+		}
+
+		// The reader always inflates whole frames, so the last one gets zero padded.
+		std::fill(raw.begin() + expected, raw.begin() + batch_bytes, 0);
+
+		std::atomic<u32> next_frame{0};
+		std::vector<std::thread> workers;
+		workers.reserve(thread_count);
+		for (u32 t = 0; t < thread_count; t++)
+		{
+			workers.emplace_back([&, t]() {
+				for (u32 i = next_frame++; i < count; i = next_frame++)
+					is_packed[i] = DeflateFrame(&streams[t], &raw[static_cast<size_t>(i) * frame_size], frame_size, packed[i]);
+			});
+		}
+		for (std::thread& worker : workers)
+			worker.join();
+
+		for (u32 i = 0; i < count; i++)
+		{
+			const u8* data = is_packed[i] ? packed[i].data() : &raw[static_cast<size_t>(i) * frame_size];
+			const u32 size = is_packed[i] ? static_cast<u32>(packed[i].size()) : frame_size;
+
+			index[first + i] = static_cast<u32>(pos >> align) | (is_packed[i] ? 0u : 0x80000000u);
+
+			const u64 next_pos = Common::AlignUp(pos + size, alignment);
+			if (std::fwrite(data, size, 1, out.get()) != 1 || !write_padding(next_pos - (pos + size)))
+			{
+				progress->DisplayFormattedError("Failed to write to '%s'.", output.c_str());
+				result = false;
+				break;
+			}
+
+			pos = next_pos;
+		}
+
+		progress->SetProgressValue(first + count);
+	}
+
+	for (z_stream& zs : streams)
+		deflateEnd(&zs);
+
+	if (!result)
+		return false;
+
+	index[num_frames] = static_cast<u32>(pos >> align);
+	if (FileSystem::FSeek64(out.get(), sizeof(CsoHeader), SEEK_SET) != 0 ||
+		std::fwrite(index.data(), sizeof(u32), index.size(), out.get()) != index.size() ||
+		std::fflush(out.get()) != 0)
+	{
+		progress->DisplayFormattedError("Failed to write to '%s'.", output.c_str());
+		return false;
+	}
+
+	return true;
+}
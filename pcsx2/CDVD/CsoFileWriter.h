@@ -0,0 +1,32 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+
+class ProgressCallback;
+
+namespace CsoFileWriter
+{
+	/// Each frame is one ThreadedFileReader chunk, so 16KB keeps its eight buffers
+	/// useful for read-ahead while compressing much better than single sectors.
+	static constexpr u32 DEFAULT_FRAME_SIZE = 16 * 1024;
+	static constexpr int DEFAULT_LEVEL = 9;
+
+	/// Compresses an ISO to a CSOv1 file readable by CsoFileReader, deflating frames on all cores.
+	bool CompressIso(const std::string& input, const std::string& output, u32 frame_size = DEFAULT_FRAME_SIZE,
+		int level = DEFAULT_LEVEL, ProgressCallback* progress = nullptr);
+} // namespace CsoFileWriter
@@ -14,10 +14,15 @@
 */
 
 #include "PrecompiledHeader.h"
+#include <algorithm>
 #include <fstream>
+#include <memory>
+#include <thread>
 #include "common/FileSystem.h"
 #include "common/Path.h"
+#include "common/ProgressCallback.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
 #include "Config.h"
 #include "ChunksCache.h"
 #include "GzippedFileReader.h"
@@ -193,8 +198,7 @@ static std::string iso2indexname(const std::string& isoname)
 
 
 GzippedFileReader::GzippedFileReader(void)
-	: mBytesRead(0)
-	, m_pIndex(0)
+	: m_pIndex(0)
 	, m_zstates(0)
 	, m_src(0)
 	, m_cache(GZFILE_CACHE_SIZE_MB)
@@ -332,36 +336,125 @@ bool GzippedFileReader::OkIndex()
 	// No valid index file. Generate an index
 	Console.Warning("This may take a while (but only once). Scanning compressed file to generate a quick access index...");
 
-	Access* index;
-	FILE* infile = FileSystem::OpenCFile(m_filename.c_str(), "rb");
-	int len = build_index(infile, GZFILE_SPAN_DEFAULT, &index);
-	printf("\n"); // build_index prints progress without \n's
-	fclose(infile);
+	m_pIndex = BuildIndex(m_filename, indexfile, nullptr, nullptr);
+	InitZstates();
+	return (m_pIndex != nullptr);
+}
 
-	if (len >= 0)
+Access* GzippedFileReader::BuildIndex(const std::string& filename, const std::string& indexfile,
+	std::atomic<s64>* progress, const std::atomic_bool* cancel)
+{
+	auto infile = FileSystem::OpenManagedCFile(filename.c_str(), "rb");
+	if (!infile)
 	{
-		m_pIndex = index;
-		WriteIndexToFile((Access*)m_pIndex, indexfile.c_str());
+		Console.Error("ERROR: Can't open '%s' to generate a gzip index", filename.c_str());
+		return nullptr;
 	}
-	else
+
+	Access* index = nullptr;
+	const int len = build_index(infile.get(), GZFILE_SPAN_DEFAULT, &index, progress, cancel);
+	if (!progress)
+		printf("\n"); // build_index prints progress without \n's
+
+	if (len < 0 || !index)
 	{
-		Console.Error("ERROR (%d): Index could not be generated for file '%s'", len, m_filename.c_str());
-		free_index(index);
-		InitZstates();
-		return false;
+		// build_index() releases its partial index on failure
+		if (!cancel || !cancel->load(std::memory_order_relaxed))
+			Console.Error("ERROR (%d): Index could not be generated for file '%s'", len, filename.c_str());
+		return nullptr;
 	}
 
-	InitZstates();
-	return true;
+	WriteIndexToFile(index, indexfile.c_str());
+	return index;
+}
+
+void GzippedFileReader::GenerateIndexes(const std::vector<std::string>& files, ProgressCallback* progress)
+{
+	struct Job
+	{
+		std::string filename;
+		std::string indexfile;
+		s64 size;
+		std::atomic<s64> done{0};
+	};
+
+	std::vector<std::unique_ptr<Job>> jobs;
+	s64 total_size = 0;
+	for (const std::string& filename : files)
+	{
+		std::string indexfile(iso2indexname(filename));
+		const s64 size = FileSystem::GetPathFileSize(filename.c_str());
+		if (indexfile.empty() || size <= 0 || FileSystem::FileExists(indexfile.c_str()))
+			continue;
+
+		std::unique_ptr<Job> job = std::make_unique<Job>();
+		job->filename = filename;
+		job->indexfile = std::move(indexfile);
+		job->size = size;
+		total_size += size;
+		jobs.push_back(std::move(job));
+	}
+	if (jobs.empty())
+		return;
+
+	// Decompression is CPU bound, but too many concurrent streams just thrash the disk.
+	const u32 num_threads = std::clamp<u32>(std::thread::hardware_concurrency(), 1u, std::min<u32>(static_cast<u32>(jobs.size()), 4u));
+	const u32 total_mb = static_cast<u32>(total_size / _1mb);
+
+	progress->PushState();
+	progress->SetFormattedStatusText("Generating gzip index for %zu file(s)...", jobs.size());
+	progress->SetProgressRange(std::max(total_mb, 1u));
+	progress->SetProgressValue(0);
+
+	std::atomic_bool cancel{false};
+	std::atomic<size_t> next_job{0};
+	std::atomic<u32> finished_threads{0};
+	std::vector<std::thread> threads;
+	threads.reserve(num_threads);
+	for (u32 i = 0; i < num_threads; i++)
+	{
+		threads.emplace_back([&jobs, &cancel, &next_job, &finished_threads]() {
+			size_t job_index;
+			while (!cancel.load(std::memory_order_relaxed) && (job_index = next_job.fetch_add(1)) < jobs.size())
+			{
+				Job& job = *jobs[job_index];
+				Access* index = BuildIndex(job.filename, job.indexfile, &job.done, &cancel);
+				if (index)
+					free_index(index);
+				job.done.store(job.size, std::memory_order_relaxed);
+			}
+			finished_threads.fetch_add(1, std::memory_order_release);
+		});
+	}
+
+	// ProgressCallback isn't thread safe, so only this thread reports.
+	while (finished_threads.load(std::memory_order_acquire) != num_threads)
+	{
+		if (progress->IsCancelled())
+			cancel.store(true, std::memory_order_relaxed);
+
+		s64 done = 0;
+		for (const std::unique_ptr<Job>& job : jobs)
+			done += job->done.load(std::memory_order_relaxed);
+		progress->SetProgressValue(static_cast<u32>(done / _1mb));
+
+		Threading::Sleep(100);
+	}
+
+	for (std::thread& thread : threads)
+		thread.join();
+
+	progress->SetProgressValue(std::max(total_mb, 1u));
+	progress->PopState();
 }
 
-bool GzippedFileReader::Open(std::string fileName)
+bool GzippedFileReader::Open2(std::string fileName)
 {
-	Close();
+	Close2();
 	m_filename = std::move(fileName);
 	if (!(m_src = FileSystem::OpenCFile(m_filename.c_str(), "rb")) || !OkIndex())
 	{
-		Close();
+		Close2();
 		return false;
 	};
 
@@ -369,33 +462,41 @@ bool GzippedFileReader::Open(std::string fileName)
 	return true;
 };
 
-void GzippedFileReader::BeginRead(void* pBuffer, uint sector, uint count)
+ThreadedFileReader::Chunk GzippedFileReader::ChunkForOffset(u64 offset)
 {
-	// No a-sync support yet, implement as sync
-	mBytesRead = ReadSync(pBuffer, sector, count);
-	return;
-};
+	Chunk chunk = {0};
+	const u64 size = m_pIndex ? static_cast<u64>(m_pIndex->uncompressed_size) : 0;
+	if (offset >= size)
+	{
+		chunk.chunkID = -1;
+	}
+	else
+	{
+		chunk.chunkID = offset / GZFILE_READ_CHUNK_SIZE;
+		chunk.offset = static_cast<u64>(chunk.chunkID) * GZFILE_READ_CHUNK_SIZE;
+		chunk.length = static_cast<u32>(std::min<u64>(GZFILE_READ_CHUNK_SIZE, size - chunk.offset));
+	}
+	return chunk;
+}
 
-int GzippedFileReader::FinishRead(void)
+int GzippedFileReader::ReadChunk(void* dst, s64 chunkID)
 {
-	int res = mBytesRead;
-	mBytesRead = -1;
-	return res;
-};
+	if (chunkID < 0)
+		return -1;
 
-#define PTT clock_t
-#define NOW() (clock() / (CLOCKS_PER_SEC / 1000))
+	const Chunk chunk = ChunkForOffset(static_cast<u64>(chunkID) * GZFILE_READ_CHUNK_SIZE);
+	if (chunk.chunkID < 0)
+		return -1;
 
-int GzippedFileReader::ReadSync(void* pBuffer, uint sector, uint count)
-{
-	s64 offset = (s64)sector * m_blocksize + m_dataoffset;
-	int bytesToRead = count * m_blocksize;
-	int res = _ReadSync(pBuffer, offset, bytesToRead);
+	const int res = _ReadSync(dst, chunk.offset, chunk.length);
 	if (res < 0)
 		Console.Error("Error: iso-gzip read unsuccessful.");
 	return res;
 }
 
+#define PTT clock_t
+#define NOW() (clock() / (CLOCKS_PER_SEC / 1000))
+
 // If we have a valid and adequate zstate for this span, use it, else, use the index
 s64 GzippedFileReader::GetOptimalExtractionStart(s64 offset)
 {
@@ -503,7 +604,7 @@ int GzippedFileReader::_ReadSync(void* pBuffer, s64 offset, uint bytesToRead)
 	return copied;
 }
 
-void GzippedFileReader::Close()
+void GzippedFileReader::Close2()
 {
 	m_filename.clear();
 	if (m_pIndex)
@@ -513,6 +614,12 @@ void GzippedFileReader::Close()
 	}
 
 	InitZstates(); // results in delete because no index
+
+	if (m_cache.GetHits() || m_cache.GetMisses())
+	{
+		DevCon.WriteLn("gunzip: chunk cache %llu hits, %llu misses",
+					   (unsigned long long)m_cache.GetHits(), (unsigned long long)m_cache.GetMisses());
+	}
 	m_cache.Clear();
 
 	if (m_src)
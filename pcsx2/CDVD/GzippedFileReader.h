@@ -17,44 +17,51 @@
 
 typedef struct zstate Zstate;
 
-#include "AsyncFileReader.h"
+#include "ThreadedFileReader.h"
 #include "ChunksCache.h"
 #include "zlib_indexed.h"
 
+#include <atomic>
+#include <string>
+#include <vector>
+
+class ProgressCallback;
+
 #define GZFILE_SPAN_DEFAULT (1048576L * 4)  /* distance between direct access points when creating a new index */
 #define GZFILE_READ_CHUNK_SIZE (256 * 1024) /* zlib extraction chunks size (at 0-based boundaries) */
 #define GZFILE_CACHE_SIZE_MB 200            /* cache size for extracted data. must be at least GZFILE_READ_CHUNK_SIZE (in MB)*/
 
-class GzippedFileReader : public AsyncFileReader
+// Decompression runs on the ThreadedFileReader thread, one GZFILE_READ_CHUNK_SIZE chunk at a
+// time. Chunks extracted on the way from an index access point are kept in m_cache.
+class GzippedFileReader : public ThreadedFileReader
 {
 	DeclareNoncopyableObject(GzippedFileReader);
 
 public:
 	GzippedFileReader(void);
 
-	virtual ~GzippedFileReader(void) { Close(); };
+	~GzippedFileReader(void) { Close(); };
 
 	static bool CanHandle(const std::string& fileName, const std::string& displayName);
-	virtual bool Open(std::string fileName);
 
-	virtual int ReadSync(void* pBuffer, uint sector, uint count);
+	/// Generates and saves the quick access index of every file which doesn't have one yet.
+	/// Several files are indexed concurrently. Called from the game list scan, so that
+	/// opening the images later doesn't have to stall on the index.
+	static void GenerateIndexes(const std::vector<std::string>& files, ProgressCallback* progress);
+	bool Open2(std::string fileName) override;
 
-	virtual void BeginRead(void* pBuffer, uint sector, uint count);
-	virtual int FinishRead(void);
-	virtual void CancelRead(void){};
+	Chunk ChunkForOffset(u64 offset) override;
+	int ReadChunk(void* dst, s64 chunkID) override;
 
-	virtual void Close(void);
+	void Close2(void) override;
 
-	virtual uint GetBlockCount(void) const
+	uint GetBlockCount(void) const override
 	{
 		// type and formula copied from FlatFileReader
 		// FIXME? : Shouldn't it be uint and (size - m_dataoffset) / m_blocksize ?
 		return (int)((m_pIndex ? m_pIndex->uncompressed_size : 0) / m_blocksize);
 	};
 
-	virtual void SetBlockSize(uint bytes) { m_blocksize = bytes; }
-	virtual void SetDataOffset(int bytes) { m_dataoffset = bytes; }
-
 private:
 	class Czstate
 	{
@@ -71,11 +78,12 @@ private:
 	};
 
 	bool OkIndex(); // Verifies that we have an index, or try to create one
+	static Access* BuildIndex(const std::string& filename, const std::string& indexfile,
+		std::atomic<s64>* progress, const std::atomic_bool* cancel);
 	s64 GetOptimalExtractionStart(s64 offset);
 	int _ReadSync(void* pBuffer, s64 offset, uint bytesToRead);
 	void InitZstates();
 
-	int mBytesRead;   // Temp sync read result when simulating async read
 	Access* m_pIndex; // Quick access index
 	Czstate* m_zstates;
 	FILE* m_src;
@@ -16,6 +16,8 @@
 
 #include "PrecompiledHeader.h"
 #include "IsoFileFormats.h"
+#include "BlockdumpFileReader.h"
+#include "MultipartFileReader.h"
 #include "common/Assertions.h"
 #include "common/Exceptions.h"
 #include "Config.h"
@@ -84,6 +86,11 @@ void InputIsoFile::BeginRead2(uint lsn)
 		m_read_count = std::min(ReadUnit, m_blocks - m_read_lsn);
 	}
 
+	// Memory mapped images are read in place, no need for the intermediate buffer.
+	m_read_ptr = m_reader->GetBlockPointer(m_read_lsn, m_read_count);
+	if (m_read_ptr)
+		return;
+
 	m_reader->BeginRead(m_readbuffer, m_read_lsn, m_read_count);
 	m_read_inprogress = true;
 }
@@ -149,7 +156,8 @@ int InputIsoFile::FinishRead3(u8* dst, uint mode)
 	length = end - _offset;
 
 	uint read_offset = (m_current_lsn - m_read_lsn) * m_blocksize;
-	memcpy(dst + diff, m_readbuffer + ndiff + read_offset, length);
+	const u8* src = m_read_ptr ? m_read_ptr : m_readbuffer;
+	memcpy(dst + diff, src + ndiff + read_offset, length);
 
 	if (m_type == ISOTYPE_CD && diff >= 12)
 	{
@@ -185,6 +193,7 @@ void InputIsoFile::_init()
 	ReadUnit = 0;
 	m_current_lsn = -1;
 	m_read_lsn = -1;
+	m_read_ptr = nullptr;
 	m_reader = NULL;
 }
 
@@ -216,14 +225,34 @@ bool InputIsoFile::Open(std::string srcfile, bool testOnly)
 	// If it wasn't compressed, let's open it has a FlatFileReader.
 	if (!isCompressed)
 	{
-		// Allow write sharing of the iso based on the ini settings.
-		// Mostly useful for romhacking, where the disc is frequently
-		// changed and the emulator would block modifications
-		m_reader = new FlatFileReader(EmuConfig.CdvdShareWrite);
+#ifndef _WIN32
+		// Map the image when nobody else is expected to modify it, falling back to
+		// regular reads if it can't be mapped.
+		if (!EmuConfig.CdvdShareWrite)
+		{
+			m_reader = new MappedFileReader();
+			if (!m_reader->Open(m_filename))
+			{
+				delete m_reader;
+				m_reader = nullptr;
+			}
+		}
+
+		if (!m_reader)
+#endif
+		{
+			// Allow write sharing of the iso based on the ini settings.
+			// Mostly useful for romhacking, where the disc is frequently
+			// changed and the emulator would block modifications
+			m_reader = new FlatFileReader(EmuConfig.CdvdShareWrite);
+			if (!m_reader->Open(m_filename))
+				return false;
+		}
 	}
-
-	if (!m_reader->Open(m_filename))
+	else if (!m_reader->Open(m_filename))
+	{
 		return false;
+	}
 
 	// It might actually be a blockdump file.
 	// Check that before continuing with the FlatFileReader.
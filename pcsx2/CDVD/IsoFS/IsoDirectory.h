@@ -16,7 +16,11 @@
 #pragma once
 
 #include "common/Pcsx2Defs.h"
+#include <memory>
+#include <mutex>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 enum IsoFS_Type
@@ -25,11 +29,40 @@ enum IsoFS_Type
 	FStype_Joliet = 2,
 };
 
+// Parsed directory contents, with file names hashed for lookup.
+struct IsoDirectoryListing
+{
+	std::vector<IsoFileDescriptor> files;
+	std::unordered_map<std::string, u32> index;
+};
+
+// Parsed directories of one image, keyed by the LBA of each directory's extent, so that
+// resolving SYSTEM.CNF, the boot ELF and other paths doesn't re-read and re-parse the
+// directory sectors every time.
+class IsoDirectoryCache
+{
+public:
+	std::shared_ptr<const IsoDirectoryListing> Find(u32 lba);
+	void Insert(u32 lba, std::shared_ptr<const IsoDirectoryListing> listing);
+
+	bool GetRoot(IsoFileDescriptor* root, IsoFS_Type* fstype);
+	void SetRoot(const IsoFileDescriptor& root, IsoFS_Type fstype);
+
+	void Clear();
+
+private:
+	std::mutex m_mutex;
+	std::unordered_map<u32, std::shared_ptr<const IsoDirectoryListing>> m_listings;
+	IsoFileDescriptor m_root;
+	IsoFS_Type m_root_fstype = FStype_ISO9660;
+	bool m_has_root = false;
+};
+
 class IsoDirectory
 {
 public:
 	SectorSource& internalReader;
-	std::vector<IsoFileDescriptor> files;
+	std::shared_ptr<const IsoDirectoryListing> m_listing;
 	IsoFS_Type m_fstype;
 
 public:
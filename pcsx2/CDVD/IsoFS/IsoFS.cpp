@@ -48,6 +48,45 @@ std::string IsoDirectory::FStype_ToString() const
 	return StringUtil::StdStringFromFormat("Unrecognized Code (0x%x)", m_fstype);
 }
 
+std::shared_ptr<const IsoDirectoryListing> IsoDirectoryCache::Find(u32 lba)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto it = m_listings.find(lba);
+	return (it != m_listings.end()) ? it->second : nullptr;
+}
+
+void IsoDirectoryCache::Insert(u32 lba, std::shared_ptr<const IsoDirectoryListing> listing)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_listings.emplace(lba, std::move(listing));
+}
+
+bool IsoDirectoryCache::GetRoot(IsoFileDescriptor* root, IsoFS_Type* fstype)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!m_has_root)
+		return false;
+
+	*root = m_root;
+	*fstype = m_root_fstype;
+	return true;
+}
+
+void IsoDirectoryCache::SetRoot(const IsoFileDescriptor& root, IsoFS_Type fstype)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_root = root;
+	m_root_fstype = fstype;
+	m_has_root = true;
+}
+
+void IsoDirectoryCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_listings.clear();
+	m_has_root = false;
+}
+
 // Used to load the Root directory from an image
 IsoDirectory::IsoDirectory(SectorSource& r)
 	: internalReader(r)
@@ -59,6 +98,13 @@ IsoDirectory::IsoDirectory(SectorSource& r)
 
 	m_fstype = FStype_ISO9660;
 
+	IsoDirectoryCache* cache = internalReader.getDirectoryCache();
+	if (cache && cache->GetRoot(&rootDirEntry, &m_fstype))
+	{
+		Init(rootDirEntry);
+		return;
+	}
+
 	while (!done)
 	{
 		u8 sector[2048];
@@ -108,6 +154,9 @@ IsoDirectory::IsoDirectory(SectorSource& r)
 			.SetDiagMsg("IsoFS could not find the root directory on the ISO image.");
 
 	DevCon.WriteLn("(IsoFS) Filesystem is %s", FStype_ToString().c_str());
+	if (cache)
+		cache->SetRoot(rootDirEntry, m_fstype);
+
 	Init(rootDirEntry);
 }
 
@@ -121,10 +170,14 @@ IsoDirectory::IsoDirectory(SectorSource& r, IsoFileDescriptor directoryEntry)
 
 void IsoDirectory::Init(const IsoFileDescriptor& directoryEntry)
 {
+	IsoDirectoryCache* cache = internalReader.getDirectoryCache();
+	if (cache && (m_listing = cache->Find(directoryEntry.lba)))
+		return;
+
 	// parse directory sector
 	IsoFile dataStream(internalReader, directoryEntry);
 
-	files.clear();
+	std::shared_ptr<IsoDirectoryListing> listing = std::make_shared<IsoDirectoryListing>();
 
 	uint remainingSize = directoryEntry.size;
 
@@ -143,24 +196,32 @@ void IsoDirectory::Init(const IsoFileDescriptor& directoryEntry)
 
 		dataStream.read(b + 1, b[0] - 1);
 
-		files.push_back(IsoFileDescriptor(b, b[0]));
+		listing->files.push_back(IsoFileDescriptor(b, b[0]));
 	}
 
 	b[0] = 0;
+
+	// first entry wins for duplicate names, same as the scan this replaced
+	listing->index.reserve(listing->files.size());
+	for (u32 i = 0; i < static_cast<u32>(listing->files.size()); i++)
+		listing->index.emplace(listing->files[i].name, i);
+
+	if (cache)
+		cache->Insert(directoryEntry.lba, listing);
+
+	m_listing = std::move(listing);
 }
 
 const IsoFileDescriptor& IsoDirectory::GetEntry(int index) const
 {
-	return files[index];
+	return m_listing->files[index];
 }
 
 int IsoDirectory::GetIndexOf(const std::string_view& fileName) const
 {
-	for (unsigned int i = 0; i < files.size(); i++)
-	{
-		if (files[i].name == fileName)
-			return i;
-	}
+	auto it = m_listing->index.find(std::string(fileName));
+	if (it != m_listing->index.end())
+		return static_cast<int>(it->second);
 
 	throw Exception::FileNotFound(std::string(fileName));
 }
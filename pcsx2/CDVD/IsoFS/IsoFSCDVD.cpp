@@ -16,9 +16,13 @@
 
 #include "PrecompiledHeader.h"
 
+#include "IsoFS.h"
 #include "IsoFSCDVD.h"
 #include "CDVD/CDVDcommon.h"
 
+// Shared by every IsoFSCDVD, they all read the disc currently in the CDVD source.
+static IsoDirectoryCache s_directory_cache;
+
 IsoFSCDVD::IsoFSCDVD()
 {
 }
@@ -35,3 +39,13 @@ int IsoFSCDVD::getNumSectors()
 
 	return td.lsn;
 }
+
+IsoDirectoryCache* IsoFSCDVD::getDirectoryCache()
+{
+	return &s_directory_cache;
+}
+
+void IsoFSCDVD::ClearDirectoryCache()
+{
+	s_directory_cache.Clear();
+}
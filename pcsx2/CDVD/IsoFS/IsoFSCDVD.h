@@ -28,4 +28,9 @@ public:
 	virtual bool readSector(unsigned char* buffer, int lba);
 
 	virtual int getNumSectors();
+
+	virtual IsoDirectoryCache* getDirectoryCache();
+
+	// Drops the parsed directories, call whenever the disc may have changed.
+	static void ClearDirectoryCache();
 };
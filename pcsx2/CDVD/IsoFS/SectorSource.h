@@ -15,10 +15,14 @@
 
 #pragma once
 
+class IsoDirectoryCache;
+
 class SectorSource
 {
 public:
 	virtual int getNumSectors() = 0;
 	virtual bool readSector(unsigned char* buffer, int lba) = 0;
+	// Sources whose contents stay the same between lookups can keep parsed directories here.
+	virtual IsoDirectoryCache* getDirectoryCache() { return nullptr; }
 	virtual ~SectorSource() = default;
 };
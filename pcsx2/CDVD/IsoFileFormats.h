@@ -63,6 +63,7 @@ protected:
 	bool m_read_inprogress;
 	uint m_read_lsn;
 	uint m_read_count;
+	const u8* m_read_ptr; // m_read_lsn in the reader's mapping, used instead of m_readbuffer when set
 	u8 m_readbuffer[MaxReadUnit * CD_FRAMESIZE_RAW];
 
 public:
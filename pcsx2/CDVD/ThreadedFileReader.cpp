@@ -17,11 +17,15 @@
 #include "ThreadedFileReader.h"
 
 #include "common/Threading.h"
+#include "Config.h"
 
 // Make sure buffer size is bigger than the cutoff where PCSX2 emulates a seek
 // If buffers are smaller than that, we can't keep up with linear reads
 static constexpr u32 MINIMUM_SIZE = 128 * 1024;
 
+// Gaps larger than this between equally spaced requests are treated as seeks, not a stride
+static constexpr u32 MAXIMUM_STRIDE = 1024 * 1024;
+
 ThreadedFileReader::ThreadedFileReader()
 {
 	m_readThread = std::thread([](ThreadedFileReader* r){ r->Loop(); }, this);
@@ -74,6 +78,7 @@ void ThreadedFileReader::Loop()
 
 		u64 requestOffset;
 		u32 requestSize;
+		u32 readaheadStride;
 
 		bool ok = true;
 		m_running = true;
@@ -83,6 +88,7 @@ void ThreadedFileReader::Loop()
 			void* ptr = m_requestPtr.load(std::memory_order_acquire);
 			requestOffset = m_requestOffset;
 			requestSize = m_requestSize;
+			readaheadStride = m_readaheadStride;
 			lock.unlock();
 
 			if (ptr)
@@ -104,7 +110,7 @@ void ThreadedFileReader::Loop()
 		if (ok)
 		{
 			// Readahead
-			Chunk chunk = ChunkForOffset(requestOffset + requestSize);
+			Chunk chunk = ChunkForOffset(requestOffset + requestSize + readaheadStride);
 			if (chunk.chunkID >= 0)
 			{
 				int buffersFilled = 0;
@@ -119,7 +125,7 @@ void ThreadedFileReader::Loop()
 					if (buf->offset + bufsize != chunk.offset || chunk.length + bufsize > buf->cap)
 					{
 						buffersFilled++;
-						if (buffersFilled >= 2)
+						if (buffersFilled >= static_cast<int>(m_bufferCount))
 							break;
 						buf = GetBlockPtr(chunk);
 					}
@@ -148,13 +154,13 @@ void ThreadedFileReader::Loop()
 
 ThreadedFileReader::Buffer* ThreadedFileReader::GetBlockPtr(const Chunk& block)
 {
-	for (int i = 0; i < static_cast<int>(std::size(m_buffer)); i++)
+	for (int i = 0; i < static_cast<int>(m_bufferCount); i++)
 	{
 		u32 size = m_buffer[i].size.load(std::memory_order_relaxed);
 		u64 offset = m_buffer[i].offset;
 		if (size && offset <= block.offset && offset + size >= block.offset + block.length)
 		{
-			m_nextBuffer = (i + 1) % std::size(m_buffer);
+			m_nextBuffer = (i + 1) % m_bufferCount;
 			return m_buffer + i;
 		}
 	}
@@ -180,7 +186,7 @@ ThreadedFileReader::Buffer* ThreadedFileReader::GetBlockPtr(const Chunk& block)
 	{
 		buf.offset = block.offset;
 		buf.size.store(size, std::memory_order_release);
-		m_nextBuffer = (m_nextBuffer + 1) % std::size(m_buffer);
+		m_nextBuffer = (m_nextBuffer + 1) % m_bufferCount;
 		return &buf;
 	}
 	return nullptr;
@@ -231,9 +237,9 @@ bool ThreadedFileReader::TryCachedRead(void*& buffer, u64& offset, u32& size, co
 	m_amtRead = 0;
 	u64 end = 0;
 	bool allDone = false;
-	for (int i = 0; i < static_cast<int>(std::size(m_buffer) * 2); i++)
+	for (int i = 0; i < static_cast<int>(m_bufferCount * 2); i++)
 	{
-		Buffer& buf = m_buffer[i % std::size(m_buffer)];
+		Buffer& buf = m_buffer[i % m_bufferCount];
 		u32 bufsize = buf.size.load(std::memory_order_acquire);
 		if (!bufsize)
 			continue;
@@ -256,9 +262,33 @@ bool ThreadedFileReader::TryCachedRead(void*& buffer, u64& offset, u32& size, co
 	return allDone;
 }
 
+void ThreadedFileReader::TrackRequest(u64 offset, u32 size)
+{
+	// Two equal forward gaps in a row look like a strided read, so the next request
+	// will most likely start the same distance past the end of this one.
+	const s64 gap = static_cast<s64>(offset) - static_cast<s64>(m_lastRequestEnd);
+	if (gap > 0 && gap <= MAXIMUM_STRIDE && gap == m_lastRequestGap)
+		m_readaheadStride = static_cast<u32>(gap);
+	else
+		m_readaheadStride = 0;
+
+	m_lastRequestGap = gap;
+	m_lastRequestEnd = offset + size;
+}
+
 bool ThreadedFileReader::Open(std::string fileName)
 {
 	CancelAndWaitUntilStopped();
+
+	m_bufferCount = std::clamp<u32>(EmuConfig.CdvdReadaheadBuffers, 2, MAX_BUFFERS);
+	m_nextBuffer = 0;
+	for (auto& buf : m_buffer)
+		buf.size.store(0, std::memory_order_relaxed);
+
+	m_lastRequestEnd = 0;
+	m_lastRequestGap = 0;
+	m_readaheadStride = 0;
+
 	return Open2(std::move(fileName));
 }
 
@@ -269,6 +299,7 @@ int ThreadedFileReader::ReadSync(void* pBuffer, uint sector, uint count)
 	u32 size = count * blocksize;
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
+		TrackRequest(offset, size);
 		if (TryCachedRead(pBuffer, offset, size, l))
 			return m_amtRead;
 
@@ -323,6 +354,7 @@ void ThreadedFileReader::BeginRead(void* pBuffer, uint sector, uint count)
 	u32 size = count * blocksize;
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
+		TrackRequest(offset, size);
 		if (TryCachedRead(pBuffer, offset, size, l))
 			return;
 		if (size == 0)
@@ -363,11 +395,16 @@ void ThreadedFileReader::CancelRead(void)
 		m_condition.wait(lock);
 }
 
-void ThreadedFileReader::Close(void)
+void ThreadedFileReader::DiscardBuffers(void)
 {
 	CancelAndWaitUntilStopped();
 	for (auto& buf : m_buffer)
 		buf.size.store(0, std::memory_order_relaxed);
+}
+
+void ThreadedFileReader::Close(void)
+{
+	DiscardBuffers();
 	Close2();
 }
 
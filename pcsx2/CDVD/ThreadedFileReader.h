@@ -53,6 +53,9 @@ protected:
 	ThreadedFileReader();
 	~ThreadedFileReader();
 
+	/// Drop everything in the readahead buffers, for readers whose offsets depend on the block size
+	void DiscardBuffers(void);
+
 private:
 	int m_amtRead;
 	/// Pointer to read into
@@ -73,10 +76,21 @@ private:
 		std::atomic<u32> size{0};
 		u32 cap = 0;
 	};
-	/// 2 buffers for readahead (current block, next block)
-	Buffer m_buffer[2];
+	/// Upper limit for the configurable readahead window
+	static constexpr u32 MAX_BUFFERS = 8;
+	/// Buffers for readahead (current block, next blocks), only the first `m_bufferCount` are used
+	Buffer m_buffer[MAX_BUFFERS];
+	u32 m_bufferCount = 2;
 	u32 m_nextBuffer = 0;
 
+	/// End offset of the previous request, used to detect the access pattern
+	u64 m_lastRequestEnd = 0;
+	/// Gap between the previous request and the one before it
+	s64 m_lastRequestGap = 0;
+	/// Bytes to skip past the end of the current request before reading ahead
+	/// Nonzero when the game is reading with a constant stride (e.g. interleaved streams)
+	u32 m_readaheadStride = 0;
+
 	std::thread m_readThread;
 	std::mutex m_mtx;
 	std::condition_variable m_condition;
@@ -102,6 +116,8 @@ private:
 	bool Decompress(void* ptr, u64 offset, u32 size);
 	/// Cancel any inflight read and wait until the thread is no longer doing anything
 	void CancelAndWaitUntilStopped(void);
+	/// Update the access pattern predictor with a new request, call with `m_mtx` held
+	void TrackRequest(u64 offset, u32 size);
 	/// Attempt to read from the cache
 	/// Adjusts pointer, offset, and size if successful
 	/// Returns true if no additional reads are necessary
@@ -114,6 +130,6 @@ public:
 	int FinishRead(void) final override;
 	void CancelRead(void) final override;
 	void Close(void) final override;
-	void SetBlockSize(uint bytes) final override;
-	void SetDataOffset(int bytes) final override;
+	void SetBlockSize(uint bytes) override;
+	void SetDataOffset(int bytes) override;
 };
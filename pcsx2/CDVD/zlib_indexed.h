@@ -107,6 +107,7 @@ Comments) 1950 to 1952 in the files http://tools.ietf.org/html/rfc1950
 #endif
 
 #include "common/FileSystem.h"
+#include <atomic>
 
 #define local static
 
@@ -222,8 +223,12 @@ local struct access* addpoint(struct access* index, int bits,
    of the first zlib or gzip stream in the file is ignored.  build_index()
    returns the number of access points on success (>= 1), Z_MEM_ERROR for out
    of memory, Z_DATA_ERROR for an error in the input file, or Z_ERRNO for a
-   file read error.  On success, *built points to the resulting index. */
-local int build_index(FILE* in, s64 span, struct access** built)
+   file read error.  On success, *built points to the resulting index.
+   If progress is given, the number of compressed bytes consumed so far is
+   published through it instead of being printed, and a set cancel flag aborts
+   the build with Z_ERRNO. */
+local int build_index(FILE* in, s64 span, struct access** built,
+					  std::atomic<s64>* progress = nullptr, const std::atomic_bool* cancel = nullptr)
 {
 	int ret;
 	s64 totin, totout, totPrinted; /* our own total counters to avoid 4GB limit */
@@ -311,7 +316,16 @@ local int build_index(FILE* in, s64 span, struct access** built)
 				last = totout;
 			}
 		} while (strm.avail_in != 0);
-		if (totin / (50 * 1024 * 1024) != totPrinted / (50 * 1024 * 1024))
+		if (cancel && cancel->load(std::memory_order_relaxed))
+		{
+			ret = Z_ERRNO;
+			goto build_index_error;
+		}
+		if (progress)
+		{
+			progress->store(totin, std::memory_order_relaxed);
+		}
+		else if (totin / (50 * 1024 * 1024) != totPrinted / (50 * 1024 * 1024))
 		{
 			printf("%dMB ", (int)(totin / (1024 * 1024)));
 			totPrinted = totin;
@@ -161,11 +161,34 @@ namespace
 
 	static Cache cache;
 
+	// Hit/miss counters per 256MB segment of the EE virtual address space, reported on reset.
+	struct CacheStats
+	{
+		u64 hits[16];
+		u64 misses[16];
+		u64 writebacks;
+	};
+
+	static CacheStats stats;
+
 }
 
 void resetCache()
 {
+	for (int i = 0; i < 16; i++)
+	{
+		const u64 total = stats.hits[i] + stats.misses[i];
+		if (total == 0)
+			continue;
+
+		DevCon.WriteLn("EE Cache: segment %x0000000: %llu accesses, %.2f%% hits", i, static_cast<unsigned long long>(total),
+			static_cast<double>(stats.hits[i]) * 100.0 / static_cast<double>(total));
+	}
+	if (stats.writebacks)
+		DevCon.WriteLn("EE Cache: %llu line writebacks", static_cast<unsigned long long>(stats.writebacks));
+
 	memzero(cache);
+	memzero(stats);
 }
 
 static bool findInCache(const CacheSet& set, uptr ppf, int* way)
@@ -195,6 +218,7 @@ static int getFreeCache(u32 mem, int* way)
 
 	if (findInCache(set, ppf, way))
 	{
+		stats.hits[mem >> 28]++;
 		if (set.tags[*way].isLocked())
 			CACHE_LOG("Index %x Way %x Locked!!", setIdx, *way);
 	}
@@ -204,6 +228,9 @@ static int getFreeCache(u32 mem, int* way)
 		*way = newWay;
 		CacheLine line = cache.lineAt(setIdx, newWay);
 
+		stats.misses[mem >> 28]++;
+		if (line.tag.isDirtyAndValid())
+			stats.writebacks++;
 		line.writeBackIfNeeded();
 		line.load(ppf);
 		line.tag.toggleLRF();
@@ -59,6 +59,7 @@ enum SpeedhackId
 	Speedhack_mvuFlag = SpeedhackId_FIRST,
 	Speedhack_InstantVU1,
 	Speedhack_MTVU,
+	Speedhack_InstantVU0,
 
 	SpeedhackId_COUNT
 };
@@ -373,7 +374,12 @@ struct Pcsx2Config
 			PreBlockCheckEE : 1,
 			PreBlockCheckIOP : 1;
 		bool
-			EnableEECache : 1;
+			EnableEECache : 1,
+			EnableEEBlockList : 1,
+			EnableEEBlockProfile : 1,
+			EnableIOPBlockList : 1;
+		bool
+			EEPipelineStalls : 1; // Charge HI/LO interlock stalls instead of flat mult/div costs
 		BITFIELD_END
 
 		RecompilerOptions();
@@ -446,8 +452,10 @@ struct Pcsx2Config
 					DisableShaderCache : 1,
 					DisableDualSourceBlend : 1,
 					DisableFramebufferFetch : 1,
+					AsyncPipelineCompilation : 1,
 					ThreadedPresentation : 1,
 					SkipDuplicateFrames : 1,
+					FrameLimiterLowLatency : 1,
 					OsdShowMessages : 1,
 					OsdShowSpeed : 1,
 					OsdShowFPS : 1,
@@ -462,10 +470,12 @@ struct Pcsx2Config
 					AccurateDATE : 1,
 					GPUPaletteConversion : 1,
 					AutoFlushSW : 1,
+					SWTileBinning : 1,
 					PreloadFrameWithGSData : 1,
 					WrapGSMem : 1,
 					Mipmap : 1,
 					PointListPalette : 1,
+					DynamicResolution : 1,
 					ManualUserHacks : 1,
 					UserHacks_AlignSpriteX : 1,
 					UserHacks_AutoFlush : 1,
@@ -535,10 +545,13 @@ struct Pcsx2Config
 		int Dithering{2};
 		int MaxAnisotropy{0};
 		int SWExtraThreads{2};
-		int SWExtraThreadsHeight{4};
+		int SWExtraThreadsHeight{0};
+		int TextureCacheBudget{0}; // MB, 0 for no limit
+		int TextureReplacementCacheBudget{0}; // MB of decoded replacements kept in memory, 0 for no limit
 		int TVShader{0};
 		int SkipDrawStart{0};
 		int SkipDrawEnd{0};
+		int FrameSkip{0}; // frames skipped after each drawn one, hardware renderers only
 
 		int UserHacks_HalfBottomOverride{-1};
 		int UserHacks_HalfPixelOffset{0};
@@ -836,11 +849,14 @@ struct Pcsx2Config
 			WaitLoop : 1, // enables constant loop detection and fast-forwarding
 			vuFlagHack : 1, // microVU specific flag hack
 			vuThread : 1, // Enable Threaded VU1
-			vu1Instant : 1; // Enable Instant VU1 (Without MTVU only)
+			vuThreadSpin : 1, // Spin before sleeping in MTVU waits when recent waits were short
+			vu1Instant : 1, // Enable Instant VU1 (Without MTVU only)
+			vu0Instant : 1; // Run VU0 micro programs to completion when started, off by default (GameDB only)
 		BITFIELD_END
 
 		s8 EECycleRate; // EE cycle rate selector (1.0, 1.5, 2.0)
 		u8 EECycleSkip; // EE Cycle skip factor (0, 1, 2, or 3)
+		u8 vuThreadRingSize; // MTVU ring buffer size in MB, applied on the next reset
 
 		SpeedhackOptions();
 		void LoadSave(SettingsWrapper& conf);
@@ -850,7 +866,7 @@ struct Pcsx2Config
 
 		bool operator==(const SpeedhackOptions& right) const
 		{
-			return OpEqu(bitset) && OpEqu(EECycleRate) && OpEqu(EECycleSkip);
+			return OpEqu(bitset) && OpEqu(EECycleRate) && OpEqu(EECycleSkip) && OpEqu(vuThreadRingSize);
 		}
 
 		bool operator!=(const SpeedhackOptions& right) const
@@ -956,9 +972,13 @@ struct Pcsx2Config
 #endif
 		// when enabled uses BOOT2 injection, skipping sony bios splashes
 		UseBOOT2Injection : 1,
+		// on fast boot, restores a cached snapshot of the machine taken when the BIOS handed over to EELOAD
+		UseBootSnapshot : 1,
 		PatchBios : 1,
 		BackupSavestate : 1,
 		SavestateZstdCompression : 1,
+		// keeps a ring of in-memory snapshots which the rewind hotkey steps back through
+		EnableRewind : 1,
 		// enables simulated ejection of memory cards when loading savestates
 		McdEnableEjection : 1,
 		McdFolderAutoManage : 1,
@@ -995,6 +1015,11 @@ struct Pcsx2Config
 	// slots (3 each)
 	McdOptions Mcd[8];
 	std::string GzipIsoIndexTemplate; // for quick-access index with gzipped ISO
+	u32 CdvdReadaheadBuffers; // number of decompressed chunk buffers kept for readahead on compressed images
+	u32 RewindSaveFrequency; // frames between rewind snapshots
+	u32 RewindBufferSize; // memory budget for rewind snapshots, in megabytes
+	u32 RunAheadFrames; // frames emulated ahead of the displayed one to hide input latency, 0 to disable
+	std::string MetricsExportPath; // Prometheus text file rewritten with the performance metrics, relative to the data folder
 
 	// Set at runtime, not loaded from config.
 	std::string CurrentBlockdump;
@@ -1063,6 +1088,7 @@ namespace EmuFolders
 
 #define THREAD_VU1 (EmuConfig.Cpu.Recompiler.EnableVU1 && EmuConfig.Speedhacks.vuThread)
 #define INSTANT_VU1 (EmuConfig.Speedhacks.vu1Instant)
+#define INSTANT_VU0 (EmuConfig.Speedhacks.vu0Instant)
 #define CHECK_EEREC (EmuConfig.Cpu.Recompiler.EnableEE)
 #define CHECK_CACHE (EmuConfig.Cpu.Recompiler.EnableEECache)
 #define CHECK_IOPREC (EmuConfig.Cpu.Recompiler.EnableIOP)
@@ -570,6 +570,15 @@ static __fi void frameLimit()
 		return;
 	}
 
+#ifdef PCSX2_CORE
+	// Run-ahead frames share the real frame's time slot, only the real one is paced.
+	if (VMManager::Internal::IsRunningAhead())
+	{
+		frameLimitUpdateCore();
+		return;
+	}
+#endif
+
 	const u64 uExpectedEnd = m_iStart + m_iTicks;  // Compute when we would expect this frame to end, assuming everything goes perfectly perfect.
 	const u64 iEnd = GetCPUTicks();                // The current tick we actually stopped on.
 	const s64 sDeltaTime = iEnd - uExpectedEnd;    // The diff between when we stopped and when we expected to.
@@ -620,8 +629,19 @@ static __fi void VSyncStart(u32 sCycle)
 	PAD::Update();
 #endif
 
-	frameLimit(); // limit FPS
-	gsPostVsyncStart(); // MUST be after framelimit; doing so before causes funk with frame times!
+	// Low latency mode hands the finished frame to the GS before sleeping off the rest of the
+	// frame time, then polls input and starts the next frame. Presents follow emulation time
+	// instead of the limiter, so pacing is less even, but the frame no longer waits out the sleep.
+	if (EmuConfig.GS.FrameLimiterLowLatency)
+	{
+		gsPostVsyncStart();
+		frameLimit();
+	}
+	else
+	{
+		frameLimit(); // limit FPS
+		gsPostVsyncStart(); // MUST be after framelimit; doing so before causes funk with frame times!
+	}
 
 	if(EmuConfig.Trace.Enabled && EmuConfig.Trace.EE.m_EnableAll)
 		SysTrace.EE.Counters.Write( "    ================  EE COUNTER VSYNC START (frame: %d)  ================", g_FrameCount );
@@ -133,6 +133,17 @@ private:
 	u8* readBuffer = nullptr;
 	//Read Buffer
 
+	//Read Ahead
+	//Sequential reads also fetch the sectors after the request,
+	//so the next read can be served without waiting on the host
+	static constexpr int readAheadSectors = 256;
+	static constexpr int readAheadBufferSectors = 256 + readAheadSectors;
+	u8* readAheadBuffer = nullptr;
+	s64 readAheadLBA = -1;
+	int readAheadCount = 0;
+	s64 lastReadEndLBA = -1;
+	//Read Ahead
+
 	//PIO Buffer
 	int pioPtr;
 	int pioEnd;
@@ -41,6 +41,10 @@ int ATA::Open(const std::string& hddPath)
 {
 	readBufferLen = 256 * 512;
 	readBuffer = new u8[readBufferLen];
+	readAheadBuffer = new u8[readAheadBufferSectors * 512];
+	readAheadLBA = -1;
+	readAheadCount = 0;
+	lastReadEndLBA = -1;
 
 	CreateHDDinfo(EmuConfig.DEV9.HddSizeSectors);
 
@@ -116,6 +120,8 @@ void ATA::Close()
 
 	delete[] readBuffer;
 	readBuffer = nullptr;
+	delete[] readAheadBuffer;
+	readAheadBuffer = nullptr;
 }
 
 void ATA::ResetBegin()
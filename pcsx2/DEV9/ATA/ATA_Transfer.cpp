@@ -75,14 +75,40 @@ void ATA::IO_Read()
 		abort();
 	}
 
-	const u64 pos = lba * 512;
-	if (FileSystem::FSeek64(hddImage, pos, SEEK_SET) != 0 ||
-		std::fread(readBuffer,  512, nsector, hddImage) != static_cast<size_t>(nsector))
+	if (readAheadLBA != -1 && lba >= readAheadLBA && lba + nsector <= readAheadLBA + readAheadCount)
 	{
-		Console.Error("DEV9: ATA: File read error");
-		pxAssert(false);
-		abort();
+		//Already read ahead
+		std::memcpy(readBuffer, &readAheadBuffer[(lba - readAheadLBA) * 512], nsector * 512);
+	}
+	else if (lba == lastReadEndLBA && nsector + readAheadSectors <= readAheadBufferSectors)
+	{
+		//Sequential, fetch the following sectors with this read
+		const int count = static_cast<int>(std::min<s64>(nsector + readAheadSectors, hddImageSize / 512 - lba));
+		const u64 pos = lba * 512;
+		readAheadLBA = -1;
+		if (FileSystem::FSeek64(hddImage, pos, SEEK_SET) != 0 ||
+			std::fread(readAheadBuffer, 512, count, hddImage) != static_cast<size_t>(count))
+		{
+			Console.Error("DEV9: ATA: File read error");
+			pxAssert(false);
+			abort();
+		}
+		readAheadLBA = lba;
+		readAheadCount = count;
+		std::memcpy(readBuffer, readAheadBuffer, nsector * 512);
 	}
+	else
+	{
+		const u64 pos = lba * 512;
+		if (FileSystem::FSeek64(hddImage, pos, SEEK_SET) != 0 ||
+			std::fread(readBuffer, 512, nsector, hddImage) != static_cast<size_t>(nsector))
+		{
+			Console.Error("DEV9: ATA: File read error");
+			pxAssert(false);
+			abort();
+		}
+	}
+	lastReadEndLBA = lba + nsector;
 	{
 		std::lock_guard ioSignallock(ioMutex);
 		ioRead = false;
@@ -99,6 +125,11 @@ bool ATA::IO_Write()
 		return false;
 	}
 
+	//Drop read ahead data this write makes stale
+	if (readAheadLBA != -1 && static_cast<s64>(entry.sector) < readAheadLBA + readAheadCount &&
+		static_cast<s64>(entry.sector + (entry.length + 511) / 512) > readAheadLBA)
+		readAheadLBA = -1;
+
 	if (FileSystem::FSeek64(hddImage, entry.sector * 512, SEEK_SET) != 0 ||
 		std::fwrite(entry.data, entry.length, 1, hddImage) != 1 ||
 		std::fflush(hddImage) != 0)
@@ -121,7 +152,7 @@ void ATA::HDD_ReadAsync(void (ATA::*drqCMD)())
 	nsectorLeft = nsector;
 	if (readBufferLen < nsector * 512)
 	{
-		delete readBuffer;
+		delete[] readBuffer;
 		readBuffer = new u8[nsector * 512];
 		readBufferLen = nsector * 512;
 	}
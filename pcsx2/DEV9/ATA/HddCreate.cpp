@@ -18,6 +18,12 @@
 #include "common/FileSystem.h"
 
 #include <fmt/format.h>
+
+#ifdef _WIN32
+#include "common/RedtapeWindows.h"
+#include <io.h>
+#include <winioctl.h>
+#endif
 #include "HddCreate.h"
 
 void HddCreate::Start()
@@ -29,9 +35,6 @@ void HddCreate::Start()
 
 void HddCreate::WriteImage(std::string hddPath, u64 reqSizeBytes)
 {
-	constexpr int buffsize = 4 * 1024;
-	u8 buff[buffsize] = {0}; //4kb
-
 	if (FileSystem::FileExists(hddPath.c_str()))
 	{
 		errored.store(true);
@@ -47,13 +50,21 @@ void HddCreate::WriteImage(std::string hddPath, u64 reqSizeBytes)
 		return;
 	}
 
-	//Size file
+#ifdef _WIN32
+	// NTFS would otherwise allocate (and zero) the whole image up front.
+	DWORD bytesReturned;
+	DeviceIoControl(reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(newImage.get()))), FSCTL_SET_SPARSE,
+		nullptr, 0, nullptr, 0, &bytesReturned, nullptr);
+#endif
+
+	// Size file. Extending a file reads back as zeros, so there's no need to write out
+	// the whole image, and the sectors only take up space once the PS2 writes to them.
 	const char zero = 0;
 	bool success = FileSystem::FSeek64(newImage.get(), reqSizeBytes - 1, SEEK_SET) == 0;
 	success = success && std::fwrite(&zero, 1, 1, newImage.get()) == 1;
-	success = success && FileSystem::FSeek64(newImage.get(), 0, SEEK_SET) == 0;
+	success = success && std::fflush(newImage.get()) == 0;
 
-	if (!success)
+	if (!success || canceled.load())
 	{
 		newImage.reset();
 		FileSystem::DeleteFilePath(filePath.c_str());
@@ -62,54 +73,7 @@ void HddCreate::WriteImage(std::string hddPath, u64 reqSizeBytes)
 		return;
 	}
 
-	lastUpdate = std::chrono::steady_clock::now();
-
-	//Round up
-	const s32 reqMiB = (reqSizeBytes + ((1024 * 1024) - 1)) / (1024 * 1024);
-	for (s32 iMiB = 0; iMiB < reqMiB; iMiB++)
-	{
-		//Round down
-		const s32 req4Kib = std::min<s32>(1024, (reqSizeBytes / 1024) - (u64)iMiB * 1024) / 4;
-		for (s32 i4kb = 0; i4kb < req4Kib; i4kb++)
-		{
-			if (std::fwrite(buff, buffsize, 1, newImage.get()) != 1)
-			{
-				newImage.reset();
-				FileSystem::DeleteFilePath(filePath.c_str());
-				errored.store(true);
-				SetError();
-				return;
-			}
-		}
-
-		if (req4Kib != 256)
-		{
-			const s32 remainingBytes = reqSizeBytes - (((u64)iMiB) * (1024 * 1024) + req4Kib * 4096);
-			if (std::fwrite(buff, remainingBytes, 1, newImage.get()) != 1)
-			{
-				newImage.reset();
-				FileSystem::DeleteFilePath(filePath.c_str());
-				errored.store(true);
-				SetError();
-				return;
-			}
-		}
-
-		const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
-		if (std::chrono::duration_cast<std::chrono::milliseconds>(now - lastUpdate).count() >= 100 || (iMiB + 1) == reqMiB)
-		{
-			lastUpdate = now;
-			SetFileProgress(static_cast<u64>(FileSystem::FTell64(newImage.get())));
-		}
-		if (canceled.load())
-		{
-			newImage.reset();
-			FileSystem::DeleteFilePath(filePath.c_str());
-			errored.store(true);
-			SetError();
-			return;
-		}
-	}
+	SetFileProgress(reqSizeBytes);
 }
 
 void HddCreate::SetFileProgress(u64 currentSize)
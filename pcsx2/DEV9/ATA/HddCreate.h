@@ -16,7 +16,6 @@
 #pragma once
 
 #include <atomic>
-#include <chrono>
 #include <string>
 
 #include "common/Path.h"
@@ -32,8 +31,6 @@ public:
 private:
 	std::atomic_bool canceled{false};
 
-	std::chrono::steady_clock::time_point lastUpdate;
-
 public:
 	HddCreate(){};
 
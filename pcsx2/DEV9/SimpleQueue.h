@@ -33,6 +33,9 @@ private:
 
 	std::atomic<SimpleQueueEntry*> head{nullptr};
 	SimpleQueueEntry* tail = nullptr;
+	//Last entry freed by the worker thread, reused by the next Enqueue()
+	//so a steady stream of packets doesn't allocate for every entry
+	std::atomic<SimpleQueueEntry*> spare{nullptr};
 
 public:
 	SimpleQueue();
@@ -58,8 +61,12 @@ SimpleQueue<T>::SimpleQueue()
 template <class T>
 void SimpleQueue<T>::Enqueue(T entry)
 {
-	//Allocate Next entry, and assign to head
-	SimpleQueueEntry* newHead = new SimpleQueueEntry();
+	//Allocate Next entry (or reuse a freed one), and assign to head
+	SimpleQueueEntry* newHead = spare.exchange(nullptr);
+	if (newHead == nullptr)
+		newHead = new SimpleQueueEntry();
+	else
+		newHead->ready.store(false);
 	SimpleQueueEntry* newEntry = head.exchange(newHead);
 
 	//Fill in
@@ -80,7 +87,7 @@ bool SimpleQueue<T>::Dequeue(T* entry)
 	tail = retEntry->next;
 
 	*entry = retEntry->value;
-	delete retEntry;
+	delete spare.exchange(retEntry);
 	return true;
 }
 
@@ -111,4 +118,5 @@ SimpleQueue<T>::~SimpleQueue()
 		head = nullptr;
 		tail = nullptr;
 	}
+	delete spare.exchange(nullptr);
 }
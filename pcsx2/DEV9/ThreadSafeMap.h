@@ -78,6 +78,22 @@ public:
 		return keys;
 	}
 
+	//Reuses the vector's storage, for callers that fetch the keys often
+	void GetKeys(std::vector<Key>* keys)
+	{
+#ifdef NO_SHARED_MUTEX
+		std::unique_lock readLock(accessMutex);
+#else
+		std::shared_lock readLock(accessMutex);
+#endif
+
+		keys->clear();
+		keys->reserve(map.size());
+
+		for (auto iter = map.begin(); iter != map.end(); ++iter)
+			keys->push_back(iter->first);
+	}
+
 	//Does not error or insert if no key is found
 	bool TryGetValue(Key key, T* value)
 	{
@@ -89,7 +105,7 @@ public:
 		auto search = map.find(key);
 		if (search != map.end())
 		{
-			*value = map[key];
+			*value = search->second;
 			return true;
 		}
 		else
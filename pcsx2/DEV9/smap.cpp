@@ -98,12 +98,12 @@ void rx_process(NetPacket* pk)
 	}
 
 	int pstart = (dev9.rxfifo_wr_ptr) & 16383;
-	int i = 0;
-	while (i < bytes)
-	{
-		dev9_rxfifo_write(pk->buffer[i++]);
-		dev9.rxfifo_wr_ptr &= 16383;
-	}
+	//copy the frame in at most two chunks, wrapping at the end of the fifo
+	const int first = std::min(bytes, 16384 - pstart);
+	memcpy(&dev9.rxfifo[pstart], pk->buffer, first);
+	if (first < bytes)
+		memcpy(&dev9.rxfifo[0], pk->buffer + first, bytes - first);
+	dev9.rxfifo_wr_ptr = (pstart + bytes) & 16383;
 
 	//increase RXBD
 	std::unique_lock<std::mutex> reset_lock(reset_mutex);
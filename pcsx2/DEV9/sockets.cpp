@@ -308,10 +308,12 @@ bool SocketAdapter::recv(NetPacket* pkt)
 	EthernetFrame* bFrame;
 	if (!vRecBuffer.Dequeue(&bFrame))
 	{
-		std::vector<ConnectionKey> keys = connections.GetKeys();
-		for (size_t i = 0; i < keys.size(); i++)
+		connections.GetKeys(&recvKeys);
+		const size_t count = recvKeys.size();
+		for (size_t i = 0; i < count; i++)
 		{
-			const ConnectionKey key = keys[i];
+			const size_t index = (recvNextSession + i) % count;
+			const ConnectionKey key = recvKeys[index];
 
 			BaseSession* session;
 			if (!connections.TryGetValue(key, &session))
@@ -321,6 +323,8 @@ bool SocketAdapter::recv(NetPacket* pkt)
 
 			if (pl != nullptr)
 			{
+				recvNextSession = index + 1;
+
 				IP_Packet* ipPkt = new IP_Packet(pl);
 				ipPkt->destinationIP = session->sourceIP;
 				ipPkt->sourceIP = session->destIP;
@@ -40,6 +40,10 @@ class SocketAdapter : public NetAdapter
 	ThreadSafeMap<Sessions::ConnectionKey, Sessions::BaseSession*> connections;
 	ThreadSafeMap<u16, Sessions::BaseSession*> fixedUDPPorts;
 
+	//recv() state, the polling order rotates so busy sessions can't starve the rest
+	std::vector<Sessions::ConnectionKey> recvKeys;
+	size_t recvNextSession = 0;
+
 public:
 	SocketAdapter();
 	virtual bool blocks();
@@ -0,0 +1,132 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "Common.h"
+#include "Hardware.h"
+#include "ps2/eeHwTraceLog.inl"
+
+#include "DebugTools/HwProfiler.h"
+#include "DebugTools/SymbolMap.h"
+
+#include "common/FileSystem.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+bool HwProfiler::g_active = false;
+
+namespace HwProfiler
+{
+	struct PCCounts
+	{
+		u64 reads = 0;
+		u64 writes = 0;
+	};
+
+	// keyed on (register << 32) | pc
+	static std::unordered_map<u64, PCCounts> s_counts;
+	static u64 s_total_accesses = 0;
+} // namespace HwProfiler
+
+void HwProfiler::Start()
+{
+	s_counts.clear();
+	s_total_accesses = 0;
+	g_active = true;
+	Console.WriteLn("Hw profiler started.");
+}
+
+void HwProfiler::RecordAccess(u32 addr, u32 size, bool write)
+{
+	// 64/128-bit accesses to FIFOs count once against the FIFO, everything else per 32-bit register.
+	const u32 reg = (size > 4) ? (addr & ~0xfu) : (addr & ~0x3u);
+	PCCounts& counts = s_counts[(static_cast<u64>(reg) << 32) | cpuRegs.pc];
+	if (write)
+		counts.writes++;
+	else
+		counts.reads++;
+	s_total_accesses++;
+}
+
+bool HwProfiler::Stop(const std::string& filename)
+{
+	if (!g_active)
+		return false;
+
+	g_active = false;
+
+	struct RegisterEntry
+	{
+		u32 reg;
+		u64 reads;
+		u64 writes;
+		std::vector<std::pair<u32, u64>> pcs;
+	};
+
+	std::unordered_map<u32, RegisterEntry> registers;
+	for (const auto& [key, counts] : s_counts)
+	{
+		const u32 reg = static_cast<u32>(key >> 32);
+		const u32 pc = static_cast<u32>(key);
+		RegisterEntry& entry = registers.try_emplace(reg, RegisterEntry{reg, 0, 0, {}}).first->second;
+		entry.reads += counts.reads;
+		entry.writes += counts.writes;
+		entry.pcs.emplace_back(pc, counts.reads + counts.writes);
+	}
+	s_counts.clear();
+
+	std::vector<RegisterEntry> sorted;
+	sorted.reserve(registers.size());
+	for (auto& it : registers)
+		sorted.push_back(std::move(it.second));
+	std::sort(sorted.begin(), sorted.end(), [](const RegisterEntry& lhs, const RegisterEntry& rhs) {
+		return (lhs.reads + lhs.writes) > (rhs.reads + rhs.writes);
+	});
+
+	auto fp = FileSystem::OpenManagedCFile(filename.c_str(), "wb");
+	if (!fp)
+	{
+		Console.Error("Failed to open hw profile '%s' for writing.", filename.c_str());
+		return false;
+	}
+
+	std::fprintf(fp.get(), "# EE hardware register accesses: %llu total, PCs are recompiled block starts\n",
+		static_cast<unsigned long long>(s_total_accesses));
+	std::fprintf(fp.get(), "# %-10s %-24s %12s %12s %7s\n", "address", "register", "reads", "writes", "share");
+
+	constexpr u32 MAX_PCS_PER_REGISTER = 8;
+	for (RegisterEntry& entry : sorted)
+	{
+		const char* name = _eelog_GetHwName<u32>(entry.reg, 0);
+		const u64 total = entry.reads + entry.writes;
+		std::fprintf(fp.get(), "0x%08X   %-24s %12llu %12llu %6.2f%%\n", entry.reg, name ? name : "Unknown",
+			static_cast<unsigned long long>(entry.reads), static_cast<unsigned long long>(entry.writes),
+			s_total_accesses ? (static_cast<double>(total) * 100.0 / static_cast<double>(s_total_accesses)) : 0.0);
+
+		std::sort(entry.pcs.begin(), entry.pcs.end(), [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+		const size_t num_pcs = std::min<size_t>(entry.pcs.size(), MAX_PCS_PER_REGISTER);
+		for (size_t i = 0; i < num_pcs; i++)
+		{
+			const u32 pc = entry.pcs[i].first;
+			const std::string label(R5900SymbolMap.GetLabelString(R5900SymbolMap.GetFunctionStart(pc)));
+			std::fprintf(fp.get(), "    pc 0x%08X %-32s %12llu\n", pc, label.c_str(), static_cast<unsigned long long>(entry.pcs[i].second));
+		}
+	}
+
+	Console.WriteLn("Hw profile written to '%s'.", filename.c_str());
+	return true;
+}
@@ -0,0 +1,41 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+#include <string>
+
+// Counts EE hardware register accesses by register and guest PC, for finding out which
+// MMIO accesses a game is hammering. Only touched from the CPU thread.
+namespace HwProfiler
+{
+	extern bool g_active;
+
+	void Start();
+
+	/// Stops counting and writes a report sorted by access count. The guest PC is the
+	/// start of the recompiled block, not the exact instruction doing the access.
+	bool Stop(const std::string& filename);
+
+	void RecordAccess(u32 addr, u32 size, bool write);
+
+	static __fi void Record(u32 addr, u32 size, bool write)
+	{
+		if (unlikely(g_active))
+			RecordAccess(addr, size, write);
+	}
+} // namespace HwProfiler
@@ -21,8 +21,28 @@
 #include "DebugInterface.h"
 #include "R5900.h"
 #include "R5900OpcodeTables.h"
+#include "Config.h"
+
+#include "common/FileSystem.h"
+#include "common/Path.h"
+
+#include "fmt/core.h"
+#include "xxhash.h"
 
 static std::vector<MIPSAnalyst::AnalyzedFunction> functions;
+// Hash of the code the current function list was built from, zero if unknown.
+static u64 functions_hash = 0;
+
+static constexpr u32 FUNCTION_CACHE_SIGNATURE = 0x4E554653; // SFUN
+static constexpr u32 FUNCTION_CACHE_VERSION = 1;
+static constexpr u32 FUNCTION_CACHE_MAX_ENTRIES = 8 * 1024 * 1024;
+
+struct FunctionCacheEntry
+{
+	u32 start;
+	u32 end;
+	u32 isStraightLeaf;
+};
 
 #define MIPS_MAKE_J(addr)   (0x08000000 | ((addr)>>2))
 #define MIPS_MAKE_JAL(addr) (0x0C000000 | ((addr)>>2))
@@ -196,7 +216,77 @@ namespace MIPSAnalyst
 		return furthestJumpbackAddr;
 	}
 
-	void ScanForFunctions(SymbolMap& map, u32 startAddr, u32 endAddr, bool insertSymbols) {
+	static u64 HashCodeRange(u32 startAddr, u32 endAddr) {
+		XXH3_state_t* state = XXH3_createState();
+		XXH3_64bits_reset(state);
+
+		u32 buffer[1024];
+		for (u32 addr = startAddr; addr <= endAddr;) {
+			u32 count = 0;
+			for (; count < std::size(buffer) && addr <= endAddr; count++, addr += 4)
+				buffer[count] = r5900Debug.read32(addr);
+			XXH3_64bits_update(state, buffer, count * sizeof(u32));
+		}
+
+		const u64 hash = XXH3_64bits_digest(state);
+		XXH3_freeState(state);
+		return hash;
+	}
+
+	static std::string GetFunctionCacheFilename(u64 hash) {
+		return Path::Combine(EmuFolders::Cache, fmt::format("functions_{:016X}.bin", hash));
+	}
+
+	static bool ReadFunctionCache(u64 hash, u32 startAddr, u32 endAddr) {
+		auto fp = FileSystem::OpenManagedCFile(GetFunctionCacheFilename(hash).c_str(), "rb");
+		if (!fp)
+			return false;
+
+		u32 header[5];
+		if (std::fread(header, sizeof(header), 1, fp.get()) != 1 || header[0] != FUNCTION_CACHE_SIGNATURE ||
+			header[1] != FUNCTION_CACHE_VERSION || header[2] != startAddr || header[3] != endAddr ||
+			header[4] > FUNCTION_CACHE_MAX_ENTRIES) {
+			return false;
+		}
+
+		std::vector<FunctionCacheEntry> entries(header[4]);
+		if (!entries.empty() && std::fread(entries.data(), sizeof(FunctionCacheEntry), entries.size(), fp.get()) != entries.size())
+			return false;
+
+		functions.clear();
+		functions.reserve(entries.size());
+		for (const FunctionCacheEntry& entry : entries) {
+			AnalyzedFunction func = {entry.start};
+			func.end = entry.end;
+			func.size = entry.end - entry.start + 4;
+			func.isStraightLeaf = entry.isStraightLeaf != 0;
+			functions.push_back(func);
+		}
+
+		return true;
+	}
+
+	static void WriteFunctionCache(u64 hash, u32 startAddr, u32 endAddr) {
+		if (EmuFolders::Cache.empty())
+			return;
+
+		auto fp = FileSystem::OpenManagedCFile(GetFunctionCacheFilename(hash).c_str(), "wb");
+		if (!fp)
+			return;
+
+		std::vector<FunctionCacheEntry> entries;
+		entries.reserve(functions.size());
+		for (const AnalyzedFunction& func : functions)
+			entries.push_back({func.start, func.end, func.isStraightLeaf ? 1u : 0u});
+
+		const u32 header[5] = {FUNCTION_CACHE_SIGNATURE, FUNCTION_CACHE_VERSION, startAddr, endAddr, static_cast<u32>(entries.size())};
+		if (std::fwrite(header, sizeof(header), 1, fp.get()) != 1 ||
+			(!entries.empty() && std::fwrite(entries.data(), sizeof(FunctionCacheEntry), entries.size(), fp.get()) != entries.size())) {
+			Console.Warning("Failed to write function analysis cache");
+		}
+	}
+
+	static void AnalyzeFunctions(SymbolMap& map, u32 startAddr, u32 endAddr) {
 		AnalyzedFunction currentFunction = {startAddr};
 
 		u32 furthestBranch = 0;
@@ -313,11 +403,25 @@ namespace MIPSAnalyst
 		currentFunction.end = addr + 4;
 		functions.push_back(currentFunction);
 
-		for (auto iter = functions.begin(); iter != functions.end(); iter++) {
+		for (auto iter = functions.begin(); iter != functions.end(); iter++)
 			iter->size = iter->end - iter->start + 4;
-			if (insertSymbols) {
+	}
+
+	void ScanForFunctions(SymbolMap& map, u32 startAddr, u32 endAddr, bool insertSymbols) {
+		// The result only depends on the code being scanned, so an executable that was analysed
+		// before (in this session or a previous one) is picked up from the cache instead.
+		const u64 hash = (endAddr > startAddr) ? HashCodeRange(startAddr, endAddr) : 0;
+		if (hash == 0 || (hash != functions_hash && !ReadFunctionCache(hash, startAddr, endAddr))) {
+			AnalyzeFunctions(map, startAddr, endAddr);
+			if (hash != 0)
+				WriteFunctionCache(hash, startAddr, endAddr);
+		}
+		functions_hash = hash;
+
+		if (insertSymbols) {
+			for (auto iter = functions.begin(); iter != functions.end(); iter++) {
 				char temp[256];
-				map.AddFunction(DefaultFunctionName(temp, iter->start), iter->start, iter->end - iter->start + 4);
+				map.AddFunction(DefaultFunctionName(temp, iter->start), iter->start, iter->size);
 			}
 		}
 	}
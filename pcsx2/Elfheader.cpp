@@ -197,11 +197,33 @@ void ElfObject::checkElfSize(s64 elfsize)
 
 u32 ElfObject::getCRC()
 {
-	u32 CRC = 0;
+	// The "CRC" is a plain XOR of every word, so it can be folded 64 bytes at a time.
+	const u8* srcdata = data.GetPtr();
+	u32 words = data.GetSizeInBytes() / 4;
+
+	__m128i acc0 = _mm_setzero_si128();
+	__m128i acc1 = _mm_setzero_si128();
+	__m128i acc2 = _mm_setzero_si128();
+	__m128i acc3 = _mm_setzero_si128();
+	for (; words >= 16; words -= 16, srcdata += 64)
+	{
+		acc0 = _mm_xor_si128(acc0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcdata)));
+		acc1 = _mm_xor_si128(acc1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcdata + 16)));
+		acc2 = _mm_xor_si128(acc2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcdata + 32)));
+		acc3 = _mm_xor_si128(acc3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcdata + 48)));
+	}
+
+	__m128i acc = _mm_xor_si128(_mm_xor_si128(acc0, acc1), _mm_xor_si128(acc2, acc3));
+	acc = _mm_xor_si128(acc, _mm_srli_si128(acc, 8));
+	acc = _mm_xor_si128(acc, _mm_srli_si128(acc, 4));
 
-	const u32* srcdata = (u32*)data.GetPtr();
-	for(u32 i=data.GetSizeInBytes()/4; i; --i, ++srcdata)
-		CRC ^= *srcdata;
+	u32 CRC = static_cast<u32>(_mm_cvtsi128_si32(acc));
+	for (; words; --words, srcdata += 4)
+	{
+		u32 word;
+		std::memcpy(&word, srcdata, sizeof(word));
+		CRC ^= word;
+	}
 
 	return CRC;
 }
@@ -319,6 +319,10 @@ bool D3D11HostDisplay::CreateRenderDevice(const WindowInfo& wi, std::string_view
 			m_allow_tearing_supported = (allow_tearing_supported == TRUE);
 	}
 
+	// Frame latency waitable objects need DXGI 1.3 (Windows 8.1).
+	ComPtr<IDXGIFactory3> dxgi_factory3;
+	m_frame_latency_waitable_supported = SUCCEEDED(m_dxgi_factory.As(&dxgi_factory3));
+
 	m_window_info = wi;
 	m_vsync_mode = vsync;
 
@@ -374,6 +378,10 @@ bool D3D11HostDisplay::CreateSwapChain(const DXGI_MODE_DESC* fullscreen_mode)
 	if (m_using_allow_tearing)
 		swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
 
+	m_using_frame_latency_waitable = (m_frame_latency_waitable_supported && m_using_flip_model_swap_chain && !fullscreen_mode);
+	if (m_using_frame_latency_waitable)
+		swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
 	if (fullscreen_mode)
 	{
 		swap_chain_desc.Flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
@@ -393,6 +401,7 @@ bool D3D11HostDisplay::CreateSwapChain(const DXGI_MODE_DESC* fullscreen_mode)
 		swap_chain_desc.Flags = 0;
 		m_using_flip_model_swap_chain = false;
 		m_using_allow_tearing = false;
+		m_using_frame_latency_waitable = false;
 
 		hr = m_dxgi_factory->CreateSwapChain(m_device.Get(), &swap_chain_desc, m_swap_chain.GetAddressOf());
 		if (FAILED(hr))
@@ -435,6 +444,10 @@ bool D3D11HostDisplay::CreateSwapChain(const DXGI_MODE_DESC* fullscreen_mode)
 	if (m_using_allow_tearing)
 		swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
 
+	m_using_frame_latency_waitable = (m_frame_latency_waitable_supported && m_using_flip_model_swap_chain && !fullscreen_mode);
+	if (m_using_frame_latency_waitable)
+		swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
 	ComPtr<IDXGISwapChain1> swap_chain1;
 	hr = factory2->CreateSwapChainForCoreWindow(m_device.Get(), static_cast<IUnknown*>(m_window_info.window_handle),
 		&swap_chain_desc, nullptr, swap_chain1.GetAddressOf());
@@ -447,9 +460,39 @@ bool D3D11HostDisplay::CreateSwapChain(const DXGI_MODE_DESC* fullscreen_mode)
 	m_swap_chain = swap_chain1;
 #endif
 
+	if (m_using_frame_latency_waitable)
+		CreateFrameLatencyWaitable();
+
 	return CreateSwapChainRTV();
 }
 
+void D3D11HostDisplay::CreateFrameLatencyWaitable()
+{
+	// Only allow a single frame to be queued. BeginPresent() waits on the object, so we block before
+	// rendering the frame instead of inside Present() with a stale frame already submitted.
+	ComPtr<IDXGISwapChain2> swap_chain2;
+	HRESULT hr = m_swap_chain.As(&swap_chain2);
+	if (SUCCEEDED(hr))
+		hr = swap_chain2->SetMaximumFrameLatency(1);
+	if (FAILED(hr))
+	{
+		Console.Warning("Failed to set up frame latency waitable: 0x%08X", hr);
+		m_using_frame_latency_waitable = false;
+		return;
+	}
+
+	m_frame_latency_waitable = swap_chain2->GetFrameLatencyWaitableObject();
+}
+
+void D3D11HostDisplay::DestroyFrameLatencyWaitable()
+{
+	if (!m_frame_latency_waitable)
+		return;
+
+	CloseHandle(m_frame_latency_waitable);
+	m_frame_latency_waitable = nullptr;
+}
+
 bool D3D11HostDisplay::CreateSwapChainRTV()
 {
 	ComPtr<ID3D11Texture2D> backbuffer;
@@ -509,6 +552,7 @@ void D3D11HostDisplay::DestroyRenderSurface()
 		SetFullscreen(false, 0, 0, 0.0f);
 
 	m_swap_chain_rtv.Reset();
+	DestroyFrameLatencyWaitable();
 	m_swap_chain.Reset();
 }
 
@@ -616,8 +660,11 @@ void D3D11HostDisplay::ResizeRenderWindow(s32 new_window_width, s32 new_window_h
 
 	m_swap_chain_rtv.Reset();
 
-	HRESULT hr = m_swap_chain->ResizeBuffers(0, 0, 0, DXGI_FORMAT_UNKNOWN,
-		m_using_allow_tearing ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0);
+	UINT flags = m_using_allow_tearing ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+	if (m_using_frame_latency_waitable)
+		flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
+	HRESULT hr = m_swap_chain->ResizeBuffers(0, 0, 0, DXGI_FORMAT_UNKNOWN, flags);
 	if (FAILED(hr))
 		Console.Error("ResizeBuffers() failed: 0x%08X", hr);
 
@@ -684,6 +731,7 @@ bool D3D11HostDisplay::SetFullscreen(bool fullscreen, u32 width, u32 height, flo
 	}
 
 	m_swap_chain_rtv.Reset();
+	DestroyFrameLatencyWaitable();
 	m_swap_chain.Reset();
 
 	if (!CreateSwapChain(&closest_mode))
@@ -722,6 +770,9 @@ bool D3D11HostDisplay::BeginPresent(bool frame_skip)
 		return false;
 	}
 
+	if (m_frame_latency_waitable)
+		WaitForSingleObjectEx(m_frame_latency_waitable, 1000, TRUE);
+
 	static constexpr std::array<float, 4> clear_color = {};
 	m_context->ClearRenderTargetView(m_swap_chain_rtv.Get(), clear_color.data());
 	m_context->OMSetRenderTargets(1, m_swap_chain_rtv.GetAddressOf(), nullptr);
@@ -85,6 +85,8 @@ protected:
 
 	bool CreateSwapChain(const DXGI_MODE_DESC* fullscreen_mode);
 	bool CreateSwapChainRTV();
+	void CreateFrameLatencyWaitable();
+	void DestroyFrameLatencyWaitable();
 
 	bool CreateTimestampQueries();
 	void DestroyTimestampQueries();
@@ -101,6 +103,9 @@ protected:
 	bool m_allow_tearing_supported = false;
 	bool m_using_flip_model_swap_chain = true;
 	bool m_using_allow_tearing = false;
+	bool m_frame_latency_waitable_supported = false;
+	bool m_using_frame_latency_waitable = false;
+	HANDLE m_frame_latency_waitable = nullptr;
 
 	std::array<std::array<ComPtr<ID3D11Query>, 3>, NUM_TIMESTAMP_QUERIES> m_timestamp_queries = {};
 	u8 m_read_timestamp_query = 0;
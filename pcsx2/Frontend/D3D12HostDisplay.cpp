@@ -195,6 +195,9 @@ bool D3D12HostDisplay::CreateRenderDevice(const WindowInfo& wi, std::string_view
 			m_allow_tearing_supported = (allow_tearing_supported == TRUE);
 	}
 
+	// Frame latency waitable objects need DXGI 1.3 (Windows 8.1).
+	m_frame_latency_waitable_supported = static_cast<bool>(m_dxgi_factory.try_query<IDXGIFactory3>());
+
 	m_window_info = wi;
 
 	if (m_window_info.type != WindowInfo::Type::Surfaceless && !CreateSwapChain(nullptr))
@@ -247,6 +250,10 @@ bool D3D12HostDisplay::CreateSwapChain(const DXGI_MODE_DESC* fullscreen_mode)
 	if (m_using_allow_tearing)
 		swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
 
+	m_using_frame_latency_waitable = (m_frame_latency_waitable_supported && !fullscreen_mode);
+	if (m_using_frame_latency_waitable)
+		swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
 	if (fullscreen_mode)
 	{
 		swap_chain_desc.Flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
@@ -293,6 +300,10 @@ bool D3D12HostDisplay::CreateSwapChain(const DXGI_MODE_DESC* fullscreen_mode)
 	if (m_using_allow_tearing)
 		swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
 
+	m_using_frame_latency_waitable = (m_frame_latency_waitable_supported && !fullscreen_mode);
+	if (m_using_frame_latency_waitable)
+		swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
 	ComPtr<IDXGISwapChain1> swap_chain1;
 	hr = factory2->CreateSwapChainForCoreWindow(g_d3d12_context->GetCommandQueue(),
 		static_cast<IUnknown*>(m_window_info.window_handle), &swap_chain_desc,
@@ -306,9 +317,39 @@ bool D3D12HostDisplay::CreateSwapChain(const DXGI_MODE_DESC* fullscreen_mode)
 	m_swap_chain = swap_chain1;
 #endif
 
+	if (m_using_frame_latency_waitable)
+		CreateFrameLatencyWaitable();
+
 	return CreateSwapChainRTV();
 }
 
+void D3D12HostDisplay::CreateFrameLatencyWaitable()
+{
+	// Only allow a single frame to be queued. BeginPresent() waits on the object, so we block before
+	// rendering the frame instead of inside Present() with a stale frame already submitted.
+	ComPtr<IDXGISwapChain2> swap_chain2;
+	HRESULT hr = m_swap_chain->QueryInterface(IID_PPV_ARGS(swap_chain2.put()));
+	if (SUCCEEDED(hr))
+		hr = swap_chain2->SetMaximumFrameLatency(1);
+	if (FAILED(hr))
+	{
+		Console.Warning("Failed to set up frame latency waitable: 0x%08X", hr);
+		m_using_frame_latency_waitable = false;
+		return;
+	}
+
+	m_frame_latency_waitable = swap_chain2->GetFrameLatencyWaitableObject();
+}
+
+void D3D12HostDisplay::DestroyFrameLatencyWaitable()
+{
+	if (!m_frame_latency_waitable)
+		return;
+
+	CloseHandle(m_frame_latency_waitable);
+	m_frame_latency_waitable = nullptr;
+}
+
 bool D3D12HostDisplay::CreateSwapChainRTV()
 {
 	DXGI_SWAP_CHAIN_DESC swap_chain_desc;
@@ -385,6 +426,7 @@ void D3D12HostDisplay::DestroyRenderSurface()
 		SetFullscreen(false, 0, 0, 0.0f);
 
 	DestroySwapChainRTVs();
+	DestroyFrameLatencyWaitable();
 	m_swap_chain.reset();
 }
 
@@ -488,8 +530,11 @@ void D3D12HostDisplay::ResizeRenderWindow(s32 new_window_width, s32 new_window_h
 
 	DestroySwapChainRTVs();
 
-	HRESULT hr = m_swap_chain->ResizeBuffers(0, 0, 0, DXGI_FORMAT_UNKNOWN,
-		m_using_allow_tearing ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0);
+	UINT flags = m_using_allow_tearing ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+	if (m_using_frame_latency_waitable)
+		flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
+	HRESULT hr = m_swap_chain->ResizeBuffers(0, 0, 0, DXGI_FORMAT_UNKNOWN, flags);
 	if (FAILED(hr))
 		Console.Error("ResizeBuffers() failed: 0x%08X", hr);
 
@@ -557,6 +602,7 @@ bool D3D12HostDisplay::SetFullscreen(bool fullscreen, u32 width, u32 height, flo
 
 	g_d3d12_context->ExecuteCommandList(true);
 	DestroySwapChainRTVs();
+	DestroyFrameLatencyWaitable();
 	m_swap_chain.reset();
 
 	if (!CreateSwapChain(&closest_mode))
@@ -607,6 +653,9 @@ bool D3D12HostDisplay::BeginPresent(bool frame_skip)
 		return false;
 	}
 
+	if (m_frame_latency_waitable)
+		WaitForSingleObjectEx(m_frame_latency_waitable, 1000, TRUE);
+
 	static constexpr std::array<float, 4> clear_color = {};
 	D3D12::Texture& swap_chain_buf = m_swap_chain_buffers[m_current_swap_chain_buffer];
 
@@ -88,6 +88,8 @@ protected:
 
 	bool CreateSwapChain(const DXGI_MODE_DESC* fullscreen_mode);
 	bool CreateSwapChainRTV();
+	void CreateFrameLatencyWaitable();
+	void DestroyFrameLatencyWaitable();
 	void DestroySwapChainRTVs();
 
 	ComPtr<IDXGIFactory> m_dxgi_factory;
@@ -97,4 +99,7 @@ protected:
 
 	bool m_allow_tearing_supported = false;
 	bool m_using_allow_tearing = false;
+	bool m_frame_latency_waitable_supported = false;
+	bool m_using_frame_latency_waitable = false;
+	HANDLE m_frame_latency_waitable = nullptr;
 };
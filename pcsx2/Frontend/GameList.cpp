@@ -30,9 +30,11 @@
 #include <ctime>
 #include <fstream>
 #include <string_view>
+#include <unordered_set>
 #include <utility>
 
 #include "CDVD/CDVD.h"
+#include "CDVD/GzippedFileReader.h"
 #include "Elfheader.h"
 #include "VMManager.h"
 
@@ -52,9 +54,12 @@ namespace GameList
 	static bool GetIsoListEntry(const std::string& path, GameList::Entry* entry);
 
 	static bool GetGameListEntryFromCache(const std::string& path, GameList::Entry* entry);
-	static void ScanDirectory(
-		const char* path, bool recursive, bool only_cache, const std::vector<std::string>& excluded_paths, ProgressCallback* progress);
-	static bool AddFileFromCache(const std::string& path, std::time_t timestamp);
+	static void ScanDirectory(const char* path, bool recursive, bool only_cache, const FileSystem::FindResultsArray& files,
+		const std::vector<std::string>& excluded_paths, ProgressCallback* progress);
+	static bool IsCacheEntryCurrent(const GameList::Entry& entry, std::time_t timestamp, s64 size);
+	static bool IsExistingEntryCurrent(const std::string& path, std::time_t timestamp, s64 size);
+	static void AddOrReplaceEntry(Entry entry);
+	static bool AddFileFromCache(const std::string& path, std::time_t timestamp, s64 size);
 	static bool ScanFile(std::string path, std::time_t timestamp);
 
 	static void LoadCache();
@@ -69,6 +74,9 @@ namespace GameList
 
 static std::vector<GameList::Entry> m_entries;
 static std::recursive_mutex s_mutex;
+
+// Paths found by the refresh in progress. Entries which aren't in here get dropped when it completes.
+static std::unordered_set<std::string> s_refreshed_paths;
 static GameList::CacheMap m_cache_map;
 static std::FILE* m_cache_write_stream = nullptr;
 
@@ -119,7 +127,7 @@ const char* GameList::EntryCompatibilityRatingToString(CompatibilityRating ratin
 
 bool GameList::IsScannableFilename(const std::string_view& path)
 {
-	static const char* extensions[] = {".iso", ".mdf", ".nrg", ".bin", ".img", ".gz", ".cso", ".chd", ".elf", ".irx"};
+	static const char* extensions[] = {".iso", ".mdf", ".nrg", ".bin", ".img", ".gz", ".cso", ".zso", ".chd", ".elf", ".irx"};
 
 	for (const char* test_extension : extensions)
 	{
@@ -534,24 +542,42 @@ static bool IsPathExcluded(const std::vector<std::string>& excluded_paths, const
 	return (std::find(excluded_paths.begin(), excluded_paths.end(), path) != excluded_paths.end());
 }
 
-void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache, const std::vector<std::string>& excluded_paths, ProgressCallback* progress)
+void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache, const FileSystem::FindResultsArray& files,
+	const std::vector<std::string>& excluded_paths, ProgressCallback* progress)
 {
-	Console.WriteLn("Scanning %s%s", path, recursive ? " (recursively)" : "");
-
 	progress->PushState();
 	progress->SetFormattedStatusText("Scanning directory '%s'%s...", path, recursive ? " (recursively)" : "");
 
-	FileSystem::FindResultsArray files;
-	FileSystem::FindFiles(path, "*",
-		recursive ? (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE) :
-                    (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES),
-		&files);
+	// Gzip images need an index before they can be opened for scanning. Building it is slow,
+	// so generate all of the missing ones up front, several at a time, rather than one per ScanFile.
+	if (!only_cache)
+	{
+		std::vector<std::string> gzip_files;
+		{
+			std::unique_lock lock(s_mutex);
+			for (const FILESYSTEM_FIND_DATA& ffd : files)
+			{
+				if (!GzippedFileReader::CanHandle(ffd.FileName, ffd.FileName) || IsPathExcluded(excluded_paths, ffd.FileName) ||
+					IsExistingEntryCurrent(ffd.FileName, ffd.ModificationTime, ffd.Size))
+				{
+					continue;
+				}
+
+				auto iter = m_cache_map.find(ffd.FileName);
+				if (iter == m_cache_map.end() || !IsCacheEntryCurrent(iter->second, ffd.ModificationTime, ffd.Size))
+					gzip_files.push_back(ffd.FileName);
+			}
+		}
+
+		if (!gzip_files.empty())
+			GzippedFileReader::GenerateIndexes(gzip_files, progress);
+	}
 
 	u32 files_scanned = 0;
 	progress->SetProgressRange(static_cast<u32>(files.size()));
 	progress->SetProgressValue(0);
 
-	for (FILESYSTEM_FIND_DATA& ffd : files)
+	for (const FILESYSTEM_FIND_DATA& ffd : files)
 	{
 		files_scanned++;
 
@@ -563,17 +589,16 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
 
 		{
 			std::unique_lock lock(s_mutex);
-			if (GetEntryForPath(ffd.FileName.c_str()) ||
-				AddFileFromCache(ffd.FileName, ffd.ModificationTime) ||
+			if (IsExistingEntryCurrent(ffd.FileName, ffd.ModificationTime, ffd.Size) ||
+				AddFileFromCache(ffd.FileName, ffd.ModificationTime, ffd.Size) ||
 				only_cache)
 			{
 				continue;
 			}
 		}
 
-		// ownership of fp is transferred
 		progress->SetFormattedStatusText("Scanning '%s'...", FileSystem::GetDisplayNameFromPath(ffd.FileName).c_str());
-		ScanFile(std::move(ffd.FileName), ffd.ModificationTime);
+		ScanFile(ffd.FileName, ffd.ModificationTime);
 		progress->SetProgressValue(files_scanned);
 	}
 
@@ -581,19 +606,43 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
 	progress->PopState();
 }
 
-bool GameList::AddFileFromCache(const std::string& path, std::time_t timestamp)
+bool GameList::IsCacheEntryCurrent(const GameList::Entry& entry, std::time_t timestamp, s64 size)
 {
-	if (std::any_of(m_entries.begin(), m_entries.end(), [&path](const Entry& other) { return other.path == path; }))
-	{
-		// already exists
-		return true;
-	}
+	// Copying an image over another one can keep the timestamp (e.g. cp -p, robocopy),
+	// so a changed size also means the file has to be scanned again.
+	return (entry.last_modified_time == timestamp && entry.total_size == static_cast<u64>(size));
+}
+
+bool GameList::IsExistingEntryCurrent(const std::string& path, std::time_t timestamp, s64 size)
+{
+	// Entries from the last refresh are kept if the file hasn't changed, which also covers
+	// the same file turning up in more than one directory.
+	const Entry* entry = GetEntryForPath(path.c_str());
+	if (!entry || !IsCacheEntryCurrent(*entry, timestamp, size))
+		return false;
+
+	s_refreshed_paths.insert(entry->path);
+	return true;
+}
 
+void GameList::AddOrReplaceEntry(Entry entry)
+{
+	// Changed files are updated in place, so the indices the frontend has for the other entries stay valid.
+	std::unique_lock lock(s_mutex);
+	s_refreshed_paths.insert(entry.path);
+	if (Entry* existing = GetMutableEntryForPath(entry.path.c_str()))
+		*existing = std::move(entry);
+	else
+		m_entries.push_back(std::move(entry));
+}
+
+bool GameList::AddFileFromCache(const std::string& path, std::time_t timestamp, s64 size)
+{
 	Entry entry;
-	if (!GetGameListEntryFromCache(path, &entry) || entry.last_modified_time != timestamp)
+	if (!GetGameListEntryFromCache(path, &entry) || !IsCacheEntryCurrent(entry, timestamp, size))
 		return false;
 
-	m_entries.push_back(std::move(entry));
+	AddOrReplaceEntry(std::move(entry));
 	return true;
 }
 
@@ -614,8 +663,7 @@ bool GameList::ScanFile(std::string path, std::time_t timestamp)
 			Console.Warning("Failed to write entry '%s' to cache", entry.path.c_str());
 	}
 
-	std::unique_lock lock(s_mutex);
-	m_entries.push_back(std::move(entry));
+	AddOrReplaceEntry(std::move(entry));
 	return true;
 }
 
@@ -692,38 +740,56 @@ void GameList::Refresh(bool invalidate_cache, bool only_cache, ProgressCallback*
 	else
 		LoadCache();
 
+	// Entries stay in the list while scanning, so the frontend isn't left empty until we're done, and
+	// the ones which weren't found are removed at the end. Rescanning everything has to start over, though.
 	// don't delete the old entries, since the frontend might still access them
 	std::vector<Entry> old_entries;
 	{
 		std::unique_lock lock(s_mutex);
-		old_entries.swap(m_entries);
+		if (invalidate_cache)
+			old_entries.swap(m_entries);
+		s_refreshed_paths.clear();
 	}
 
 	const std::vector<std::string> excluded_paths(Host::GetStringListSetting("GameList", "ExcludedPaths"));
 	const std::vector<std::string> dirs(Host::GetStringListSetting("GameList", "Paths"));
 	const std::vector<std::string> recursive_dirs(Host::GetStringListSetting("GameList", "RecursivePaths"));
 
-	if (!dirs.empty() || !recursive_dirs.empty())
+	std::vector<std::pair<const std::string*, bool>> scan_dirs;
+	scan_dirs.reserve(dirs.size() + recursive_dirs.size());
+	for (const std::string& dir : dirs)
+		scan_dirs.emplace_back(&dir, false);
+	for (const std::string& dir : recursive_dirs)
+		scan_dirs.emplace_back(&dir, true);
+
+	if (!scan_dirs.empty())
 	{
-		progress->SetProgressRange(static_cast<u32>(dirs.size() + recursive_dirs.size()));
+		// Every directory gets a pass which only adds known files from the cache first. That's quick, so the
+		// list is usable almost straight away, with new and changed files (which have to be opened) trickling in after.
+		const u32 passes = only_cache ? 1 : 2;
+		progress->SetProgressRange(static_cast<u32>(scan_dirs.size()) * passes);
 		progress->SetProgressValue(0);
 
 		// we manually count it here, because otherwise pop state updates it itself
 		int directory_counter = 0;
-		for (const std::string& dir : dirs)
+		std::vector<FileSystem::FindResultsArray> dir_files(scan_dirs.size());
+		for (size_t i = 0; i < scan_dirs.size() && !progress->IsCancelled(); i++)
 		{
-			if (progress->IsCancelled())
-				break;
+			const auto& [dir, recursive] = scan_dirs[i];
+			Console.WriteLn("Scanning %s%s", dir->c_str(), recursive ? " (recursively)" : "");
 
-			ScanDirectory(dir.c_str(), false, only_cache, excluded_paths, progress);
+			FileSystem::FindFiles(dir->c_str(), "*",
+				recursive ? (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE) :
+                            (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES),
+				&dir_files[i]);
+
+			ScanDirectory(dir->c_str(), recursive, true, dir_files[i], excluded_paths, progress);
 			progress->SetProgressValue(++directory_counter);
 		}
-		for (const std::string& dir : recursive_dirs)
-		{
-			if (progress->IsCancelled())
-				break;
 
-			ScanDirectory(dir.c_str(), true, only_cache, excluded_paths, progress);
+		for (size_t i = 0; i < scan_dirs.size() && !only_cache && !progress->IsCancelled(); i++)
+		{
+			ScanDirectory(scan_dirs[i].first->c_str(), scan_dirs[i].second, false, dir_files[i], excluded_paths, progress);
 			progress->SetProgressValue(++directory_counter);
 		}
 	}
@@ -731,6 +797,18 @@ void GameList::Refresh(bool invalidate_cache, bool only_cache, ProgressCallback*
 	// don't need unused cache entries
 	CloseCacheFileStream();
 	m_cache_map.clear();
+
+	std::unique_lock lock(s_mutex);
+
+	// A cancelled refresh hasn't looked at everything, so leave the rest alone until the next one.
+	if (!progress->IsCancelled())
+	{
+		m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
+							[](const Entry& entry) { return s_refreshed_paths.find(entry.path) == s_refreshed_paths.end(); }),
+			m_entries.end());
+	}
+
+	s_refreshed_paths.clear();
 }
 
 std::string GameList::GetCoverImagePathForEntry(const Entry* entry)
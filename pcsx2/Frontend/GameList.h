@@ -120,6 +120,8 @@ namespace GameList
 	bool IsGameListLoaded();
 
 	/// Populates the game list with files in the configured directories.
+	/// Entries are added while scanning, and existing ones are kept (or updated in place) until it completes,
+	/// at which point those which no longer exist are removed. A cancelled refresh removes nothing.
 	/// If invalidate_cache is set, all files will be re-scanned.
 	/// If only_cache is set, no new files will be scanned, only those present in the cache.
 	void Refresh(bool invalidate_cache, bool only_cache = false, ProgressCallback* progress = nullptr);
@@ -37,6 +37,7 @@
 #include "Frontend/InputManager.h"
 #include "GS.h"
 #include "GS/GS.h"
+#include "GS/GSPerfMon.h"
 #include "Host.h"
 #include "HostDisplay.h"
 #include "IconsFontAwesome5.h"
@@ -59,6 +60,7 @@ namespace ImGuiManager
 	static void AcquirePendingOSDMessages();
 	static void DrawOSDMessages();
 	static void FormatProcessorStat(std::string& text, double usage, double time);
+	static void BuildPerformanceOverlay();
 	static void DrawPerformanceOverlay();
 } // namespace ImGuiManager
 
@@ -71,6 +73,39 @@ static std::vector<u8> s_standard_font_data;
 static std::vector<u8> s_fixed_font_data;
 static std::vector<u8> s_icon_font_data;
 
+namespace
+{
+	/// A line of the performance overlay, or the frame time graph when font is null.
+	struct OverlayLine
+	{
+		ImFont* font;
+		std::string text;
+		ImU32 color;
+		float width;
+		float height;
+	};
+
+	/// Everything the overlay text depends on, besides the metrics themselves.
+	struct OverlayKey
+	{
+		u64 metrics_update;
+		u32 perfmon_update;
+		float scale;
+		double limit_scalar;
+		bool paused;
+		u8 osd_flags;
+
+		bool operator!=(const OverlayKey& rhs) const
+		{
+			return (metrics_update != rhs.metrics_update || perfmon_update != rhs.perfmon_update || scale != rhs.scale ||
+					limit_scalar != rhs.limit_scalar || paused != rhs.paused || osd_flags != rhs.osd_flags);
+		}
+	};
+} // namespace
+
+static std::vector<OverlayLine> s_overlay_lines;
+static OverlayKey s_overlay_key = {};
+
 static Common::Timer s_last_render_time;
 
 #ifdef PCSX2_CORE
@@ -413,6 +448,9 @@ bool ImGuiManager::AddImGuiFonts()
 	ImGuiIO& io = ImGui::GetIO();
 	io.Fonts->Clear();
 
+	// The cached overlay lines point at the old fonts.
+	s_overlay_lines.clear();
+
 	s_standard_font = AddTextFont(standard_font_size);
 	if (!s_standard_font || !AddIconFonts(standard_font_size))
 		return false;
@@ -590,30 +628,19 @@ void ImGuiManager::FormatProcessorStat(std::string& text, double usage, double t
 		fmt::format_to(std::back_inserter(text), "{:.1f}% ({:.2f}ms)", usage, time);
 }
 
-void ImGuiManager::DrawPerformanceOverlay()
+void ImGuiManager::BuildPerformanceOverlay()
 {
-	const float scale = s_global_scale;
-	const float shadow_offset = std::ceil(1.0f * scale);
-	const float margin = std::ceil(10.0f * scale);
-	const float spacing = std::ceil(5.0f * scale);
-	float position_y = margin;
-
-	ImDrawList* dl = ImGui::GetBackgroundDrawList();
 	std::string text;
-	ImVec2 text_size;
 	bool first = true;
 
 	text.reserve(128);
+	s_overlay_lines.clear();
 
 #define DRAW_LINE(font, text, color) \
 	do \
 	{ \
-		text_size = font->CalcTextSizeA(font->FontSize, std::numeric_limits<float>::max(), -1.0f, (text), nullptr, nullptr); \
-		dl->AddText(font, font->FontSize, \
-			ImVec2(ImGui::GetIO().DisplaySize.x - margin - text_size.x + shadow_offset, position_y + shadow_offset), \
-			IM_COL32(0, 0, 0, 100), (text)); \
-		dl->AddText(font, font->FontSize, ImVec2(ImGui::GetIO().DisplaySize.x - margin - text_size.x, position_y), color, (text)); \
-		position_y += text_size.y + spacing; \
+		const ImVec2 line_size = font->CalcTextSizeA(font->FontSize, std::numeric_limits<float>::max(), -1.0f, (text), nullptr, nullptr); \
+		s_overlay_lines.push_back({(font), (text), (color), line_size.x, line_size.y}); \
 	} while (0)
 
 #ifdef PCSX2_CORE
@@ -695,6 +722,14 @@ void ImGuiManager::DrawPerformanceOverlay()
 				PerformanceMetrics::GetWorstFrameTime());
 			DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 
+			text.clear();
+			fmt::format_to(std::back_inserter(text), "Present latency: {:.2f}ms ({:.2f}ms worst)",
+				PerformanceMetrics::GetAveragePresentLatency(), PerformanceMetrics::GetWorstPresentLatency());
+			DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
+
+			// Frame time graph, drawn fresh every frame.
+			s_overlay_lines.push_back({nullptr, {}, 0, 0.0f, 0.0f});
+
 			text.clear();
 			if (EmuConfig.Speedhacks.EECycleRate != 0 || EmuConfig.Speedhacks.EECycleSkip != 0)
 				fmt::format_to(std::back_inserter(text), "EE[{}/{}]: ", EmuConfig.Speedhacks.EECycleRate, EmuConfig.Speedhacks.EECycleSkip);
@@ -707,12 +742,19 @@ void ImGuiManager::DrawPerformanceOverlay()
 			FormatProcessorStat(text, PerformanceMetrics::GetGSThreadUsage(), PerformanceMetrics::GetGSThreadAverageTime());
 			DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 
+			text.clear();
+			fmt::format_to(std::back_inserter(text), "GS sync: {:.2f}ms queue | {:.2f}ms readback ({}, {} drained)",
+				PerformanceMetrics::GetGSVsyncWaitTime(), PerformanceMetrics::GetGSReadbackWaitTime(),
+				PerformanceMetrics::GetGSReadbackCount(), PerformanceMetrics::GetGSReadbackDrainCount());
+			DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
+
 			const u32 gs_sw_threads = PerformanceMetrics::GetGSSWThreadCount();
 			for (u32 i = 0; i < gs_sw_threads; i++)
 			{
 				text.clear();
 				fmt::format_to(std::back_inserter(text), "SW-{}: ", i);
 				FormatProcessorStat(text, PerformanceMetrics::GetGSSWThreadUsage(i), PerformanceMetrics::GetGSSWThreadAverageTime(i));
+				fmt::format_to(std::back_inserter(text), " | {:.2f}ms busy", g_perfmon.GetThreadBusy(static_cast<int>(i)));
 				DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 			}
 
@@ -721,13 +763,37 @@ void ImGuiManager::DrawPerformanceOverlay()
 				text = "VU: ";
 				FormatProcessorStat(text, PerformanceMetrics::GetVUThreadUsage(), PerformanceMetrics::GetVUThreadAverageTime());
 				DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
+
+				// Histogram buckets: <10us / <100us / <1ms / <10ms / longer.
+				text.clear();
+				fmt::format_to(std::back_inserter(text), "EE wait: {:.2f}ms [{}/{}/{}/{}/{}]", PerformanceMetrics::GetVUThreadEEWaitTime(),
+					PerformanceMetrics::GetVUThreadEEWaitHistogram(0), PerformanceMetrics::GetVUThreadEEWaitHistogram(1),
+					PerformanceMetrics::GetVUThreadEEWaitHistogram(2), PerformanceMetrics::GetVUThreadEEWaitHistogram(3),
+					PerformanceMetrics::GetVUThreadEEWaitHistogram(4));
+				DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
+
+				text.clear();
+				fmt::format_to(std::back_inserter(text), "VU idle: {:.2f}ms [{}/{}/{}/{}/{}]", PerformanceMetrics::GetVUThreadIdleTime(),
+					PerformanceMetrics::GetVUThreadIdleHistogram(0), PerformanceMetrics::GetVUThreadIdleHistogram(1),
+					PerformanceMetrics::GetVUThreadIdleHistogram(2), PerformanceMetrics::GetVUThreadIdleHistogram(3),
+					PerformanceMetrics::GetVUThreadIdleHistogram(4));
+				DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 			}
+
+			text.clear();
+			fmt::format_to(std::back_inserter(text), "SPU2: {:.1f}ms buffered ({:.0f}ms target) | {} underruns",
+				PerformanceMetrics::GetAudioLatency(), PerformanceMetrics::GetAudioTargetLatency(), PerformanceMetrics::GetAudioUnderrunCount());
+			DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 		}
 
 		if (GSConfig.OsdShowGPU)
 		{
 			text = "GPU: ";
 			FormatProcessorStat(text, PerformanceMetrics::GetGPUUsage(), PerformanceMetrics::GetGPUAverageTime());
+
+			// The GPU being busy for nearly all of the interval means it, not emulation, is limiting the frame rate.
+			if (PerformanceMetrics::GetGPUUsage() >= 90.0f)
+				text += " | GPU bound";
 			DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 		}
 
@@ -752,6 +818,72 @@ void ImGuiManager::DrawPerformanceOverlay()
 #undef DRAW_LINE
 }
 
+void ImGuiManager::DrawPerformanceOverlay()
+{
+#ifdef PCSX2_CORE
+	const bool paused = (VMManager::GetState() == VMState::Paused);
+#else
+	constexpr bool paused = false;
+#endif
+
+	// The stats only change when the metrics are recalculated, so only format the text then (or when the overlay
+	// settings change). The frame time graph is the only part which moves every frame.
+	const u8 osd_flags = static_cast<u8>(GSConfig.OsdShowFPS | (GSConfig.OsdShowSpeed << 1) | (GSConfig.OsdShowGSStats << 2) |
+										  (GSConfig.OsdShowResolution << 3) | (GSConfig.OsdShowCPU << 4) |
+										  (GSConfig.OsdShowGPU << 5) | (GSConfig.OsdShowIndicators << 6));
+	const OverlayKey key = {PerformanceMetrics::GetUpdateCount(), static_cast<u32>(g_perfmon.GetFrame() >> 5),
+		s_global_scale, EmuConfig.GS.LimitScalar, paused, osd_flags};
+	if (key != s_overlay_key || s_overlay_lines.empty())
+	{
+		s_overlay_key = key;
+		BuildPerformanceOverlay();
+	}
+
+	const float scale = s_global_scale;
+	const float shadow_offset = std::ceil(1.0f * scale);
+	const float margin = std::ceil(10.0f * scale);
+	const float spacing = std::ceil(5.0f * scale);
+	const float right = ImGui::GetIO().DisplaySize.x - margin;
+	float position_y = margin;
+
+	ImDrawList* dl = ImGui::GetBackgroundDrawList();
+	for (const OverlayLine& line : s_overlay_lines)
+	{
+		if (!line.font)
+		{
+			// Frame time graph, scaled to the worst frame in the history (at least 1.5x a 60hz frame).
+			const auto& history = PerformanceMetrics::GetFrameTimeHistory();
+			const u32 history_pos = PerformanceMetrics::GetFrameTimeHistoryPos();
+			const float graph_width = 150.0f * scale;
+			const float graph_height = 40.0f * scale;
+			const float graph_x = ImGui::GetIO().DisplaySize.x - margin - graph_width;
+			float max_time = 25.0f;
+			for (const float time : history)
+				max_time = std::max(max_time, time);
+
+			ImVec2 points[PerformanceMetrics::FRAME_TIME_HISTORY_SIZE];
+			for (u32 i = 0; i < PerformanceMetrics::FRAME_TIME_HISTORY_SIZE; i++)
+			{
+				const float time = history[(history_pos + i) % PerformanceMetrics::FRAME_TIME_HISTORY_SIZE];
+				points[i] = ImVec2(graph_x + graph_width * static_cast<float>(i) / static_cast<float>(PerformanceMetrics::FRAME_TIME_HISTORY_SIZE - 1),
+					position_y + graph_height * (1.0f - std::min(time / max_time, 1.0f)));
+			}
+
+			dl->AddRectFilled(ImVec2(graph_x, position_y), ImVec2(graph_x + graph_width, position_y + graph_height), IM_COL32(0, 0, 0, 100));
+			dl->AddPolyline(points, PerformanceMetrics::FRAME_TIME_HISTORY_SIZE, IM_COL32(255, 255, 255, 255), 0, 1.0f);
+			position_y += graph_height + spacing;
+			continue;
+		}
+
+		const char* text = line.text.c_str();
+		const char* text_end = text + line.text.size();
+		dl->AddText(line.font, line.font->FontSize, ImVec2(right - line.width + shadow_offset, position_y + shadow_offset),
+			IM_COL32(0, 0, 0, 100), text, text_end);
+		dl->AddText(line.font, line.font->FontSize, ImVec2(right - line.width, position_y), line.color, text, text_end);
+		position_y += line.height + spacing;
+	}
+}
+
 void ImGuiManager::RenderOSD()
 {
 	// acquire for IO.MousePos.
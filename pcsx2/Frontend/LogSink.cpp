@@ -344,6 +344,10 @@ static void UpdateLoggingSinks(bool system_console, bool file_log)
 			emuLogName = Path::Combine(EmuFolders::Logs, "emulog.txt");
 			emuLog = FileSystem::OpenCFile(emuLogName.c_str(), "wb");
 			file_log = (emuLog != nullptr);
+
+			// trace logging can write millions of lines, so give it a decent buffer
+			if (emuLog)
+				std::setvbuf(emuLog, nullptr, _IOFBF, 1024 * 1024);
 		}
 	}
 	else
@@ -20,6 +20,7 @@
 #include "GS/GS.h"
 #include <atomic>
 #include <functional>
+#include <future>
 #include <mutex>
 #include <thread>
 
@@ -329,6 +330,8 @@ public:
 
 	// note: when m_ReadPos == m_WritePos, the fifo is empty
 	// Threading info: m_ReadPos is updated by the MTGS thread. m_WritePos is updated by the EE thread
+	// The EE thread is the only producer: MTVU hands its xgkick data over through the PATH1 buffer
+	// and only the GS_RINGTYPE_MTVU_GSPACKET marker goes through the ring, so no locking is needed.
 	std::atomic<unsigned int> m_ReadPos; // cur pos gs is reading from
 	std::atomic<unsigned int> m_WritePos; // cur pos ee thread is writing to
 
@@ -338,6 +341,14 @@ public:
 	std::atomic<int> m_QueuedFrameCount;
 	std::atomic<bool> m_VsyncSignalListener;
 
+	// EE time spent blocked on the GS thread, in nanoseconds: at vsync because VsyncQueueSize frames
+	// are already in flight, and at readbacks, which drain the ring. m_ReadbackDrainCount counts the
+	// readbacks that had frames queued, since those throw away the overlap. Reset by PerformanceMetrics.
+	std::atomic<u64> m_VsyncWaitNs{0};
+	std::atomic<u64> m_ReadbackWaitNs{0};
+	std::atomic<u32> m_ReadbackCount{0};
+	std::atomic<u32> m_ReadbackDrainCount{0};
+
 	std::mutex m_mtx_RingBufferBusy2; // Gets released on semaXGkick waiting...
 	std::mutex m_mtx_WaitGS;
 	Threading::WorkSema m_sem_event;
@@ -352,6 +363,9 @@ public:
 	// has more than one command in it when the thread is kicked.
 	int m_CopyDataTally;
 
+	// Amount of queued data (in qwords) after which the MTGS thread is woken up.
+	static constexpr int RingBufferWakeThreshold = 0x2000;
+
 	// These vars maintain instance data for sending Data Packets.
 	// Only one data packet can be constructed and uploaded at a time.
 
@@ -359,6 +373,17 @@ public:
 	uint m_packet_size; // size of the packet (data only, ie. not including the 16 byte command!)
 	uint m_packet_writepos; // index of the data location in the ringbuffer.
 
+	// Completed GIF path packets that sit back to back in the same path buffer are
+	// merged here and sent as a single GS_RINGTYPE_GSPACKET. Flushed before any other
+	// ring command is written and before waiting on the GS thread.
+	u32 m_pending_gspacket_offset;
+	u32 m_pending_gspacket_size;
+	GIF_PATH m_pending_gspacket_path;
+
+	// Merged packets are sent once they reach this size (in bytes), so the GS thread
+	// isn't kept waiting on long runs of small packets.
+	static constexpr u32 GSPacketMergeLimit = 0x4000;
+
 #ifdef RINGBUF_DEBUG_STACK
 	std::mutex m_lock_Stack;
 #endif
@@ -368,6 +393,10 @@ public:
 	std::atomic_bool m_open_flag{false};
 	std::atomic_bool m_shutdown_flag{false};
 	Threading::KernelSemaphore m_open_or_close_done;
+	// set by BeginOpen() until WaitForOpen() has collected the result, only touched by the CPU thread
+	bool m_open_pending = false;
+	// vsyncs posted while set are rendered but not presented, only touched by the CPU thread
+	bool m_frames_hidden = false;
 
 public:
 	SysMtgsThread();
@@ -394,6 +423,9 @@ public:
 	void PrepDataPacket(GIF_PATH pathidx, u32 size);
 	void SendDataPacket();
 	void SendGameCRC(u32 crc);
+	/// Asks the GS thread to open the renderer without waiting for it, so the caller can get
+	/// on with other work. WaitForOpen() must be called before anything is sent to the GS.
+	void BeginOpen();
 	bool WaitForOpen();
 	void WaitForClose();
 	void Freeze(FreezeAction mode, MTGS_FreezeData& data);
@@ -401,10 +433,13 @@ public:
 	void SendSimpleGSPacket(MTGS_RingCommand type, u32 offset, u32 size, GIF_PATH path);
 	void SendSimplePacket(MTGS_RingCommand type, int data0, int data1, int data2);
 	void SendPointerPacket(MTGS_RingCommand type, u32 data0, void* data1);
+	void FlushPendingGSPacket();
 
 	u8* GetDataPacketPtr() const;
 	void SetEvent();
 	void PostVsyncStart(bool registers_written);
+	/// Frames ending with a vsync posted while hidden are drawn, but not presented or counted.
+	void SetFramesHidden(bool hidden) { m_frames_hidden = hidden; }
 	void InitAndReadFIFO(u8* mem, u32 qwc);
 
 	void RunOnGSThread(AsyncCallType func);
@@ -415,7 +450,8 @@ public:
 	void SwitchRenderer(GSRendererType renderer, bool display_message = true);
 	void SetSoftwareRendering(bool software, bool display_message = true);
 	void ToggleSoftwareRendering();
-	bool SaveMemorySnapshot(u32 width, u32 height, std::vector<u32>* pixels);
+	/// Queues a downscaled readback of the current frame. pixels must stay alive until the future is ready.
+	std::future<bool> SaveMemorySnapshot(u32 width, u32 height, std::vector<u32>* pixels);
 
 protected:
 	bool TryOpenGS();
@@ -428,6 +464,7 @@ protected:
 
 	// Used internally by SendSimplePacket type functions
 	void _FinishSimplePacket();
+	void _SendSimplePacket(MTGS_RingCommand type, int data0, int data1, int data2);
 };
 
 // GetMTGS() is a required external implementation. This function is *NOT* provided
@@ -28,6 +28,7 @@
 #include "Renderers/HW/GSRendererHW.h"
 #include "Renderers/HW/GSTextureReplacements.h"
 #include "GSLzma.h"
+#include "GSPng.h"
 
 #include "common/Console.h"
 #include "common/FileSystem.h"
@@ -37,6 +38,7 @@
 #include "pcsx2/Counters.h"
 #include "pcsx2/Host.h"
 #include "pcsx2/HostDisplay.h"
+#include "pcsx2/PerformanceMetrics.h"
 #include "pcsx2/GS.h"
 #ifdef PCSX2_CORE
 #include "pcsx2/HostSettings.h"
@@ -66,6 +68,7 @@ static HRESULT s_hr = E_FAIL;
 
 #endif
 
+#include <ctime>
 #include <fstream>
 
 // do NOT undefine this/put it above includes, as x11 people love to redefine
@@ -125,6 +128,10 @@ void GSshutdown()
 		g_gs_renderer->Destroy();
 		g_gs_renderer.reset();
 	}
+
+	// don't lose screenshots which are still being encoded
+	GSPng::FlushAsyncSaves();
+
 	if (g_gs_device)
 	{
 		g_gs_device->Destroy();
@@ -146,6 +153,8 @@ void GSshutdown()
 
 void GSclose()
 {
+	PerformanceMetrics::StopFrameTrace();
+
 	if (g_gs_renderer)
 	{
 		g_gs_renderer->Destroy();
@@ -282,7 +291,9 @@ static bool DoGSOpen(GSRendererType renderer, u8* basemem)
 	}
 
 	display->SetVSync(EmuConfig.GetEffectiveVsyncMode());
-	GSConfig.OsdShowGPU = EmuConfig.GS.OsdShowGPU && display->SetGPUTimingEnabled(true);
+	const bool gpu_timing = (EmuConfig.GS.OsdShowGPU || EmuConfig.GS.DynamicResolution) && display->SetGPUTimingEnabled(true);
+	GSConfig.OsdShowGPU = EmuConfig.GS.OsdShowGPU && gpu_timing;
+	GSConfig.DynamicResolution = EmuConfig.GS.DynamicResolution && gpu_timing;
 
 	g_gs_renderer->SetRegsMem(basemem);
 	g_perfmon.Reset();
@@ -502,11 +513,11 @@ void GSgifTransfer3(u8* mem, u32 size)
 	}
 }
 
-void GSvsync(u32 field, bool registers_written)
+void GSvsync(u32 field, bool registers_written, bool hidden)
 {
 	try
 	{
-		g_gs_renderer->VSync(field, registers_written);
+		g_gs_renderer->VSync(field, registers_written, hidden);
 	}
 	catch (GSRecoverableError)
 	{
@@ -689,9 +700,12 @@ void GSgetStats(std::string& info)
 	{
 		const double fps = GetVerticalFrequency();
 		const double fillrate = pm.Get(GSPerfMon::Fillrate);
-		info = StringUtil::StdStringFromFormat("%s SW | %d S | %d P | %d D | %.2f U | %.2f D | %.2f mpps",
+		info = StringUtil::StdStringFromFormat("%s SW | %d S | %d/%d/%d W | %d P | %d D | %.2f U | %.2f D | %.2f mpps",
 			api_name,
 			(int)pm.Get(GSPerfMon::SyncPoint),
+			(int)pm.Get(GSPerfMon::SyncTarget),
+			(int)pm.Get(GSPerfMon::SyncSource),
+			(int)pm.Get(GSPerfMon::SyncTransfer),
 			(int)pm.Get(GSPerfMon::Prim),
 			(int)pm.Get(GSPerfMon::Draw),
 			pm.Get(GSPerfMon::Swizzle) / 1024,
@@ -706,7 +720,7 @@ void GSgetStats(std::string& info)
 	{
 		if (GSConfig.TexturePreloading == TexturePreloadingLevel::Full)
 		{
-			info = StringUtil::StdStringFromFormat("%s HW | HC: %d MB | %d P | %d D | %d DC | %d B | %d RB | %d TC | %d TU",
+			info = StringUtil::StdStringFromFormat("%s HW | HC: %d MB | %d P | %d D | %d DC | %d B | %d/%d RB | %d TC | %d TU | %d TM | %d TA | %d TF | %d/%d TL | %d/%d DR | %d HK",
 				api_name,
 				(int)std::ceil(GSRendererHW::GetInstance()->GetTextureCache()->GetHashCacheMemoryUsage() / 1048576.0f),
 				(int)pm.Get(GSPerfMon::Prim),
@@ -714,20 +728,38 @@ void GSgetStats(std::string& info)
 				(int)std::ceil(pm.Get(GSPerfMon::DrawCalls)),
 				(int)std::ceil(pm.Get(GSPerfMon::Barriers)),
 				(int)std::ceil(pm.Get(GSPerfMon::Readbacks)),
+				(int)std::ceil(pm.Get(GSPerfMon::ReadbacksElided)),
 				(int)std::ceil(pm.Get(GSPerfMon::TextureCopies)),
-				(int)std::ceil(pm.Get(GSPerfMon::TextureUploads)));
+				(int)std::ceil(pm.Get(GSPerfMon::TextureUploads)),
+				(int)std::ceil(pm.Get(GSPerfMon::TextureMipmaps)),
+				(int)std::ceil(pm.Get(GSPerfMon::TextureAllocations)),
+				(int)std::ceil(pm.Get(GSPerfMon::TransferFlushes)),
+				(int)std::ceil(pm.Get(GSPerfMon::TargetLookups)),
+				(int)std::ceil(pm.Get(GSPerfMon::TargetLookupsSkipped)),
+				(int)std::ceil(pm.Get(GSPerfMon::DirtyRects)),
+				(int)std::ceil(pm.Get(GSPerfMon::DirtyRectsMerged)),
+				(int)std::ceil(pm.Get(GSPerfMon::HackChecks)));
 		}
 		else
 		{
-			info = StringUtil::StdStringFromFormat("%s HW | %d P | %d D | %d DC | %d B | %d RB | %d TC | %d TU",
+			info = StringUtil::StdStringFromFormat("%s HW | %d P | %d D | %d DC | %d B | %d/%d RB | %d TC | %d TU | %d TM | %d TA | %d TF | %d/%d TL | %d/%d DR | %d HK",
 				api_name,
 				(int)pm.Get(GSPerfMon::Prim),
 				(int)pm.Get(GSPerfMon::Draw),
 				(int)std::ceil(pm.Get(GSPerfMon::DrawCalls)),
 				(int)std::ceil(pm.Get(GSPerfMon::Barriers)),
 				(int)std::ceil(pm.Get(GSPerfMon::Readbacks)),
+				(int)std::ceil(pm.Get(GSPerfMon::ReadbacksElided)),
 				(int)std::ceil(pm.Get(GSPerfMon::TextureCopies)),
-				(int)std::ceil(pm.Get(GSPerfMon::TextureUploads)));
+				(int)std::ceil(pm.Get(GSPerfMon::TextureUploads)),
+				(int)std::ceil(pm.Get(GSPerfMon::TextureMipmaps)),
+				(int)std::ceil(pm.Get(GSPerfMon::TextureAllocations)),
+				(int)std::ceil(pm.Get(GSPerfMon::TransferFlushes)),
+				(int)std::ceil(pm.Get(GSPerfMon::TargetLookups)),
+				(int)std::ceil(pm.Get(GSPerfMon::TargetLookupsSkipped)),
+				(int)std::ceil(pm.Get(GSPerfMon::DirtyRects)),
+				(int)std::ceil(pm.Get(GSPerfMon::DirtyRectsMerged)),
+				(int)std::ceil(pm.Get(GSPerfMon::HackChecks)));
 		}
 	}
 }
@@ -800,6 +832,7 @@ void GSUpdateConfig(const Pcsx2Config::GSOptions& new_config)
 		GSConfig.CRCHack != old_config.CRCHack ||
 		GSConfig.SWExtraThreads != old_config.SWExtraThreads ||
 		GSConfig.SWExtraThreadsHeight != old_config.SWExtraThreadsHeight ||
+		GSConfig.SWTileBinning != old_config.SWTileBinning ||
 
 		GSConfig.SaveN != old_config.SaveN ||
 		GSConfig.SaveL != old_config.SaveL ||
@@ -859,12 +892,15 @@ void GSUpdateConfig(const Pcsx2Config::GSOptions& new_config)
 		g_gs_renderer->PurgeTextureCache();
 	}
 
-	if (GSConfig.OsdShowGPU != old_config.OsdShowGPU)
+	if (GSConfig.OsdShowGPU != old_config.OsdShowGPU || GSConfig.DynamicResolution != old_config.DynamicResolution)
 	{
 		if (HostDisplay* display = Host::GetHostDisplay(); display)
 		{
-			if (!display->SetGPUTimingEnabled(GSConfig.OsdShowGPU))
+			if (!display->SetGPUTimingEnabled(GSConfig.OsdShowGPU || GSConfig.DynamicResolution))
+			{
 				GSConfig.OsdShowGPU = false;
+				GSConfig.DynamicResolution = false;
+			}
 		}
 	}
 }
@@ -1402,6 +1438,7 @@ void GSApp::Init()
 	m_gs_tv_shaders.push_back(GSSetting(3, "Triangular filter", ""));
 	m_gs_tv_shaders.push_back(GSSetting(4, "Wave filter", ""));
 	m_gs_tv_shaders.push_back(GSSetting(5, "Lottes CRT filter", ""));
+	m_gs_tv_shaders.push_back(GSSetting(6, "Sharpen (CAS)", "Pair with a lower upscale"));
 
 	m_gs_dump_compression.push_back(GSSetting(static_cast<u32>(GSDumpCompressionMethod::Uncompressed), "Uncompressed", ""));
 	m_gs_dump_compression.push_back(GSSetting(static_cast<u32>(GSDumpCompressionMethod::LZMA), "LZMA (xz)", ""));
@@ -1422,6 +1459,7 @@ void GSApp::Init()
 	m_default_configuration["accurate_date"]                              = "1";
 	m_default_configuration["accurate_blending_unit"]                     = "1";
 	m_default_configuration["AspectRatio"]                                = "1";
+	m_default_configuration["async_pipeline_compilation"]                 = "0";
 	m_default_configuration["autoflush_sw"]                               = "1";
 	m_default_configuration["capture_enabled"]                            = "0";
 	m_default_configuration["capture_out_dir"]                            = "/tmp/GS_Capture";
@@ -1442,7 +1480,7 @@ void GSApp::Init()
 	m_default_configuration["DumpDirectTextures"]                         = "1";
 	m_default_configuration["DumpPaletteTextures"]                        = "1";
 	m_default_configuration["extrathreads"]                               = "2";
-	m_default_configuration["extrathreads_height"]                        = "4";
+	m_default_configuration["extrathreads_height"]                        = "0";
 	m_default_configuration["filter"]                                     = std::to_string(static_cast<s8>(BiFiltering::PS2));
 	m_default_configuration["FMVSoftwareRendererSwitch"]                  = "0";
 	m_default_configuration["FullscreenMode"]                             = "";
@@ -1500,6 +1538,11 @@ void GSApp::Init()
 	m_default_configuration["shaderfx_conf"]                              = "shaders/GS_FX_Settings.ini";
 	m_default_configuration["shaderfx_glsl"]                              = "shaders/GS.fx";
 	m_default_configuration["SkipDuplicateFrames"]                        = "0";
+	m_default_configuration["FrameSkip"]                                  = "0";
+	m_default_configuration["sw_tile_binning"]                            = "0";
+	m_default_configuration["FrameLimiterLowLatency"]                     = "0";
+	m_default_configuration["texture_cache_budget"]                       = "0";
+	m_default_configuration["texture_replacement_cache_budget"]           = "0";
 	m_default_configuration["texture_preloading"]                         = "0";
 	m_default_configuration["ThreadedPresentation"]                       = "0";
 	m_default_configuration["TVShader"]                                   = "0";
@@ -1721,6 +1764,23 @@ BEGIN_HOTKEY_LIST(g_gs_hotkeys)
 				GSStopGSDump();
 		});
 	}},
+	{"ToggleFrameTrace", "Graphics", "Toggle Frame Timing Trace", [](s32 pressed) {
+		if (pressed)
+			return;
+
+		GetMTGS().RunOnGSThread([]() {
+			if (PerformanceMetrics::IsFrameTraceActive())
+			{
+				PerformanceMetrics::StopFrameTrace();
+				Host::AddKeyedOSDMessage("ToggleFrameTrace", "Frame timing trace stopped.", 10.0f);
+				return;
+			}
+
+			const std::string path(Path::Combine(EmuFolders::Logs, fmt::format("frametrace_{}.csv", static_cast<u64>(std::time(nullptr)))));
+			if (PerformanceMetrics::StartFrameTrace(path))
+				Host::AddKeyedOSDMessage("ToggleFrameTrace", fmt::format("Writing frame timing trace to '{}'.", Path::GetFileName(path)), 10.0f);
+		});
+	}},
 	{"ToggleSoftwareRendering", "Graphics", "Toggle Software Rendering", [](s32 pressed) {
 		if (!pressed)
 			GetMTGS().ToggleSoftwareRendering();
@@ -527,6 +527,11 @@ bool GSCapture::BeginCapture(float fps, GSVector2i recommendedResolution, float
 	m_graph.query<IMediaControl>()->Run();
 	m_src.query<IGSSource>()->DeliverNewSegment();
 
+	m_encoder = std::make_unique<EncodeWorker>(
+		[]() { CoInitializeEx(nullptr, COINIT_MULTITHREADED); },
+		[this](std::shared_ptr<PendingFrame>& frame) { EncodeFrame(frame); },
+		[]() { CoUninitialize(); });
+
 	m_capturing = true;
 	filename = StringUtil::WideStringToUTF8String(dlg.m_filename.erase(dlg.m_filename.length() - 3, 3) + L"wav");
 	return true;
@@ -567,9 +572,17 @@ bool GSCapture::DeliverFrame(const void* bits, int pitch, bool rgba)
 
 #ifdef _WIN32
 
-	if (m_src)
+	if (m_src && m_encoder)
 	{
-		m_src.query<IGSSource>()->DeliverFrame(bits, pitch, rgba);
+		// The readback buffer is only valid until DownloadTextureComplete(), so take a copy
+		// and let the encode thread do the rest.
+		const size_t size = static_cast<size_t>(pitch) * m_size.y;
+		std::shared_ptr<PendingFrame> frame = std::make_shared<PendingFrame>();
+		frame->bits = std::make_unique<u8[]>(size);
+		frame->pitch = pitch;
+		frame->rgba = rgba;
+		std::memcpy(frame->bits.get(), bits, size);
+		m_encoder->Push(frame);
 
 		return true;
 	}
@@ -587,6 +600,13 @@ bool GSCapture::DeliverFrame(const void* bits, int pitch, bool rgba)
 	return false;
 }
 
+#ifdef _WIN32
+void GSCapture::EncodeFrame(std::shared_ptr<PendingFrame>& frame)
+{
+	m_src.query<IGSSource>()->DeliverFrame(frame->bits.get(), frame->pitch, frame->rgba);
+}
+#endif
+
 bool GSCapture::EndCapture()
 {
 	if (!m_capturing)
@@ -596,6 +616,12 @@ bool GSCapture::EndCapture()
 
 #ifdef _WIN32
 
+	if (m_encoder)
+	{
+		m_encoder->Wait();
+		m_encoder.reset();
+	}
+
 	if (m_src)
 	{
 		m_src.query<IGSSource>()->DeliverEOS();
@@ -609,6 +635,8 @@ bool GSCapture::EndCapture()
 	}
 
 #elif defined(__unix__)
+	for (auto& worker : m_workers)
+		worker->Wait();
 	m_workers.clear();
 
 	m_frame = 0;
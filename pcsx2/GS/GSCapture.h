@@ -33,8 +33,22 @@ class GSCapture
 
 #ifdef _WIN32
 
+	struct PendingFrame
+	{
+		std::unique_ptr<u8[]> bits;
+		int pitch;
+		bool rgba;
+	};
+
+	// Colour conversion and the DirectShow encoder run on this thread, so the GS thread
+	// only pays for the readback and a copy.
+	using EncodeWorker = GSJobQueue<std::shared_ptr<PendingFrame>, 8>;
+
 	wil::com_ptr_failfast<IGraphBuilder> m_graph;
 	wil::com_ptr_failfast<IBaseFilter> m_src;
+	std::unique_ptr<EncodeWorker> m_encoder;
+
+	void EncodeFrame(std::shared_ptr<PendingFrame>& frame);
 
 #elif defined(__unix__)
 
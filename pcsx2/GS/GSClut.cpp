@@ -17,6 +17,7 @@
 #include "GSClut.h"
 #include "GSLocalMemory.h"
 #include "GSGL.h"
+#include "xxhash.h"
 
 #define CLUT_ALLOC_SIZE (2 * 4096)
 
@@ -170,10 +171,18 @@ void GSClut::Write(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT)
 {
 	m_write.TEX0 = TEX0;
 	m_write.TEXCLUT = TEXCLUT;
-	m_read.dirty = true;
 	m_write.dirty = false;
-	
+
 	(this->*m_wc[TEX0.CSM][TEX0.CPSM][TEX0.PSM])(TEX0, TEXCLUT);
+
+	// Lots of games reload the same palette before every draw, in which case the expanded copy is still good.
+	// The read state still checks CSA/CPSM/TEXA, so only the contents need to be compared here.
+	const u64 hash = XXH3_64bits(m_clut, CLUT_ALLOC_SIZE / 4);
+	if (hash != m_clut_hash)
+	{
+		m_clut_hash = hash;
+		m_read.dirty = true;
+	}
 }
 
 void GSClut::WriteCLUT32_I8_CSM1(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT)
@@ -316,6 +325,7 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 		m_read.TEXA = TEXA;
 		m_read.dirty = false;
 		m_read.adirty = true;
+		m_read_generation++;
 
 		u16* clut = m_clut;
 
@@ -35,6 +35,12 @@ class alignas(32) GSClut : public GSAlignedClass<32>
 	u32* m_buff32;
 	u64* m_buff64;
 
+	// Hash of m_clut after the last write, so reloading an identical palette doesn't force a re-expand.
+	u64 m_clut_hash = 0;
+
+	// Bumped every time m_buff32/m_buff64 are re-expanded, lets users skip re-hashing an unchanged palette.
+	u32 m_read_generation = 0;
+
 	struct alignas(32) WriteState
 	{
 		GIFRegTEX0 TEX0;
@@ -109,6 +115,8 @@ public:
 	void Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
 	void GetAlphaMinMax32(int& amin, int& amax);
 
+	u32 GetReadGeneration() const { return m_read_generation; }
+
 	u32 operator[](size_t i) const { return m_buff32[i]; }
 
 	operator const u32*() const { return m_buff32; }
@@ -110,6 +110,16 @@ bool GSDumpBase::VSync(int field, bool last, const GSPrivRegSet* regs)
 	return (++m_frames & 1) == 0 && last && (m_extra_frames < 0);
 }
 
+void GSDumpBase::Keyframe(const freezeData& fd, const GSPrivRegSet* regs)
+{
+	AppendRawData(4);
+	AppendRawData(&fd.size, 4);
+	AppendRawData(fd.data, fd.size);
+
+	AppendRawData(3);
+	AppendRawData(regs, sizeof(*regs));
+}
+
 void GSDumpBase::Write(const void* data, size_t size)
 {
 	if (!m_gs || size == 0)
@@ -142,6 +152,98 @@ void GSDumpUncompressed::AppendRawData(u8 c)
 	Write(&c, 1);
 }
 
+//////////////////////////////////////////////////////////////////////
+// GSDumpCompressed implementation
+//////////////////////////////////////////////////////////////////////
+
+static u32 GetDumpCompressionThreads()
+{
+	// Leave most of the machine to the emulator, the dump only has to keep up with it.
+	return std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+}
+
+GSDumpCompressed::GSDumpCompressed(std::string fn)
+	: GSDumpBase(std::move(fn))
+{
+	m_fill_buff.reserve(COMPRESS_BLOCK_SIZE);
+	m_work_buff.reserve(COMPRESS_BLOCK_SIZE);
+}
+
+GSDumpCompressed::~GSDumpCompressed()
+{
+	pxAssertMsg(!m_worker.joinable(), "Compressed dump was not finished");
+}
+
+void GSDumpCompressed::AppendRawData(const void* data, size_t size)
+{
+	const u8* src = static_cast<const u8*>(data);
+	while (size > 0)
+	{
+		const size_t copy_size = std::min(size, COMPRESS_BLOCK_SIZE - m_fill_buff.size());
+		m_fill_buff.insert(m_fill_buff.end(), src, src + copy_size);
+		src += copy_size;
+		size -= copy_size;
+
+		if (m_fill_buff.size() == COMPRESS_BLOCK_SIZE)
+			SubmitBlock(false);
+	}
+}
+
+void GSDumpCompressed::AppendRawData(u8 c)
+{
+	m_fill_buff.push_back(c);
+	if (m_fill_buff.size() == COMPRESS_BLOCK_SIZE)
+		SubmitBlock(false);
+}
+
+void GSDumpCompressed::SubmitBlock(bool finish)
+{
+	std::unique_lock lock(m_mutex);
+
+	// Only one block is compressed at a time; if the worker is still busy with the previous one,
+	// the dump is being produced faster than it can be compressed, so we have to wait for it.
+	m_cv.wait(lock, [this]() { return !m_work_pending; });
+	m_work_buff.swap(m_fill_buff);
+	m_fill_buff.clear();
+	m_work_pending = true;
+	m_work_finish = finish;
+	lock.unlock();
+	m_cv.notify_all();
+
+	if (!m_worker.joinable())
+		m_worker = std::thread(&GSDumpCompressed::WorkerThread, this);
+}
+
+void GSDumpCompressed::WorkerThread()
+{
+	Threading::SetNameOfCurrentThread("GS Dump Compressor");
+
+	for (;;)
+	{
+		std::unique_lock lock(m_mutex);
+		m_cv.wait(lock, [this]() { return m_work_pending; });
+		const bool finish = m_work_finish;
+		lock.unlock();
+
+		CompressBlock(m_work_buff.data(), m_work_buff.size(), finish);
+
+		lock.lock();
+		m_work_buff.clear();
+		m_work_pending = false;
+		lock.unlock();
+		m_cv.notify_all();
+
+		if (finish)
+			break;
+	}
+}
+
+void GSDumpCompressed::Finish()
+{
+	SubmitBlock(true);
+	m_worker.join();
+}
+
 //////////////////////////////////////////////////////////////////////
 // GSDumpXz implementation
 //////////////////////////////////////////////////////////////////////
@@ -149,82 +251,68 @@ void GSDumpUncompressed::AppendRawData(u8 c)
 GSDumpXz::GSDumpXz(const std::string& fn, const std::string& serial, u32 crc,
 	u32 screenshot_width, u32 screenshot_height, const u32* screenshot_pixels,
 	const freezeData& fd, const GSPrivRegSet* regs)
-	: GSDumpBase(fn + ".gs.xz")
+	: GSDumpCompressed(fn + ".gs.xz")
 {
 	m_strm = LZMA_STREAM_INIT;
-	lzma_ret ret = lzma_easy_encoder(&m_strm, 6 /*level*/, LZMA_CHECK_CRC64);
+
+	lzma_mt mt = {};
+	mt.threads = GetDumpCompressionThreads();
+	mt.preset = 6;
+	mt.check = LZMA_CHECK_CRC64;
+	lzma_ret ret = lzma_stream_encoder_mt(&m_strm, &mt);
+	if (ret != LZMA_OK)
+	{
+		// liblzma may be built without threading support.
+		ret = lzma_easy_encoder(&m_strm, 6 /*level*/, LZMA_CHECK_CRC64);
+	}
 	if (ret != LZMA_OK)
 	{
 		fprintf(stderr, "GSDumpXz: Error initializing LZMA encoder ! (error code %u)\n", ret);
 		return;
 	}
 
+	m_valid = true;
+	m_out_buff.resize(_1mb);
+
 	AddHeader(serial, crc, screenshot_width, screenshot_height, screenshot_pixels, fd, regs);
 }
 
 GSDumpXz::~GSDumpXz()
 {
-	Flush();
-
-	// Finish the stream
-	m_strm.avail_in = 0;
-	Compress(LZMA_FINISH, LZMA_STREAM_END);
-
+	Finish();
 	lzma_end(&m_strm);
 }
 
-void GSDumpXz::AppendRawData(const void* data, size_t size)
-{
-	size_t old_size = m_in_buff.size();
-	m_in_buff.resize(old_size + size);
-	memcpy(&m_in_buff[old_size], data, size);
-
-	// Enough data was accumulated, time to write/compress it.  If compression
-	// is enabled, it will freeze PCSX2. 1GB should be enough for long dump.
-	//
-	// Note: long dumps are currently not supported so this path won't be executed
-	if (m_in_buff.size() > 1024 * 1024 * 1024)
-		Flush();
-}
-
-void GSDumpXz::AppendRawData(u8 c)
+void GSDumpXz::CompressBlock(const u8* data, size_t size, bool finish)
 {
-	m_in_buff.push_back(c);
-}
-
-void GSDumpXz::Flush()
-{
-	if (m_in_buff.empty())
+	if (!m_valid)
 		return;
 
-	m_strm.next_in = m_in_buff.data();
-	m_strm.avail_in = m_in_buff.size();
+	const lzma_action action = finish ? LZMA_FINISH : LZMA_RUN;
+	const lzma_ret expected_status = finish ? LZMA_STREAM_END : LZMA_OK;
 
-	Compress(LZMA_RUN, LZMA_OK);
+	m_strm.next_in = data;
+	m_strm.avail_in = size;
 
-	m_in_buff.clear();
-}
-
-void GSDumpXz::Compress(lzma_action action, lzma_ret expected_status)
-{
-	std::vector<u8> out_buff(1024 * 1024);
 	do
 	{
-		m_strm.next_out = out_buff.data();
-		m_strm.avail_out = out_buff.size();
-
-		lzma_ret ret = lzma_code(&m_strm, action);
+		m_strm.next_out = m_out_buff.data();
+		m_strm.avail_out = m_out_buff.size();
 
-		if (ret != expected_status)
+		const lzma_ret ret = lzma_code(&m_strm, action);
+		if (ret != expected_status && !(finish && ret == LZMA_OK))
 		{
 			fprintf(stderr, "GSDumpXz: Error %d\n", (int)ret);
+			m_valid = false;
 			return;
 		}
 
-		size_t write_size = out_buff.size() - m_strm.avail_out;
-		Write(out_buff.data(), write_size);
+		Write(m_out_buff.data(), m_out_buff.size() - m_strm.avail_out);
 
-	} while (m_strm.avail_out == 0);
+		// LZMA_FINISH has to be repeated until the stream end is reported.
+		if (finish && ret == LZMA_STREAM_END)
+			break;
+	} while (finish || m_strm.avail_in > 0 || m_strm.avail_out == 0);
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -234,14 +322,16 @@ void GSDumpXz::Compress(lzma_action action, lzma_ret expected_status)
 GSDumpZst::GSDumpZst(const std::string& fn, const std::string& serial, u32 crc,
 	u32 screenshot_width, u32 screenshot_height, const u32* screenshot_pixels,
 	const freezeData& fd, const GSPrivRegSet* regs)
-	: GSDumpBase(fn + ".gs.zst")
+	: GSDumpCompressed(fn + ".gs.zst")
 {
 	m_strm = ZSTD_createCStream();
 
 	// Compression level 6 provides a good balance between speed and ratio.
 	ZSTD_CCtx_setParameter(m_strm, ZSTD_c_compressionLevel, 6);
 
-	m_in_buff.reserve(_1mb);
+	// This fails harmlessly when zstd is built without multithreading, and we compress on one thread.
+	ZSTD_CCtx_setParameter(m_strm, ZSTD_c_nbWorkers, static_cast<int>(GetDumpCompressionThreads()));
+
 	m_out_buff.resize(_1mb);
 
 	AddHeader(serial, crc, screenshot_width, screenshot_height, screenshot_pixels, fd, regs);
@@ -249,38 +339,14 @@ GSDumpZst::GSDumpZst(const std::string& fn, const std::string& serial, u32 crc,
 
 GSDumpZst::~GSDumpZst()
 {
-	// Finish the stream
-	Compress(ZSTD_e_end);
-
+	Finish();
 	ZSTD_freeCStream(m_strm);
 }
 
-void GSDumpZst::AppendRawData(const void* data, size_t size)
+void GSDumpZst::CompressBlock(const u8* data, size_t size, bool finish)
 {
-	size_t old_size = m_in_buff.size();
-	m_in_buff.resize(old_size + size);
-	memcpy(&m_in_buff[old_size], data, size);
-	MayFlush();
-}
-
-void GSDumpZst::AppendRawData(u8 c)
-{
-	m_in_buff.push_back(c);
-	MayFlush();
-}
-
-void GSDumpZst::MayFlush()
-{
-	if (m_in_buff.size() >= _1mb)
-		Compress(ZSTD_e_continue);
-}
-
-void GSDumpZst::Compress(ZSTD_EndDirective action)
-{
-	if (m_in_buff.empty())
-		return;
-
-	ZSTD_inBuffer inbuf = {m_in_buff.data(), m_in_buff.size(), 0};
+	const ZSTD_EndDirective action = finish ? ZSTD_e_end : ZSTD_e_continue;
+	ZSTD_inBuffer inbuf = {data, size, 0};
 
 	for (;;)
 	{
@@ -294,10 +360,7 @@ void GSDumpZst::Compress(ZSTD_EndDirective action)
 		}
 
 		if (outbuf.pos > 0)
-		{
 			Write(m_out_buff.data(), outbuf.pos);
-			outbuf.pos = 0;
-		}
 
 		if (action == ZSTD_e_end)
 		{
@@ -312,6 +375,4 @@ void GSDumpZst::Compress(ZSTD_EndDirective action)
 				break;
 		}
 	}
-
-	m_in_buff.clear();
 }
@@ -18,7 +18,10 @@
 #include "SaveState.h"
 #include "GSRegs.h"
 #include "Renderers/SW/GSVertexSW.h"
+#include <condition_variable>
 #include <lzma.h>
+#include <mutex>
+#include <thread>
 #include <zstd.h>
 
 /*
@@ -38,6 +41,9 @@ ReadFIFO2 data (id == 2)
 Regs data (id == 3)
 - [PMODE/0x2000]
 
+Keyframe data (id == 4), written after every KEYFRAME_INTERVAL vsyncs and followed by a regs packet
+- [4/1] [state size/4] [state data/size]
+
 */
 
 #pragma pack(push, 4)
@@ -77,9 +83,15 @@ public:
 
 	__fi const std::string& GetPath() const { return m_filename; }
 
+	/// Vsyncs between keyframes, which let the replayer seek without going through every frame before.
+	static constexpr int KEYFRAME_INTERVAL = 120;
+
 	void ReadFIFO(u32 size);
 	void Transfer(int index, const u8* mem, size_t size);
 	bool VSync(int field, bool last, const GSPrivRegSet* regs);
+
+	__fi bool IsKeyframeDue() const { return m_gs && m_frames > 0 && (m_frames % KEYFRAME_INTERVAL) == 0; }
+	void Keyframe(const freezeData& fd, const GSPrivRegSet* regs);
 };
 
 class GSDumpUncompressed final : public GSDumpBase
@@ -94,16 +106,47 @@ public:
 	virtual ~GSDumpUncompressed() = default;
 };
 
-class GSDumpXz final : public GSDumpBase
+/// Base for compressed dumps. Data is gathered into blocks on the GS thread, and each full block is
+/// handed to a worker thread to compress, so recording a dump doesn't stall the frame being captured.
+class GSDumpCompressed : public GSDumpBase
+{
+	static constexpr size_t COMPRESS_BLOCK_SIZE = 4 * _1mb;
+
+	std::vector<u8> m_fill_buff;
+	std::vector<u8> m_work_buff;
+	bool m_work_pending = false;
+	bool m_work_finish = false;
+
+	std::thread m_worker;
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+
+	void AppendRawData(const void* data, size_t size) final;
+	void AppendRawData(u8 c) final;
+	void SubmitBlock(bool finish);
+	void WorkerThread();
+
+protected:
+	/// Called on the worker thread for each block. finish is set on the last call, which may be empty.
+	virtual void CompressBlock(const u8* data, size_t size, bool finish) = 0;
+
+	/// Compresses the remaining data, ends the stream and stops the worker.
+	/// Must be called by the derived class's destructor, before its encoder goes away.
+	void Finish();
+
+public:
+	GSDumpCompressed(std::string fn);
+	virtual ~GSDumpCompressed();
+};
+
+class GSDumpXz final : public GSDumpCompressed
 {
 	lzma_stream m_strm;
+	bool m_valid = false;
 
-	std::vector<u8> m_in_buff;
+	std::vector<u8> m_out_buff;
 
-	void Flush();
-	void Compress(lzma_action action, lzma_ret expected_status);
-	void AppendRawData(const void* data, size_t size);
-	void AppendRawData(u8 c);
+	void CompressBlock(const u8* data, size_t size, bool finish) override;
 
 public:
 	GSDumpXz(const std::string& fn, const std::string& serial, u32 crc,
@@ -112,17 +155,13 @@ public:
 	virtual ~GSDumpXz();
 };
 
-class GSDumpZst final : public GSDumpBase
+class GSDumpZst final : public GSDumpCompressed
 {
 	ZSTD_CStream* m_strm;
 
-	std::vector<u8> m_in_buff;
 	std::vector<u8> m_out_buff;
 
-	void MayFlush();
-	void Compress(ZSTD_EndDirective action);
-	void AppendRawData(const void* data, size_t size);
-	void AppendRawData(u8 c);
+	void CompressBlock(const u8* data, size_t size, bool finish) override;
 
 public:
 	GSDumpZst(const std::string& fn, const std::string& serial, u32 crc,
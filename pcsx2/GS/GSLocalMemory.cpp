@@ -364,6 +364,12 @@ GSLocalMemory::~GSLocalMemory()
 	else
 		vmfree(m_vm8, m_vmsize * 4);
 
+	if (m_pixel_offset_lookups > 0)
+	{
+		DevCon.WriteLn("GSLocalMemory: %u pixel offset tables built for %u lookups (%.1f%% hit rate).", m_pixel_offset_builds,
+			m_pixel_offset_lookups, 100.0 * (m_pixel_offset_lookups - m_pixel_offset_builds) / m_pixel_offset_lookups);
+	}
+
 	for (auto& i : m_pomap)
 		_aligned_free(i.second);
 	for (auto& i : m_po4map)
@@ -375,6 +381,23 @@ GSLocalMemory::~GSLocalMemory()
 	}
 }
 
+const int* GSLocalMemory::GetPixelColumnOffsets(u32 psm)
+{
+	std::unique_ptr<int[]>& col = m_pixel_col[psm];
+	if (!col)
+	{
+		const GSSwizzleInfo& info = m_psm[psm].info;
+		const int shift = m_psm[psm].bpp >> 5;
+		const u32 base = info.pa(0, 0, 0, 32);
+
+		col = std::make_unique<int[]>(2048);
+		for (int i = 0; i < 2048; i++)
+			col[i] = (info.pa(i, 0, 0, 32) - base) << shift;
+	}
+
+	return col.get();
+}
+
 GSPixelOffset* GSLocalMemory::GetPixelOffset(const GIFRegFRAME& FRAME, const GIFRegZBUF& ZBUF)
 {
 	u32 fbp = FRAME.Block();
@@ -392,6 +415,8 @@ GSPixelOffset* GSLocalMemory::GetPixelOffset(const GIFRegFRAME& FRAME, const GIF
 
 	u32 hash = (FRAME.FBP << 0) | (ZBUF.ZBP << 9) | (bw << 18) | (fpsm_hash << 24) | (zpsm_hash << 28);
 
+	m_pixel_offset_lookups++;
+
 	auto it = m_pomap.find(hash);
 
 	if (it != m_pomap.end())
@@ -399,6 +424,8 @@ GSPixelOffset* GSLocalMemory::GetPixelOffset(const GIFRegFRAME& FRAME, const GIF
 		return it->second;
 	}
 
+	m_pixel_offset_builds++;
+
 	GSPixelOffset* off = (GSPixelOffset*)_aligned_malloc(sizeof(GSPixelOffset), 32);
 
 	off->hash = hash;
@@ -417,10 +444,13 @@ GSPixelOffset* GSLocalMemory::GetPixelOffset(const GIFRegFRAME& FRAME, const GIF
 		off->row[i].y = (int)m_psm[zpsm].info.pa(0, i, zbp, bw) << zs;
 	}
 
+	const int* fcol = GetPixelColumnOffsets(fpsm);
+	const int* zcol = GetPixelColumnOffsets(zpsm);
+
 	for (int i = 0; i < 2048; i++)
 	{
-		off->col[i].x = (m_psm[fpsm].info.pa(i, 0, 0, 32) - m_psm[fpsm].info.pa(0, 0, 0, 32)) << fs;
-		off->col[i].y = (m_psm[zpsm].info.pa(i, 0, 0, 32) - m_psm[zpsm].info.pa(0, 0, 0, 32)) << zs;
+		off->col[i].x = fcol[i];
+		off->col[i].y = zcol[i];
 	}
 
 	m_pomap[hash] = off;
@@ -445,6 +475,8 @@ GSPixelOffset4* GSLocalMemory::GetPixelOffset4(const GIFRegFRAME& FRAME, const G
 
 	u32 hash = (FRAME.FBP << 0) | (ZBUF.ZBP << 9) | (bw << 18) | (fpsm_hash << 24) | (zpsm_hash << 28);
 
+	m_pixel_offset_lookups++;
+
 	auto it = m_po4map.find(hash);
 
 	if (it != m_po4map.end())
@@ -452,6 +484,8 @@ GSPixelOffset4* GSLocalMemory::GetPixelOffset4(const GIFRegFRAME& FRAME, const G
 		return it->second;
 	}
 
+	m_pixel_offset_builds++;
+
 	GSPixelOffset4* off = (GSPixelOffset4*)_aligned_malloc(sizeof(GSPixelOffset4), 32);
 
 	off->hash = hash;
@@ -470,10 +504,13 @@ GSPixelOffset4* GSLocalMemory::GetPixelOffset4(const GIFRegFRAME& FRAME, const G
 		off->row[i].y = (int)m_psm[zpsm].info.pa(0, i, zbp, bw) << zs;
 	}
 
+	const int* fcol = GetPixelColumnOffsets(fpsm);
+	const int* zcol = GetPixelColumnOffsets(zpsm);
+
 	for (int i = 0; i < 512; i++)
 	{
-		off->col[i].x = (m_psm[fpsm].info.pa(i * 4, 0, 0, 32) - m_psm[fpsm].info.pa(0, 0, 0, 32)) << fs;
-		off->col[i].y = (m_psm[zpsm].info.pa(i * 4, 0, 0, 32) - m_psm[zpsm].info.pa(0, 0, 0, 32)) << zs;
+		off->col[i].x = fcol[i * 4];
+		off->col[i].y = zcol[i * 4];
 	}
 
 	m_po4map[hash] = off;
@@ -593,23 +630,27 @@ void GSLocalMemory::WriteImageColumn(int l, int r, int y, int h, const u8* src,
 template <int psm, int bsx, int bsy, int alignment>
 void GSLocalMemory::WriteImageBlock(int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
 {
-	u32 bp = BITBLTBUF.DBP;
-	u32 bw = BITBLTBUF.DBW;
+	// Everything here is whole blocks, so step through the swizzle incrementally rather than
+	// computing each block's address from scratch. Big aligned uploads spend nearly all their time in here.
+	const GSOffset off = GSOffset::fromKnownPSM(BITBLTBUF.DBP, BITBLTBUF.DBW, static_cast<GS_PSM>(psm));
+	GSOffset::BNHelper bn = off.bnMulti(l, y);
 
-	for (int offset = srcpitch * bsy; h >= bsy; h -= bsy, y += bsy, src += offset)
+	for (int offset = srcpitch * bsy; h >= bsy; h -= bsy, src += offset, bn.nextBlockY())
 	{
-		for (int x = l; x < r; x += bsx)
+		for (int x = l; x < r; x += bsx, bn.nextBlockX())
 		{
+			u8* dst = BlockPtr(bn.value());
+
 			switch (psm)
 			{
-				case PSM_PSMCT32: GSBlock::WriteBlock32<alignment, 0xffffffff>(BlockPtr32(x, y, bp, bw), &src[x * 4], srcpitch); break;
-				case PSM_PSMCT16: GSBlock::WriteBlock16<alignment>(BlockPtr16(x, y, bp, bw), &src[x * 2], srcpitch); break;
-				case PSM_PSMCT16S: GSBlock::WriteBlock16<alignment>(BlockPtr16S(x, y, bp, bw), &src[x * 2], srcpitch); break;
-				case PSM_PSMT8: GSBlock::WriteBlock8<alignment>(BlockPtr8(x, y, bp, bw), &src[x], srcpitch); break;
-				case PSM_PSMT4: GSBlock::WriteBlock4<alignment>(BlockPtr4(x, y, bp, bw), &src[x >> 1], srcpitch); break;
-				case PSM_PSMZ32: GSBlock::WriteBlock32<alignment, 0xffffffff>(BlockPtr32Z(x, y, bp, bw), &src[x * 4], srcpitch); break;
-				case PSM_PSMZ16: GSBlock::WriteBlock16<alignment>(BlockPtr16Z(x, y, bp, bw), &src[x * 2], srcpitch); break;
-				case PSM_PSMZ16S: GSBlock::WriteBlock16<alignment>(BlockPtr16SZ(x, y, bp, bw), &src[x * 2], srcpitch); break;
+				case PSM_PSMCT32:
+				case PSM_PSMZ32: GSBlock::WriteBlock32<alignment, 0xffffffff>(dst, &src[x * 4], srcpitch); break;
+				case PSM_PSMCT16:
+				case PSM_PSMCT16S:
+				case PSM_PSMZ16:
+				case PSM_PSMZ16S: GSBlock::WriteBlock16<alignment>(dst, &src[x * 2], srcpitch); break;
+				case PSM_PSMT8: GSBlock::WriteBlock8<alignment>(dst, &src[x], srcpitch); break;
+				case PSM_PSMT4: GSBlock::WriteBlock4<alignment>(dst, &src[x >> 1], srcpitch); break;
 				// TODO
 				default: __assume(0);
 			}
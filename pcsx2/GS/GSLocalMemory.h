@@ -516,6 +516,14 @@ protected:
 	std::unordered_map<u32, GSPixelOffset4*> m_po4map;
 	std::unordered_map<u64, std::vector<GSVector2i>*> m_p2tmap;
 
+	// Column offsets of the pixel offset tables only depend on the format, so they're built once per
+	// PSM and shared by every bp/bw combination. Only the rows are computed for a new FRAME/ZBUF pair.
+	std::unique_ptr<int[]> m_pixel_col[64];
+	u32 m_pixel_offset_lookups = 0;
+	u32 m_pixel_offset_builds = 0;
+
+	const int* GetPixelColumnOffsets(u32 psm);
+
 public:
 	GSLocalMemory();
 	virtual ~GSLocalMemory();
@@ -223,6 +223,9 @@ bool GSDumpFile::ReadFile()
 			case GSType::Registers:
 				packet.length = 8192;
 				break;
+			case GSType::Keyframe:
+				GET_WORD(&packet.length);
+				break;
 			default:
 				return false;
 		}
@@ -244,6 +247,11 @@ bool GSDumpFile::ReadFile()
 			remaining -= packet.length;
 		}
 
+		if (packet.id == GSType::VSync)
+			m_frame_count++;
+		else if (packet.id == GSType::Keyframe)
+			m_keyframes.push_back({m_frame_count, static_cast<u32>(m_dump_packets.size())});
+
 		m_dump_packets.push_back(std::move(packet));
 	}
 
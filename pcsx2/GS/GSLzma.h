@@ -49,7 +49,8 @@ namespace GSDumpTypes
 	X(GSType, Transfer,  0) \
 	X(GSType, VSync,     1) \
 	X(GSType, ReadFIFO2, 2) \
-	X(GSType, Registers, 3)
+	X(GSType, Registers, 3) \
+	X(GSType, Keyframe,  4)
 		GEN_REG_ENUM_CLASS_AND_GETNAME(DEF_GSType, GSType, u8, "UnknownType")
 #undef DEF_GSType
 
@@ -298,8 +299,16 @@ public:
 		GSDumpTypes::GSTransferPath path;
 	};
 
+	/// A packet holding a full GS state, which replay can restart from.
+	struct Keyframe
+	{
+		u32 frame; ///< Number of vsyncs before the keyframe.
+		u32 packet; ///< Index of the keyframe packet.
+	};
+
 	using ByteArray = std::vector<u8>;
 	using GSDataArray = std::vector<GSData>;
+	using KeyframeArray = std::vector<Keyframe>;
 
 	virtual ~GSDumpFile();
 
@@ -312,6 +321,8 @@ public:
 	__fi const ByteArray& GetRegsData() const { return m_regs_data; }
 	__fi const ByteArray& GetStateData() const { return m_state_data; }
 	__fi const GSDataArray& GetPackets() const { return m_dump_packets; }
+	__fi const KeyframeArray& GetKeyframes() const { return m_keyframes; }
+	__fi u32 GetFrameCount() const { return m_frame_count; }
 
 	bool ReadFile();
 
@@ -336,6 +347,8 @@ private:
 	std::vector<u8> m_packet_data;
 
 	GSDataArray m_dump_packets;
+	KeyframeArray m_keyframes;
+	u32 m_frame_count = 0;
 };
 
 class GSDumpLzma : public GSDumpFile
@@ -28,12 +28,19 @@ void GSPerfMon::Reset()
 	m_count = 0;
 	std::memset(m_counters, 0, sizeof(m_counters));
 	std::memset(m_stats, 0, sizeof(m_stats));
+	std::memset(m_frame_counters, 0, sizeof(m_frame_counters));
+	std::memset(m_last_frame, 0, sizeof(m_last_frame));
+	std::memset(m_thread_busy_counters, 0, sizeof(m_thread_busy_counters));
+	std::memset(m_thread_busy_stats, 0, sizeof(m_thread_busy_stats));
 }
 
 void GSPerfMon::EndFrame()
 {
 	m_frame++;
 	m_count++;
+
+	std::memcpy(m_last_frame, m_frame_counters, sizeof(m_last_frame));
+	std::memset(m_frame_counters, 0, sizeof(m_frame_counters));
 }
 
 void GSPerfMon::Update()
@@ -45,8 +52,14 @@ void GSPerfMon::Update()
 			m_stats[i] = m_counters[i] / m_count;
 		}
 
+		for (size_t i = 0; i < std::size(m_thread_busy_counters); i++)
+		{
+			m_thread_busy_stats[i] = m_thread_busy_counters[i] / m_count;
+		}
+
 		m_count = 0;
 	}
 
 	memset(m_counters, 0, sizeof(m_counters));
+	memset(m_thread_busy_counters, 0, sizeof(m_thread_busy_counters));
 }
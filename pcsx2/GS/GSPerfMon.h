@@ -30,16 +30,38 @@ public:
 		Quad,
 		SyncPoint,
 		Barriers,
+		TransferFlushes,
+		// SW: draws and transfers that had to wait for queued draws using the same pages, by cause.
+		SyncTarget,
+		SyncSource,
+		SyncTransfer,
+		// HW: target readbacks skipped because local memory already held the data.
+		ReadbacksElided,
+		// HW: rects added to target dirty lists, and how many of those were merged into another.
+		DirtyRects,
+		DirtyRectsMerged,
+		// HW: draws that had to call a per-game CRC hack or render hook.
+		HackChecks,
 		CounterLast,
 
 		// Reused counters for HW.
 		TextureCopies = Fillrate,
 		TextureUploads = SyncPoint,
+		TextureAllocations = Quad,
+		TargetLookups = SyncTarget, // targets visited by lookups and invalidations
+		TargetLookupsSkipped = SyncSource, // target list walks avoided by the page map
+		TextureMipmaps = SyncTransfer, // mip levels uploaded from GS memory or generated on the GPU
 	};
 
+	static constexpr int MaxThreads = 64;
+
 protected:
 	double m_counters[CounterLast] = {};
 	double m_stats[CounterLast] = {};
+	double m_frame_counters[CounterLast] = {};
+	double m_last_frame[CounterLast] = {};
+	double m_thread_busy_counters[MaxThreads] = {};
+	double m_thread_busy_stats[MaxThreads] = {};
 	u64 m_frame = 0;
 	clock_t m_lastframe = 0;
 	int m_count = 0;
@@ -54,8 +76,24 @@ public:
 	u64 GetFrame() { return m_frame; }
 	void EndFrame();
 
-	void Put(counter_t c, double val) { m_counters[c] += val; }
+	void Put(counter_t c, double val)
+	{
+		m_counters[c] += val;
+		m_frame_counters[c] += val;
+	}
 	double Get(counter_t c) { return m_stats[c]; }
+
+	/// Counter totals of the last completed frame (not averaged).
+	double GetLastFrame(counter_t c) const { return m_last_frame[c]; }
+
+	/// Milliseconds a software rasterizer thread spent drawing, reported as a per-frame average.
+	void PutThreadBusy(int thread, double ms)
+	{
+		if (thread < MaxThreads)
+			m_thread_busy_counters[thread] += ms;
+	}
+	double GetThreadBusy(int thread) const { return (thread < MaxThreads) ? m_thread_busy_stats[thread] : 0.0; }
+
 	void Update();
 
 	__fi void AddDisplayFramebufferSpriteBlit() { m_disp_fb_sprite_blits++; }
@@ -19,6 +19,8 @@
 #include "common/FileSystem.h"
 #include <zlib.h>
 #include <png.h>
+#include <mutex>
+#include <thread>
 
 struct
 {
@@ -73,6 +75,9 @@ namespace GSPng
 
 			png_init_io(png_ptr, fp);
 			png_set_compression_level(png_ptr, compression);
+			// adaptive filtering costs more than the deflate itself at the fastest level
+			if (compression == Z_BEST_SPEED)
+				png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_NONE);
 			png_set_IHDR(png_ptr, info_ptr, width, height, channel_bit_depth, type,
 				PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
 			png_write_info(png_ptr, info_ptr);
@@ -148,7 +153,41 @@ namespace GSPng
 
 	void Process(std::shared_ptr<Transaction>& item)
 	{
-		Save(item->m_fmt, item->m_file, item->m_image, item->m_w, item->m_h, item->m_pitch, item->m_compression);
+		const bool result = item->m_image &&
+			Save(item->m_fmt, item->m_file, item->m_image, item->m_w, item->m_h, item->m_pitch, item->m_compression);
+		if (item->m_callback)
+			item->m_callback(result);
+	}
+
+	static std::mutex s_async_workers_mutex;
+	static std::vector<std::unique_ptr<Worker>> s_async_workers;
+	static u32 s_async_next_worker = 0;
+
+	void SaveAsync(GSPng::Format fmt, const std::string& file, const u8* image, int w, int h, int pitch, int compression,
+		std::function<void(bool)> callback)
+	{
+		std::shared_ptr<Transaction> item = std::make_shared<Transaction>(fmt, file, image, w, h, pitch, compression);
+		item->m_callback = std::move(callback);
+
+		std::unique_lock<std::mutex> lock(s_async_workers_mutex);
+		if (s_async_workers.empty())
+		{
+			const u32 count = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+			for (u32 i = 0; i < count; i++)
+				s_async_workers.push_back(std::make_unique<Worker>(std::function<void()>(), &Process, std::function<void()>()));
+		}
+
+		s_async_workers[s_async_next_worker]->Push(item);
+		s_async_next_worker = (s_async_next_worker + 1) % static_cast<u32>(s_async_workers.size());
+	}
+
+	void FlushAsyncSaves()
+	{
+		std::unique_lock<std::mutex> lock(s_async_workers_mutex);
+		for (const std::unique_ptr<Worker>& worker : s_async_workers)
+			worker->Wait();
+		s_async_workers.clear();
+		s_async_next_worker = 0;
 	}
 
 } // namespace GSPng
@@ -42,6 +42,7 @@ namespace GSPng
 		int m_h;
 		int m_pitch;
 		int m_compression;
+		std::function<void(bool)> m_callback;
 
 		Transaction(GSPng::Format fmt, const std::string& file, const u8* image, int w, int h, int pitch, int compression);
 		~Transaction();
@@ -52,4 +53,12 @@ namespace GSPng
 	void Process(std::shared_ptr<Transaction>& item);
 
 	using Worker = GSJobQueue<std::shared_ptr<Transaction>, 16>;
+
+	/// Copies the image and encodes it on a shared pool of worker threads. The callback, if any, is
+	/// invoked on the worker thread with the result. Blocks if every worker's queue is full.
+	void SaveAsync(GSPng::Format fmt, const std::string& file, const u8* image, int w, int h, int pitch, int compression,
+		std::function<void(bool)> callback = {});
+
+	/// Waits for all queued asynchronous saves to complete, and releases the worker threads.
+	void FlushAsyncSaves();
 } // namespace GSPng
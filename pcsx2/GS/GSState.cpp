@@ -54,6 +54,8 @@ GSState::GSState()
 	m_nativeres = GSConfig.UpscaleMultiplier == 1;
 	m_mipmap = GSConfig.Mipmap;
 
+	m_pending_invalidate_rect = GSVector4i::zero();
+
 	s_n = 0;
 	s_dump = theApp.GetConfigB("dump");
 	s_save = theApp.GetConfigB("save");
@@ -78,6 +80,7 @@ GSState::GSState()
 	memset(&m_v, 0, sizeof(m_v));
 	memset(&m_vertex, 0, sizeof(m_vertex));
 	memset(&m_index, 0, sizeof(m_index));
+	m_vertex_reserved = 0;
 
 	m_v.RGBAQ.Q = 1.0f;
 
@@ -141,10 +144,7 @@ GSState::GSState()
 
 GSState::~GSState()
 {
-	if (m_vertex.buff)
-		_aligned_free(m_vertex.buff);
-	if (m_index.buff)
-		_aligned_free(m_index.buff);
+	FreeVertexBuffer();
 }
 
 void GSState::Reset(bool hardware_reset)
@@ -204,7 +204,11 @@ void GSState::SetPrimHandlers()
 	m_fpGIFRegHandlerXYZ[P][2] = &GSState::GIFRegHandlerXYZ2<P, 0, auto_flush, index_swap>; \
 	m_fpGIFRegHandlerXYZ[P][3] = &GSState::GIFRegHandlerXYZ2<P, 1, auto_flush, index_swap>; \
 	m_fpGIFPackedRegHandlerSTQRGBAXYZF2[P] = &GSState::GIFPackedRegHandlerSTQRGBAXYZF2<P, auto_flush, index_swap>; \
-	m_fpGIFPackedRegHandlerSTQRGBAXYZ2[P] = &GSState::GIFPackedRegHandlerSTQRGBAXYZ2<P, auto_flush, index_swap>;
+	m_fpGIFPackedRegHandlerSTQRGBAXYZ2[P] = &GSState::GIFPackedRegHandlerSTQRGBAXYZ2<P, auto_flush, index_swap>; \
+	m_fpGIFPackedRegHandlerRGBAXYZF2[P][0] = &GSState::GIFPackedRegHandlerRGBAXYZF2<P, auto_flush, index_swap, false>; \
+	m_fpGIFPackedRegHandlerRGBAXYZF2[P][1] = &GSState::GIFPackedRegHandlerRGBAXYZF2<P, auto_flush, index_swap, true>; \
+	m_fpGIFPackedRegHandlerRGBAXYZ2[P][0] = &GSState::GIFPackedRegHandlerRGBAXYZ2<P, auto_flush, index_swap, false>; \
+	m_fpGIFPackedRegHandlerRGBAXYZ2[P][1] = &GSState::GIFPackedRegHandlerRGBAXYZ2<P, auto_flush, index_swap, true>;
 
 	SetHandlerXYZ(GS_POINTLIST, true, false);
 	SetHandlerXYZ(GS_LINELIST, auto_flush, index_swap);
@@ -830,31 +834,26 @@ void GSState::GIFPackedRegHandlerSTQRGBAXYZF2(const GIFPackedReg* RESTRICT r, u3
 
 	CheckFlushes();
 
-	const GIFPackedReg* RESTRICT r_end = r + size;
-
-	while (r < r_end)
-	{
-		const GSVector4i st = GSVector4i::loadl(&r[0].U64[0]);
-		GSVector4i q = GSVector4i::loadl(&r[0].U64[1]);
-		const GSVector4i rgba = (GSVector4i::load<false>(&r[1]) & GSVector4i::x000000ff()).ps32().pu16();
+	VertexKickBatch<prim, auto_flush, index_swap>(r, size / 3, 3, [this](const GIFPackedReg* RESTRICT v) {
+		const GSVector4i st = GSVector4i::loadl(&v[0].U64[0]);
+		GSVector4i q = GSVector4i::loadl(&v[0].U64[1]);
+		const GSVector4i rgba = (GSVector4i::load<false>(&v[1]) & GSVector4i::x000000ff()).ps32().pu16();
 
 		q = q.blend8(GSVector4i::cast(GSVector4::m_one), q == GSVector4i::zero()); // see GIFPackedRegHandlerSTQ
 
 		m_v.m[0] = st.upl64(rgba.upl32(q)); // TODO: only store the last one
 
-		GSVector4i xy = GSVector4i::loadl(&r[2].U64[0]);
-		GSVector4i zf = GSVector4i::loadl(&r[2].U64[1]);
+		GSVector4i xy = GSVector4i::loadl(&v[2].U64[0]);
+		GSVector4i zf = GSVector4i::loadl(&v[2].U64[1]);
 		xy = xy.upl16(xy.srl<4>()).upl32(GSVector4i::load((int)m_v.UV));
 		zf = zf.srl32(4) & GSVector4i::x00ffffff().upl32(GSVector4i::x000000ff());
 
 		m_v.m[1] = xy.upl32(zf); // TODO: only store the last one
 
-		VertexKick<prim, auto_flush, index_swap>(r[2].XYZF2.Skip());
-
-		r += 3;
-	}
+		return v[2].XYZF2.Skip();
+	});
 
-	m_q = r[-3].STQ.Q; // remember the last one, STQ outputs this to the temp Q each time
+	m_q = r[size - 3].STQ.Q; // remember the last one, STQ outputs this to the temp Q each time
 }
 
 template <u32 prim, bool auto_flush, bool index_swap>
@@ -864,30 +863,97 @@ void GSState::GIFPackedRegHandlerSTQRGBAXYZ2(const GIFPackedReg* RESTRICT r, u32
 
 	CheckFlushes();
 
-	const GIFPackedReg* RESTRICT r_end = r + size;
-
-	while (r < r_end)
-	{
-		const GSVector4i st = GSVector4i::loadl(&r[0].U64[0]);
-		GSVector4i q = GSVector4i::loadl(&r[0].U64[1]);
-		const GSVector4i rgba = (GSVector4i::load<false>(&r[1]) & GSVector4i::x000000ff()).ps32().pu16();
+	VertexKickBatch<prim, auto_flush, index_swap>(r, size / 3, 3, [this](const GIFPackedReg* RESTRICT v) {
+		const GSVector4i st = GSVector4i::loadl(&v[0].U64[0]);
+		GSVector4i q = GSVector4i::loadl(&v[0].U64[1]);
+		const GSVector4i rgba = (GSVector4i::load<false>(&v[1]) & GSVector4i::x000000ff()).ps32().pu16();
 
 		q = q.blend8(GSVector4i::cast(GSVector4::m_one), q == GSVector4i::zero()); // see GIFPackedRegHandlerSTQ
 
 		m_v.m[0] = st.upl64(rgba.upl32(q)); // TODO: only store the last one
 
-		const GSVector4i xy = GSVector4i::loadl(&r[2].U64[0]);
-		const GSVector4i z = GSVector4i::loadl(&r[2].U64[1]);
+		const GSVector4i xy = GSVector4i::loadl(&v[2].U64[0]);
+		const GSVector4i z = GSVector4i::loadl(&v[2].U64[1]);
 		const GSVector4i xyz = xy.upl16(xy.srl<4>()).upl32(z);
 
 		m_v.m[1] = xyz.upl64(GSVector4i::loadl(&m_v.UV)); // TODO: only store the last one
 
-		VertexKick<prim, auto_flush, index_swap>(r[2].XYZ2.Skip());
+		return v[2].XYZ2.Skip();
+	});
 
-		r += 3;
-	}
+	m_q = r[size - 3].STQ.Q; // remember the last one, STQ outputs this to the temp Q each time
+}
+
+// Same as running the UV (if present), RGBA and XYZF2 handlers for each vertex, without the calls in between.
+template <u32 prim, bool auto_flush, bool index_swap, bool uv>
+void GSState::GIFPackedRegHandlerRGBAXYZF2(const GIFPackedReg* RESTRICT r, u32 size)
+{
+	constexpr u32 nreg = uv ? 3 : 2;
+
+	ASSERT(size > 0 && size % nreg == 0);
+
+	CheckFlushes();
+
+	const GSVector4i mask = GSVector4i::load(0x0c080400);
+	const bool uv_hack = uv && GSConfig.UserHacks_WildHack;
+
+	m_v.RGBAQ.Q = m_q;
+
+	VertexKickBatch<prim, auto_flush, index_swap>(r, size / nreg, nreg, [this, mask, uv_hack](const GIFPackedReg* RESTRICT v) {
+		if (uv)
+		{
+			const GSVector4i t = GSVector4i::loadl(&v[0]) & GSVector4i::x00003fff();
+			m_v.UV = (u32)GSVector4i::store(t.ps32(t));
+			if (uv_hack)
+				m_isPackedUV_HackFlag = true;
+		}
+
+		m_v.RGBAQ.U32[0] = (u32)GSVector4i::store(GSVector4i::load<false>(&v[nreg - 2]).shuffle8(mask));
+
+		GSVector4i xy = GSVector4i::loadl(&v[nreg - 1].U64[0]);
+		GSVector4i zf = GSVector4i::loadl(&v[nreg - 1].U64[1]);
+		xy = xy.upl16(xy.srl<4>()).upl32(GSVector4i::load((int)m_v.UV));
+		zf = zf.srl32(4) & GSVector4i::x00ffffff().upl32(GSVector4i::x000000ff());
+
+		m_v.m[1] = xy.upl32(zf);
+
+		return v[nreg - 1].XYZF2.Skip();
+	});
+}
+
+template <u32 prim, bool auto_flush, bool index_swap, bool uv>
+void GSState::GIFPackedRegHandlerRGBAXYZ2(const GIFPackedReg* RESTRICT r, u32 size)
+{
+	constexpr u32 nreg = uv ? 3 : 2;
+
+	ASSERT(size > 0 && size % nreg == 0);
+
+	CheckFlushes();
+
+	const GSVector4i mask = GSVector4i::load(0x0c080400);
+	const bool uv_hack = uv && GSConfig.UserHacks_WildHack;
+
+	m_v.RGBAQ.Q = m_q;
+
+	VertexKickBatch<prim, auto_flush, index_swap>(r, size / nreg, nreg, [this, mask, uv_hack](const GIFPackedReg* RESTRICT v) {
+		if (uv)
+		{
+			const GSVector4i t = GSVector4i::loadl(&v[0]) & GSVector4i::x00003fff();
+			m_v.UV = (u32)GSVector4i::store(t.ps32(t));
+			if (uv_hack)
+				m_isPackedUV_HackFlag = true;
+		}
+
+		m_v.RGBAQ.U32[0] = (u32)GSVector4i::store(GSVector4i::load<false>(&v[nreg - 2]).shuffle8(mask));
 
-	m_q = r[-3].STQ.Q; // remember the last one, STQ outputs this to the temp Q each time
+		const GSVector4i xy = GSVector4i::loadl(&v[nreg - 1].U64[0]);
+		const GSVector4i z = GSVector4i::loadl(&v[nreg - 1].U64[1]);
+		const GSVector4i xyz = xy.upl16(xy.srl<4>()).upl32(z);
+
+		m_v.m[1] = xyz.upl64(GSVector4i::loadl(&m_v.UV));
+
+		return v[nreg - 1].XYZ2.Skip();
+	});
 }
 
 void GSState::GIFPackedRegHandlerNOP(const GIFPackedReg* RESTRICT r, u32 size)
@@ -1609,7 +1675,21 @@ void GSState::GIFRegHandlerTRXDIR(const GIFReg* RESTRICT r)
 {
 	GL_REG("TRXDIR = 0x%x_%x", r->U32[1], r->U32[0]);
 
-	Flush();
+	// Uploads which can't affect the queued draw don't need to end it, which lets the draws
+	// either side of the upload go to the GPU as one. Games streaming textures between sprite
+	// kicks otherwise end up with a draw call per sprite. Uploads also keep the pending
+	// invalidation, so back to back uploads of one texture are invalidated together.
+	if (r->TRXDIR.XDIR == 0 && (m_index.tail == 0 || !TransferOverlapsQueuedDraw()))
+	{
+		FlushWrite();
+	}
+	else
+	{
+		if (m_index.tail > 0)
+			g_perfmon.Put(GSPerfMon::TransferFlushes, 1);
+
+		Flush();
+	}
 
 	m_env.TRXDIR = (GSVector4i)r->TRXDIR;
 
@@ -1629,6 +1709,56 @@ void GSState::GIFRegHandlerTRXDIR(const GIFReg* RESTRICT r)
 	}
 }
 
+bool GSState::TransferOverlapsQueuedDraw() const
+{
+	const GIFRegBITBLTBUF& blit = m_env.BITBLTBUF;
+	const GSVector4i rect(m_env.TRXPOS.DSAX, m_env.TRXPOS.DSAY,
+		m_env.TRXPOS.DSAX + m_env.TRXREG.RRW, m_env.TRXPOS.DSAY + m_env.TRXREG.RRH);
+
+	u32 pages[MAX_PAGES / 32] = {};
+	m_mem.GetOffset(blit.DBP, blit.DBW, blit.DPSM).loopPages(rect, [&pages](u32 page) {
+		pages[page >> 5] |= 1u << (page & 31);
+	});
+
+	const auto overlaps = [this, &pages](u32 bp, u32 bw, u32 psm, const GSVector4i& r) {
+		bool result = false;
+		m_mem.GetOffset(bp, bw, psm).pageLooperForRect(r).loopPagesWithBreak([&](u32 page) {
+			result = (pages[page >> 5] & (1u << (page & 31))) != 0;
+			return !result;
+		});
+		return result;
+	};
+
+	// The queued draw is described by the environment it was kicked with, not the current one.
+	const GSDrawingContext& ctx = m_prev_env.CTXT[m_prev_env.PRIM.CTXT];
+	const GSVector4i scissor(ctx.SCISSOR.SCAX0, ctx.SCISSOR.SCAY0, ctx.SCISSOR.SCAX1 + 1, ctx.SCISSOR.SCAY1 + 1);
+
+	if (overlaps(ctx.FRAME.Block(), ctx.FRAME.FBW, ctx.FRAME.PSM, scissor))
+		return true;
+
+	if (!(ctx.ZBUF.ZMSK && (!ctx.TEST.ZTE || ctx.TEST.ZTST == ZTST_ALWAYS)) &&
+		overlaps(ctx.ZBUF.Block(), ctx.FRAME.FBW, ctx.ZBUF.PSM, scissor))
+	{
+		return true;
+	}
+
+	if (m_prev_env.PRIM.TME)
+	{
+		// Don't bother working out the extent of every mip level.
+		if (ctx.TEX1.MXL > 0)
+			return true;
+
+		const GIFRegTEX0& TEX0 = ctx.TEX0;
+		if (overlaps(TEX0.TBP0, TEX0.TBW, TEX0.PSM, GSVector4i(0, 0, 1 << TEX0.TW, 1 << TEX0.TH)))
+			return true;
+
+		if (GSLocalMemory::m_psm[TEX0.PSM].pal > 0 && (pages[(TEX0.CBP >> 5) >> 5] & (1u << ((TEX0.CBP >> 5) & 31))))
+			return true;
+	}
+
+	return false;
+}
+
 void GSState::GIFRegHandlerHWREG(const GIFReg* RESTRICT r)
 {
 	GL_REG("HWREG = 0x%x_%x", r->U32[1], r->U32[0]);
@@ -1651,6 +1781,7 @@ inline void GSState::CopyEnv(GSDrawingEnvironment* dest, GSDrawingEnvironment* s
 void GSState::Flush()
 {
 	FlushWrite();
+	FlushInvalidateVideoMem();
 
 	if (m_index.tail > 0)
 	{
@@ -1705,7 +1836,7 @@ void GSState::FlushWrite()
 	r.right = r.left + m_env.TRXREG.RRW;
 	r.bottom = r.top + m_env.TRXREG.RRH;
 
-	InvalidateVideoMem(m_env.BITBLTBUF, r);
+	QueueInvalidateVideoMem(m_env.BITBLTBUF, r);
 
 	const GSLocalMemory::writeImage wi = GSLocalMemory::m_psm[m_env.BITBLTBUF.DPSM].wi;
 
@@ -1716,6 +1847,47 @@ void GSState::FlushWrite()
 	g_perfmon.Put(GSPerfMon::Swizzle, len);
 }
 
+void GSState::QueueInvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r)
+{
+	if (!m_pending_invalidate_rect.rempty())
+	{
+		const GIFRegBITBLTBUF& pending = m_pending_invalidate_blit;
+		const GSVector4i& pr = m_pending_invalidate_rect;
+
+		// Only merge when the union is exactly the two rects, so nothing outside the written area gets invalidated.
+		const bool same_buffer = BITBLTBUF.DBP == pending.DBP && BITBLTBUF.DBW == pending.DBW && BITBLTBUF.DPSM == pending.DPSM;
+		const bool adjacent = r.eq(pr) ||
+			(r.x == pr.x && r.z == pr.z && (r.y == pr.w || r.w == pr.y)) ||
+			(r.y == pr.y && r.w == pr.w && (r.x == pr.z || r.z == pr.x));
+
+		if (same_buffer && adjacent && CanDeferInvalidateVideoMem(BITBLTBUF, r))
+		{
+			m_pending_invalidate_rect = pr.runion(r);
+			return;
+		}
+
+		FlushInvalidateVideoMem();
+	}
+
+	if (!r.rempty() && CanDeferInvalidateVideoMem(BITBLTBUF, r))
+	{
+		m_pending_invalidate_blit = BITBLTBUF;
+		m_pending_invalidate_rect = r;
+		return;
+	}
+
+	InvalidateVideoMem(BITBLTBUF, r);
+}
+
+void GSState::FlushInvalidateVideoMem()
+{
+	if (m_pending_invalidate_rect.rempty())
+		return;
+
+	InvalidateVideoMem(m_pending_invalidate_blit, m_pending_invalidate_rect);
+	m_pending_invalidate_rect = GSVector4i::zero();
+}
+
 // This function decides if the context has changed in a way which warrants flushing the draw.
 inline bool GSState::TestDrawChanged()
 {
@@ -1957,7 +2129,7 @@ void GSState::Write(const u8* mem, int len)
 		r.right = r.left + m_env.TRXREG.RRW;
 		r.bottom = r.top + m_env.TRXREG.RRH;
 
-		InvalidateVideoMem(blit, r);
+		QueueInvalidateVideoMem(blit, r);
 
 		(m_mem.*psm.wi)(m_tr.x, m_tr.y, mem, m_tr.total, blit, m_env.TRXPOS, m_env.TRXREG);
 
@@ -1999,7 +2171,10 @@ void GSState::InitReadFIFO(u8* mem, int len)
 		return;
 
 	if (m_tr.x == sx && m_tr.y == sy)
+	{
+		FlushInvalidateVideoMem();
 		InvalidateLocalMem(m_env.BITBLTBUF, GSVector4i(sx, sy, sx + w, sy + h));
+	}
 }
 
 // NOTE: called from outside MTGS
@@ -2376,6 +2551,30 @@ void GSState::Transfer(const u8* mem, u32 size)
 
 								mem += total * sizeof(GIFPackedReg);
 
+								break;
+							case GIFPath::TYPE_UVRGBAXYZF2:
+								(this->*m_fpGIFPackedRegHandlersC[GIF_REG_UVRGBAXYZF2])((GIFPackedReg*)mem, total);
+
+								mem += total * sizeof(GIFPackedReg);
+
+								break;
+							case GIFPath::TYPE_UVRGBAXYZ2:
+								(this->*m_fpGIFPackedRegHandlersC[GIF_REG_UVRGBAXYZ2])((GIFPackedReg*)mem, total);
+
+								mem += total * sizeof(GIFPackedReg);
+
+								break;
+							case GIFPath::TYPE_RGBAXYZF2:
+								(this->*m_fpGIFPackedRegHandlersC[GIF_REG_RGBAXYZF2])((GIFPackedReg*)mem, total);
+
+								mem += total * sizeof(GIFPackedReg);
+
+								break;
+							case GIFPath::TYPE_RGBAXYZ2:
+								(this->*m_fpGIFPackedRegHandlersC[GIF_REG_RGBAXYZ2])((GIFPackedReg*)mem, total);
+
+								mem += total * sizeof(GIFPackedReg);
+
 								break;
 							default:
 								__assume(0);
@@ -2732,12 +2931,81 @@ void GSState::UpdateVertexKick()
 
 	m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZF2] = m_fpGIFPackedRegHandlerSTQRGBAXYZF2[prim];
 	m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZ2] = m_fpGIFPackedRegHandlerSTQRGBAXYZ2[prim];
+	m_fpGIFPackedRegHandlersC[GIF_REG_UVRGBAXYZF2] = m_fpGIFPackedRegHandlerRGBAXYZF2[prim][1];
+	m_fpGIFPackedRegHandlersC[GIF_REG_UVRGBAXYZ2] = m_fpGIFPackedRegHandlerRGBAXYZ2[prim][1];
+	m_fpGIFPackedRegHandlersC[GIF_REG_RGBAXYZF2] = m_fpGIFPackedRegHandlerRGBAXYZF2[prim][0];
+	m_fpGIFPackedRegHandlersC[GIF_REG_RGBAXYZ2] = m_fpGIFPackedRegHandlerRGBAXYZ2[prim][0];
+}
+
+// Enough for anything seen in practice, growing past it falls back to copying into heap buffers.
+static constexpr size_t VERTEX_RESERVE_COUNT = 4 * 1024 * 1024;
+
+static size_t PageAlign(size_t size) { return (size + __pagesize - 1) & ~static_cast<size_t>(__pagesize - 1); }
+static size_t GetVertexReserveSize(size_t count) { return PageAlign(sizeof(GSVertex) * count); }
+static size_t GetIndexReserveSize(size_t count) { return PageAlign(sizeof(u32) * count * 3); } // worst case is slightly less than vertex number * 3
+
+void GSState::FreeVertexBuffer()
+{
+	if (m_vertex_reserved != 0)
+	{
+		HostSys::Munmap(m_vertex.buff, GetVertexReserveSize(m_vertex_reserved));
+		HostSys::Munmap(m_index.buff, GetIndexReserveSize(m_vertex_reserved));
+		m_vertex_reserved = 0;
+	}
+	else
+	{
+		if (m_vertex.buff)
+			_aligned_free(m_vertex.buff);
+		if (m_index.buff)
+			_aligned_free(m_index.buff);
+	}
+
+	m_vertex.buff = nullptr;
+	m_index.buff = nullptr;
 }
 
 void GSState::GrowVertexBuffer()
 {
 	const size_t maxcount = std::max<size_t>(m_vertex.maxcount * 3 / 2, 10000);
 
+	if (m_vertex.buff == NULL)
+	{
+		void* vertex = HostSys::MmapReservePtr(nullptr, GetVertexReserveSize(VERTEX_RESERVE_COUNT));
+		void* index = vertex ? HostSys::MmapReservePtr(nullptr, GetIndexReserveSize(VERTEX_RESERVE_COUNT)) : nullptr;
+
+		if (index)
+		{
+			m_vertex.buff = static_cast<GSVertex*>(vertex);
+			m_index.buff = static_cast<u32*>(index);
+			m_vertex_reserved = VERTEX_RESERVE_COUNT;
+		}
+		else if (vertex)
+		{
+			HostSys::Munmap(vertex, GetVertexReserveSize(VERTEX_RESERVE_COUNT));
+		}
+	}
+
+	if (maxcount <= m_vertex_reserved)
+	{
+		// Committing pages which already are is harmless, so just extend from the start.
+		if (!HostSys::MmapCommitPtr(m_vertex.buff, GetVertexReserveSize(maxcount), PageAccess_ReadWrite()) ||
+			!HostSys::MmapCommitPtr(m_index.buff, GetIndexReserveSize(maxcount), PageAccess_ReadWrite()))
+		{
+			Console.Error("GS: failed to commit %zu bytes for verticles and %zu for indices.",
+				GetVertexReserveSize(maxcount), GetIndexReserveSize(maxcount));
+
+			throw GSError();
+		}
+
+		if (m_vertex.maxcount != 0)
+			DevCon.WriteLn("GS: vertex buffer grown to %zu vertices in place", maxcount);
+
+		m_vertex.maxcount = maxcount - 3; // -3 to have some space at the end of the buffer before DrawingKick can grow it
+		return;
+	}
+
+	DevCon.Warning("GS: vertex buffer grown to %zu vertices, copying", maxcount);
+
 	GSVertex* vertex = (GSVertex*)_aligned_malloc(sizeof(GSVertex) * maxcount, 32);
 	u32* index = (u32*)_aligned_malloc(sizeof(u32) * maxcount * 3, 32); // worst case is slightly less than vertex number * 3
 
@@ -2753,18 +3021,12 @@ void GSState::GrowVertexBuffer()
 	}
 
 	if (m_vertex.buff != NULL)
-	{
 		memcpy(vertex, m_vertex.buff, sizeof(GSVertex) * m_vertex.tail);
 
-		_aligned_free(m_vertex.buff);
-	}
-
 	if (m_index.buff != NULL)
-	{
 		memcpy(index, m_index.buff, sizeof(u32) * m_index.tail);
 
-		_aligned_free(m_index.buff);
-	}
+	FreeVertexBuffer();
 
 	m_vertex.buff = vertex;
 	m_vertex.maxcount = maxcount - 3; // -3 to have some space at the end of the buffer before DrawingKick can grow it
@@ -3074,6 +3336,81 @@ __forceinline void GSState::HandleAutoFlush()
 	}
 }
 
+__forceinline void GSState::BackupDrawEnv()
+{
+	if ((m_backed_up_ctx != m_env.PRIM.CTXT) || m_dirty_gs_regs)
+	{
+		CopyEnv(&m_prev_env, &m_env, m_env.PRIM.CTXT);
+		memcpy(&m_prev_env.CTXT[m_prev_env.PRIM.CTXT].offset, &m_env.CTXT[m_prev_env.PRIM.CTXT].offset, sizeof(m_env.CTXT[m_prev_env.PRIM.CTXT].offset));
+		m_dirty_gs_regs = 0;
+		m_backed_up_ctx = m_env.PRIM.CTXT;
+	}
+}
+
+template <u32 prim>
+__forceinline u32 GSState::CullPrimitive(const GSVector4i& v0, const GSVector4i& v1, const GSVector4i& v2, const GSVector4i& v3) const
+{
+	GSVector4i pmin, pmax;
+
+	switch (prim)
+	{
+		case GS_POINTLIST:
+			pmin = v2;
+			pmax = v2;
+			break;
+		case GS_LINELIST:
+		case GS_LINESTRIP:
+		case GS_SPRITE:
+			pmin = v2.min_i16(v1);
+			pmax = v2.max_i16(v1);
+			break;
+		case GS_TRIANGLELIST:
+		case GS_TRIANGLESTRIP:
+			pmin = v2.min_i16(v1.min_i16(v0));
+			pmax = v2.max_i16(v1.max_i16(v0));
+			break;
+		case GS_TRIANGLEFAN:
+			pmin = v2.min_i16(v1.min_i16(v3));
+			pmax = v2.max_i16(v1.max_i16(v3));
+			break;
+		default:
+			break;
+	}
+
+	GSVector4i test = pmax.lt16(m_scissor) | pmin.gt16(m_scissor.zwzwl());
+
+	switch (prim)
+	{
+		case GS_TRIANGLELIST:
+		case GS_TRIANGLESTRIP:
+		case GS_TRIANGLEFAN:
+		case GS_SPRITE:
+			// FIXME: GREG I don't understand the purpose of the m_nativeres check
+			// It impacts badly the number of draw call in the HW renderer.
+			test |= m_nativeres ? pmin.eq16(pmax).zwzwl() : pmin.eq16(pmax);
+			break;
+		default:
+			break;
+	}
+
+	switch (prim)
+	{
+		case GS_TRIANGLELIST:
+		case GS_TRIANGLESTRIP:
+			// TODO: any way to do a 16-bit integer cross product?
+			// cross product is zero most of the time because either of the vertices are the same
+			test = (test | v0 == v1) | (v1 == v2 | v0 == v2);
+			break;
+		case GS_TRIANGLEFAN:
+			test = (test | v3 == v1) | (v1 == v2 | v3 == v2);
+			break;
+		default:
+			break;
+	}
+
+	return test.mask() & 15;
+}
+
 template <u32 prim, bool auto_flush, bool index_swap>
 __forceinline void GSState::VertexKick(u32 skip)
 {
@@ -3133,70 +3470,12 @@ __forceinline void GSState::VertexKick(u32 skip)
 
 	if (skip == 0 && (prim != GS_TRIANGLEFAN || m <= 4)) // m_vertex.xy only knows about the last 4 vertices, head could be far behind for fan
 	{
-		GSVector4i pmin, pmax;
-
 		const GSVector4i v0 = GSVector4i::loadl(&m_vertex.xy[(xy_tail + 1) & 3]); // T-3
 		const GSVector4i v1 = GSVector4i::loadl(&m_vertex.xy[(xy_tail + 2) & 3]); // T-2
 		const GSVector4i v2 = GSVector4i::loadl(&m_vertex.xy[(xy_tail + 3) & 3]); // T-1
 		const GSVector4i v3 = GSVector4i::loadl(&m_vertex.xy[(xy_tail - m) & 3]); // H
 
-		switch (prim)
-		{
-			case GS_POINTLIST:
-				pmin = v2;
-				pmax = v2;
-				break;
-			case GS_LINELIST:
-			case GS_LINESTRIP:
-			case GS_SPRITE:
-				pmin = v2.min_i16(v1);
-				pmax = v2.max_i16(v1);
-				break;
-			case GS_TRIANGLELIST:
-			case GS_TRIANGLESTRIP:
-				pmin = v2.min_i16(v1.min_i16(v0));
-				pmax = v2.max_i16(v1.max_i16(v0));
-				break;
-			case GS_TRIANGLEFAN:
-				pmin = v2.min_i16(v1.min_i16(v3));
-				pmax = v2.max_i16(v1.max_i16(v3));
-				break;
-			default:
-				break;
-		}
-
-		GSVector4i test = pmax.lt16(m_scissor) | pmin.gt16(m_scissor.zwzwl());
-
-		switch (prim)
-		{
-			case GS_TRIANGLELIST:
-			case GS_TRIANGLESTRIP:
-			case GS_TRIANGLEFAN:
-			case GS_SPRITE:
-				// FIXME: GREG I don't understand the purpose of the m_nativeres check
-				// It impacts badly the number of draw call in the HW renderer.
-				test |= m_nativeres ? pmin.eq16(pmax).zwzwl() : pmin.eq16(pmax);
-				break;
-			default:
-				break;
-		}
-
-		switch (prim)
-		{
-			case GS_TRIANGLELIST:
-			case GS_TRIANGLESTRIP:
-				// TODO: any way to do a 16-bit integer cross product?
-				// cross product is zero most of the time because either of the vertices are the same
-				test = (test | v0 == v1) | (v1 == v2 | v0 == v2);
-				break;
-			case GS_TRIANGLEFAN:
-				test = (test | v3 == v1) | (v1 == v2 | v3 == v2);
-				break;
-			default:
-				break;
-		}
-
-		skip |= test.mask() & 15;
+		skip |= CullPrimitive<prim>(v0, v1, v2, v3);
 	}
 
 	if (skip != 0)
@@ -3228,13 +3507,8 @@ __forceinline void GSState::VertexKick(u32 skip)
 	if (tail >= m_vertex.maxcount)
 		GrowVertexBuffer();
 
-	if (m_index.tail == 0 && ((m_backed_up_ctx != m_env.PRIM.CTXT) || m_dirty_gs_regs))
-	{
-		CopyEnv(&m_prev_env, &m_env, m_env.PRIM.CTXT);
-		memcpy(&m_prev_env.CTXT[m_prev_env.PRIM.CTXT].offset, &m_env.CTXT[m_prev_env.PRIM.CTXT].offset, sizeof(m_env.CTXT[m_prev_env.PRIM.CTXT].offset));
-		m_dirty_gs_regs = 0;
-		m_backed_up_ctx = m_env.PRIM.CTXT;
-	}
+	if (m_index.tail == 0)
+		BackupDrawEnv();
 
 	u32* RESTRICT buff = &m_index.buff[m_index.tail];
 
@@ -3314,6 +3588,102 @@ __forceinline void GSState::VertexKick(u32 skip)
 	}
 }
 
+template <u32 prim, bool auto_flush, bool index_swap, typename Decode>
+__forceinline void GSState::VertexKickBatch(const GIFPackedReg* RESTRICT r, u32 count, u32 nreg, Decode&& decode)
+{
+	// Lists without auto flush can take whole primitives at a time: nothing carries over from one
+	// primitive to the next, so head/tail stay in registers and the buffer is grown once up front.
+	// Strips, fans and auto flush need the per-vertex bookkeeping of VertexKick.
+	constexpr bool batch = !auto_flush && (prim == GS_POINTLIST || prim == GS_LINELIST || prim == GS_TRIANGLELIST || prim == GS_SPRITE);
+
+	if constexpr (batch)
+	{
+		constexpr u32 n = (prim == GS_POINTLIST) ? 1 : (prim == GS_TRIANGLELIST) ? 3 : 2;
+
+		// Finish a primitive left open by the previous tag, so the batch starts on a boundary.
+		for (; count > 0 && m_vertex.tail != m_vertex.head; count--, r += nreg)
+			VertexKick<prim, auto_flush, index_swap>(decode(r));
+
+		const u32 batch_count = count - count % n;
+		if (batch_count > 0)
+		{
+			while (m_vertex.tail + batch_count >= m_vertex.maxcount)
+				GrowVertexBuffer();
+
+			size_t head = m_vertex.head;
+			u32* RESTRICT buff = &m_index.buff[m_index.tail];
+			GSVector4i xy[3];
+
+			for (const GIFPackedReg* RESTRICT r_end = r + batch_count * nreg; r < r_end;)
+			{
+				u32 skip = 0;
+
+				for (u32 i = 0; i < n; i++, r += nreg)
+				{
+					skip = decode(r);
+
+					const GSVector4i new_v0(m_v.m[0]);
+					const GSVector4i new_v1(m_v.m[1]);
+
+					GSVector4i* RESTRICT tailptr = (GSVector4i*)&m_vertex.buff[head + i];
+
+					tailptr[0] = new_v0;
+					tailptr[1] = new_v1;
+
+					const GSVector4i v = new_v1.xxxx().u16to32().sub32(m_ofxy);
+
+					xy[i] = v.blend16<0xf0>(v.sra32(4)).ps32();
+				}
+
+				// Only the last vertex's ADC bit counts, like in VertexKick.
+				if (skip == 0)
+					skip = CullPrimitive<prim>(xy[0], (n > 1) ? xy[n - 2] : xy[0], xy[n - 1], xy[0]);
+
+				if (skip != 0)
+					continue;
+
+				if (buff == m_index.buff)
+					BackupDrawEnv();
+
+				switch (prim)
+				{
+					case GS_POINTLIST:
+						buff[0] = head + 0;
+						break;
+					case GS_LINELIST:
+						buff[0] = head + (index_swap ? 1 : 0);
+						buff[1] = head + (index_swap ? 0 : 1);
+						break;
+					case GS_TRIANGLELIST:
+						buff[0] = head + (index_swap ? 2 : 0);
+						buff[1] = head + 1;
+						buff[2] = head + (index_swap ? 0 : 2);
+						break;
+					case GS_SPRITE:
+						buff[0] = head + 0;
+						buff[1] = head + 1;
+						break;
+					default:
+						__assume(0);
+				}
+
+				buff += n;
+				head += n;
+			}
+
+			m_vertex.head = head;
+			m_vertex.tail = head;
+			m_vertex.next = head;
+			m_index.tail = buff - m_index.buff;
+		}
+
+		count -= batch_count;
+	}
+
+	for (; count > 0; count--, r += nreg)
+		VertexKick<prim, auto_flush, index_swap>(decode(r));
+}
+
 /// Checks if region repeat is used (applying it does something to at least one of the values in min...max)
 /// Also calculates the real min and max values seen after applying the region repeat to all values in min...max
 static bool UsesRegionRepeat(int fix, int msk, int min, int max, int* min_out, int* max_out)
@@ -71,12 +71,16 @@ class GSState : public GSAlignedClass<32>
 
 	typedef void (GSState::*GIFPackedRegHandlerC)(const GIFPackedReg* RESTRICT r, u32 size);
 
-	GIFPackedRegHandlerC m_fpGIFPackedRegHandlersC[2];
+	GIFPackedRegHandlerC m_fpGIFPackedRegHandlersC[6];
 	GIFPackedRegHandlerC m_fpGIFPackedRegHandlerSTQRGBAXYZF2[8];
 	GIFPackedRegHandlerC m_fpGIFPackedRegHandlerSTQRGBAXYZ2[8];
+	GIFPackedRegHandlerC m_fpGIFPackedRegHandlerRGBAXYZF2[8][2];
+	GIFPackedRegHandlerC m_fpGIFPackedRegHandlerRGBAXYZ2[8][2];
 
 	template<u32 prim, bool auto_flush, bool index_swap> void GIFPackedRegHandlerSTQRGBAXYZF2(const GIFPackedReg* RESTRICT r, u32 size);
 	template<u32 prim, bool auto_flush, bool index_swap> void GIFPackedRegHandlerSTQRGBAXYZ2(const GIFPackedReg* RESTRICT r, u32 size);
+	template<u32 prim, bool auto_flush, bool index_swap, bool uv> void GIFPackedRegHandlerRGBAXYZF2(const GIFPackedReg* RESTRICT r, u32 size);
+	template<u32 prim, bool auto_flush, bool index_swap, bool uv> void GIFPackedRegHandlerRGBAXYZ2(const GIFPackedReg* RESTRICT r, u32 size);
 	void GIFPackedRegHandlerNOP(const GIFPackedReg* RESTRICT r, u32 size);
 
 	template<int i> void ApplyTEX0(GIFRegTEX0& TEX0);
@@ -143,6 +147,11 @@ class GSState : public GSAlignedClass<32>
 
 	} m_tr;
 
+	// Host->local invalidation not sent to the renderer yet, so the following uploads next to it can be
+	// merged in. Only used while the renderer says it can't affect anything but sources, empty otherwise.
+	GIFRegBITBLTBUF m_pending_invalidate_blit;
+	GSVector4i m_pending_invalidate_rect;
+
 private:
 	void CalcAlphaMinMax();
 
@@ -178,17 +187,31 @@ protected:
 		size_t tail;
 	} m_index;
 
+	// Vertices and indices live in address space reserved up front, so growing only commits more of it
+	// instead of copying. Zero when the reservation failed or ran out, the buffers are on the heap then.
+	size_t m_vertex_reserved;
+
 	void UpdateContext();
 	void UpdateScissor();
 
 	void UpdateVertexKick();
 
 	void GrowVertexBuffer();
+	void FreeVertexBuffer();
 	void HandleAutoFlush();
 	
+	void BackupDrawEnv();
+
+	template <u32 prim>
+	u32 CullPrimitive(const GSVector4i& v0, const GSVector4i& v1, const GSVector4i& v2, const GSVector4i& v3) const;
+
 	template <u32 prim, bool auto_flush, bool index_swap>
 	void VertexKick(u32 skip);
 
+	/// Kicks count vertices of nreg registers each, decode(r) loads one into m_v and returns its skip bit.
+	template <u32 prim, bool auto_flush, bool index_swap, typename Decode>
+	void VertexKickBatch(const GIFPackedReg* RESTRICT r, u32 count, u32 nreg, Decode&& decode);
+
 	// following functions need m_vt to be initialized
 
 	GSVertexTrace m_vt;
@@ -344,10 +367,14 @@ public:
 	void Flush();
 	void FlushPrim();
 	bool TestDrawChanged();
+	bool TransferOverlapsQueuedDraw() const;
 	void FlushWrite();
+	void QueueInvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r);
+	void FlushInvalidateVideoMem();
 	virtual void Draw() = 0;
 	virtual void PurgePool() = 0;
 	virtual void InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r) {}
+	virtual bool CanDeferInvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r) { return false; }
 	virtual void InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r, bool clut = false) {}
 
 	virtual void Move();
@@ -76,6 +76,12 @@ public:
 		return m_queue.empty();
 	}
 
+	/// Number of items not finished yet, including the one being processed. Only meaningful on the worker thread.
+	size_t GetPendingCount() const
+	{
+		return m_queue.size();
+	}
+
 	void Push(const T& item)
 	{
 		while (!m_queue.push(item))
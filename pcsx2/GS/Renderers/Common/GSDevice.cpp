@@ -17,6 +17,10 @@
 #include "GSDevice.h"
 #include "GS/GSGL.h"
 #include "GS/GS.h"
+#include "GS/GSPerfMon.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include "Config.h"
 
 const char* shaderName(ShaderConvert value)
 {
@@ -58,6 +62,7 @@ const char* shaderName(PresentShader value)
 		case PresentShader::TRIANGULAR_FILTER: return "ps_filter_triangular";
 		case PresentShader::COMPLEX_FILTER:    return "ps_filter_complex";
 		case PresentShader::LOTTES_FILTER:     return "ps_filter_lottes";
+		case PresentShader::SHARPEN_FILTER:    return "ps_filter_sharpen";
 			// clang-format on
 		default:
 			ASSERT(0);
@@ -107,6 +112,79 @@ void GSDevice::Destroy()
 	m_current = nullptr; // current is special, points to other textures, no need to delete
 }
 
+// Pipelines are compiled the first time a draw needs them, which shows up as a hitch on a cold
+// cache. The selectors of every pipeline a game creates are appended to a per-CRC manifest in
+// the cache directory, and the device compiles the whole manifest when that game boots again.
+// Bump the version whenever any PipelineSelector layout changes.
+static constexpr u32 PIPELINE_MANIFEST_SIGNATURE = 0x4D505347; // GSPM
+static constexpr u32 PIPELINE_MANIFEST_VERSION = 1;
+static constexpr u32 PIPELINE_MANIFEST_MAX_ENTRIES = 0x10000;
+
+static std::string GetPipelineManifestFilename(const char* api, u32 crc)
+{
+	return Path::Combine(EmuFolders::Cache, fmt::format("{}_pipelines_{:08X}.bin", api, crc));
+}
+
+void GSDevice::RecordPipeline(const void* selector, u32 selector_size)
+{
+	if (m_pipeline_manifest_crc == 0)
+		return;
+
+	const u8* bytes = static_cast<const u8*>(selector);
+	m_pipeline_manifest_pending.insert(m_pipeline_manifest_pending.end(), bytes, bytes + selector_size);
+}
+
+bool GSDevice::LoadPipelineManifest(const char* api, u32 crc, u32 selector_size, std::vector<u8>* data) const
+{
+	auto fp = FileSystem::OpenManagedCFile(GetPipelineManifestFilename(api, crc).c_str(), "rb");
+	if (!fp)
+		return false;
+
+	u32 header[4];
+	if (std::fread(header, sizeof(header), 1, fp.get()) != 1 || header[0] != PIPELINE_MANIFEST_SIGNATURE ||
+		header[1] != PIPELINE_MANIFEST_VERSION || header[2] != selector_size || header[3] > PIPELINE_MANIFEST_MAX_ENTRIES)
+	{
+		return false;
+	}
+
+	data->resize(static_cast<size_t>(header[3]) * selector_size);
+	if (header[3] > 0 && std::fread(data->data(), selector_size, header[3], fp.get()) != header[3])
+	{
+		data->clear();
+		return false;
+	}
+
+	return true;
+}
+
+void GSDevice::SavePipelineManifest(const char* api, u32 selector_size)
+{
+	if (m_pipeline_manifest_crc == 0 || m_pipeline_manifest_pending.empty())
+		return;
+
+	// Anything the previous run recorded was compiled up front and never re-recorded, so the
+	// pending list only holds new selectors and can be appended without deduplicating.
+	std::vector<u8> data;
+	LoadPipelineManifest(api, m_pipeline_manifest_crc, selector_size, &data);
+	data.insert(data.end(), m_pipeline_manifest_pending.begin(), m_pipeline_manifest_pending.end());
+	m_pipeline_manifest_pending.clear();
+
+	auto fp = FileSystem::OpenManagedCFile(GetPipelineManifestFilename(api, m_pipeline_manifest_crc).c_str(), "wb");
+	if (!fp)
+		return;
+
+	const u32 count = std::min<u32>(static_cast<u32>(data.size() / selector_size), PIPELINE_MANIFEST_MAX_ENTRIES);
+	const u32 header[4] = {PIPELINE_MANIFEST_SIGNATURE, PIPELINE_MANIFEST_VERSION, selector_size, count};
+	if (std::fwrite(header, sizeof(header), 1, fp.get()) != 1 ||
+		(count > 0 && std::fwrite(data.data(), selector_size, count, fp.get()) != count))
+	{
+		Console.Error("Failed to write %s pipeline manifest for CRC %08X", api, m_pipeline_manifest_crc);
+		return;
+	}
+
+	DevCon.WriteLn("Saved %u %s pipelines for CRC %08X", count, api, m_pipeline_manifest_crc);
+}
+
 void GSDevice::ResetAPIState()
 {
 }
@@ -121,43 +199,38 @@ GSTexture* GSDevice::FetchSurface(GSTexture::Type type, int width, int height, i
 	const bool prefer_new_texture = (m_features.prefer_new_textures && type == GSTexture::Type::Texture && !prefer_reuse);
 
 	GSTexture* t = nullptr;
-	auto fallback = m_pool.end();
 
-	for (auto i = m_pool.begin(); i != m_pool.end(); ++i)
+	const auto bucket = m_pool.find(GetPoolKey(type, size, levels, format));
+	if (bucket != m_pool.end())
 	{
-		t = *i;
-
-		assert(t);
-
-		if (t->GetType() == type && t->GetFormat() == format && t->GetSize() == size && t->GetMipmapLevels() == levels)
+		std::deque<GSTexture*>& list = bucket->second;
+		if (!prefer_new_texture)
 		{
-			if (!prefer_new_texture || t->last_frame_used != m_frame)
-			{
-				m_pool.erase(i);
-				break;
-			}
-			else if (fallback == m_pool.end())
-			{
-				fallback = i;
-			}
+			t = list.front();
+			list.pop_front();
+		}
+		else if (list.back()->last_frame_used != m_frame || m_pool_size >= MAX_POOLED_TEXTURES)
+		{
+			// The oldest one is the only candidate, if it was used this frame then all of them were.
+			t = list.back();
+			list.pop_back();
 		}
 
-		t = nullptr;
+		if (t)
+		{
+			m_pool_size--;
+			if (list.empty())
+				m_pool.erase(bucket);
+		}
 	}
 
 	if (!t)
 	{
-		if (m_pool.size() >= MAX_POOLED_TEXTURES && fallback != m_pool.end())
-		{
-			t = *fallback;
-			m_pool.erase(fallback);
-		}
-		else
-		{
-			t = CreateSurface(type, width, height, levels, format);
-			if (!t)
-				throw std::bad_alloc();
-		}
+		t = CreateSurface(type, width, height, levels, format);
+		if (!t)
+			throw std::bad_alloc();
+
+		g_perfmon.Put(GSPerfMon::TextureAllocations, 1);
 	}
 
 	t->SetScale(GSVector2(1, 1)); // Things seem to assume that all textures come out of here with scale 1...
@@ -191,12 +264,12 @@ void GSDevice::PrintMemoryUsage()
 {
 #ifdef ENABLE_OGL_DEBUG
 	u32 pool = 0;
-	for (auto t : m_pool)
+	for (const auto& it : m_pool)
 	{
-		if (t)
+		for (const GSTexture* t : it.second)
 			pool += t->GetMemUsage();
 	}
-	GL_PERF("MEM: Surface Pool %dMB", pool >> 20u);
+	GL_PERF("MEM: Surface Pool %dMB in %u surfaces, %zu buckets", pool >> 20u, m_pool_size, m_pool.size());
 #endif
 }
 
@@ -214,16 +287,11 @@ void GSDevice::Recycle(GSTexture* t)
 	{
 		t->last_frame_used = m_frame;
 
-		m_pool.push_front(t);
-
-		//printf("%d\n",m_pool.size());
+		m_pool[GetPoolKey(t->GetType(), t->GetSize(), t->GetMipmapLevels(), t->GetFormat())].push_front(t);
+		m_pool_size++;
 
-		while (m_pool.size() > MAX_POOLED_TEXTURES)
-		{
-			delete m_pool.back();
-
-			m_pool.pop_back();
-		}
+		while (m_pool_size > MAX_POOLED_TEXTURES)
+			DeleteOldestPooledSurface(0);
 	}
 }
 
@@ -231,19 +299,47 @@ void GSDevice::AgePool()
 {
 	m_frame++;
 
-	while (m_pool.size() > 40 && m_frame - m_pool.back()->last_frame_used > 10)
-	{
-		delete m_pool.back();
-
-		m_pool.pop_back();
-	}
+	while (m_pool_size > 40 && DeleteOldestPooledSurface(11))
+		;
 }
 
 void GSDevice::PurgePool()
 {
-	for (auto t : m_pool)
-		delete t;
+	for (const auto& it : m_pool)
+	{
+		for (GSTexture* t : it.second)
+			delete t;
+	}
 	m_pool.clear();
+	m_pool_size = 0;
+}
+
+u64 GSDevice::GetPoolKey(GSTexture::Type type, const GSVector2i& size, int levels, GSTexture::Format format)
+{
+	return (static_cast<u64>(type) << 56) | (static_cast<u64>(format) << 48) | (static_cast<u64>(levels & 0xFF) << 40) |
+		   (static_cast<u64>(size.x & 0xFFFFF) << 20) | static_cast<u64>(size.y & 0xFFFFF);
+}
+
+bool GSDevice::DeleteOldestPooledSurface(u32 min_age)
+{
+	// Only the back of each bucket needs checking, and there are far fewer buckets than surfaces.
+	auto oldest = m_pool.end();
+	for (auto it = m_pool.begin(); it != m_pool.end(); ++it)
+	{
+		if (oldest == m_pool.end() || it->second.back()->last_frame_used < oldest->second.back()->last_frame_used)
+			oldest = it;
+	}
+
+	if (oldest == m_pool.end() || (m_frame - oldest->second.back()->last_frame_used) < min_age)
+		return false;
+
+	delete oldest->second.back();
+	oldest->second.pop_back();
+	if (oldest->second.empty())
+		m_pool.erase(oldest);
+
+	m_pool_size--;
+	return true;
 }
 
 void GSDevice::ClearSamplerCache()
@@ -435,8 +531,20 @@ void GSDevice::ShadeBoost()
 			static_cast<float>(GSConfig.ShadeBoost_Saturation) * (1.0f / 50.0f),
 		};
 
-		StretchRect(m_current, sRect, m_target_tmp, dRect, ShaderConvert::COPY, false);
-		DoShadeBoost(m_target_tmp, m_current, params);
+		// m_merge and m_blend are fully redrawn every frame, so rather than copying to the temporary
+		// and back, shade into it and swap it in. m_weavebob keeps the other field, it must stay put.
+		GSTexture** owner = (m_current == m_merge) ? &m_merge : (m_current == m_blend) ? &m_blend : nullptr;
+		if (owner)
+		{
+			DoShadeBoost(m_current, m_target_tmp, params);
+			std::swap(*owner, m_target_tmp);
+			m_current = *owner;
+		}
+		else
+		{
+			StretchRect(m_current, sRect, m_target_tmp, dRect, ShaderConvert::COPY, false);
+			DoShadeBoost(m_target_tmp, m_current, params);
+		}
 	}
 }
 
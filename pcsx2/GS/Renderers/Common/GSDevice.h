@@ -23,6 +23,9 @@
 #include "GS/GSAlignedClass.h"
 #include "GS/GSExtra.h"
 #include <array>
+#include <deque>
+#include <unordered_map>
+#include <vector>
 #ifdef _WIN32
 #include <dxgi.h>
 #endif
@@ -59,6 +62,7 @@ enum class PresentShader
 	TRIANGULAR_FILTER,
 	COMPLEX_FILTER,
 	LOTTES_FILTER,
+	SHARPEN_FILTER,
 	Count
 };
 
@@ -660,7 +664,13 @@ public:
 	// clang-format on
 
 private:
-	FastList<GSTexture*> m_pool;
+	// Pooled surfaces, bucketed by type/format/size/levels so a lookup doesn't have to scan
+	// the whole pool. Each bucket is ordered by recycle time, most recent first.
+	std::unordered_map<u64, std::deque<GSTexture*>> m_pool;
+	u32 m_pool_size = 0;
+
+	static u64 GetPoolKey(GSTexture::Type type, const GSVector2i& size, int levels, GSTexture::Format format);
+	bool DeleteOldestPooledSurface(u32 min_age);
 	static const std::array<HWBlend, 3*3*3*3> m_blendMap;
 	static const std::array<u8, 16> m_replaceDualSrcBlendMap;
 
@@ -686,6 +696,14 @@ protected:
 	bool m_rbswapped = false;
 	FeatureSupport m_features;
 
+	/// Raw selectors of the pipelines created for the current game since the manifest was last saved.
+	u32 m_pipeline_manifest_crc = 0;
+	std::vector<u8> m_pipeline_manifest_pending;
+
+	void RecordPipeline(const void* selector, u32 selector_size);
+	bool LoadPipelineManifest(const char* api, u32 crc, u32 selector_size, std::vector<u8>* data) const;
+	void SavePipelineManifest(const char* api, u32 selector_size);
+
 	virtual GSTexture* CreateSurface(GSTexture::Type type, int width, int height, int levels, GSTexture::Format format) = 0;
 	GSTexture* FetchSurface(GSTexture::Type type, int width, int height, int levels, GSTexture::Format format, bool clear, bool prefer_reuse);
 
@@ -723,6 +741,9 @@ public:
 	virtual bool Create(HostDisplay* display);
 	virtual void Destroy();
 
+	/// Called when the running game changes, so the device can precompile the pipelines it used last time.
+	virtual void SetGameCRC(u32 crc) {}
+
 	virtual void ResetAPIState();
 	virtual void RestoreAPIState();
 
@@ -15,6 +15,7 @@
 
 #include "PrecompiledHeader.h"
 #include "GSDirtyRect.h"
+#include "GS/GSPerfMon.h"
 
 GSDirtyRect::GSDirtyRect() :
 	r(GSVector4i::zero()),
@@ -55,6 +56,58 @@ const GSVector4i GSDirtyRect::GetDirtyRect(const GIFRegTEX0& TEX0) const
 
 //
 
+static u64 GetRectArea(const GSVector4i& r)
+{
+	return static_cast<u64>(std::max(r.width(), 0)) * static_cast<u64>(std::max(r.height(), 0));
+}
+
+void GSDirtyRectList::Add(const GSDirtyRect& rect)
+{
+	g_perfmon.Put(GSPerfMon::DirtyRects, 1);
+
+	// Targets written in strips produce lots of adjacent or overlapping rects. Merging them is free
+	// when the union covers no more than the two did, which Update() ends up using anyway, and keeps
+	// the searches in UpdateIfDirtyIntersects() and the surface offset checks short.
+	GSVector4i r = rect.r;
+	for (auto it = begin(); it != end();)
+	{
+		if (it->psm != rect.psm || it->bw != rect.bw)
+		{
+			++it;
+			continue;
+		}
+
+		const GSVector4i merged = r.runion(it->r);
+		if (GetRectArea(merged) > GetRectArea(r) + GetRectArea(it->r))
+		{
+			++it;
+			continue;
+		}
+
+		// the grown rect might now touch one we skipped, so start over
+		r = merged;
+		erase(it);
+		it = begin();
+		g_perfmon.Put(GSPerfMon::DirtyRectsMerged, 1);
+	}
+
+	if (size() >= MAX_RECTS)
+	{
+		// Too scattered to be worth tracking individually, the union is all that gets updated in the end.
+		const size_t old_size = size();
+		erase(std::remove_if(begin(), end(), [&rect, &r](const GSDirtyRect& other) {
+			if (other.psm != rect.psm || other.bw != rect.bw)
+				return false;
+
+			r = r.runion(other.r);
+			return true;
+		}), end());
+		g_perfmon.Put(GSPerfMon::DirtyRectsMerged, static_cast<double>(old_size - size()));
+	}
+
+	emplace_back(r, rect.psm, rect.bw);
+}
+
 const GSVector4i GSDirtyRectList::GetDirtyRect(const GIFRegTEX0& TEX0, const GSVector2i& size) const
 {
 	if (!empty())
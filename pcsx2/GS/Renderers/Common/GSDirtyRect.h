@@ -20,9 +20,9 @@
 class GSDirtyRect
 {
 public:
-	const GSVector4i r;
-	const u32 psm;
-	const u32 bw;
+	GSVector4i r;
+	u32 psm;
+	u32 bw;
 
 	GSDirtyRect();
 	GSDirtyRect(const GSVector4i& r, const u32 psm, const u32 bw);
@@ -32,7 +32,13 @@ public:
 class GSDirtyRectList : public std::vector<GSDirtyRect>
 {
 public:
+	/// Past this many rects, everything with the same layout is collapsed into a single rect.
+	static constexpr size_t MAX_RECTS = 16;
+
 	GSDirtyRectList() {}
+
+	/// Adds a rect, merging it with any existing ones of the same PSM/BW it overlaps or abuts.
+	void Add(const GSDirtyRect& rect);
 	const GSVector4i GetDirtyRect(const GIFRegTEX0& TEX0, const GSVector2i& size) const;
 	const GSVector4i GetDirtyRectAndClear(const GIFRegTEX0& TEX0, const GSVector2i& size);
 };
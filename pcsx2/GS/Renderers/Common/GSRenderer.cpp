@@ -56,10 +56,11 @@ static std::string GetDumpSerial()
 }
 #endif
 
-static constexpr std::array<PresentShader, 6> s_tv_shader_indices = {
+static constexpr std::array<PresentShader, 7> s_tv_shader_indices = {
 	PresentShader::COPY, PresentShader::SCANLINE,
 	PresentShader::DIAGONAL_FILTER, PresentShader::TRIANGULAR_FILTER,
-	PresentShader::COMPLEX_FILTER, PresentShader::LOTTES_FILTER};
+	PresentShader::COMPLEX_FILTER, PresentShader::LOTTES_FILTER,
+	PresentShader::SHARPEN_FILTER};
 
 std::unique_ptr<GSRenderer> g_gs_renderer;
 
@@ -555,7 +556,7 @@ static GSVector4i CalculateDrawSrcRect(const GSTexture* src)
 #endif
 }
 
-void GSRenderer::VSync(u32 field, bool registers_written)
+void GSRenderer::VSync(u32 field, bool registers_written, bool hidden)
 {
 	Flush();
 
@@ -567,8 +568,16 @@ void GSRenderer::VSync(u32 field, bool registers_written)
 	const int fb_sprite_blits = g_perfmon.GetDisplayFramebufferSpriteBlits();
 	const bool fb_sprite_frame = (fb_sprite_blits > 0);
 
-	bool skip_frame = false;
-	if (GSConfig.SkipDuplicateFrames)
+	// Run-ahead frames only need their drawing done, the screen and the frame counters
+	// only ever see the frame that's shown.
+	if (hidden)
+	{
+		g_perfmon.EndFrame();
+		return;
+	}
+
+	bool skip_frame = m_frame_draws_skipped;
+	if (!skip_frame && GSConfig.SkipDuplicateFrames)
 	{
 		bool is_unique_frame;
 		switch (PerformanceMetrics::GetInternalFPSMethod())
@@ -595,7 +604,8 @@ void GSRenderer::VSync(u32 field, bool registers_written)
 		}
 	}
 
-	const bool blank_frame = !Merge(field);
+	// Nothing new was drawn to the display buffers on skipped frames, so there's nothing to merge either.
+	const bool blank_frame = m_frame_draws_skipped || !Merge(field);
 
 	if (skip_frame)
 	{
@@ -635,7 +645,7 @@ void GSRenderer::VSync(u32 field, bool registers_written)
 
 		Host::EndPresentFrame();
 
-		if (GSConfig.OsdShowGPU)
+		if (GSConfig.OsdShowGPU || GSConfig.DynamicResolution || PerformanceMetrics::IsFrameTraceActive())
 			PerformanceMetrics::OnGPUPresent(Host::GetHostDisplay()->GetAndResetAccumulatedGPUTime());
 	}
 	g_gs_device->RestoreAPIState();
@@ -697,16 +707,20 @@ void GSRenderer::VSync(u32 field, bool registers_written)
 
 		if (GSTexture* t = g_gs_device->GetCurrent())
 		{
-			const std::string path(m_snapshot + ".png");
-			if (t->Save(path))
-			{
-				Host::AddKeyedOSDMessage("GSScreenshot",
-					fmt::format("Screenshot saved to '{}'.", Path::GetFileName(path)), 10.0f);
-			}
-			else
-			{
+			std::string path(m_snapshot + ".png");
+			const bool queued = t->SaveAsync(path, [path](bool result) {
+				if (result)
+				{
+					Host::AddKeyedOSDMessage("GSScreenshot",
+						fmt::format("Screenshot saved to '{}'.", Path::GetFileName(path)), 10.0f);
+				}
+				else
+				{
+					Host::AddFormattedOSDMessage(10.0f, "Failed to save screenshot to '%s'.", path.c_str());
+				}
+			});
+			if (!queued)
 				Host::AddFormattedOSDMessage(10.0f, "Failed to save screenshot to '%s'.", path.c_str());
-			}
 		}
 
 		m_snapshot = {};
@@ -719,9 +733,20 @@ void GSRenderer::VSync(u32 field, bool registers_written)
 			Host::AddKeyedOSDMessage("GSDump", fmt::format("Saved GS dump to '{}'.", Path::GetFileName(m_dump->GetPath())), 10.0f);
 			m_dump.reset();
 		}
-		else if (!last)
+		else
 		{
-			m_dump_frames--;
+			if (!last)
+				m_dump_frames--;
+
+			if (m_dump->IsKeyframeDue())
+			{
+				freezeData fd = {0, nullptr};
+				Freeze(&fd, true);
+				std::unique_ptr<u8[]> data = std::make_unique<u8[]>(fd.size);
+				fd.data = data.get();
+				Freeze(&fd, false);
+				m_dump->Keyframe(fd, m_regs);
+			}
 		}
 	}
 
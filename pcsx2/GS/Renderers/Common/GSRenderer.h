@@ -46,6 +46,9 @@ protected:
 	GSVector2i m_real_size{0, 0};
 	bool m_texture_shuffle;
 
+	/// Set for frames whose draws to the display buffers were skipped, these aren't merged or presented.
+	bool m_frame_draws_skipped = false;
+
 	virtual GSTexture* GetOutput(int i, int& y_offset) = 0;
 	virtual GSTexture* GetFeedbackOutput() { return nullptr; }
 
@@ -57,7 +60,7 @@ public:
 
 	virtual void Destroy();
 
-	virtual void VSync(u32 field, bool registers_written);
+	virtual void VSync(u32 field, bool registers_written, bool hidden);
 	virtual bool CanUpscale() { return false; }
 	virtual int GetUpscaleMultiplier() { return 1; }
 	virtual GSVector2 GetTextureScaleFactor() { return { 1.0f, 1.0f }; }
@@ -17,6 +17,7 @@
 #include "GSTexture.h"
 #include "GSDevice.h"
 #include "GS/GSPng.h"
+#include "GS/GSPerfMon.h"
 #include <bitset>
 
 GSTexture::GSTexture()
@@ -32,24 +33,31 @@ GSTexture::GSTexture()
 {
 }
 
-bool GSTexture::Save(const std::string& fn)
+static bool GetPNGFormat(GSTexture::Format format, GSPng::Format* png_format)
 {
 #ifdef PCSX2_DEVBUILD
-	GSPng::Format format = GSPng::RGB_A_PNG;
+	*png_format = GSPng::RGB_A_PNG;
 #else
-	GSPng::Format format = GSPng::RGB_PNG;
+	*png_format = GSPng::RGB_PNG;
 #endif
-	switch (m_format)
+	switch (format)
 	{
-		case Format::UNorm8:
-			format = GSPng::R8I_PNG;
-			break;
-		case Format::Color:
-			break;
+		case GSTexture::Format::UNorm8:
+			*png_format = GSPng::R8I_PNG;
+			return true;
+		case GSTexture::Format::Color:
+			return true;
 		default:
-			Console.Error("Format %d not saved to image", static_cast<int>(m_format));
+			Console.Error("Format %d not saved to image", static_cast<int>(format));
 			return false;
 	}
+}
+
+bool GSTexture::Save(const std::string& fn)
+{
+	GSPng::Format format;
+	if (!GetPNGFormat(m_format, &format))
+		return false;
 
 	GSMap map;
 	if (!g_gs_device->DownloadTexture(this, GSVector4i(0, 0, m_size.x, m_size.y), map))
@@ -66,6 +74,28 @@ bool GSTexture::Save(const std::string& fn)
 	return success;
 }
 
+bool GSTexture::SaveAsync(const std::string& fn, std::function<void(bool)> callback)
+{
+	GSPng::Format format;
+	if (!GetPNGFormat(m_format, &format))
+		return false;
+
+	GSMap map;
+	if (!g_gs_device->DownloadTexture(this, GSVector4i(0, 0, m_size.x, m_size.y), map))
+	{
+		Console.Error("(GSTexture) DownloadTexture() failed.");
+		return false;
+	}
+
+	// only the readback and copy happen here, the PNG is encoded on a worker thread
+	const int compression = theApp.GetConfigI("png_compression_level");
+	GSPng::SaveAsync(format, fn, map.bits, m_size.x, m_size.y, map.pitch, compression, std::move(callback));
+
+	g_gs_device->DownloadTextureComplete();
+
+	return true;
+}
+
 void GSTexture::Swap(GSTexture* tex)
 {
 	std::swap(m_scale, tex->m_scale);
@@ -126,5 +156,6 @@ void GSTexture::GenerateMipmapsIfNeeded()
 		return;
 
 	m_needs_mipmaps_generated = false;
+	g_perfmon.Put(GSPerfMon::TextureMipmaps, 1);
 	GenerateMipmap();
 }
@@ -16,6 +16,7 @@
 #pragma once
 
 #include "GS/GSVector.h"
+#include <functional>
 
 class GSTexture
 {
@@ -79,6 +80,7 @@ public:
 	virtual void Unmap() = 0;
 	virtual void GenerateMipmap() {}
 	virtual bool Save(const std::string& fn);
+	bool SaveAsync(const std::string& fn, std::function<void(bool)> callback);
 	virtual void Swap(GSTexture* tex);
 	virtual u32 GetID() { return 0; }
 
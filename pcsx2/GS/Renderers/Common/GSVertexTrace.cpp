@@ -17,6 +17,7 @@
 #include "GSVertexTrace.h"
 #include "GS/GSUtil.h"
 #include "GS/GSState.h"
+#include "common/StringUtil.h"
 #include <cfloat>
 
 CONSTINIT const GSVector4 GSVertexTrace::s_minmax = GSVector4::cxpr(FLT_MAX, -FLT_MAX, 0.f, 0.f);
@@ -154,10 +155,8 @@ void GSVertexTrace::Update(const void* vertex, const u32* index, int v_count, in
 }
 
 template <GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, bool flat_swapped>
-void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
+void GSVertexTrace::FindMinMaxRange(const GSVertex* RESTRICT v, const u32* index, int count, MinMax& mm)
 {
-	const GSDrawingContext* context = m_state->m_context;
-
 	int n = 1;
 
 	switch (primclass)
@@ -182,8 +181,6 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 	GSVector4i pmin = GSVector4i::xffffffff();
 	GSVector4i pmax = GSVector4i::zero();
 
-	const GSVertex* RESTRICT v = (GSVertex*)vertex;
-
 	// Process 2 vertices at a time for increased efficiency
 	auto processVertices = [&](const GSVertex& v0, const GSVertex& v1, bool finalVertex)
 	{
@@ -302,6 +299,100 @@ void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
 		pxAssertRel(0, "Bad n value");
 	}
 
+	mm.tmin = tmin;
+	mm.tmax = tmax;
+	mm.cmin = cmin;
+	mm.cmax = cmax;
+	mm.pmin = pmin;
+	mm.pmax = pmax;
+}
+
+// Indices per helper before splitting a draw is worth waking threads for, keeps a multiple of 6 so
+// no triangle or line (or flat shaded triangle pair, see below) straddles two ranges.
+static constexpr int MINMAX_SPLIT_INDICES = 6 * 8192;
+static constexpr int MINMAX_MAX_HELPERS = 3;
+
+int GSVertexTrace::GetHelperCount(int count)
+{
+	const int wanted = std::min(count / MINMAX_SPLIT_INDICES - 1, MINMAX_MAX_HELPERS);
+	if (wanted <= 0)
+		return 0;
+
+	if (m_workers.empty())
+	{
+		// Leave room for the EE, VU and GS threads, and the SW rasterizer ones if they're around.
+		const int threads = std::min<int>(MINMAX_MAX_HELPERS, static_cast<int>(std::thread::hardware_concurrency()) / 4);
+		for (int i = 0; i < std::max(threads, 0); i++)
+		{
+			m_workers.push_back(std::make_unique<Worker>(
+				[i]() { Threading::SetNameOfCurrentThread(StringUtil::StdStringFromFormat("GS-VertexTrace-%d", i).c_str()); },
+				[](std::function<void()>& func) { func(); },
+				std::function<void()>()));
+		}
+
+		// Don't come back here when the machine doesn't have any to spare.
+		if (m_workers.empty())
+			m_workers.push_back(nullptr);
+	}
+
+	if (!m_workers[0])
+		return 0;
+
+	return std::min(wanted, static_cast<int>(m_workers.size()));
+}
+
+template <GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, bool flat_swapped>
+void GSVertexTrace::FindMinMax(const void* vertex, const u32* index, int count)
+{
+	const GSDrawingContext* context = m_state->m_context;
+	const GSVertex* RESTRICT v = (GSVertex*)vertex;
+
+	MinMax mm;
+
+	if (const int helpers = GetHelperCount(count); helpers > 0)
+	{
+		// Each part gets a multiple of 6 indices, the last one takes any remainder.
+		std::array<MinMax, MINMAX_MAX_HELPERS + 1> parts;
+		const int part_count = ((count / (helpers + 1)) / 6) * 6;
+
+		for (int i = 0; i < helpers; i++)
+		{
+			MinMax* part = &parts[i + 1];
+			const u32* part_index = index + part_count * (i + 1);
+			const int part_size = (i == helpers - 1) ? (count - part_count * helpers) : part_count;
+			m_workers[i]->Push([v, part_index, part_size, part]() {
+				FindMinMaxRange<primclass, iip, tme, fst, color, flat_swapped>(v, part_index, part_size, *part);
+			});
+		}
+
+		FindMinMaxRange<primclass, iip, tme, fst, color, flat_swapped>(v, index, part_count, parts[0]);
+
+		for (int i = 0; i < helpers; i++)
+			m_workers[i]->Wait();
+
+		mm = parts[0];
+		for (int i = 1; i <= helpers; i++)
+		{
+			mm.tmin = mm.tmin.min(parts[i].tmin);
+			mm.tmax = mm.tmax.max(parts[i].tmax);
+			mm.cmin = mm.cmin.min_u8(parts[i].cmin);
+			mm.cmax = mm.cmax.max_u8(parts[i].cmax);
+			mm.pmin = mm.pmin.min_u32(parts[i].pmin);
+			mm.pmax = mm.pmax.max_u32(parts[i].pmax);
+		}
+	}
+	else
+	{
+		FindMinMaxRange<primclass, iip, tme, fst, color, flat_swapped>(v, index, count, mm);
+	}
+
+	const GSVector4 tmin = mm.tmin;
+	const GSVector4 tmax = mm.tmax;
+	const GSVector4i cmin = mm.cmin;
+	const GSVector4i cmax = mm.cmax;
+	const GSVector4i pmin = mm.pmin;
+	const GSVector4i pmax = mm.pmax;
+
 	GSVector4 o(context->XYOFFSET);
 	GSVector4 s(1.0f / 16, 1.0f / 16, 2.0f, 1.0f);
 
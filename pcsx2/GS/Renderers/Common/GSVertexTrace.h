@@ -21,6 +21,7 @@
 #include "GS/Renderers/SW/GSVertexSW.h"
 #include "GS/Renderers/HW/GSVertexHW.h"
 #include "GSFunctionMap.h"
+#include "GS/GSThread_CXX11.h"
 
 class GSState;
 
@@ -48,9 +49,27 @@ protected:
 
 	FindMinMaxPtr m_fmm[2][2][2][2][4];
 
+	/// Raw ranges of part of a draw, before offsets and scaling.
+	struct alignas(16) MinMax
+	{
+		GSVector4 tmin, tmax;
+		GSVector4i cmin, cmax;
+		GSVector4i pmin, pmax;
+	};
+
+	// Helpers for splitting huge draws, created the first time one shows up.
+	using Worker = GSJobQueue<std::function<void()>, 4>;
+	std::vector<std::unique_ptr<Worker>> m_workers;
+
+	template <GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, bool provoking_vertex_first>
+	static void FindMinMaxRange(const GSVertex* RESTRICT v, const u32* index, int count, MinMax& mm);
+
 	template <GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, bool provoking_vertex_first>
 	void FindMinMax(const void* vertex, const u32* index, int count);
 
+	/// Returns how many helper threads a draw of this size should be split across, zero to do it all here.
+	int GetHelperCount(int count);
+
 public:
 	GS_PRIM_CLASS m_primclass;
 
@@ -89,6 +89,16 @@ bool GSDevice11::Create(HostDisplay* display)
 	m_ctx = static_cast<ID3D11DeviceContext*>(display->GetRenderContext());
 	level = m_dev->GetFeatureLevel();
 
+	if (SUCCEEDED(m_ctx->QueryInterface(IID_PPV_ARGS(m_ctx1.put()))))
+	{
+		D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+		if (FAILED(m_dev->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options))) ||
+			!options.ConstantBufferOffsetting || !options.MapNoOverwriteOnDynamicConstantBuffer)
+		{
+			m_ctx1.reset();
+		}
+	}
+
 	if (!GSConfig.DisableShaderCache)
 	{
 		if (!m_shader_cache.Open(EmuFolders::Cache, m_dev->GetFeatureLevel(), SHADER_VERSION, GSConfig.UseDebugDevice))
@@ -369,11 +379,11 @@ void GSDevice11::RestoreAPIState()
 	m_ctx->IASetInputLayout(m_state.layout);
 	m_ctx->IASetPrimitiveTopology(m_state.topology);
 	m_ctx->VSSetShader(m_state.vs, nullptr, 0);
-	m_ctx->VSSetConstantBuffers(0, 1, &m_state.vs_cb);
+	VSApplyConstantBuffer();
 	m_ctx->GSSetShader(m_state.gs, nullptr, 0);
-	m_ctx->GSSetConstantBuffers(0, 1, &m_state.gs_cb);
+	GSApplyConstantBuffer();
 	m_ctx->PSSetShader(m_state.ps, nullptr, 0);
-	m_ctx->PSSetConstantBuffers(0, 1, &m_state.ps_cb);
+	PSApplyConstantBuffer();
 
 	const CD3D11_VIEWPORT vp(0.0f, 0.0f,
 		static_cast<float>(m_state.viewport.x), static_cast<float>(m_state.viewport.y),
@@ -1128,7 +1138,80 @@ void GSDevice11::IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology)
 	}
 }
 
-void GSDevice11::VSSetShader(ID3D11VertexShader* vs, ID3D11Buffer* vs_cb)
+bool GSDevice11::ReserveConstantRing()
+{
+	// Wrap before a draw rather than during it, so both offsets always point into the same buffer instance.
+	if (m_cb_ring_pos + CB_RING_DRAW_RESERVE <= CB_RING_SIZE)
+		return false;
+
+	m_cb_ring_pos = 0;
+	m_cb_ring_discard = true;
+	return true;
+}
+
+u32 GSDevice11::UploadConstantRing(const void* data, u32 size)
+{
+	const u32 aligned_size = Common::AlignUpPow2(size, CB_RING_ALIGNMENT);
+	pxAssert((m_cb_ring_pos + aligned_size) <= CB_RING_SIZE);
+
+	const u32 offset = m_cb_ring_pos / 16;
+
+	D3D11_MAPPED_SUBRESOURCE m;
+	const D3D11_MAP type = m_cb_ring_discard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+	if (FAILED(m_ctx->Map(m_cb_ring.get(), 0, type, 0, &m)))
+	{
+		Console.Error("Failed to map constant buffer ring");
+		return offset;
+	}
+
+	memcpy(static_cast<u8*>(m.pData) + m_cb_ring_pos, data, size);
+	m_ctx->Unmap(m_cb_ring.get(), 0);
+
+	m_cb_ring_pos += aligned_size;
+	m_cb_ring_discard = false;
+	return offset;
+}
+
+void GSDevice11::VSApplyConstantBuffer()
+{
+	if (m_state.vs_cb && m_state.vs_cb == m_cb_ring.get())
+	{
+		const UINT count = VS_CB_RING_SIZE / 16;
+		m_ctx1->VSSetConstantBuffers1(0, 1, &m_state.vs_cb, &m_state.vs_cb_offset, &count);
+	}
+	else
+	{
+		m_ctx->VSSetConstantBuffers(0, 1, &m_state.vs_cb);
+	}
+}
+
+void GSDevice11::GSApplyConstantBuffer()
+{
+	if (m_state.gs_cb && m_state.gs_cb == m_cb_ring.get())
+	{
+		const UINT count = VS_CB_RING_SIZE / 16;
+		m_ctx1->GSSetConstantBuffers1(0, 1, &m_state.gs_cb, &m_state.gs_cb_offset, &count);
+	}
+	else
+	{
+		m_ctx->GSSetConstantBuffers(0, 1, &m_state.gs_cb);
+	}
+}
+
+void GSDevice11::PSApplyConstantBuffer()
+{
+	if (m_state.ps_cb && m_state.ps_cb == m_cb_ring.get())
+	{
+		const UINT count = PS_CB_RING_SIZE / 16;
+		m_ctx1->PSSetConstantBuffers1(0, 1, &m_state.ps_cb, &m_state.ps_cb_offset, &count);
+	}
+	else
+	{
+		m_ctx->PSSetConstantBuffers(0, 1, &m_state.ps_cb);
+	}
+}
+
+void GSDevice11::VSSetShader(ID3D11VertexShader* vs, ID3D11Buffer* vs_cb, u32 vs_cb_offset)
 {
 	if (m_state.vs != vs)
 	{
@@ -1137,15 +1220,16 @@ void GSDevice11::VSSetShader(ID3D11VertexShader* vs, ID3D11Buffer* vs_cb)
 		m_ctx->VSSetShader(vs, nullptr, 0);
 	}
 
-	if (m_state.vs_cb != vs_cb)
+	if (m_state.vs_cb != vs_cb || m_state.vs_cb_offset != vs_cb_offset)
 	{
 		m_state.vs_cb = vs_cb;
+		m_state.vs_cb_offset = vs_cb_offset;
 
-		m_ctx->VSSetConstantBuffers(0, 1, &vs_cb);
+		VSApplyConstantBuffer();
 	}
 }
 
-void GSDevice11::GSSetShader(ID3D11GeometryShader* gs, ID3D11Buffer* gs_cb)
+void GSDevice11::GSSetShader(ID3D11GeometryShader* gs, ID3D11Buffer* gs_cb, u32 gs_cb_offset)
 {
 	if (m_state.gs != gs)
 	{
@@ -1154,11 +1238,12 @@ void GSDevice11::GSSetShader(ID3D11GeometryShader* gs, ID3D11Buffer* gs_cb)
 		m_ctx->GSSetShader(gs, nullptr, 0);
 	}
 
-	if (m_state.gs_cb != gs_cb)
+	if (m_state.gs_cb != gs_cb || m_state.gs_cb_offset != gs_cb_offset)
 	{
 		m_state.gs_cb = gs_cb;
+		m_state.gs_cb_offset = gs_cb_offset;
 
-		m_ctx->GSSetConstantBuffers(0, 1, &gs_cb);
+		GSApplyConstantBuffer();
 	}
 }
 
@@ -1180,7 +1265,7 @@ void GSDevice11::PSSetSamplerState(ID3D11SamplerState* ss0, ID3D11SamplerState*
 	m_state.ps_ss[1] = ss1;
 }
 
-void GSDevice11::PSSetShader(ID3D11PixelShader* ps, ID3D11Buffer* ps_cb)
+void GSDevice11::PSSetShader(ID3D11PixelShader* ps, ID3D11Buffer* ps_cb, u32 ps_cb_offset)
 {
 	if (m_state.ps != ps)
 	{
@@ -1189,11 +1274,12 @@ void GSDevice11::PSSetShader(ID3D11PixelShader* ps, ID3D11Buffer* ps_cb)
 		m_ctx->PSSetShader(ps, nullptr, 0);
 	}
 
-	if (m_state.ps_cb != ps_cb)
+	if (m_state.ps_cb != ps_cb || m_state.ps_cb_offset != ps_cb_offset)
 	{
 		m_state.ps_cb = ps_cb;
+		m_state.ps_cb_offset = ps_cb_offset;
 
-		m_ctx->PSSetConstantBuffers(0, 1, &ps_cb);
+		PSApplyConstantBuffer();
 	}
 }
 
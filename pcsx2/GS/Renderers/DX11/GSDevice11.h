@@ -18,9 +18,11 @@
 #include "GSTexture11.h"
 #include "GS/GSVector.h"
 #include "GS/Renderers/Common/GSDevice.h"
+#include "common/Align.h"
 #include "common/D3D11/ShaderCache.h"
 #include <unordered_map>
 #include <wil/com.h>
+#include <d3d11_1.h>
 #include <dxgi1_3.h>
 
 struct GSVertexShader11
@@ -132,6 +134,22 @@ private:
 	wil::com_ptr_nothrow<ID3D11Buffer> m_vb;
 	wil::com_ptr_nothrow<ID3D11Buffer> m_ib;
 
+	static constexpr u32 CB_RING_SIZE = 1024 * 1024;
+	static constexpr u32 CB_RING_ALIGNMENT = 256; // D3D11.1 offsets are in multiples of 16 constants
+	static constexpr u32 VS_CB_RING_SIZE = Common::AlignUpPow2(static_cast<u32>(sizeof(GSHWDrawConfig::VSConstantBuffer)), CB_RING_ALIGNMENT);
+	static constexpr u32 PS_CB_RING_SIZE = Common::AlignUpPow2(static_cast<u32>(sizeof(GSHWDrawConfig::PSConstantBuffer)), CB_RING_ALIGNMENT);
+	// RenderHW uploads one VS block and up to four PS blocks (main pass plus the DATE/blend/alpha passes).
+	static constexpr u32 CB_RING_DRAW_RESERVE = VS_CB_RING_SIZE + PS_CB_RING_SIZE * 4;
+
+	// Draw constants are sub-allocated from a single dynamic buffer when the
+	// device supports D3D11.1 constant buffer offsetting, otherwise m_vs_cb/m_ps_cb are used.
+	wil::com_ptr_nothrow<ID3D11DeviceContext1> m_ctx1;
+	wil::com_ptr_nothrow<ID3D11Buffer> m_cb_ring;
+	u32 m_cb_ring_pos = 0;
+	bool m_cb_ring_discard = true;
+	u32 m_vs_cb_offset = 0;
+	u32 m_ps_cb_offset = 0;
+
 	struct
 	{
 		ID3D11Buffer* vb;
@@ -141,11 +159,14 @@ private:
 		D3D11_PRIMITIVE_TOPOLOGY topology;
 		ID3D11VertexShader* vs;
 		ID3D11Buffer* vs_cb;
+		u32 vs_cb_offset;
 		ID3D11GeometryShader* gs;
 		ID3D11Buffer* gs_cb;
+		u32 gs_cb_offset;
 		std::array<ID3D11ShaderResourceView*, MAX_TEXTURES> ps_sr_views;
 		ID3D11PixelShader* ps;
 		ID3D11Buffer* ps_cb;
+		u32 ps_cb_offset;
 		std::array<ID3D11SamplerState*, MAX_SAMPLERS> ps_ss;
 		GSVector2i viewport;
 		GSVector4i scissor;
@@ -232,6 +253,12 @@ private:
 	D3D11::ShaderCache m_shader_cache;
 	std::string m_tfx_source;
 
+	bool ReserveConstantRing();
+	u32 UploadConstantRing(const void* data, u32 size);
+	void VSApplyConstantBuffer();
+	void GSApplyConstantBuffer();
+	void PSApplyConstantBuffer();
+
 public:
 	GSDevice11();
 	~GSDevice11() override;
@@ -278,12 +305,12 @@ public:
 	void IASetInputLayout(ID3D11InputLayout* layout);
 	void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology);
 
-	void VSSetShader(ID3D11VertexShader* vs, ID3D11Buffer* vs_cb);
-	void GSSetShader(ID3D11GeometryShader* gs, ID3D11Buffer* gs_cb = NULL);
+	void VSSetShader(ID3D11VertexShader* vs, ID3D11Buffer* vs_cb, u32 vs_cb_offset = 0);
+	void GSSetShader(ID3D11GeometryShader* gs, ID3D11Buffer* gs_cb = NULL, u32 gs_cb_offset = 0);
 
 	void PSSetShaderResources(GSTexture* sr0, GSTexture* sr1);
 	void PSSetShaderResource(int i, GSTexture* sr);
-	void PSSetShader(ID3D11PixelShader* ps, ID3D11Buffer* ps_cb);
+	void PSSetShader(ID3D11PixelShader* ps, ID3D11Buffer* ps_cb, u32 ps_cb_offset = 0);
 	void PSUpdateShaderState();
 	void PSSetSamplerState(ID3D11SamplerState* ss0, ID3D11SamplerState* ss1);
 
@@ -46,6 +46,27 @@ bool GSDevice11::CreateTextureFX()
 	if (FAILED(hr))
 		return false;
 
+	if (m_ctx1)
+	{
+		memset(&bd, 0, sizeof(bd));
+
+		bd.ByteWidth = CB_RING_SIZE;
+		bd.Usage = D3D11_USAGE_DYNAMIC;
+		bd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+		bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+		hr = m_dev->CreateBuffer(&bd, nullptr, m_cb_ring.put());
+
+		if (FAILED(hr))
+		{
+			Console.Warning("Failed to create constant buffer ring, using UpdateSubresource.");
+			m_ctx1.reset();
+		}
+
+		// Forces a wrap (and discard) on the first draw.
+		m_cb_ring_pos = CB_RING_SIZE;
+	}
+
 	D3D11_SAMPLER_DESC sd;
 
 	memset(&sd, 0, sizeof(sd));
@@ -107,12 +128,29 @@ void GSDevice11::SetupVS(VSSelector sel, const GSHWDrawConfig::VSConstantBuffer*
 		i = m_vs.try_emplace(sel.key, std::move(vs)).first;
 	}
 
-	if (m_vs_cb_cache.Update(*cb))
+	if (m_cb_ring)
 	{
-		m_ctx->UpdateSubresource(m_vs_cb.get(), 0, NULL, cb, 0, 0);
+		// SetupVS starts every draw, so reserve room for all of its constants here.
+		const bool wrapped = ReserveConstantRing();
+
+		if (m_vs_cb_cache.Update(*cb) || wrapped)
+			m_vs_cb_offset = UploadConstantRing(cb, sizeof(*cb));
+
+		// The old PS block went away with the discard, and SetupPS may be called without constants.
+		if (wrapped)
+			m_ps_cb_offset = UploadConstantRing(&m_ps_cb_cache, sizeof(m_ps_cb_cache));
+
+		VSSetShader(i->second.vs.get(), m_cb_ring.get(), m_vs_cb_offset);
 	}
+	else
+	{
+		if (m_vs_cb_cache.Update(*cb))
+		{
+			m_ctx->UpdateSubresource(m_vs_cb.get(), 0, NULL, cb, 0, 0);
+		}
 
-	VSSetShader(i->second.vs.get(), m_vs_cb.get());
+		VSSetShader(i->second.vs.get(), m_vs_cb.get());
+	}
 
 	IASetInputLayout(i->second.il.get());
 }
@@ -144,7 +182,10 @@ void GSDevice11::SetupGS(GSSelector sel)
 		}
 	}
 
-	GSSetShader(gs.get(), m_vs_cb.get());
+	if (m_cb_ring)
+		GSSetShader(gs.get(), m_cb_ring.get(), m_vs_cb_offset);
+	else
+		GSSetShader(gs.get(), m_vs_cb.get());
 }
 
 void GSDevice11::SetupPS(const PSSelector& sel, const GSHWDrawConfig::PSConstantBuffer* cb, PSSamplerSelector ssel)
@@ -207,7 +248,10 @@ void GSDevice11::SetupPS(const PSSelector& sel, const GSHWDrawConfig::PSConstant
 
 	if (cb && m_ps_cb_cache.Update(*cb))
 	{
-		m_ctx->UpdateSubresource(m_ps_cb.get(), 0, NULL, cb, 0, 0);
+		if (m_cb_ring)
+			m_ps_cb_offset = UploadConstantRing(cb, sizeof(*cb));
+		else
+			m_ctx->UpdateSubresource(m_ps_cb.get(), 0, NULL, cb, 0, 0);
 	}
 
 	wil::com_ptr_nothrow<ID3D11SamplerState> ss0, ss1;
@@ -274,7 +318,10 @@ void GSDevice11::SetupPS(const PSSelector& sel, const GSHWDrawConfig::PSConstant
 
 	PSSetSamplerState(ss0.get(), ss1.get());
 
-	PSSetShader(i->second.get(), m_ps_cb.get());
+	if (m_cb_ring)
+		PSSetShader(i->second.get(), m_cb_ring.get(), m_ps_cb_offset);
+	else
+		PSSetShader(i->second.get(), m_ps_cb.get());
 }
 
 void GSDevice11::ClearSamplerCache()
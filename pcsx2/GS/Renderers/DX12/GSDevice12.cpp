@@ -21,6 +21,8 @@
 #include "common/Align.h"
 #include "common/ScopedGuard.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
+#include "common/Timer.h"
 #include "D3D12MemAlloc.h"
 #include "GS.h"
 #include "GSDevice12.h"
@@ -160,6 +162,9 @@ bool GSDevice12::Create(HostDisplay* display)
 		return false;
 	}
 
+	if (GSConfig.AsyncPipelineCompilation)
+		StartPipelineCompileThread();
+
 	InitializeState();
 	InitializeSamplers();
 	return true;
@@ -172,6 +177,8 @@ void GSDevice12::Destroy()
 
 	EndRenderPass();
 	ExecuteCommandList(true);
+	StopPipelineCompileThread();
+	SavePipelineManifest("d3d12", sizeof(PipelineSelector));
 	DestroyResources();
 	GSDevice::Destroy();
 }
@@ -450,9 +457,8 @@ void GSDevice12::CopyRect(GSTexture* sTex, GSTexture* dTex, const GSVector4i& r,
 		dTexVK->CommitClear();
 
 	EndRenderPass();
-	sTexVK->TransitionToState(D3D12_RESOURCE_STATE_COPY_SOURCE);
 	dTexVK->SetState(GSTexture::State::Dirty);
-	dTexVK->TransitionToState(D3D12_RESOURCE_STATE_COPY_DEST);
+	GSTexture12::TransitionToStates(sTexVK, D3D12_RESOURCE_STATE_COPY_SOURCE, dTexVK, D3D12_RESOURCE_STATE_COPY_DEST);
 
 	D3D12_TEXTURE_COPY_LOCATION srcloc;
 	srcloc.pResource = sTexVK->GetResource();
@@ -615,9 +621,8 @@ void GSDevice12::DoMerge(GSTexture* sTex[3], GSVector4* sRect, GSTexture* dTex,
 	EndRenderPass();
 
 	// transition everything before starting the new render pass
-	static_cast<GSTexture12*>(dTex)->TransitionToState(D3D12_RESOURCE_STATE_RENDER_TARGET);
-	if (sTex[0])
-		static_cast<GSTexture12*>(sTex[0])->TransitionToState(D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	GSTexture12::TransitionToStates(static_cast<GSTexture12*>(dTex), D3D12_RESOURCE_STATE_RENDER_TARGET,
+		static_cast<GSTexture12*>(sTex[0]), D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
 
 	// Upload constant to select YUV algo, but skip constant buffer update if we don't need it
 	if (feedback_write_2 || feedback_write_1 || sTex[0])
@@ -865,12 +870,7 @@ void GSDevice12::OMSetRenderTargets(GSTexture* rt, GSTexture* ds, const GSVector
 	m_current_depth_target = vkDs;
 
 	if (!InRenderPass())
-	{
-		if (vkRt)
-			vkRt->TransitionToState(D3D12_RESOURCE_STATE_RENDER_TARGET);
-		if (vkDs)
-			vkDs->TransitionToState(D3D12_RESOURCE_STATE_DEPTH_WRITE);
-	}
+		GSTexture12::TransitionToStates(vkRt, D3D12_RESOURCE_STATE_RENDER_TARGET, vkDs, D3D12_RESOURCE_STATE_DEPTH_WRITE);
 
 	// This is used to set/initialize the framebuffer for tfx rendering.
 	const GSVector2i size = vkRt ? vkRt->GetSize() : vkDs->GetSize();
@@ -967,6 +967,29 @@ bool GSDevice12::GetTextureGroupDescriptors(D3D12::DescriptorHandle* gpu_handle,
 	return true;
 }
 
+bool GSDevice12::GetCachedTextureGroupDescriptors(std::unordered_map<u64, D3D12::DescriptorHandle>& cache, D3D12::DescriptorHandle* gpu_handle, const D3D12::DescriptorHandle* cpu_handles)
+{
+	if (m_tfx_group_cache_fence_value != g_d3d12_context->GetCurrentFenceValue())
+	{
+		m_tfx_textures_group_cache.clear();
+		m_tfx_rt_textures_group_cache.clear();
+		m_tfx_group_cache_fence_value = g_d3d12_context->GetCurrentFenceValue();
+	}
+
+	const u64 key = (static_cast<u64>(cpu_handles[0].index) << 32) | cpu_handles[1].index;
+	if (auto it = cache.find(key); it != cache.end())
+	{
+		*gpu_handle = it->second;
+		return true;
+	}
+
+	if (!GetTextureGroupDescriptors(gpu_handle, cpu_handles, 2))
+		return false;
+
+	cache.emplace(key, *gpu_handle);
+	return true;
+}
+
 static void AddUtilityVertexAttributes(D3D12::GraphicsPipelineBuilder& gpb)
 {
 	gpb.AddVertexAttribute("POSITION", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 0);
@@ -1701,11 +1724,132 @@ const ID3D12PipelineState* GSDevice12::GetTFXPipeline(const PipelineSelector& p)
 	if (it != m_tfx_pipelines.end())
 		return it->second.get();
 
+	if (m_pipeline_compile_thread.joinable())
+	{
+		ProcessCompiledPipelines();
+		it = m_tfx_pipelines.find(p);
+		if (it != m_tfx_pipelines.end())
+			return it->second.get();
+
+		// Draw is skipped until the compile thread catches up.
+		QueuePipelineCompile(p, true);
+		return nullptr;
+	}
+
 	ComPtr<ID3D12PipelineState> pipeline(CreateTFXPipeline(p));
 	it = m_tfx_pipelines.emplace(p, std::move(pipeline)).first;
+	RecordPipeline(&p, sizeof(p));
 	return it->second.get();
 }
 
+void GSDevice12::SetGameCRC(u32 crc)
+{
+	if (crc == m_pipeline_manifest_crc)
+		return;
+
+	SavePipelineManifest("d3d12", sizeof(PipelineSelector));
+	m_pipeline_manifest_crc = crc;
+
+	std::vector<u8> data;
+	if (crc == 0 || !LoadPipelineManifest("d3d12", crc, sizeof(PipelineSelector), &data))
+		return;
+
+	// See GSDeviceVK::SetGameCRC(), the shader caches are only safe to use from one thread.
+	Common::Timer timer;
+	u32 compiled = 0;
+	for (size_t pos = 0; pos < data.size(); pos += sizeof(PipelineSelector))
+	{
+		PipelineSelector p;
+		std::memcpy(&p, &data[pos], sizeof(p));
+		if (m_tfx_pipelines.find(p) != m_tfx_pipelines.end())
+			continue;
+
+		if (m_pipeline_compile_thread.joinable())
+			QueuePipelineCompile(p, false);
+		else
+			m_tfx_pipelines.emplace(p, CreateTFXPipeline(p));
+		compiled++;
+	}
+
+	DevCon.WriteLn("%s %u D3D12 pipelines for CRC %08X in %.2f ms", m_pipeline_compile_thread.joinable() ? "Queued" : "Precompiled",
+		compiled, crc, timer.GetTimeMilliseconds());
+}
+
+void GSDevice12::StartPipelineCompileThread()
+{
+	m_pipeline_compile_quit = false;
+	m_pipeline_compile_thread = std::thread(&GSDevice12::PipelineCompileThreadEntryPoint, this);
+}
+
+void GSDevice12::StopPipelineCompileThread()
+{
+	if (!m_pipeline_compile_thread.joinable())
+		return;
+
+	{
+		std::unique_lock lock(m_pipeline_compile_mutex);
+		m_pipeline_compile_quit = true;
+		m_pipeline_compile_queue.clear();
+		m_pipeline_compile_cv.notify_one();
+	}
+
+	m_pipeline_compile_thread.join();
+
+	// Take ownership of anything which finished, so it gets released with the rest.
+	ProcessCompiledPipelines();
+	m_pipeline_compile_pending.clear();
+}
+
+void GSDevice12::PipelineCompileThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("GS Pipeline Compiler");
+
+	std::unique_lock lock(m_pipeline_compile_mutex);
+	for (;;)
+	{
+		m_pipeline_compile_cv.wait(lock, [this]() { return m_pipeline_compile_quit || !m_pipeline_compile_queue.empty(); });
+		if (m_pipeline_compile_quit)
+			break;
+
+		const PipelineCompileRequest req = m_pipeline_compile_queue.front();
+		m_pipeline_compile_queue.pop_front();
+		lock.unlock();
+
+		ComPtr<ID3D12PipelineState> pipeline(CreateTFXPipeline(req.p));
+
+		lock.lock();
+		m_pipeline_compile_results.emplace_back(req, std::move(pipeline));
+		m_pipeline_compile_results_ready.store(true, std::memory_order_release);
+	}
+}
+
+void GSDevice12::QueuePipelineCompile(const PipelineSelector& p, bool record)
+{
+	if (!m_pipeline_compile_pending.insert(p).second)
+		return;
+
+	std::unique_lock lock(m_pipeline_compile_mutex);
+	m_pipeline_compile_queue.push_back({p, record});
+	m_pipeline_compile_cv.notify_one();
+}
+
+void GSDevice12::ProcessCompiledPipelines()
+{
+	if (!m_pipeline_compile_results_ready.load(std::memory_order_acquire))
+		return;
+
+	std::unique_lock lock(m_pipeline_compile_mutex);
+	for (auto& [req, pipeline] : m_pipeline_compile_results)
+	{
+		m_pipeline_compile_pending.erase(req.p);
+		m_tfx_pipelines.emplace(req.p, std::move(pipeline));
+		if (req.record)
+			RecordPipeline(&req.p, sizeof(req.p));
+	}
+	m_pipeline_compile_results.clear();
+	m_pipeline_compile_results_ready.store(false, std::memory_order_relaxed);
+}
+
 bool GSDevice12::BindDrawPipeline(const PipelineSelector& p)
 {
 	const ID3D12PipelineState* pipeline = GetTFXPipeline(p);
@@ -2001,10 +2145,20 @@ void GSDevice12::RenderTextureMipmap(const D3D12::Texture& texture,
 
 	// *now* we don't have to worry about running out of anything.
 	ID3D12GraphicsCommandList* cmdlist = g_d3d12_context->GetCommandList();
+	D3D12_RESOURCE_BARRIER barriers[2];
+	u32 num_barriers = 0;
 	if (texture.GetState() != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE)
-		texture.TransitionSubresourceToState(cmdlist, src_level, texture.GetState(), D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	{
+		barriers[num_barriers++] = {D3D12_RESOURCE_BARRIER_TYPE_TRANSITION, D3D12_RESOURCE_BARRIER_FLAG_NONE,
+			{{texture.GetResource(), src_level, texture.GetState(), D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}}};
+	}
 	if (texture.GetState() != D3D12_RESOURCE_STATE_RENDER_TARGET)
-		texture.TransitionSubresourceToState(cmdlist, dst_level, texture.GetState(), D3D12_RESOURCE_STATE_RENDER_TARGET);
+	{
+		barriers[num_barriers++] = {D3D12_RESOURCE_BARRIER_TYPE_TRANSITION, D3D12_RESOURCE_BARRIER_FLAG_NONE,
+			{{texture.GetResource(), dst_level, texture.GetState(), D3D12_RESOURCE_STATE_RENDER_TARGET}}};
+	}
+	if (num_barriers > 0)
+		cmdlist->ResourceBarrier(num_barriers, barriers);
 
 	// We set the state directly here.
 	constexpr u32 MODIFIED_STATE = DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR | DIRTY_FLAG_RENDER_TARGET;
@@ -2027,10 +2181,11 @@ void GSDevice12::RenderTextureMipmap(const D3D12::Texture& texture,
 		GSVector4(0.0f, 0.0f, static_cast<float>(dst_width), static_cast<float>(dst_height)),
 		GSVector2i(dst_width, dst_height));
 
-	if (texture.GetState() != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE)
-		texture.TransitionSubresourceToState(cmdlist, src_level, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, texture.GetState());
-	if (texture.GetState() != D3D12_RESOURCE_STATE_RENDER_TARGET)
-		texture.TransitionSubresourceToState(cmdlist, dst_level, D3D12_RESOURCE_STATE_RENDER_TARGET, texture.GetState());
+	// Same barriers in reverse, back to the texture's tracked state.
+	for (u32 i = 0; i < num_barriers; i++)
+		std::swap(barriers[i].Transition.StateBefore, barriers[i].Transition.StateAfter);
+	if (num_barriers > 0)
+		cmdlist->ResourceBarrier(num_barriers, barriers);
 
 	// Must destroy after current cmdlist.
 	g_d3d12_context->DeferDescriptorDestruction(g_d3d12_context->GetDescriptorHeapManager(), &srv_handle);
@@ -2246,7 +2401,7 @@ bool GSDevice12::ApplyTFXState(bool already_execed)
 
 	if (flags & DIRTY_FLAG_TFX_TEXTURES)
 	{
-		if (!GetTextureGroupDescriptors(&m_tfx_textures_handle_gpu, m_tfx_textures.data(), 2))
+		if (!GetCachedTextureGroupDescriptors(m_tfx_textures_group_cache, &m_tfx_textures_handle_gpu, m_tfx_textures.data()))
 		{
 			ExecuteCommandListAndRestartRenderPass("Ran out of TFX texture descriptor groups");
 			return ApplyTFXState(true);
@@ -2257,7 +2412,7 @@ bool GSDevice12::ApplyTFXState(bool already_execed)
 
 	if (flags & DIRTY_FLAG_TFX_RT_TEXTURES)
 	{
-		if (!GetTextureGroupDescriptors(&m_tfx_rt_textures_handle_gpu, m_tfx_textures.data() + 2, 2))
+		if (!GetCachedTextureGroupDescriptors(m_tfx_rt_textures_group_cache, &m_tfx_rt_textures_handle_gpu, m_tfx_textures.data() + 2))
 		{
 			ExecuteCommandListAndRestartRenderPass("Ran out of TFX RT descriptor descriptor groups");
 			return ApplyTFXState(true);
@@ -22,7 +22,13 @@
 #include "common/D3D12/StreamBuffer.h"
 #include "common/HashCombine.h"
 #include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace D3D12MA
 {
@@ -169,6 +175,23 @@ private:
 	std::unordered_map<GSHWDrawConfig::PSSelector, ComPtr<ID3DBlob>, GSHWDrawConfig::PSSelectorHash> m_tfx_pixel_shaders;
 	std::unordered_map<PipelineSelector, ComPtr<ID3D12PipelineState>, PipelineSelectorHash> m_tfx_pipelines;
 
+	// Background TFX pipeline compilation, only running when GSConfig.AsyncPipelineCompilation is set.
+	// While it runs, the GS thread never creates TFX pipelines itself, so the shader caches stay
+	// single threaded. Pending is only touched by the GS thread, everything else is under the mutex.
+	struct PipelineCompileRequest
+	{
+		PipelineSelector p;
+		bool record;
+	};
+	std::thread m_pipeline_compile_thread;
+	std::mutex m_pipeline_compile_mutex;
+	std::condition_variable m_pipeline_compile_cv;
+	std::deque<PipelineCompileRequest> m_pipeline_compile_queue;
+	std::vector<std::pair<PipelineCompileRequest, ComPtr<ID3D12PipelineState>>> m_pipeline_compile_results;
+	std::unordered_set<PipelineSelector, PipelineSelectorHash> m_pipeline_compile_pending;
+	std::atomic_bool m_pipeline_compile_results_ready{false};
+	bool m_pipeline_compile_quit = false;
+
 	GSHWDrawConfig::VSConstantBuffer m_vs_cb_cache;
 	GSHWDrawConfig::PSConstantBuffer m_ps_cb_cache;
 
@@ -189,6 +212,7 @@ private:
 	bool GetSampler(D3D12::DescriptorHandle* cpu_handle, GSHWDrawConfig::SamplerSelector ss);
 	void ClearSamplerCache() final;
 	bool GetTextureGroupDescriptors(D3D12::DescriptorHandle* gpu_handle, const D3D12::DescriptorHandle* cpu_handles, u32 count);
+	bool GetCachedTextureGroupDescriptors(std::unordered_map<u64, D3D12::DescriptorHandle>& cache, D3D12::DescriptorHandle* gpu_handle, const D3D12::DescriptorHandle* cpu_handles);
 
 	const ID3DBlob* GetTFXVertexShader(GSHWDrawConfig::VSSelector sel);
 	const ID3DBlob* GetTFXGeometryShader(GSHWDrawConfig::GSSelector sel);
@@ -196,6 +220,12 @@ private:
 	ComPtr<ID3D12PipelineState> CreateTFXPipeline(const PipelineSelector& p);
 	const ID3D12PipelineState* GetTFXPipeline(const PipelineSelector& p);
 
+	void StartPipelineCompileThread();
+	void StopPipelineCompileThread();
+	void PipelineCompileThreadEntryPoint();
+	void QueuePipelineCompile(const PipelineSelector& p, bool record);
+	void ProcessCompiledPipelines();
+
 	ComPtr<ID3DBlob> GetUtilityVertexShader(const std::string& source, const char* entry_point);
 	ComPtr<ID3DBlob> GetUtilityPixelShader(const std::string& source, const char* entry_point);
 
@@ -226,6 +256,8 @@ public:
 	bool Create(HostDisplay* display) override;
 	void Destroy() override;
 
+	void SetGameCRC(u32 crc) override;
+
 	void ResetAPIState() override;
 	void RestoreAPIState() override;
 
@@ -403,6 +435,12 @@ private:
 	D3D12::DescriptorHandle m_tfx_samplers_handle_gpu;
 	D3D12::DescriptorHandle m_tfx_rt_textures_handle_gpu;
 
+	// Texture groups copied in the current command list, keyed by the two SRV indices, so going back to a previous
+	// pair of textures doesn't copy them again. They live in the per-frame allocator, so are dropped with the fence.
+	std::unordered_map<u64, D3D12::DescriptorHandle> m_tfx_textures_group_cache;
+	std::unordered_map<u64, D3D12::DescriptorHandle> m_tfx_rt_textures_group_cache;
+	u64 m_tfx_group_cache_fence_value = 0;
+
 	D3D12::DescriptorHandle m_utility_texture_cpu;
 	D3D12::DescriptorHandle m_utility_texture_gpu;
 	D3D12::DescriptorHandle m_utility_sampler_cpu;
@@ -197,8 +197,11 @@ bool GSTexture12::Update(const GSVector4i& r, const void* data, int pitch, int l
 		D3D12::StreamBuffer& sbuffer = g_d3d12_context->GetTextureStreamBuffer();
 		if (!sbuffer.ReserveMemory(required_size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT))
 		{
-			GSDevice12::GetInstance()->ExecuteCommandList(
-				false, "While waiting for %u bytes in texture upload buffer", required_size);
+			if (!g_d3d12_context->GrowTextureStreamBuffer())
+			{
+				GSDevice12::GetInstance()->ExecuteCommandList(
+					false, "While waiting for %u bytes in texture upload buffer", required_size);
+			}
 			if (!sbuffer.ReserveMemory(required_size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT))
 			{
 				Console.Error("Failed to reserve texture upload memory (%u bytes).", required_size);
@@ -266,8 +269,11 @@ bool GSTexture12::Map(GSMap& m, const GSVector4i* r, int layer)
 
 	if (!buffer.ReserveMemory(required_size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT))
 	{
-		GSDevice12::GetInstance()->ExecuteCommandList(
-			false, "While waiting for %u bytes in texture upload buffer", required_size);
+		if (!g_d3d12_context->GrowTextureStreamBuffer())
+		{
+			GSDevice12::GetInstance()->ExecuteCommandList(
+				false, "While waiting for %u bytes in texture upload buffer", required_size);
+		}
 		if (!buffer.ReserveMemory(required_size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT))
 			pxFailRel("Failed to reserve texture upload memory");
 	}
@@ -366,6 +372,18 @@ void GSTexture12::TransitionToState(D3D12_RESOURCE_STATES state)
 	m_texture.TransitionToState(g_d3d12_context->GetCommandList(), state);
 }
 
+void GSTexture12::TransitionToStates(GSTexture12* tex0, D3D12_RESOURCE_STATES state0, GSTexture12* tex1, D3D12_RESOURCE_STATES state1)
+{
+	D3D12_RESOURCE_BARRIER barriers[2];
+	u32 num_barriers = 0;
+	if (tex0 && tex0->m_texture.GetTransitionBarrier(state0, &barriers[num_barriers]))
+		num_barriers++;
+	if (tex1 && tex1->m_texture.GetTransitionBarrier(state1, &barriers[num_barriers]))
+		num_barriers++;
+	if (num_barriers > 0)
+		g_d3d12_context->GetCommandList()->ResourceBarrier(num_barriers, barriers);
+}
+
 void GSTexture12::CommitClear()
 {
 	if (m_state != GSTexture::State::Cleared)
@@ -54,6 +54,9 @@ public:
 	void Swap(GSTexture* tex) override;
 
 	void TransitionToState(D3D12_RESOURCE_STATES state);
+
+	// Transitions two textures (either may be null) with a single ResourceBarrier() call.
+	static void TransitionToStates(GSTexture12* tex0, D3D12_RESOURCE_STATES state0, GSTexture12* tex1, D3D12_RESOURCE_STATES state1);
 	void CommitClear();
 	void CommitClear(ID3D12GraphicsCommandList* cmdlist);
 
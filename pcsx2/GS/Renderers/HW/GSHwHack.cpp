@@ -901,6 +901,10 @@ void GSState::SetupCrcHack()
 
 bool GSState::IsBadFrame()
 {
+	// Most games have no skip hack and no skipdraw range, don't bother building the frame info for them.
+	if (!m_gsc && m_skip == 0 && GSConfig.SkipDrawEnd == 0)
+		return false;
+
 	GSFrameInfo fi;
 
 	fi.FBP = m_context->FRAME.Block();
@@ -911,9 +915,11 @@ bool GSState::IsBadFrame()
 	fi.TPSM = m_context->TEX0.PSM;
 	fi.TZTST = m_context->TEST.ZTST;
 
-	if (m_gsc && !m_gsc(fi, m_skip))
+	if (m_gsc)
 	{
-		return false;
+		g_perfmon.Put(GSPerfMon::HackChecks, 1);
+		if (!m_gsc(fi, m_skip))
+			return false;
 	}
 
 	if (m_skip == 0 && GSConfig.SkipDrawEnd > 0)
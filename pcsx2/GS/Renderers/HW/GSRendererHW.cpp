@@ -20,6 +20,11 @@
 #include "GS/Renderers/SW/GSTextureCacheSW.h"
 #include "GS/Renderers/SW/GSDrawScanline.h"
 #include "Host.h"
+#include "PerformanceMetrics.h"
+#ifdef PCSX2_CORE
+#include "VMManager.h"
+#include "pcsx2/GS.h"
+#endif
 #include "common/Align.h"
 #include "common/StringUtil.h"
 
@@ -38,6 +43,9 @@ GSRendererHW::GSRendererHW()
 	m_mipmap = (GSConfig.HWMipmap >= HWMipmapLevel::Basic);
 	SetTCOffset();
 
+	// Skip the interval we were created in, it's full of shader compiles.
+	m_dynres_last_update = PerformanceMetrics::GetUpdateCount();
+
 	m_dump_root = root_hw;
 	GSTextureReplacements::Initialize(m_tc);
 
@@ -103,6 +111,73 @@ void GSRendererHW::SetTCOffset()
 	m_userhacks_tcoffset = m_userhacks_tcoffset_x < 0.0f || m_userhacks_tcoffset_y < 0.0f;
 }
 
+void GSRendererHW::UpdateDynamicResolution()
+{
+#ifdef PCSX2_CORE
+	// Fraction of the frame budget the GPU may use before we drop a step, and must be predicted to
+	// stay under before we go back up. Sample counts are in metrics updates (half a second each).
+	static constexpr float DOWN_THRESHOLD = 0.90f;
+	static constexpr float UP_THRESHOLD = 0.70f;
+	static constexpr int DOWN_SAMPLES = 2;
+	static constexpr int UP_SAMPLES = 6;
+
+	const u64 update = PerformanceMetrics::GetUpdateCount();
+	if (!GSConfig.DynamicResolution || m_dynres_requested || update == m_dynres_last_update)
+		return;
+
+	m_dynres_last_update = update;
+
+	const float vfreq = PerformanceMetrics::GetVerticalFrequency();
+	const float gpu_time = PerformanceMetrics::GetGPUAverageTime();
+	if (vfreq <= 0.0f || gpu_time <= 0.0f)
+		return;
+
+	// The configured multiplier is the ceiling, we only scale down from it and back up again.
+	const int current = static_cast<int>(GSConfig.UpscaleMultiplier);
+	const int ceiling = static_cast<int>(EmuConfig.GS.UpscaleMultiplier);
+	const float budget = 1000.0f / vfreq;
+
+	// Fill cost goes with the area, so predict the step up from the square of the ratio.
+	const float up_cost = static_cast<float>((current + 1) * (current + 1)) / static_cast<float>(current * current);
+
+	int delta = 0;
+	if (current > 1 && gpu_time > budget * DOWN_THRESHOLD)
+	{
+		m_dynres_under = 0;
+		if (++m_dynres_over >= DOWN_SAMPLES)
+			delta = -1;
+	}
+	else if (current < ceiling && gpu_time * up_cost < budget * UP_THRESHOLD)
+	{
+		m_dynres_over = 0;
+		if (++m_dynres_under >= UP_SAMPLES)
+			delta = 1;
+	}
+	else
+	{
+		m_dynres_over = 0;
+		m_dynres_under = 0;
+	}
+
+	if (delta == 0)
+		return;
+
+	// The multiplier is baked into shaders and every target, so a change needs a renderer reopen,
+	// which also drops the texture cache. That can't happen from inside our own vsync, so bounce it
+	// through the CPU thread back into the GS queue. Only GSConfig changes, the user's value stays.
+	const u32 new_multiplier = static_cast<u32>(current + delta);
+	DevCon.WriteLn("Dynamic resolution: %dx -> %ux (GPU %.2fms, budget %.2fms)", current, new_multiplier, gpu_time, budget);
+	m_dynres_requested = true;
+	Host::RunOnCPUThread([new_multiplier]() {
+		GetMTGS().RunOnGSThread([new_multiplier]() {
+			Pcsx2Config::GSOptions opts(GSConfig);
+			opts.UpscaleMultiplier = new_multiplier;
+			GSUpdateConfig(opts);
+		});
+	});
+#endif
+}
+
 GSRendererHW::~GSRendererHW()
 {
 	delete m_tc;
@@ -167,6 +242,8 @@ void GSRendererHW::SetGameCRC(u32 crc, int options)
 	m_hacks.SetGameCRC(m_game);
 
 	GSTextureReplacements::GameChanged();
+
+	g_gs_device->SetGameCRC(crc);
 }
 
 bool GSRendererHW::CanUpscale()
@@ -185,6 +262,9 @@ void GSRendererHW::Reset(bool hardware_reset)
 	// m_tc->RemoveAll();
 
 	m_reset = true;
+	m_frames_skipped = 0;
+	m_frame_draws_skipped = false;
+	m_display_buffers[0] = m_display_buffers[1] = UINT32_MAX;
 
 	GSRenderer::Reset(hardware_reset);
 }
@@ -196,7 +276,7 @@ void GSRendererHW::UpdateSettings(const Pcsx2Config::GSOptions& old_config)
 	SetTCOffset();
 }
 
-void GSRendererHW::VSync(u32 field, bool registers_written)
+void GSRendererHW::VSync(u32 field, bool registers_written, bool hidden)
 {
 	if (m_reset)
 	{
@@ -207,7 +287,10 @@ void GSRendererHW::VSync(u32 field, bool registers_written)
 	if (GSConfig.LoadTextureReplacements)
 		GSTextureReplacements::ProcessAsyncLoadedTextures();
 
-	GSRenderer::VSync(field, registers_written);
+	GSRenderer::VSync(field, registers_written, hidden);
+
+	UpdateDynamicResolution();
+	UpdateFrameSkip();
 
 	m_tc->IncAge();
 
@@ -227,6 +310,32 @@ void GSRendererHW::VSync(u32 field, bool registers_written)
 	m_skip_offset = 0;
 }
 
+void GSRendererHW::UpdateFrameSkip()
+{
+	for (int i = 0; i < 2; i++)
+	{
+		if (!IsEnabled(i))
+			continue;
+
+		const u32 bp = m_regs->DISP[i].DISPFB.Block();
+		if (bp != m_display_buffers[0] && bp != m_display_buffers[1])
+		{
+			m_display_buffers[1] = m_display_buffers[0];
+			m_display_buffers[0] = bp;
+		}
+	}
+
+	// Decides for the frame which starts now, the base class reads it back when that frame ends.
+	m_frame_draws_skipped = (GSConfig.FrameSkip > 0 && m_frames_skipped < GSConfig.FrameSkip);
+	m_frames_skipped = m_frame_draws_skipped ? (m_frames_skipped + 1) : 0;
+}
+
+bool GSRendererHW::IsDisplayBufferDraw() const
+{
+	const u32 bp = m_context->FRAME.Block();
+	return (bp == m_display_buffers[0] || bp == m_display_buffers[1]);
+}
+
 GSTexture* GSRendererHW::GetOutput(int i, int& y_offset)
 {
 	const GSRegDISPFB& DISPFB = m_regs->DISP[i].DISPFB;
@@ -779,6 +888,13 @@ void GSRendererHW::InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 	m_tc->InvalidateVideoMem(m_mem.GetOffset(BITBLTBUF.DBP, BITBLTBUF.DBW, BITBLTBUF.DPSM), r);
 }
 
+bool GSRendererHW::CanDeferInvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r)
+{
+	// Sources are only looked at when drawing, which flushes the pending invalidation first. Targets
+	// are also dirtied by readbacks and moves, and Inside() doesn't hold for unions, so keep those exact.
+	return !m_tc->InvalidatesTargets(m_mem.GetOffset(BITBLTBUF.DBP, BITBLTBUF.DBW, BITBLTBUF.DPSM), r);
+}
+
 void GSRendererHW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r, bool clut)
 {
 	// printf("[%d] InvalidateLocalMem %d,%d - %d,%d %05x (%d)\n", (int)m_perfmon.GetFrame(), r.left, r.top, r.right, r.bottom, (int)BITBLTBUF.SBP, (int)BITBLTBUF.SPSM);
@@ -1212,6 +1328,14 @@ void GSRendererHW::Draw()
 		GL_INS("Warning skipping a draw call (%d)", s_n);
 		return;
 	}
+
+	// Skipped frames only drop the draws to the display buffers, which the next drawn frame draws
+	// over anyway. Render to texture, and anything else later frames might read, still happens.
+	if (m_frame_draws_skipped && IsDisplayBufferDraw())
+	{
+		GL_INS("Frame skip: skipping draw %d to display buffer %x", s_n, m_context->FRAME.Block());
+		return;
+	}
 	GL_PUSH("HW Draw %d", s_n);
 
 	const GSDrawingEnvironment& env = m_env;
@@ -1681,10 +1805,14 @@ void GSRendererHW::Draw()
 		}
 	}
 
-	if (m_hacks.m_oi && !(this->*m_hacks.m_oi)(rt ? rt->m_texture : nullptr, ds ? ds->m_texture : nullptr, m_src))
+	if (m_hacks.m_oi)
 	{
-		GL_INS("Warning skipping a draw call (%d)", s_n);
-		return;
+		g_perfmon.Put(GSPerfMon::HackChecks, 1);
+		if (!(this->*m_hacks.m_oi)(rt ? rt->m_texture : nullptr, ds ? ds->m_texture : nullptr, m_src))
+		{
+			GL_INS("Warning skipping a draw call (%d)", s_n);
+			return;
+		}
 	}
 
 	if (!OI_BlitFMV(rt, m_src, m_r))
@@ -1800,6 +1928,7 @@ void GSRendererHW::Draw()
 
 	if (m_hacks.m_oo)
 	{
+		g_perfmon.Put(GSPerfMon::HackChecks, 1);
 		(this->*m_hacks.m_oo)();
 	}
 
@@ -3751,7 +3880,7 @@ bool GSRendererHW::SwPrimRender()
 	// Optimize the division by 1 with a nop. It also means that GS_SPRITE_CLASS must be processed when !m_vt.m_eq.q.
 	// If you have both GS_SPRITE_CLASS && m_vt.m_eq.q, it will depends on the first part of the 'OR'.
 	const u32 q_div = ((m_vt.m_eq.q && m_vt.m_min.t.z != 1.0f) || (!m_vt.m_eq.q && m_vt.m_primclass == GS_SPRITE_CLASS));
-	GSVertexSW::s_cvb[m_vt.m_primclass][PRIM->TME][PRIM->FST][q_div](m_context, data.vertex, m_vertex.buff, m_vertex.next);
+	GSVertexSW::s_cvb[m_vt.m_primclass][PRIM->TME][PRIM->FST][q_div][0](m_context, data.vertex, m_vertex.buff, m_vertex.next);
 
 	GSVector4i scissor = GSVector4i(m_context->scissor.in);
 	GSVector4i bbox = GSVector4i(m_vt.m_min.p.floor().xyxy(m_vt.m_max.p.ceil()));
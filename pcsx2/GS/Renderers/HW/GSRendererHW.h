@@ -145,6 +145,9 @@ private:
 	void EmulateATST(float& AREF, GSHWDrawConfig::PSSelector& ps, bool pass_2);
 
 	void SetTCOffset();
+	void UpdateDynamicResolution();
+	void UpdateFrameSkip();
+	bool IsDisplayBufferDraw() const;
 
 	GSTextureCache* m_tc;
 	GSVector4i m_r;
@@ -159,6 +162,18 @@ private:
 
 	GSVector2i m_lod; // Min & Max level of detail
 
+	// Dynamic resolution: metrics update the last decision was made on, and how many updates in
+	// a row were over/under budget. A change reopens the renderer, so this never outlives one step.
+	u64 m_dynres_last_update = 0;
+	int m_dynres_over = 0;
+	int m_dynres_under = 0;
+	bool m_dynres_requested = false;
+
+	// Frame skip: frames skipped in a row, and the last two buffers scanned out. With double buffering
+	// the back buffer being drawn to is the one which was shown before the current front buffer.
+	int m_frames_skipped = 0;
+	u32 m_display_buffers[2] = {UINT32_MAX, UINT32_MAX};
+
 	GSHWDrawConfig m_conf;
 
 	// software sprite renderer state
@@ -190,11 +205,12 @@ public:
 
 	void Reset(bool hardware_reset) override;
 	void UpdateSettings(const Pcsx2Config::GSOptions& old_config) override;
-	void VSync(u32 field, bool registers_written) override;
+	void VSync(u32 field, bool registers_written, bool hidden) override;
 
 	GSTexture* GetOutput(int i, int& y_offset) override;
 	GSTexture* GetFeedbackOutput() override;
 	void InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r) override;
+	bool CanDeferInvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r) override;
 	void InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r, bool clut = false) override;
 	void Move() override;
 	void Draw() override;
@@ -22,6 +22,7 @@
 #include "GS/GSUtil.h"
 #include "common/Align.h"
 #include "common/HashCombine.h"
+#include "common/StringUtil.h"
 
 //#define DISABLE_HW_TEXTURE_CACHE 1
 
@@ -30,6 +31,7 @@
 #include "xxhash.h"
 
 u8* GSTextureCache::m_temp;
+std::vector<std::unique_ptr<GSTextureCache::UnswizzleWorker>> GSTextureCache::m_unswizzle_workers;
 
 GSTextureCache::GSTextureCache()
 {
@@ -48,6 +50,7 @@ GSTextureCache::~GSTextureCache()
 	RemoveAll();
 
 	m_surface_offset_cache.clear();
+	m_unswizzle_workers.clear();
 
 	_aligned_free(m_temp);
 }
@@ -442,22 +445,30 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(const GIFRegTEX0& TEX0, con
 	auto& list = m_dst[type];
 	if (!is_frame)
 	{
-		for (auto i = list.begin(); i != list.end(); ++i)
+		if (m_dst_pages[type].HasStart(bp))
 		{
-			Target* t = *i;
-
-			if (bp == t->m_TEX0.TBP0)
+			for (auto i = list.begin(); i != list.end(); ++i)
 			{
-				list.MoveFront(i.Index());
+				Target* t = *i;
+				g_perfmon.Put(GSPerfMon::TargetLookups, 1);
 
-				dst = t;
+				if (bp == t->m_TEX0.TBP0)
+				{
+					list.MoveFront(i.Index());
 
-				dst->m_32_bits_fmt |= (psm_s.bpp != 16);
-				dst->m_TEX0 = TEX0;
+					dst = t;
 
-				break;
+					dst->m_32_bits_fmt |= (psm_s.bpp != 16);
+					dst->m_TEX0 = TEX0;
+
+					break;
+				}
 			}
 		}
+		else
+		{
+			g_perfmon.Put(GSPerfMon::TargetLookupsSkipped, 1);
+		}
 	}	
 	else
 	{
@@ -608,13 +619,17 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(const GIFRegTEX0& TEX0, con
 			// h is likely smaller than w (true most of the time). Reduce the upload size (speed)
 			max_h = std::min<int>(max_h, TEX0.TBW * 64);
 
-			dst->m_dirty.push_back(GSDirtyRect(GSVector4i(0, 0, TEX0.TBW * 64, is_frame ? real_h : max_h), TEX0.PSM, TEX0.TBW));
+			dst->m_dirty.Add(GSDirtyRect(GSVector4i(0, 0, TEX0.TBW * 64, is_frame ? real_h : max_h), TEX0.PSM, TEX0.TBW));
 			dst->Update();
 		}
 	}
 	if (used)
 	{
 		dst->m_used = true;
+
+		// About to be drawn to. Display lookups only read it, so readbacks stay valid for those.
+		if (!is_frame)
+			dst->m_readback_valid = false;
 	}
 	if (is_frame)
 		dst->m_dirty_alpha = false;
@@ -678,7 +693,7 @@ void GSTextureCache::ScaleTargetForDisplay(Target* t, const GIFRegTEX0& dispfb,
 	t->m_texture = new_texture;
 
 	// We unconditionally preload the frame here, because otherwise we'll end up with blackness for one frame (when the expand happens).
-	t->m_dirty.push_back(GSDirtyRect(GSVector4i(0, 0, t->m_TEX0.TBW * 64, needed_height), t->m_TEX0.PSM, t->m_TEX0.TBW));
+	t->m_dirty.Add(GSDirtyRect(GSVector4i(0, 0, t->m_TEX0.TBW * 64, needed_height), t->m_TEX0.PSM, t->m_TEX0.TBW));
 
 	// Inject the new height back into the cache.
 	GetTargetHeight(t->m_TEX0.TBP0, t->m_TEX0.TBW, t->m_TEX0.PSM, static_cast<u32>(needed_height));
@@ -692,10 +707,17 @@ void GSTextureCache::InvalidateVideoMemType(int type, u32 bp)
 	if (GSConfig.UserHacks_DisableDepthSupport)
 		return;
 
+	if (!m_dst_pages[type].HasStart(bp))
+	{
+		g_perfmon.Put(GSPerfMon::TargetLookupsSkipped, 1);
+		return;
+	}
+
 	auto& list = m_dst[type];
 	for (auto i = list.begin(); i != list.end(); ++i)
 	{
 		Target* t = *i;
+		g_perfmon.Put(GSPerfMon::TargetLookups, 1);
 
 		if (bp == t->m_TEX0.TBP0)
 		{
@@ -780,6 +802,7 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 						t->m_TEX0.TBP0);
 					g_gs_device->ClearRenderTarget(t->m_texture, 0);
 					t->m_dirty.clear();
+					t->m_readback_valid = false;
 				}
 			}
 		}
@@ -855,13 +878,26 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 	if (!target)
 		return;
 
+	u32 begin_page = 0, end_page = 0;
+	const bool use_page_map = GetInvalidationPages(off, rect, begin_page, end_page);
+
 	for (int type = 0; type < 2; type++)
 	{
+		if (use_page_map && !m_dst_pages[type].IsCovered(begin_page, end_page))
+		{
+			g_perfmon.Put(GSPerfMon::TargetLookupsSkipped, 1);
+			continue;
+		}
+
 		auto& list = m_dst[type];
 		for (auto i = list.begin(); i != list.end();)
 		{
 			auto j = i++;
 			Target* t = *j;
+			g_perfmon.Put(GSPerfMon::TargetLookups, 1);
+
+			if (use_page_map && (t->m_page_end < begin_page || t->m_page_begin > end_page))
+				continue;
 
 			// GH: (I think) this code is completely broken. Typical issue:
 			// EE write an alpha channel into 32 bits texture
@@ -878,7 +914,7 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 						t->m_texture ? t->m_texture->GetID() : 0,
 						t->m_TEX0.TBP0, r.x, r.y, r.z, r.w);
 					t->m_TEX0.TBW = bw;
-					t->m_dirty.push_back(GSDirtyRect(r, psm, bw));
+					t->m_dirty.Add(GSDirtyRect(r, psm, bw));
 				}
 				else
 				{
@@ -887,7 +923,7 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 					if (so.is_valid)
 					{
 						// Offset from Target to Write in Target coords.
-						t->m_dirty.push_back(GSDirtyRect(so.b2a_offset, psm, bw));
+						t->m_dirty.Add(GSDirtyRect(so.b2a_offset, psm, bw));
 						GL_CACHE("TC: Dirty in the middle [aggressive] of Target(%s) %d [PSM:%s BP:0x%x->0x%x BW:%u rect(%d,%d=>%d,%d)] write[PSM:%s BP:0x%x BW:%u rect(%d,%d=>%d,%d)]",
 							to_string(type),
 							t->m_texture ? t->m_texture->GetID() : 0,
@@ -954,7 +990,7 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 								t->m_TEX0.TBP0);
 							// TODO: do not add this rect above too
 							t->m_TEX0.TBW = bw;
-							t->m_dirty.push_back(GSDirtyRect(GSVector4i(r.left, r.top - y, r.right, r.bottom - y), psm, bw));
+							t->m_dirty.Add(GSDirtyRect(GSVector4i(r.left, r.top - y, r.right, r.bottom - y), psm, bw));
 							continue;
 						}
 					}
@@ -982,7 +1018,7 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 							r.left, r.top + y, r.right, r.bottom + y, bw);
 
 						t->m_TEX0.TBW = bw;
-						t->m_dirty.push_back(GSDirtyRect(GSVector4i(r.left, r.top + y, r.right, r.bottom + y), psm, bw));
+						t->m_dirty.Add(GSDirtyRect(GSVector4i(r.left, r.top + y, r.right, r.bottom + y), psm, bw));
 						continue;
 					}
 				}
@@ -992,6 +1028,34 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 	}
 }
 
+bool GSTextureCache::GetInvalidationPages(const GSOffset& off, const GSVector4i& rect, u32& begin_page, u32& end_page) const
+{
+	const u32 bp = off.bp();
+	const u32 bw = off.bw();
+	const u32 psm = off.psm();
+
+	// Only targets starting at bp or shortly after it (dirty after target), or containing bp (dirty in the
+	// middle), can be affected. Writes wrapping around the end of memory can affect any target.
+	const u32 write_end_block = GSLocalMemory::m_psm[psm].info.bn(rect.z - 1, rect.w - 1, bp, bw);
+	if (rect.rempty() || write_end_block < bp)
+		return false;
+
+	const GSVector4i r = rect.ralign<Align_Outside>((bp & 31) == 0 ? GSLocalMemory::m_psm[psm].pgs : GSLocalMemory::m_psm[psm].bs);
+	const u32 after_blocks = (bw > 0) ? (static_cast<u32>(r.bottom + 1) * bw * 32) / GSLocalMemory::m_psm[psm].pgs.y + 1 : 0;
+	begin_page = bp >> 5;
+	end_page = std::min(bp + after_blocks, MAX_BP) >> 5;
+	return true;
+}
+
+bool GSTextureCache::InvalidatesTargets(const GSOffset& off, const GSVector4i& rect) const
+{
+	u32 begin_page = 0, end_page = 0;
+	if (!GetInvalidationPages(off, rect, begin_page, end_page))
+		return true;
+
+	return m_dst_pages[RenderTarget].IsCovered(begin_page, end_page) || m_dst_pages[DepthStencil].IsCovered(begin_page, end_page);
+}
+
 // Goal: retrive the data from the GPU to the GS memory.
 // Called each time you want to read from the GS memory
 void GSTextureCache::InvalidateLocalMem(const GSOffset& off, const GSVector4i& r)
@@ -1220,6 +1284,9 @@ bool GSTextureCache::Move(u32 SBP, u32 SBW, u32 SPSM, int sx, int sy, u32 DBP, u
 		GSVector4i(scaled_sx, scaled_sy, scaled_sx + scaled_w, scaled_sy + scaled_h),
 		scaled_dx, scaled_dy);
 
+	// The destination changed without a draw, so any previous readback is stale.
+	dst->m_readback_valid = false;
+
 	// Invalidate any sources that overlap with the target (since they're now stale).
 	InvalidateVideoMem(g_gs_renderer->m_mem.GetOffset(DBP, DBW, DPSM), GSVector4i(dx, dy, dx + w, dy + h), false);
 	return true;
@@ -1227,7 +1294,11 @@ bool GSTextureCache::Move(u32 SBP, u32 SBW, u32 SPSM, int sx, int sy, u32 DBP, u
 
 GSTextureCache::Target* GSTextureCache::GetExactTarget(u32 BP, u32 BW, u32 PSM) const
 {
-	auto& rts = m_dst[GSLocalMemory::m_psm[PSM].depth ? DepthStencil : RenderTarget];
+	const int type = GSLocalMemory::m_psm[PSM].depth ? DepthStencil : RenderTarget;
+	if (!m_dst_pages[type].HasStart(BP))
+		return nullptr;
+
+	auto& rts = m_dst[type];
 	for (auto it = rts.begin(); it != rts.end(); ++it) // Iterate targets from MRU to LRU.
 	{
 		Target* t = *it;
@@ -1240,7 +1311,11 @@ GSTextureCache::Target* GSTextureCache::GetExactTarget(u32 BP, u32 BW, u32 PSM)
 
 GSTextureCache::Target* GSTextureCache::GetTargetWithSharedBits(u32 BP, u32 PSM) const
 {
-	auto& rts = m_dst[GSLocalMemory::m_psm[PSM].depth ? DepthStencil : RenderTarget];
+	const int type = GSLocalMemory::m_psm[PSM].depth ? DepthStencil : RenderTarget;
+	if (!m_dst_pages[type].HasStart(BP))
+		return nullptr;
+
+	auto& rts = m_dst[type];
 	for (auto it = rts.begin(); it != rts.end(); ++it) // Iterate targets from MRU to LRU.
 	{
 		Target* t = *it;
@@ -1312,6 +1387,95 @@ void GSTextureCache::InvalidateVideoMemSubTarget(GSTextureCache::Target* rt)
 	}
 }
 
+void GSTextureCache::EvictToBudget(u64 budget)
+{
+	// Replacement textures aren't counted, since they'd just be loaded straight back in.
+	u64 usage = m_hash_cache_memory_usage;
+	for (int type = 0; type < 2; type++)
+	{
+		for (const Target* t : m_dst[type])
+			usage += t->m_texture ? t->m_texture->GetMemUsage() : 0;
+	}
+
+	if (usage <= budget)
+		return;
+
+	struct Candidate
+	{
+		u32 age;
+		u32 size;
+		int type;
+		Target* target;
+		decltype(m_hash_cache)::iterator hc;
+	};
+	std::vector<Candidate> candidates;
+
+	for (auto it = m_hash_cache.begin(); it != m_hash_cache.end(); ++it)
+	{
+		const HashCacheEntry& e = it->second;
+		if (e.refcount == 0 && !e.is_replacement)
+			candidates.push_back({e.age, e.texture->GetMemUsage(), -1, nullptr, it});
+	}
+
+	// Targets drawn to or sampled from in the last frame stay, dropping those is a visible glitch.
+	for (int type = 0; type < 2; type++)
+	{
+		for (Target* t : m_dst[type])
+		{
+			if (t->m_age > 1 && t->m_texture)
+				candidates.push_back({static_cast<u32>(t->m_age), t->m_texture->GetMemUsage(), type, t, m_hash_cache.end()});
+		}
+	}
+
+	// Least recently used first, and the largest of those, so as few surfaces as possible get dropped.
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate& lhs, const Candidate& rhs) {
+		return (lhs.age != rhs.age) ? (lhs.age > rhs.age) : (lhs.size > rhs.size);
+	});
+
+	const u64 start_usage = usage;
+	u32 evicted = 0;
+	for (const Candidate& c : candidates)
+	{
+		if (usage <= budget)
+			break;
+
+		if (c.target)
+		{
+			auto& list = m_dst[c.type];
+			for (auto i = list.begin(); i != list.end(); ++i)
+			{
+				if (*i == c.target)
+				{
+					list.erase(i);
+					break;
+				}
+			}
+
+			GL_CACHE("TC: Remove Target(%s): %d (0x%x) due to budget", to_string(c.type),
+				c.target->m_texture->GetID(), c.target->m_TEX0.TBP0);
+			delete c.target;
+		}
+		else
+		{
+			m_hash_cache_memory_usage -= c.size;
+			g_gs_device->Recycle(c.hc->second.texture);
+			m_hash_cache.erase(c.hc);
+		}
+
+		usage -= c.size;
+		evicted++;
+	}
+
+	if (evicted == 0)
+		return;
+
+	// Otherwise the evicted textures would just be sitting in the pool instead.
+	g_gs_device->PurgePool();
+
+	DevCon.WriteLn("TC: Evicted %u surfaces to stay within budget, %" PRIu64 "MB -> %" PRIu64 "MB", evicted,
+		start_usage >> 20, usage >> 20);
+}
+
 void GSTextureCache::IncAge()
 {
 	const int max_age = m_src.m_used ? 3 : 6;
@@ -1411,6 +1575,9 @@ void GSTextureCache::IncAge()
 			++it;
 		}
 	}
+
+	if (GSConfig.TextureCacheBudget > 0)
+		EvictToBudget(static_cast<u64>(GSConfig.TextureCacheBudget) << 20);
 }
 
 //Fixme: Several issues in here. Not handling depth stencil, pitch conversion doesnt work.
@@ -1916,6 +2083,7 @@ GSTextureCache::Target* GSTextureCache::CreateTarget(const GIFRegTEX0& TEX0, int
 
 	t->m_texture->SetScale(static_cast<GSRendererHW*>(g_gs_renderer.get())->GetTextureScaleFactor());
 
+	m_dst_pages[type].Add(t);
 	m_dst[type].push_front(t);
 
 	return t;
@@ -1926,6 +2094,16 @@ void GSTextureCache::Read(Target* t, const GSVector4i& r)
 	if (!t->m_dirty.empty() || r.width() == 0 || r.height() == 0)
 		return;
 
+	// Games often read the same area back several times (e.g. one transfer per block), or read a
+	// frame again after drawing to other targets. Nothing has rendered to this target since the
+	// last download, so skip the GPU sync.
+	if (t->m_readback_valid && t->m_readback_rect.rintersect(r).eq(r))
+	{
+		GL_PERF("TC: Skipping redundant readback of target %d (0x%x)", t->m_texture->GetID(), t->m_TEX0.TBP0);
+		g_perfmon.Put(GSPerfMon::ReadbacksElided, 1);
+		return;
+	}
+
 	const GIFRegTEX0& TEX0 = t->m_TEX0;
 
 	GSTexture::Format fmt;
@@ -2002,6 +2180,9 @@ void GSTextureCache::Read(Target* t, const GSVector4i& r)
 		}
 
 		g_gs_device->DownloadTextureComplete();
+
+		t->m_readback_rect = r;
+		t->m_readback_valid = true;
 	}
 }
 
@@ -2045,8 +2226,16 @@ void GSTextureCache::PrintMemoryUsage()
 		if (t)
 			dss += t->m_texture->GetMemUsage();
 	}
+	u64 replacements = 0;
+	for (const auto& it : m_hash_cache)
+	{
+		if (it.second.is_replacement)
+			replacements += it.second.texture->GetMemUsage();
+	}
 
-	GL_PERF("MEM: RO Tex %dMB. RW Tex %dMB. Target %dMB. Depth %dMB", tex >> 20u, tex_rt >> 20u, rt >> 20u, dss >> 20u);
+	GL_PERF("MEM: RO Tex %dMB. RW Tex %dMB. Target %dMB. Depth %dMB. Hash Cache %dMB. Replacements %dMB",
+		tex >> 20u, tex_rt >> 20u, rt >> 20u, dss >> 20u,
+		static_cast<u32>(m_hash_cache_memory_usage >> 20), static_cast<u32>(replacements >> 20));
 #endif
 }
 
@@ -2255,6 +2444,9 @@ void GSTextureCache::Source::Update(const GSVector4i& rect, int level)
 					{
 						m_valid[row] |= col;
 
+						if (CheckBlockHash(block))
+							continue;
+
 						Write(GSVector4i(x, y, x + bs.x, y + bs.y), level);
 
 						blocks++;
@@ -2267,6 +2459,8 @@ void GSTextureCache::Source::Update(const GSVector4i& rect, int level)
 	if (blocks > 0)
 	{
 		g_perfmon.Put(GSPerfMon::Unswizzle, bs.x * bs.y * blocks << (m_palette ? 2 : 0));
+		if (level > 0)
+			g_perfmon.Put(GSPerfMon::TextureMipmaps, 1);
 		Flush(m_write.count, level);
 	}
 }
@@ -2279,12 +2473,19 @@ void GSTextureCache::Source::UpdateLayer(const GIFRegTEX0& TEX0, const GSVector4
 	if (m_target) // Yeah keep dreaming
 		return;
 
-	if (TEX0 == m_layer_TEX0[layer])
+	// Like the base level, only the blocks this draw samples are uploaded, so the layer fills in
+	// over several draws, and comes back after an invalidation clears m_complete_layers.
+	if (TEX0 != m_layer_TEX0[layer])
+	{
+		m_layer_TEX0[layer] = TEX0;
+		m_complete_layers &= ~(1u << layer);
+	}
+	else if (m_complete_layers & (1u << layer))
+	{
 		return;
+	}
 
 	GIFRegTEX0 old_TEX0 = m_TEX0;
-
-	m_layer_TEX0[layer] = TEX0;
 	m_TEX0 = TEX0;
 
 	Update(rect, layer);
@@ -2292,6 +2493,27 @@ void GSTextureCache::Source::UpdateLayer(const GIFRegTEX0& TEX0, const GSVector4
 	m_TEX0 = old_TEX0;
 }
 
+bool GSTextureCache::Source::CheckBlockHash(u32 block)
+{
+	// Invalidation works on whole pages, so games which rewrite the same data every frame
+	// (or only touch part of a page) would otherwise reupload every block of it.
+	if (!m_block_hashes)
+		m_block_hashes = std::make_unique<std::unique_ptr<BlockHashes>[]>(MAX_PAGES);
+
+	std::unique_ptr<BlockHashes>& bh = m_block_hashes[block >> 5];
+	if (!bh)
+		bh = std::make_unique<BlockHashes>();
+
+	const u32 bit = 1u << (block & 31u);
+	const HashType hash = XXH3_64bits(g_gs_renderer->m_mem.BlockPtr(block), BLOCK_SIZE);
+	if ((bh->hashed & bit) && bh->hash[block & 31u] == hash)
+		return true;
+
+	bh->hashed |= bit;
+	bh->hash[block & 31u] = hash;
+	return false;
+}
+
 void GSTextureCache::Source::Write(const GSVector4i& r, int layer)
 {
 	m_write.rect[m_write.count++] = r;
@@ -2371,7 +2593,7 @@ void GSTextureCache::Source::Flush(u32 count, int layer)
 
 			if (m_texture->Map(m, &r, layer))
 			{
-				(mem.*rtx)(off, r, m.bits, m.pitch, m_TEXA);
+				ReadTexture(mem, rtx, off, r, m.bits, m.pitch, m_TEXA);
 
 				m_texture->Unmap();
 			}
@@ -2410,6 +2632,8 @@ void GSTextureCache::Source::PreloadLevel(int level)
 	m_layer_hash[level] = hash;
 
 	// And upload the texture.
+	if (level > 0)
+		g_perfmon.Put(GSPerfMon::TextureMipmaps, 1);
 	PreloadTexture(m_TEX0, m_TEXA, g_gs_renderer->m_mem, m_palette != nullptr, m_texture, level);
 }
 
@@ -2430,6 +2654,18 @@ GSTextureCache::Target::Target(const GIFRegTEX0& TEX0, const bool depth_supporte
 	m_dirty_alpha = GSLocalMemory::m_psm[TEX0.PSM].trbpp != 24;
 
 	m_valid = GSVector4i::zero();
+	m_readback_rect = GSVector4i::zero();
+	m_readback_valid = false;
+
+	m_page_map = nullptr;
+	m_page_begin = 0;
+	m_page_end = 0;
+}
+
+GSTextureCache::Target::~Target()
+{
+	if (m_page_map)
+		m_page_map->Remove(this);
 }
 
 void GSTextureCache::Target::Update()
@@ -2543,6 +2779,9 @@ void GSTextureCache::Target::UpdateIfDirtyIntersects(const GSVector4i& rc)
 
 void GSTextureCache::Target::UpdateValidity(const GSVector4i& rect)
 {
+	// Called after every draw into the target and upload from local memory.
+	m_readback_valid = false;
+
 	if (m_valid.eq(GSVector4i::zero()))
 		m_valid = rect;
 	else
@@ -2554,9 +2793,60 @@ void GSTextureCache::Target::UpdateValidity(const GSVector4i& rect)
 	// that we clamp the draw rect to the target size in GSRendererHW::Draw().
 	m_end_block = GSLocalMemory::m_psm[m_TEX0.PSM].info.bn(m_valid.z - 1, m_valid.w - 1, m_TEX0.TBP0, m_TEX0.TBW); // Valid only for color formats
 
+	if (m_page_map)
+		m_page_map->Update(this);
+
 	// GL_CACHE("UpdateValidity (0x%x->0x%x) from R:%d,%d Valid: %d,%d", m_TEX0.TBP0, m_end_block, rect.z, rect.w, m_valid.z, m_valid.w);
 }
 
+// GSTextureCache::TargetPageMap
+
+void GSTextureCache::TargetPageMap::Add(Target* t)
+{
+	// Inside()/Overlaps() can't match a range which ends before it starts (not validated yet, or wrapping),
+	// so only the first page is covered then, which is all the BP comparisons need.
+	const u32 begin = t->m_TEX0.TBP0 >> 5;
+	const u32 end = std::max(t->m_end_block >> 5, begin);
+
+	t->m_page_map = this;
+	t->m_page_begin = static_cast<u16>(begin);
+	t->m_page_end = static_cast<u16>(end);
+
+	m_start[begin]++;
+	for (u32 page = begin; page <= end; page++)
+		m_covered[page]++;
+}
+
+void GSTextureCache::TargetPageMap::Remove(Target* t)
+{
+	m_start[t->m_page_begin]--;
+	for (u32 page = t->m_page_begin; page <= t->m_page_end; page++)
+		m_covered[page]--;
+
+	t->m_page_map = nullptr;
+}
+
+void GSTextureCache::TargetPageMap::Update(Target* t)
+{
+	const u32 end = std::max(t->m_end_block >> 5, static_cast<u32>(t->m_page_begin));
+	if (end == t->m_page_end)
+		return;
+
+	Remove(t);
+	Add(t);
+}
+
+bool GSTextureCache::TargetPageMap::IsCovered(u32 begin_page, u32 end_page) const
+{
+	for (u32 page = begin_page; page <= end_page; page++)
+	{
+		if (m_covered[page] != 0)
+			return true;
+	}
+
+	return false;
+}
+
 // GSTextureCache::SourceMap
 
 void GSTextureCache::SourceMap::Add(Source* s, const GIFRegTEX0& TEX0, const GSOffset& off)
@@ -2945,7 +3235,16 @@ std::shared_ptr<GSTextureCache::Palette> GSTextureCache::PaletteMap::LookupPalet
 	// Choose which hash map search into:
 	//    pal == 16  : index 0
 	//    pal == 256 : index 1
-	auto& map = m_maps[pal == 16 ? 0 : 1];
+	const u32 map_index = (pal == 16) ? 0 : 1;
+	auto& map = m_maps[map_index];
+
+	const u32 generation = g_gs_renderer->m_mem.m_clut.GetReadGeneration();
+	if (m_last_palette[map_index] && m_last_generation[map_index] == generation)
+	{
+		if (need_gs_texture && !m_last_palette[map_index]->GetPaletteGSTexture())
+			m_last_palette[map_index]->InitializeTexture();
+		return m_last_palette[map_index];
+	}
 
 	const u32* clut = (const u32*)g_gs_renderer->m_mem.m_clut;
 
@@ -2962,6 +3261,8 @@ std::shared_ptr<GSTextureCache::Palette> GSTextureCache::PaletteMap::LookupPalet
 			// Generate GSTexture and upload clut content if needed and not done yet
 			it1->second->InitializeTexture();
 		}
+		m_last_palette[map_index] = it1->second;
+		m_last_generation[map_index] = generation;
 		return it1->second;
 	}
 
@@ -3006,6 +3307,8 @@ std::shared_ptr<GSTextureCache::Palette> GSTextureCache::PaletteMap::LookupPalet
 	std::shared_ptr<Palette> palette = std::make_shared<Palette>(pal, need_gs_texture);
 
 	map.emplace(palette->GetPaletteKey(), palette);
+	m_last_palette[map_index] = palette;
+	m_last_generation[map_index] = generation;
 
 	GL_CACHE("TC, %u-bit PaletteMap (Size %u): Added new palette.", pal * sizeof(u32), map.size());
 
@@ -3019,6 +3322,9 @@ void GSTextureCache::PaletteMap::Clear()
 		map.clear(); // Clear all the nodes of the map, deleting Palette objects managed by shared pointers as they should be unused elsewhere
 		map.reserve(MAX_SIZE); // Ensure map capacity is not modified by the clearing
 	}
+
+	for (auto& palette : m_last_palette)
+		palette.reset();
 }
 
 std::size_t GSTextureCache::SurfaceOffsetKeyHash::operator()(const GSTextureCache::SurfaceOffsetKey& key) const
@@ -3062,11 +3368,6 @@ __fi static void BlockHashReset(BlockHashState& st)
 	XXH3_64bits_reset(&st);
 }
 
-__fi static void BlockHashAccumulate(BlockHashState& st, const u8* bp)
-{
-	XXH3_64bits_update(&st, bp, BLOCK_SIZE);
-}
-
 __fi static void BlockHashAccumulate(BlockHashState& st, const u8* bp, u32 size)
 {
 	XXH3_64bits_update(&st, bp, size);
@@ -3106,7 +3407,7 @@ static void HashTextureLevel(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, Blo
 		const GSLocalMemory::readTexture rtx = psm.rtxP;
 
 		// Use temp buffer for expanding, since we may not need to update.
-		(mem.*rtx)(off, block_rect, temp, pitch, TEXA);
+		GSTextureCache::ReadTexture(mem, rtx, off, block_rect, temp, pitch, TEXA);
 
 		// Hash the expanded texture.
 		u8* ptr = temp;
@@ -3127,15 +3428,34 @@ static void HashTextureLevel(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, Blo
 		GSOffset::BNHelper bn = off.bnMulti(block_rect.left, block_rect.top);
 		const int right = block_rect.right >> off.blockShiftX();
 		const int bottom = block_rect.bottom >> off.blockShiftY();
-		const int xAdd = (1 << off.blockShiftX()) * (psm.bpp / 8);
+
+		// Blocks which follow each other in memory are hashed with a single update. The result is the
+		// same as feeding them one at a time, but XXH3 can consume whole stripes directly from local
+		// memory instead of copying every block through its internal buffer first.
+		const u8* run_ptr = nullptr;
+		u32 run_size = 0;
 
 		for (; bn.blkY() < bottom; bn.nextBlockY())
 		{
-			for (int x = 0; bn.blkX() < right; bn.nextBlockX(), x += xAdd)
+			for (; bn.blkX() < right; bn.nextBlockX())
 			{
-				BlockHashAccumulate(hash_st, mem.BlockPtr(bn.value()));
+				const u8* bp = mem.BlockPtr(bn.value());
+				if (bp == run_ptr + run_size)
+				{
+					run_size += BLOCK_SIZE;
+					continue;
+				}
+
+				if (run_size > 0)
+					BlockHashAccumulate(hash_st, run_ptr, run_size);
+
+				run_ptr = bp;
+				run_size = BLOCK_SIZE;
 			}
 		}
+
+		if (run_size > 0)
+			BlockHashAccumulate(hash_st, run_ptr, run_size);
 	}
 }
 
@@ -3172,7 +3492,7 @@ void GSTextureCache::PreloadTexture(const GIFRegTEX0& TEX0, const GIFRegTEXA& TE
 	GSTexture::GSMap map;
 	if (rect.eq(block_rect) && tex->Map(map, &rect, level))
 	{
-		(mem.*rtx)(off, block_rect, map.bits, map.pitch, TEXA);
+		ReadTexture(mem, rtx, off, block_rect, map.bits, map.pitch, TEXA);
 		tex->Unmap();
 	}
 	else
@@ -3181,11 +3501,68 @@ void GSTextureCache::PreloadTexture(const GIFRegTEX0& TEX0, const GIFRegTEXA& TE
 		pitch = Common::AlignUpPow2(pitch, 32);
 
 		u8* buff = m_temp;
-		(mem.*rtx)(off, block_rect, buff, pitch, TEXA);
+		ReadTexture(mem, rtx, off, block_rect, buff, pitch, TEXA);
 		tex->Update(rect, buff, pitch, level);
 	}
 }
 
+// Texels before splitting an expansion is worth waking threads for, each band gets at least this many.
+static constexpr int UNSWIZZLE_SPLIT_TEXELS = 256 * 256;
+static constexpr int UNSWIZZLE_MAX_HELPERS = 3;
+
+void GSTextureCache::ReadTexture(GSLocalMemory& mem, GSLocalMemory::readTexture rtx, const GSOffset& off, const GSVector4i& r, u8* dst, int dstpitch, const GIFRegTEXA& TEXA)
+{
+	const int block_height = 1 << off.blockShiftY();
+	const int block_rows = r.height() >> off.blockShiftY();
+	int helpers = std::min(r.width() * r.height() / UNSWIZZLE_SPLIT_TEXELS - 1, std::min(block_rows - 1, UNSWIZZLE_MAX_HELPERS));
+
+	if (helpers > 0 && m_unswizzle_workers.empty())
+	{
+		// Leave room for the EE, VU and GS threads.
+		const int threads = std::min<int>(UNSWIZZLE_MAX_HELPERS, static_cast<int>(std::thread::hardware_concurrency()) / 4);
+		for (int i = 0; i < std::max(threads, 0); i++)
+		{
+			m_unswizzle_workers.push_back(std::make_unique<UnswizzleWorker>(
+				[i]() { Threading::SetNameOfCurrentThread(StringUtil::StdStringFromFormat("GS-Unswizzle-%d", i).c_str()); },
+				[](std::function<void()>& func) { func(); },
+				std::function<void()>()));
+		}
+
+		// Don't come back here when the machine doesn't have any to spare.
+		if (m_unswizzle_workers.empty())
+			m_unswizzle_workers.push_back(nullptr);
+	}
+
+	if (helpers > 0 && m_unswizzle_workers[0])
+		helpers = std::min(helpers, static_cast<int>(m_unswizzle_workers.size()));
+	else
+		helpers = 0;
+
+	if (helpers == 0)
+	{
+		(mem.*rtx)(off, r, dst, dstpitch, TEXA);
+		return;
+	}
+
+	// Split into bands of whole block rows, the calling thread takes the first one.
+	const int band_height = (block_rows / (helpers + 1)) * block_height;
+	for (int i = 0; i < helpers; i++)
+	{
+		const int top = r.top + band_height * (i + 1);
+		const int bottom = (i == helpers - 1) ? r.bottom : (top + band_height);
+		const GSVector4i band(r.left, top, r.right, bottom);
+		u8* band_dst = dst + static_cast<size_t>(top - r.top) * dstpitch;
+		m_unswizzle_workers[i]->Push([&mem, rtx, &off, band, band_dst, dstpitch, &TEXA]() {
+			(mem.*rtx)(off, band, band_dst, dstpitch, TEXA);
+		});
+	}
+
+	(mem.*rtx)(off, GSVector4i(r.left, r.top, r.right, r.top + band_height), dst, dstpitch, TEXA);
+
+	for (int i = 0; i < helpers; i++)
+		m_unswizzle_workers[i]->Wait();
+}
+
 GSTextureCache::HashCacheKey::HashCacheKey()
 	: TEX0Hash(0)
 	, CLUTHash(0)
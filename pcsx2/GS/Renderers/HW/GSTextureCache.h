@@ -20,6 +20,7 @@
 #include "GS/Renderers/Common/GSRenderer.h"
 #include "GS/Renderers/Common/GSFastList.h"
 #include "GS/Renderers/Common/GSDirtyRect.h"
+#include "GS/GSThread_CXX11.h"
 #include <unordered_set>
 
 class GSTextureCache
@@ -149,8 +150,18 @@ public:
 			u32 count;
 		} m_write;
 
+		// Hash of each GS memory block as it was last uploaded, allocated per page. Lets blocks
+		// which were invalidated by a write of identical data skip the reupload.
+		struct BlockHashes
+		{
+			u32 hashed; // one bit per block of the page
+			HashType hash[32];
+		};
+		std::unique_ptr<std::unique_ptr<BlockHashes>[]> m_block_hashes;
+
 		void PreloadLevel(int level);
 
+		bool CheckBlockHash(u32 block);
 		void Write(const GSVector4i& r, int layer);
 		void Flush(u32 count, int layer);
 
@@ -187,6 +198,8 @@ public:
 		bool ClutMatch(const PaletteKey& palette_key);
 	};
 
+	class TargetPageMap;
+
 	class Target : public Surface
 	{
 	public:
@@ -197,8 +210,19 @@ public:
 		const bool m_depth_supported;
 		bool m_dirty_alpha;
 
+		/// Area downloaded by the last readback. Until the target is next drawn to, moved into or
+		/// updated (m_readback_valid cleared), local memory already holds this data.
+		GSVector4i m_readback_rect;
+		bool m_readback_valid;
+
+		/// Page map the target is registered in, and the pages it was registered with.
+		TargetPageMap* m_page_map;
+		u16 m_page_begin;
+		u16 m_page_end;
+
 	public:
 		Target(const GIFRegTEX0& TEX0, const bool depth_supported, const int type);
+		virtual ~Target();
 
 		void UpdateValidity(const GSVector4i& rect);
 
@@ -218,6 +242,11 @@ public:
 		// There is one PaletteKey per Palette, and the hashing and comparison of PaletteKey is done with custom operators PaletteKeyHash and PaletteKeyEqual.
 		std::array<std::unordered_map<PaletteKey, std::shared_ptr<Palette>, PaletteKeyHash, PaletteKeyEqual>, 2> m_maps;
 
+		// Last palette returned from each map, and the CLUT read generation it was looked up with.
+		// While the CLUT hasn't been re-expanded, the same palette can be returned without hashing it again.
+		std::array<std::shared_ptr<Palette>, 2> m_last_palette;
+		std::array<u32, 2> m_last_generation = {};
+
 	public:
 		PaletteMap();
 
@@ -246,6 +275,22 @@ public:
 		void RemoveAt(Source* s);
 	};
 
+	/// Counts the targets of one type covering each page, so that lookups and invalidations
+	/// can skip walking the whole target list when nothing can match.
+	class TargetPageMap
+	{
+	public:
+		std::array<u32, MAX_PAGES> m_start = {}; // targets with TBP0 in the page
+		std::array<u32, MAX_PAGES> m_covered = {}; // targets whose TBP0..m_end_block range covers the page
+
+		void Add(Target* t);
+		void Remove(Target* t);
+		void Update(Target* t);
+
+		__fi bool HasStart(u32 bp) const { return m_start[(bp >> 5) % MAX_PAGES] != 0; }
+		bool IsCovered(u32 begin_page, u32 end_page) const;
+	};
+
 	struct TargetHeightElem
 	{
 		union
@@ -300,8 +345,13 @@ protected:
 	std::unordered_map<HashCacheKey, HashCacheEntry, HashCacheKeyHash> m_hash_cache;
 	u64 m_hash_cache_memory_usage = 0;
 	FastList<Target*> m_dst[2];
+	TargetPageMap m_dst_pages[2];
 	FastList<TargetHeightElem> m_target_heights;
 	static u8* m_temp;
+
+	// Helpers for expanding large textures, created the first time one shows up.
+	using UnswizzleWorker = GSJobQueue<std::function<void()>, 4>;
+	static std::vector<std::unique_ptr<UnswizzleWorker>> m_unswizzle_workers;
 	constexpr static size_t S_SURFACE_OFFSET_CACHE_MAX_SIZE = std::numeric_limits<u16>::max();
 	std::unordered_map<SurfaceOffsetKey, SurfaceOffset, SurfaceOffsetKeyHash, SurfaceOffsetKeyEqual> m_surface_offset_cache;
 	Source* m_temporary_source = nullptr; // invalidated after the draw
@@ -315,6 +365,12 @@ protected:
 
 	HashCacheEntry* LookupHashCache(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, bool& paltex, const u32* clut, const GSVector2i* lod);
 
+	/// Works out the pages of targets which a write to rect could affect. Returns false if it could affect any target.
+	bool GetInvalidationPages(const GSOffset& off, const GSVector4i& rect, u32& begin_page, u32& end_page) const;
+
+	/// Drops unused hash cache textures and targets, oldest first, until the total is within budget.
+	void EvictToBudget(u64 budget);
+
 	static void PreloadTexture(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, GSLocalMemory& mem, bool paltex, GSTexture* tex, u32 level);
 	static HashType HashTexture(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
 
@@ -327,6 +383,9 @@ public:
 
 	__fi u64 GetHashCacheMemoryUsage() const { return m_hash_cache_memory_usage; }
 
+	/// Expands a block aligned rect of local memory, splitting large ones into bands across helper threads.
+	static void ReadTexture(GSLocalMemory& mem, GSLocalMemory::readTexture rtx, const GSOffset& off, const GSVector4i& r, u8* dst, int dstpitch, const GIFRegTEXA& TEXA);
+
 	void Read(Target* t, const GSVector4i& r);
 	void Read(Source* t, const GSVector4i& r);
 	void RemoveAll();
@@ -347,6 +406,8 @@ public:
 	void InvalidateVideoMemType(int type, u32 bp);
 	void InvalidateVideoMemSubTarget(GSTextureCache::Target* rt);
 	void InvalidateVideoMem(const GSOffset& off, const GSVector4i& r, bool target = true);
+	/// Returns false if invalidating the area can only affect sources, not any target.
+	bool InvalidatesTargets(const GSOffset& off, const GSVector4i& rect) const;
 	void InvalidateLocalMem(const GSOffset& off, const GSVector4i& r);
 	bool Move(u32 SBP, u32 SBW, u32 SPSM, int sx, int sy, u32 DBP, u32 DBW, u32 DPSM, int dx, int dy, int w, int h);
 
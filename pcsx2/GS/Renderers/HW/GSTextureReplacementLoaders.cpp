@@ -25,6 +25,7 @@
 
 #include <csetjmp>
 #include <png.h>
+#include <zlib.h>
 
 struct LoaderDefinition
 {
@@ -34,10 +35,12 @@ struct LoaderDefinition
 
 static bool PNGLoader(const std::string& filename, GSTextureReplacements::ReplacementTexture* tex, bool only_base_image);
 static bool DDSLoader(const std::string& filename, GSTextureReplacements::ReplacementTexture* tex, bool only_base_image);
+static bool KTX2Loader(const std::string& filename, GSTextureReplacements::ReplacementTexture* tex, bool only_base_image);
 
 static constexpr LoaderDefinition s_loaders[] = {
 	{"png", PNGLoader},
 	{"dds", DDSLoader},
+	{"ktx2", KTX2Loader},
 };
 
 
@@ -68,7 +71,7 @@ static u32 GetBlockCount(u32 extent, u32 block_size)
 static void CalcBlockMipmapSize(u32 block_size, u32 bytes_per_block, u32 base_width, u32 base_height, u32 mip, u32& width, u32& height, u32& pitch, u32& size)
 {
 	width = std::max<u32>(base_width >> mip, 1u);
-	height = std::max<u32>(base_width >> mip, 1u);
+	height = std::max<u32>(base_height >> mip, 1u);
 
 	const u32 blocks_wide = GetBlockCount(width, block_size);
 	const u32 blocks_high = GetBlockCount(height, block_size);
@@ -261,6 +264,8 @@ bool GSTextureReplacements::SavePNGImage(const std::string& filename, u32 width,
 
 	png_init_io(png_ptr, fp.get());
 	png_set_compression_level(png_ptr, compression);
+	if (compression == Z_BEST_SPEED)
+		png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_NONE);
 	png_set_IHDR(png_ptr, info_ptr, width, height, 8, PNG_COLOR_TYPE_RGBA,
 		PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
 	png_write_info(png_ptr, info_ptr);
@@ -478,7 +483,7 @@ static bool ParseDDSHeader(std::FILE* fp, DDSLoadInfo* info)
 		}
 
 		const GSDevice::FeatureSupport features(g_gs_device->Features());
-		if (header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '1') || dxt10_format == 71)
+		if (header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '1') || dxt10_format == 71 || dxt10_format == 72)
 		{
 			info->format = GSTexture::Format::BC1;
 			info->block_size = 4;
@@ -486,7 +491,7 @@ static bool ParseDDSHeader(std::FILE* fp, DDSLoadInfo* info)
 			if (!features.dxt_textures)
 				return false;
 		}
-		else if (header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '2') || header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '3') || dxt10_format == 74)
+		else if (header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '2') || header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '3') || dxt10_format == 74 || dxt10_format == 75)
 		{
 			info->format = GSTexture::Format::BC2;
 			info->block_size = 4;
@@ -494,7 +499,7 @@ static bool ParseDDSHeader(std::FILE* fp, DDSLoadInfo* info)
 			if (!features.dxt_textures)
 				return false;
 		}
-		else if (header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '4') || header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '5') || dxt10_format == 77)
+		else if (header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '4') || header.ddspf.dwFourCC == MAKEFOURCC('D', 'X', 'T', '5') || dxt10_format == 77 || dxt10_format == 78)
 		{
 			info->format = GSTexture::Format::BC3;
 			info->block_size = 4;
@@ -502,7 +507,7 @@ static bool ParseDDSHeader(std::FILE* fp, DDSLoadInfo* info)
 			if (!features.dxt_textures)
 				return false;
 		}
-		else if (dxt10_format == 98)
+		else if (dxt10_format == 98 || dxt10_format == 99)
 		{
 			info->format = GSTexture::Format::BC7;
 			info->block_size = 4;
@@ -632,7 +637,7 @@ bool DDSLoader(const std::string& filename, GSTextureReplacements::ReplacementTe
 	// Read in any remaining mip levels in the file.
 	if (!only_base_image)
 	{
-		for (u32 level = 1; level <= info.mip_count; level++)
+		for (u32 level = 1; level < info.mip_count; level++)
 		{
 			GSTextureReplacements::ReplacementTexture::MipData md;
 			u32 mip_width, mip_height, mip_size;
@@ -646,3 +651,177 @@ bool DDSLoader(const std::string& filename, GSTextureReplacements::ReplacementTe
 
 	return true;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// KTX2 Handler
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// See https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+// Only files without supercompression are handled, since the GPU consumes the BCn blocks directly.
+
+static constexpr u8 KTX2_IDENTIFIER[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+// VkFormat values we can map to GSTexture formats.
+enum : u32
+{
+	KTX2_VK_FORMAT_R8G8B8A8_UNORM = 37,
+	KTX2_VK_FORMAT_R8G8B8A8_SRGB = 43,
+	KTX2_VK_FORMAT_BC1_RGB_UNORM_BLOCK = 131,
+	KTX2_VK_FORMAT_BC1_RGBA_SRGB_BLOCK = 134,
+	KTX2_VK_FORMAT_BC2_UNORM_BLOCK = 135,
+	KTX2_VK_FORMAT_BC2_SRGB_BLOCK = 136,
+	KTX2_VK_FORMAT_BC3_UNORM_BLOCK = 137,
+	KTX2_VK_FORMAT_BC3_SRGB_BLOCK = 138,
+	KTX2_VK_FORMAT_BC7_UNORM_BLOCK = 145,
+	KTX2_VK_FORMAT_BC7_SRGB_BLOCK = 146,
+};
+
+#pragma pack(push, 1)
+struct KTX2_HEADER
+{
+	u8 identifier[12];
+	u32 vkFormat;
+	u32 typeSize;
+	u32 pixelWidth;
+	u32 pixelHeight;
+	u32 pixelDepth;
+	u32 layerCount;
+	u32 faceCount;
+	u32 levelCount;
+	u32 supercompressionScheme;
+	u32 dfdByteOffset;
+	u32 dfdByteLength;
+	u32 kvdByteOffset;
+	u32 kvdByteLength;
+	u64 sgdByteOffset;
+	u64 sgdByteLength;
+};
+
+struct KTX2_LEVEL_INDEX
+{
+	u64 byteOffset;
+	u64 byteLength;
+	u64 uncompressedByteLength;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(KTX2_HEADER) == 80, "KTX2 header size mismatch");
+static_assert(sizeof(KTX2_LEVEL_INDEX) == 24, "KTX2 level index size mismatch");
+
+static bool ReadKTX2Level(std::FILE* fp, const KTX2_LEVEL_INDEX& level, u32 size, std::vector<u8>& data)
+{
+	// levels can't be shorter than what the format needs, but may be padded
+	if (level.byteLength < size || FileSystem::FSeek64(fp, static_cast<s64>(level.byteOffset), SEEK_SET) != 0)
+		return false;
+
+	data.resize(size);
+	return (std::fread(data.data(), size, 1, fp) == 1);
+}
+
+bool KTX2Loader(const std::string& filename, GSTextureReplacements::ReplacementTexture* tex, bool only_base_image)
+{
+	auto fp = FileSystem::OpenManagedCFile(filename.c_str(), "rb");
+	if (!fp)
+		return false;
+
+	KTX2_HEADER header;
+	if (std::fread(&header, sizeof(header), 1, fp.get()) != 1 ||
+		std::memcmp(header.identifier, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) != 0)
+	{
+		return false;
+	}
+
+	// 2D, non-array, non-cubemap only.
+	if (header.pixelWidth == 0 || header.pixelWidth >= DDS_MAX_TEXTURE_SIZE ||
+		header.pixelHeight == 0 || header.pixelHeight >= DDS_MAX_TEXTURE_SIZE ||
+		header.pixelDepth > 1 || header.layerCount > 1 || header.faceCount != 1)
+	{
+		return false;
+	}
+
+	if (header.supercompressionScheme != 0)
+	{
+		Console.Error("KTX2 texture '%s' uses supercompression, which is not supported.", filename.c_str());
+		return false;
+	}
+
+	const GSDevice::FeatureSupport features(g_gs_device->Features());
+	u32 block_size = 4;
+	u32 bytes_per_block = 16;
+	if (header.vkFormat == KTX2_VK_FORMAT_R8G8B8A8_UNORM || header.vkFormat == KTX2_VK_FORMAT_R8G8B8A8_SRGB)
+	{
+		tex->format = GSTexture::Format::Color;
+		block_size = 1;
+		bytes_per_block = 4;
+	}
+	else if (header.vkFormat >= KTX2_VK_FORMAT_BC1_RGB_UNORM_BLOCK && header.vkFormat <= KTX2_VK_FORMAT_BC1_RGBA_SRGB_BLOCK)
+	{
+		tex->format = GSTexture::Format::BC1;
+		bytes_per_block = 8;
+		if (!features.dxt_textures)
+			return false;
+	}
+	else if (header.vkFormat == KTX2_VK_FORMAT_BC2_UNORM_BLOCK || header.vkFormat == KTX2_VK_FORMAT_BC2_SRGB_BLOCK)
+	{
+		tex->format = GSTexture::Format::BC2;
+		if (!features.dxt_textures)
+			return false;
+	}
+	else if (header.vkFormat == KTX2_VK_FORMAT_BC3_UNORM_BLOCK || header.vkFormat == KTX2_VK_FORMAT_BC3_SRGB_BLOCK)
+	{
+		tex->format = GSTexture::Format::BC3;
+		if (!features.dxt_textures)
+			return false;
+	}
+	else if (header.vkFormat == KTX2_VK_FORMAT_BC7_UNORM_BLOCK || header.vkFormat == KTX2_VK_FORMAT_BC7_SRGB_BLOCK)
+	{
+		tex->format = GSTexture::Format::BC7;
+		if (!features.bptc_textures)
+			return false;
+	}
+	else
+	{
+		Console.Error("KTX2 texture '%s' has unsupported format %u.", filename.c_str(), header.vkFormat);
+		return false;
+	}
+
+	if (block_size > 1 && ((header.pixelWidth % block_size) != 0 || (header.pixelHeight % block_size) != 0))
+	{
+		Console.Error(
+			"Invalid dimensions for KTX2 texture %s. For compressed textures of this format, "
+			"the width/height of the first mip level must be a multiple of %u.",
+			filename.c_str(), block_size);
+		return false;
+	}
+
+	// level count of zero means the application should generate mips, which we do anyway
+	const u32 level_count = std::max(header.levelCount, 1u);
+	if (level_count > GSTextureReplacements::CalcMipmapLevelsForReplacement(header.pixelWidth, header.pixelHeight))
+		return false;
+
+	std::vector<KTX2_LEVEL_INDEX> levels(level_count);
+	if (std::fread(levels.data(), sizeof(KTX2_LEVEL_INDEX), level_count, fp.get()) != level_count)
+		return false;
+
+	u32 mip_width, mip_height, mip_size;
+	tex->width = header.pixelWidth;
+	tex->height = header.pixelHeight;
+	CalcBlockMipmapSize(block_size, bytes_per_block, tex->width, tex->height, 0, mip_width, mip_height, tex->pitch, mip_size);
+	if (!ReadKTX2Level(fp.get(), levels[0], mip_size, tex->data))
+		return false;
+
+	if (!only_base_image)
+	{
+		for (u32 level = 1; level < level_count; level++)
+		{
+			GSTextureReplacements::ReplacementTexture::MipData md;
+			CalcBlockMipmapSize(block_size, bytes_per_block, tex->width, tex->height, level, mip_width, mip_height, md.pitch, mip_size);
+			if (!ReadKTX2Level(fp.get(), levels[level], mip_size, md.data))
+				break;
+
+			tex->mips.push_back(std::move(md));
+		}
+	}
+
+	return true;
+}
@@ -47,6 +47,7 @@
 #define TEXTURE_FILENAME_CLUT_FORMAT_STRING "%" PRIx64 "-%" PRIx64 "-%08x"
 #define TEXTURE_REPLACEMENT_SUBDIRECTORY_NAME "replacements"
 #define TEXTURE_DUMP_SUBDIRECTORY_NAME "dumps"
+#define TEXTURE_PRELOAD_MANIFEST_NAME "seen_replacements.txt"
 
 namespace
 {
@@ -118,10 +119,18 @@ namespace GSTextureReplacements
 	static void QueueAsyncReplacementTextureLoad(const TextureName& name, const std::string& filename, bool mipmap);
 	static void PrecacheReplacementTextures();
 	static void ClearReplacementTextures();
+	static u64 GetReplacementTextureMemoryUsage(const ReplacementTexture& rtex);
+	static const ReplacementTexture& InsertIntoReplacementCache(const TextureName& name, ReplacementTexture rtex);
+	static void TouchReplacementCacheEntry(const TextureName& name);
+	static void EvictReplacementCacheToBudget(const TextureName& keep);
+	static void ClearReplacementCache();
+	static void LoadPreloadManifest();
+	static void SavePreloadManifest();
 
 	static void StartWorkerThread();
 	static void StopWorkerThread();
 	static void QueueWorkerThreadItem(std::function<void()> fn);
+	static void WaitForPendingDumps();
 	static void WorkerThreadEntryPoint();
 	static void SyncWorkerThread();
 	static void CancelPendingLoadsAndDumps();
@@ -144,6 +153,15 @@ namespace GSTextureReplacements
 	static std::unordered_map<TextureName, ReplacementTexture> s_replacement_texture_cache;
 	static std::mutex s_replacement_texture_cache_mutex;
 
+	/// Decoded size of the cache, and when each entry was last used, for evicting down to the budget.
+	static u64 s_replacement_texture_cache_size = 0;
+	static u64 s_replacement_texture_use_counter = 0;
+	static std::unordered_map<TextureName, u64> s_replacement_texture_last_used;
+
+	/// Replacements which have been used for this game, loaded ahead of time on the next boot.
+	static std::unordered_set<TextureName> s_seen_replacement_textures;
+	static bool s_seen_replacement_textures_dirty = false;
+
 	/// List of textures that are pending asynchronous load.
 	static std::unordered_set<TextureName> s_pending_async_load_textures;
 
@@ -151,12 +169,19 @@ namespace GSTextureReplacements
 	/// Second element is whether the texture should be created with mipmaps.
 	static std::vector<std::pair<TextureName, bool>> s_async_loaded_textures;
 
-	/// Loader/dumper thread.
-	static std::thread s_worker_thread;
+	/// Loader/dumper threads.
+	static std::vector<std::thread> s_worker_threads;
 	static std::mutex s_worker_thread_mutex;
 	static std::condition_variable s_worker_thread_cv;
+	static std::condition_variable s_worker_thread_done_cv;
 	static std::queue<std::function<void()>> s_worker_thread_queue;
+	static u32 s_worker_threads_busy = 0;
 	static bool s_worker_thread_running = false;
+
+	/// Number of texture dumps which have been queued but not written yet. Once this reaches
+	/// MAX_PENDING_DUMPS, the GS thread waits for the workers to catch up instead of piling up memory.
+	static u32 s_pending_dumps = 0;
+	static constexpr u32 MAX_PENDING_DUMPS = 64;
 }; // namespace GSTextureReplacements
 
 TextureName GSTextureReplacements::CreateTextureName(const GSTextureCache::HashCacheKey& hash, u32 miplevel)
@@ -282,6 +307,7 @@ void GSTextureReplacements::GameChanged()
 	if (s_current_serial == new_serial)
 		return;
 
+	SavePreloadManifest();
 	s_current_serial = std::move(new_serial);
 	ReloadReplacementMap();
 	ClearDumpedTextureList();
@@ -290,14 +316,17 @@ void GSTextureReplacements::GameChanged()
 void GSTextureReplacements::ReloadReplacementMap()
 {
 	SyncWorkerThread();
+	SavePreloadManifest();
 
 	// clear out the caches
 	{
 		s_replacement_texture_filenames.clear();
 		s_replacement_textures_without_clut_hash.clear();
+		s_seen_replacement_textures.clear();
+		s_seen_replacement_textures_dirty = false;
 
 		std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
-		s_replacement_texture_cache.clear();
+		ClearReplacementCache();
 		s_pending_async_load_textures.clear();
 		s_async_loaded_textures.clear();
 	}
@@ -337,6 +366,8 @@ void GSTextureReplacements::ReloadReplacementMap()
 	{
 		if (GSConfig.PrecacheTextureReplacements)
 			PrecacheReplacementTextures();
+		else
+			LoadPreloadManifest();
 
 		// log a warning when paltex is on and preloading is off, since we'll be disabling paltex
 		if (GSConfig.GPUPaletteConversion && GSConfig.TexturePreloading != TexturePreloadingLevel::Full)
@@ -376,6 +407,7 @@ void GSTextureReplacements::UpdateConfig(Pcsx2Config::GSOptions& old_config)
 void GSTextureReplacements::Shutdown()
 {
 	StopWorkerThread();
+	SavePreloadManifest();
 
 	std::string().swap(s_current_serial);
 	ClearReplacementTextures();
@@ -409,6 +441,10 @@ GSTexture* GSTextureReplacements::LookupReplacementTexture(const GSTextureCache:
 	if (fnit == s_replacement_texture_filenames.end())
 		return nullptr;
 
+	// remember it for preloading next time
+	if (s_seen_replacement_textures.insert(name).second)
+		s_seen_replacement_textures_dirty = true;
+
 	// try the full cache first, to avoid reloading from disk
 	{
 		std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
@@ -416,6 +452,7 @@ GSTexture* GSTextureReplacements::LookupReplacementTexture(const GSTextureCache:
 		if (it != s_replacement_texture_cache.end())
 		{
 			// replacement is cached, can immediately upload to host GPU
+			TouchReplacementCacheEntry(name);
 			return CreateReplacementTexture(it->second, name.ReplacementScale(it->second), mipmap);
 		}
 	}
@@ -439,7 +476,7 @@ GSTexture* GSTextureReplacements::LookupReplacementTexture(const GSTextureCache:
 
 		// insert into cache
 		std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
-		const ReplacementTexture& rtex = s_replacement_texture_cache.emplace(name, std::move(replacement.value())).first->second;
+		const ReplacementTexture& rtex = InsertIntoReplacementCache(name, std::move(replacement.value()));
 
 		// and upload to gpu
 		return CreateReplacementTexture(rtex, name.ReplacementScale(rtex), mipmap);
@@ -478,7 +515,7 @@ void GSTextureReplacements::QueueAsyncReplacementTextureLoad(const TextureName&
 		// insert into the cache and queue for later injection
 		if (replacement.has_value())
 		{
-			s_replacement_texture_cache.emplace(name, std::move(replacement.value()));
+			InsertIntoReplacementCache(name, std::move(replacement.value()));
 			s_async_loaded_textures.emplace_back(name, mipmap);
 		}
 		else
@@ -511,15 +548,140 @@ void GSTextureReplacements::PrecacheReplacementTextures()
 
 void GSTextureReplacements::ClearReplacementTextures()
 {
+	SavePreloadManifest();
+
 	s_replacement_texture_filenames.clear();
 	s_replacement_textures_without_clut_hash.clear();
+	s_seen_replacement_textures.clear();
 
 	std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
-	s_replacement_texture_cache.clear();
+	ClearReplacementCache();
 	s_pending_async_load_textures.clear();
 	s_async_loaded_textures.clear();
 }
 
+u64 GSTextureReplacements::GetReplacementTextureMemoryUsage(const ReplacementTexture& rtex)
+{
+	u64 size = rtex.data.size();
+	for (const ReplacementTexture::MipData& mip : rtex.mips)
+		size += mip.data.size();
+	return size;
+}
+
+const GSTextureReplacements::ReplacementTexture& GSTextureReplacements::InsertIntoReplacementCache(const TextureName& name, ReplacementTexture rtex)
+{
+	// lock must be held
+	auto [it, inserted] = s_replacement_texture_cache.emplace(name, std::move(rtex));
+	if (inserted)
+		s_replacement_texture_cache_size += GetReplacementTextureMemoryUsage(it->second);
+
+	TouchReplacementCacheEntry(name);
+	EvictReplacementCacheToBudget(name);
+	return it->second;
+}
+
+void GSTextureReplacements::TouchReplacementCacheEntry(const TextureName& name)
+{
+	// lock must be held
+	s_replacement_texture_last_used[name] = ++s_replacement_texture_use_counter;
+}
+
+void GSTextureReplacements::EvictReplacementCacheToBudget(const TextureName& keep)
+{
+	// lock must be held
+	const u64 budget = static_cast<u64>(std::max(GSConfig.TextureReplacementCacheBudget, 0)) << 20;
+	if (budget == 0 || s_replacement_texture_cache_size <= budget)
+		return;
+
+	// anything waiting to be injected into the TC has to stay, otherwise the load was wasted
+	std::vector<std::pair<u64, TextureName>> candidates;
+	candidates.reserve(s_replacement_texture_cache.size());
+	for (const auto& it : s_replacement_texture_cache)
+	{
+		if (it.first == keep || s_pending_async_load_textures.find(it.first) != s_pending_async_load_textures.end())
+			continue;
+
+		candidates.emplace_back(s_replacement_texture_last_used[it.first], it.first);
+	}
+
+	std::sort(candidates.begin(), candidates.end(),
+		[](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+	for (const auto& [last_used, name] : candidates)
+	{
+		if (s_replacement_texture_cache_size <= budget)
+			break;
+
+		auto it = s_replacement_texture_cache.find(name);
+		s_replacement_texture_cache_size -= GetReplacementTextureMemoryUsage(it->second);
+		s_replacement_texture_cache.erase(it);
+		s_replacement_texture_last_used.erase(name);
+	}
+}
+
+void GSTextureReplacements::ClearReplacementCache()
+{
+	// lock must be held
+	s_replacement_texture_cache.clear();
+	s_replacement_texture_last_used.clear();
+	s_replacement_texture_cache_size = 0;
+}
+
+void GSTextureReplacements::LoadPreloadManifest()
+{
+	const std::string filename(Path::Combine(GetGameTextureDirectory(), TEXTURE_PRELOAD_MANIFEST_NAME));
+	std::optional<std::string> manifest(FileSystem::ReadFileToString(filename.c_str()));
+	if (!manifest.has_value())
+		return;
+
+	// same guess as precaching
+	const bool mipmap = GSConfig.HWMipmap >= HWMipmapLevel::Basic ||
+						GSConfig.UserHacks_TriFilter == TriFiltering::Forced;
+
+	std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
+	u32 count = 0;
+	for (const std::string_view& line : StringUtil::SplitString(manifest.value(), '\n'))
+	{
+		std::optional<TextureName> name(ParseReplacementName(std::string(StringUtil::StripWhitespace(line))));
+		if (!name.has_value())
+			continue;
+
+		// pack may have changed since the manifest was written
+		auto fnit = s_replacement_texture_filenames.find(name.value());
+		if (fnit == s_replacement_texture_filenames.end())
+			continue;
+
+		s_seen_replacement_textures.insert(name.value());
+		QueueAsyncReplacementTextureLoad(name.value(), fnit->second, mipmap);
+		count++;
+	}
+
+	DevCon.WriteLn("Preloading %u previously used replacement textures.", count);
+}
+
+void GSTextureReplacements::SavePreloadManifest()
+{
+	if (!s_seen_replacement_textures_dirty || s_current_serial.empty())
+		return;
+
+	s_seen_replacement_textures_dirty = false;
+
+	std::string manifest;
+	for (const TextureName& name : s_seen_replacement_textures)
+	{
+		auto fnit = s_replacement_texture_filenames.find(name);
+		if (fnit == s_replacement_texture_filenames.end())
+			continue;
+
+		manifest.append(Path::GetFileName(fnit->second));
+		manifest.push_back('\n');
+	}
+
+	const std::string filename(Path::Combine(GetGameTextureDirectory(), TEXTURE_PRELOAD_MANIFEST_NAME));
+	if (!FileSystem::WriteBinaryFile(filename.c_str(), manifest.data(), manifest.size()))
+		Console.Error("Failed to write replacement texture manifest to '%s'.", filename.c_str());
+}
+
 GSTexture* GSTextureReplacements::CreateReplacementTexture(const ReplacementTexture& rtex, const GSVector2& scale, bool mipmap)
 {
 	// can't use generated mipmaps with compressed formats, because they can't be rendered to
@@ -573,6 +735,8 @@ void GSTextureReplacements::ProcessAsyncLoadedTextures()
 		if (it == s_replacement_texture_cache.end())
 			continue;
 
+		TouchReplacementCacheEntry(name);
+
 		// upload and inject into TC
 		GSTexture* tex = CreateReplacementTexture(it->second, name.ReplacementScale(it->second), mipmap);
 		if (tex)
@@ -615,12 +779,25 @@ void GSTextureReplacements::DumpTexture(const GSTextureCache::HashCacheKey& hash
 	(mem.*psm.rtx)(mem.GetOffset(TEX0.TBP0, TEX0.TBW, TEX0.PSM), block_rect, buffer.GetPtr(), pitch, TEXA);
 
 	// okay, now we can actually dump it
+	WaitForPendingDumps();
 	QueueWorkerThreadItem([filename = std::move(filename), tw, th, pitch, buffer = std::move(buffer)]() {
 		if (!SavePNGImage(filename.c_str(), tw, th, buffer.GetPtr(), pitch))
 			Console.Error("Failed to dump texture to '%s'.", filename.c_str());
+
+		std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
+		if (s_pending_dumps > 0)
+			s_pending_dumps--;
+		s_worker_thread_done_cv.notify_all();
 	});
 }
 
+void GSTextureReplacements::WaitForPendingDumps()
+{
+	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
+	s_worker_thread_done_cv.wait(lock, []() { return s_pending_dumps < MAX_PENDING_DUMPS; });
+	s_pending_dumps++;
+}
+
 void GSTextureReplacements::ClearDumpedTextureList()
 {
 	s_dumped_textures.clear();
@@ -634,25 +811,30 @@ void GSTextureReplacements::StartWorkerThread()
 {
 	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
 
-	if (s_worker_thread.joinable())
+	if (!s_worker_threads.empty())
 		return;
 
+	// PNG encoding is the bottleneck when dumping, so use a few threads
+	const u32 num_threads = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
 	s_worker_thread_running = true;
-	s_worker_thread = std::thread(WorkerThreadEntryPoint);
+	for (u32 i = 0; i < num_threads; i++)
+		s_worker_threads.emplace_back(WorkerThreadEntryPoint);
 }
 
 void GSTextureReplacements::StopWorkerThread()
 {
 	{
 		std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-		if (!s_worker_thread.joinable())
+		if (s_worker_threads.empty())
 			return;
 
 		s_worker_thread_running = false;
-		s_worker_thread_cv.notify_one();
+		s_worker_thread_cv.notify_all();
 	}
 
-	s_worker_thread.join();
+	for (std::thread& thread : s_worker_threads)
+		thread.join();
+	s_worker_threads.clear();
 
 	// clear out workery-things too
 	CancelPendingLoadsAndDumps();
@@ -660,7 +842,7 @@ void GSTextureReplacements::StopWorkerThread()
 
 void GSTextureReplacements::QueueWorkerThreadItem(std::function<void()> fn)
 {
-	pxAssert(s_worker_thread.joinable());
+	pxAssert(!s_worker_threads.empty());
 
 	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
 	s_worker_thread_queue.push(std::move(fn));
@@ -680,28 +862,22 @@ void GSTextureReplacements::WorkerThreadEntryPoint()
 
 		std::function<void()> fn = std::move(s_worker_thread_queue.front());
 		s_worker_thread_queue.pop();
+		s_worker_threads_busy++;
 		lock.unlock();
 		fn();
 		lock.lock();
+		s_worker_threads_busy--;
+		s_worker_thread_done_cv.notify_all();
 	}
 }
 
 void GSTextureReplacements::SyncWorkerThread()
 {
 	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-	if (!s_worker_thread.joinable())
+	if (s_worker_threads.empty())
 		return;
 
-	// not the most efficient by far, but it only gets called on config changes, so whatever
-	for (;;)
-	{
-		if (s_worker_thread_queue.empty())
-			break;
-
-		lock.unlock();
-		std::this_thread::sleep_for(std::chrono::milliseconds(1));
-		lock.lock();
-	}
+	s_worker_thread_done_cv.wait(lock, []() { return s_worker_thread_queue.empty() && s_worker_threads_busy == 0; });
 }
 
 void GSTextureReplacements::CancelPendingLoadsAndDumps()
@@ -709,6 +885,8 @@ void GSTextureReplacements::CancelPendingLoadsAndDumps()
 	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
 	while (!s_worker_thread_queue.empty())
 		s_worker_thread_queue.pop();
+	s_pending_dumps = 0;
+	s_worker_thread_done_cv.notify_all();
 	s_async_loaded_textures.clear();
 	s_pending_async_load_textures.clear();
 }
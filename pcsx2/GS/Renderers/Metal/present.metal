@@ -72,6 +72,26 @@ fragment float4 ps_filter_complex(ConvertShaderData data [[stage_in]], ConvertPS
 	return factor * res.sample(float2(data.t.x, ycoord));
 }
 
+// Contrast adaptive sharpening (after AMD FidelityFX CAS). Sharpens less where the
+// neighbourhood is already contrasty, so a low internal resolution can be restored
+// at present time without haloing.
+fragment float4 ps_filter_sharpen(ConvertShaderData data [[stage_in]], ConvertPSRes res)
+{
+	float2 texel = 1.f / float2(res.texture.get_width(), res.texture.get_height());
+	float4 c = res.sample(data.t);
+	float3 n = res.sample(data.t + float2(0.f, -texel.y)).rgb;
+	float3 w = res.sample(data.t + float2(-texel.x, 0.f)).rgb;
+	float3 e = res.sample(data.t + float2(texel.x, 0.f)).rgb;
+	float3 s = res.sample(data.t + float2(0.f, texel.y)).rgb;
+
+	float3 mn = min(c.rgb, min(min(n, w), min(e, s)));
+	float3 mx = max(c.rgb, max(max(n, w), max(e, s)));
+	float3 amp = sqrt(saturate(min(mn, 2.f - mx) / max(mx, 1.f / 256.f)));
+	float3 wt = amp * (-1.f / 6.5f);
+
+	return float4(saturate(((n + w + e + s) * wt + c.rgb) / (1.f + 4.f * wt)), c.a);
+}
+
 #define MaskingType 4                      //[1|2|3|4] The type of CRT shadow masking used. 1: compressed TV style, 2: Aperture-grille, 3: Stretched VGA style, 4: VGA style.
 #define ScanBrightness -8.00               //[-16.0 to 1.0] The overall brightness of the scanline effect. Lower for darker, higher for brighter.
 #define FilterCRTAmount -1.00              //[-4.0 to 1.0] The amount of filtering used, to replicate the TV CRT look. Lower for less, higher for more.
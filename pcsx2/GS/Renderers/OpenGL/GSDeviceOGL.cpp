@@ -15,6 +15,7 @@
 
 #include "PrecompiledHeader.h"
 #include "common/StringUtil.h"
+#include "common/Timer.h"
 #include "GS/GSState.h"
 #include "GSDeviceOGL.h"
 #include "GLState.h"
@@ -92,6 +93,8 @@ GSDeviceOGL::~GSDeviceOGL()
 	m_fragment_uniform_stream_buffer.reset();
 	glDeleteSamplers(1, &m_palette_ss);
 
+	SavePipelineManifest("opengl", sizeof(ProgramSelector));
+	m_programs_linking.clear();
 	m_programs.clear();
 
 	glDeleteSamplers(std::size(m_ps_ss), m_ps_ss);
@@ -214,6 +217,17 @@ bool GSDeviceOGL::Create(HostDisplay* display)
 		Console.WriteLn("Not using shader cache.");
 	}
 
+	// Preloaded cache binaries get linked by the driver's own threads instead of stalling a draw.
+	m_parallel_link = GSConfig.AsyncPipelineCompilation &&
+		(GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile);
+	if (m_parallel_link)
+	{
+		if (GLAD_GL_KHR_parallel_shader_compile)
+			glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+		else
+			glMaxShaderCompilerThreadsARB(0xFFFFFFFFu);
+	}
+
 	// optional features based on context
 	m_features.broken_point_sampler = GLLoader::vendor_id_amd;
 	m_features.geometry_shader = GLLoader::found_geometry_shader;
@@ -1788,23 +1802,80 @@ __fi static void WriteToStreamBuffer(GL::StreamBuffer* sb, u32 index, u32 align,
 	glBindBufferRange(GL_UNIFORM_BUFFER, index, sb->GetGLBufferId(), res.buffer_offset, size);
 }
 
-void GSDeviceOGL::SetupPipeline(const ProgramSelector& psel)
+GL::Program GSDeviceOGL::CompileTFXProgram(const ProgramSelector& psel, bool async)
+{
+	const std::string vs(GetVSSource(psel.vs));
+	const std::string ps(GetPSSource(psel.ps));
+	const std::string gs((psel.gs.key != 0) ? GetGSSource(psel.gs) : std::string());
+
+	GL::Program prog;
+	if (async)
+		m_shader_cache.GetProgramAsync(&prog, vs, gs, ps);
+	else
+		m_shader_cache.GetProgram(&prog, vs, gs, ps);
+	return prog;
+}
+
+bool GSDeviceOGL::SetupPipeline(const ProgramSelector& psel)
 {
 	auto it = m_programs.find(psel);
+	if (it != m_programs.end() && !m_programs_linking.empty() && m_programs_linking.find(psel) != m_programs_linking.end())
+	{
+		// Draw is skipped until the driver has finished linking the preloaded program.
+		if (!it->second.IsLinkComplete())
+			return false;
+
+		m_programs_linking.erase(psel);
+		if (!it->second.CheckLinkStatus())
+		{
+			m_programs.erase(it);
+			it = m_programs.emplace(psel, CompileTFXProgram(psel, false)).first;
+		}
+	}
+
 	if (it != m_programs.end())
 	{
 		it->second.Bind();
-		return;
+		return true;
 	}
 
-	const std::string vs(GetVSSource(psel.vs));
-	const std::string ps(GetPSSource(psel.ps));
-	const std::string gs((psel.gs.key != 0) ? GetGSSource(psel.gs) : std::string());
-
-	GL::Program prog;
-	m_shader_cache.GetProgram(&prog, vs, gs, ps);
-	it = m_programs.emplace(psel, std::move(prog)).first;
+	it = m_programs.emplace(psel, CompileTFXProgram(psel, false)).first;
+	RecordPipeline(&psel, sizeof(psel));
 	it->second.Bind();
+	return true;
+}
+
+void GSDeviceOGL::SetGameCRC(u32 crc)
+{
+	if (crc == m_pipeline_manifest_crc)
+		return;
+
+	SavePipelineManifest("opengl", sizeof(ProgramSelector));
+	m_pipeline_manifest_crc = crc;
+
+	std::vector<u8> data;
+	if (crc == 0 || !LoadPipelineManifest("opengl", crc, sizeof(ProgramSelector), &data))
+		return;
+
+	// With parallel link, cached binaries are only handed to the driver here, and SetupPipeline()
+	// waits for them to finish. Otherwise they're linked now, while the game is booting.
+	Common::Timer timer;
+	u32 compiled = 0;
+	for (size_t pos = 0; pos < data.size(); pos += sizeof(ProgramSelector))
+	{
+		ProgramSelector p;
+		std::memcpy(&p, &data[pos], sizeof(p));
+		if (m_programs.find(p) != m_programs.end())
+			continue;
+
+		m_programs.emplace(p, CompileTFXProgram(p, m_parallel_link));
+		if (m_parallel_link)
+			m_programs_linking.insert(p);
+		compiled++;
+	}
+
+	DevCon.WriteLn("%s %u OpenGL programs for CRC %08X in %.2f ms", m_parallel_link ? "Queued" : "Precompiled",
+		compiled, crc, timer.GetTimeMilliseconds());
 }
 
 void GSDeviceOGL::SetupSampler(PSSamplerSelector ssel)
@@ -1948,7 +2019,7 @@ void GSDeviceOGL::RenderHW(GSHWDrawConfig& config)
 		}
 	}
 
-	SetupPipeline(psel);
+	bool program_ready = SetupPipeline(psel);
 
 	// additional non-pipeline config stuff
 	const bool point_size_enabled = config.vs.point_size;
@@ -1979,14 +2050,15 @@ void GSDeviceOGL::RenderHW(GSHWDrawConfig& config)
 		// Neither in the depth buffer
 		glDepthMask(false);
 		// Compute primitiveID max that pass the date test (Draw without barrier)
-		DrawIndexedPrimitive();
+		if (program_ready)
+			DrawIndexedPrimitive();
 
 		// Ask PS to discard shader above the primitiveID max
 		glDepthMask(GLState::depth_mask);
 
 		psel.ps.date = 3;
 		config.alpha_second_pass.ps.date = 3;
-		SetupPipeline(psel);
+		program_ready = SetupPipeline(psel);
 
 		// Be sure that first pass is finished !
 		Barrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
@@ -1994,17 +2066,19 @@ void GSDeviceOGL::RenderHW(GSHWDrawConfig& config)
 
 	OMSetRenderTargets(hdr_rt ? hdr_rt : config.rt, config.ds, &config.scissor);
 
-	SendHWDraw(config, psel.ps.IsFeedbackLoop());
+	if (program_ready)
+		SendHWDraw(config, psel.ps.IsFeedbackLoop());
 
 	if (config.separate_alpha_pass)
 	{
 		GSHWDrawConfig::BlendState dummy_bs;
 		SetHWDrawConfigForAlphaPass(&psel.ps, &config.colormask, &dummy_bs, &config.depth);
-		SetupPipeline(psel);
+		program_ready = SetupPipeline(psel);
 		OMSetColorMaskState(config.alpha_second_pass.colormask);
 		SetupOM(config.alpha_second_pass.depth);
 		OMSetBlendState();
-		SendHWDraw(config, psel.ps.IsFeedbackLoop());
+		if (program_ready)
+			SendHWDraw(config, psel.ps.IsFeedbackLoop());
 
 		// restore blend state if we're doing a second pass
 		if (config.alpha_second_pass.enable)
@@ -2026,20 +2100,22 @@ void GSDeviceOGL::RenderHW(GSHWDrawConfig& config)
 		}
 
 		psel.ps = config.alpha_second_pass.ps;
-		SetupPipeline(psel);
+		program_ready = SetupPipeline(psel);
 		OMSetColorMaskState(config.alpha_second_pass.colormask);
 		SetupOM(config.alpha_second_pass.depth);
-		SendHWDraw(config, psel.ps.IsFeedbackLoop());
+		if (program_ready)
+			SendHWDraw(config, psel.ps.IsFeedbackLoop());
 
 		if (config.second_separate_alpha_pass)
 		{
 			GSHWDrawConfig::BlendState dummy_bs;
 			SetHWDrawConfigForAlphaPass(&psel.ps, &config.colormask, &dummy_bs, &config.depth);
-			SetupPipeline(psel);
+			program_ready = SetupPipeline(psel);
 			OMSetColorMaskState(config.alpha_second_pass.colormask);
 			SetupOM(config.alpha_second_pass.depth);
 			OMSetBlendState();
-			SendHWDraw(config, psel.ps.IsFeedbackLoop());
+			if (program_ready)
+				SendHWDraw(config, psel.ps.IsFeedbackLoop());
 		}
 	}
 
@@ -26,6 +26,7 @@
 #include "GLState.h"
 #include "GLLoader.h"
 #include "GS/GS.h"
+#include <unordered_set>
 
 #ifdef ENABLE_OGL_DEBUG_MEM_BW
 extern u64 g_real_texture_upload_byte;
@@ -293,6 +294,11 @@ private:
 	std::unordered_map<ProgramSelector, GL::Program, ProgramSelectorHash> m_programs;
 	GL::ShaderCache m_shader_cache;
 
+	// Programs preloaded from the pipeline manifest which the driver may still be linking in parallel,
+	// only used when GSConfig.AsyncPipelineCompilation is set and GL_KHR_parallel_shader_compile exists.
+	std::unordered_set<ProgramSelector, ProgramSelectorHash> m_programs_linking;
+	bool m_parallel_link = false;
+
 	GLuint m_palette_ss;
 
 	GSHWDrawConfig::VSConstantBuffer m_vs_cb_cache;
@@ -328,6 +334,8 @@ public:
 	void ResetAPIState() override;
 	void RestoreAPIState() override;
 
+	void SetGameCRC(u32 crc) override;
+
 	void DrawPrimitive();
 	void DrawIndexedPrimitive();
 	void DrawIndexedPrimitive(int offset, int count);
@@ -386,7 +394,8 @@ public:
 	GLuint CreateSampler(PSSamplerSelector sel);
 	GSDepthStencilOGL* CreateDepthStencil(OMDepthStencilSelector dssel);
 
-	void SetupPipeline(const ProgramSelector& psel);
+	GL::Program CompileTFXProgram(const ProgramSelector& psel, bool async);
+	bool SetupPipeline(const ProgramSelector& psel);
 	void SetupSampler(PSSamplerSelector ssel);
 	void SetupOM(OMDepthStencilSelector dssel);
 	GLuint GetSamplerID(PSSamplerSelector ssel);
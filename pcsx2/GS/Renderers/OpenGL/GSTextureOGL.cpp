@@ -420,7 +420,7 @@ bool GSTextureOGL::Update(const GSVector4i& r, const void* data, int pitch, int
 		PboPool::EndTransfer();
 	}
 
-	m_needs_mipmaps_generated = true;
+	m_needs_mipmaps_generated |= (layer == 0);
 
 	return true;
 }
@@ -482,7 +482,7 @@ void GSTextureOGL::Unmap()
 
 		PboPool::EndTransfer();
 
-		m_needs_mipmaps_generated = true;
+		m_needs_mipmaps_generated |= (m_layer == 0);
 
 		GL_POP(); // PUSH is in Map
 	}
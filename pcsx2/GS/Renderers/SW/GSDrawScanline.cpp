@@ -61,13 +61,7 @@ void GSDrawScanline::BeginDraw(const GSRasterizerData* data)
 
 	if (m_global.sel.aa1)
 	{
-		GSScanlineSelector sel;
-
-		sel.key = m_global.sel.key;
-		sel.zwrite = 0;
-		sel.edge = 1;
-
-		m_de = m_ds_map[sel];
+		m_de = m_ds_map[GetEdgeSelector(m_global.sel)];
 	}
 	else
 	{
@@ -83,25 +77,54 @@ void GSDrawScanline::BeginDraw(const GSRasterizerData* data)
 		m_dr = NULL;
 	}
 
+	m_sp = m_sp_map[GetSetupPrimSelector(m_global.sel)];
+}
+
+GSScanlineSelector GSDrawScanline::GetEdgeSelector(const GSScanlineSelector& global)
+{
+	GSScanlineSelector sel;
+
+	sel.key = global.key;
+	sel.zwrite = 0;
+	sel.edge = 1;
+
+	return sel;
+}
+
+GSScanlineSelector GSDrawScanline::GetSetupPrimSelector(const GSScanlineSelector& global)
+{
 	// doesn't need all bits => less functions generated
 
 	GSScanlineSelector sel;
 
 	sel.key = 0;
 
-	sel.iip = m_global.sel.iip;
-	sel.tfx = m_global.sel.tfx;
-	sel.tcc = m_global.sel.tcc;
-	sel.fst = m_global.sel.fst;
-	sel.fge = m_global.sel.fge;
-	sel.prim = m_global.sel.prim;
-	sel.fb = m_global.sel.fb;
-	sel.zb = m_global.sel.zb;
-	sel.zoverflow = m_global.sel.zoverflow;
-	sel.zequal = m_global.sel.zequal;
-	sel.notest = m_global.sel.notest;
-
-	m_sp = m_sp_map[sel];
+	sel.iip = global.iip;
+	sel.tfx = global.tfx;
+	sel.tcc = global.tcc;
+	sel.fst = global.fst;
+	sel.fge = global.fge;
+	sel.prim = global.prim;
+	sel.fb = global.fb;
+	sel.zb = global.zb;
+	sel.zoverflow = global.zoverflow;
+	sel.zequal = global.zequal;
+	sel.notest = global.notest;
+
+	return sel;
+}
+
+void GSDrawScanline::Precompile(u64 key)
+{
+	GSScanlineSelector sel;
+	sel.key = key;
+
+	m_ds_map[sel];
+
+	if (sel.aa1)
+		m_ds_map[GetEdgeSelector(sel)];
+
+	m_sp_map[GetSetupPrimSelector(sel)];
 }
 
 void GSDrawScanline::EndDraw(u64 frame, u64 ticks, int actual, int total, int prims)
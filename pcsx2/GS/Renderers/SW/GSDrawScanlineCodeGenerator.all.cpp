@@ -247,6 +247,13 @@ void GSDrawScanlineCodeGenerator2::alltrue(const XYm& test)
 
 void GSDrawScanlineCodeGenerator2::blend(const XYm& a, const XYm& b, const XYm& mask)
 {
+	if (hasAVX512VL)
+	{
+		// a = (b & mask) | (a & ~mask), b and mask are left alone
+		vpternlogd(a, b, mask, 0xd8);
+		return;
+	}
+
 	pand(b, mask);
 	pandn(mask, a);
 	if (hasAVX)
@@ -262,6 +269,13 @@ void GSDrawScanlineCodeGenerator2::blend(const XYm& a, const XYm& b, const XYm&
 
 void GSDrawScanlineCodeGenerator2::blendr(const XYm& b, const XYm& a, const XYm& mask)
 {
+	if (hasAVX512VL)
+	{
+		// b = (b & mask) | (a & ~mask)
+		vpternlogd(b, a, mask, 0xe4);
+		return;
+	}
+
 	pand(b, mask);
 	pandn(mask, a);
 	por(b, mask);
@@ -2928,8 +2942,15 @@ void GSDrawScanlineCodeGenerator2::WriteFrame()
 		psrld(xym1, 6);
 
 		por(xym0, xym1);
-		por(xym5, xym6);
-		por(xym5, xym0);
+		if (hasAVX512VL)
+		{
+			vpternlogd(xym5, xym6, xym0, 0xfe); // xym5 | xym6 | xym0
+		}
+		else
+		{
+			por(xym5, xym6);
+			por(xym5, xym0);
+		}
 	}
 
 	if (m_sel.rfb)
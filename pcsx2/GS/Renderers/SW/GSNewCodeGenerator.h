@@ -32,6 +32,8 @@ namespace SSEVersion
 struct CPUInfo
 {
 	bool hasFMA = false;
+	/// EVEX encoded 128/256-bit instructions (vpternlogd etc.), these don't drop the clocks like 512-bit ones do.
+	bool hasAVX512VL = false;
 	SSEVersion::SSEVersion sseVersion = SSEVersion::SSE41;
 
 	CPUInfo() = default;
@@ -44,6 +46,7 @@ struct CPUInfo
 			version = SSEVersion::AVX2;
 
 		hasFMA = cpu.has(cpu.tFMA);
+		hasAVX512VL = version >= SSEVersion::AVX2 && cpu.has(cpu.tAVX512F) && cpu.has(cpu.tAVX512VL);
 		sseVersion = version;
 	}
 };
@@ -118,7 +121,7 @@ public:
 	template <typename T32, typename T64>
 	static T64 choose3264(T32 t32, T64 t64) { return t64; }
 
-	const bool hasAVX, hasAVX2, hasFMA;
+	const bool hasAVX, hasAVX2, hasFMA, hasAVX512VL;
 
 	const Xmm xmm0{0}, xmm1{1}, xmm2{2}, xmm3{3}, xmm4{4}, xmm5{5}, xmm6{6}, xmm7{7}, xmm8{8}, xmm9{9}, xmm10{10}, xmm11{11}, xmm12{12}, xmm13{13}, xmm14{14}, xmm15{15};
 	const Ymm ymm0{0}, ymm1{1}, ymm2{2}, ymm3{3}, ymm4{4}, ymm5{5}, ymm6{6}, ymm7{7}, ymm8{8}, ymm9{9}, ymm10{10}, ymm11{11}, ymm12{12}, ymm13{13}, ymm14{14}, ymm15{15};
@@ -135,6 +138,7 @@ public:
 		, hasAVX(cpu.sseVersion >= SSEVersion::AVX)
 		, hasAVX2(cpu.sseVersion >= SSEVersion::AVX2)
 		, hasFMA(cpu.hasFMA)
+		, hasAVX512VL(cpu.hasAVX512VL)
 	{
 	}
 
@@ -152,6 +156,7 @@ public:
 //   AVX:     available only on AVX (exception on SSE)
 //   AVX2:    available only on AVX2 (exception on AVX/SSE)
 //   FMA:     available only with FMA
+//   AVX512VL: EVEX 128/256-bit, available only with AVX-512 F+VL
 // SFORWARD forwards an SSE-AVX pair where the AVX variant takes the same number of registers (e.g. pshufd dst, src + vpshufd dst, src)
 // AFORWARD forwards an SSE-AVX pair where the AVX variant takes an extra destination register (e.g. shufps dst, src + vshufps dst, src, src)
 
@@ -196,6 +201,12 @@ public:
 	else \
 		throw Error(Error::ERR_AVX_INSTR_IN_SSE);
 
+#define ACTUAL_FORWARD_AVX512VL(name, ...) \
+	if (hasAVX512VL) \
+		actual.name(__VA_ARGS__); \
+	else \
+		throw Error(Error::ERR_AVX_INSTR_IN_SSE);
+
 #define FORWARD1(category, name, type) \
 	void name(type a) \
 	{ \
@@ -419,6 +430,7 @@ public:
 	FORWARD(3, AVX2, vpgatherdd,     const Xmm&, const Address&, const Xmm&);
 	FORWARD(3, AVX2, vpsravd,        ARGS_XXO)
 	FORWARD(3, AVX2, vpsrlvd,        ARGS_XXO)
+	FORWARD(4, AVX512VL, vpternlogd, const Xmm&, const Xmm&, const Operand&, u8)
 
 #undef ARGS_OI
 #undef ARGS_OO
@@ -440,6 +452,7 @@ public:
 #undef FORWARD3
 #undef FORWARD2
 #undef FORWARD1
+#undef ACTUAL_FORWARD_AVX512VL
 #undef ACTUAL_FORWARD_FMA
 #undef ACTUAL_FORWARD_AVX2
 #undef ACTUAL_FORWARD_AVX
@@ -20,6 +20,7 @@
 #include "GS/GSExtra.h"
 #include "PerformanceMetrics.h"
 #include "common/StringUtil.h"
+#include "common/Timer.h"
 
 #ifdef PCSX2_CORE
 #include "VMManager.h"
@@ -27,6 +28,11 @@
 
 #define ENABLE_DRAW_STATS 0
 
+// Limits for tile binning, only draws with few primitives are worth walking more than once.
+static constexpr int BIN_MAX_DRAWS = 32;
+static constexpr int BIN_MAX_DRAW_VERTICES = 256;
+static constexpr int BIN_MAX_BATCH_VERTICES = 2048;
+
 int GSRasterizerData::s_counter = 0;
 
 static int compute_best_thread_height(int threads)
@@ -39,8 +45,14 @@ static int compute_best_thread_height(int threads)
 
 	if (th > 0 && th < 9)
 		return th;
-	else
-		return 4;
+
+	// Automatic: shrink the bands until every thread gets at least four of them
+	// in a 512 line frame, so a tall primitive can't land on a single thread.
+	th = 4;
+	while (th > 2 && (512 >> th) < threads * 4)
+		th--;
+
+	return th;
 }
 
 GSRasterizer::GSRasterizer(IDrawScanline* ds, int id, int threads)
@@ -51,9 +63,16 @@ GSRasterizer::GSRasterizer(IDrawScanline* ds, int id, int threads)
 {
 	memset(&m_pixels, 0, sizeof(m_pixels));
 	m_primcount = 0;
+	m_busy_ticks = 0;
 
 	m_thread_height = compute_best_thread_height(threads);
 
+	// Size binning tiles so the lines of one that belong to this thread, at about 32 of them,
+	// keep their colour and depth in L2 for a typical 640 pixel wide 32-bit target.
+	const int bands = std::max(1, 32 >> m_thread_height);
+	m_tile_height = (bands * threads) << m_thread_height;
+	m_batch_vertices = 0;
+
 	m_edge.buff = (GSVertexSW*)vmalloc(sizeof(GSVertexSW) * 2048, false);
 	m_edge.count = 0;
 
@@ -128,6 +147,12 @@ void GSRasterizer::Queue(const GSRingHeap::SharedPtr<GSRasterizerData>& data)
 	Draw(data.get());
 }
 
+void GSRasterizer::Precompile(std::shared_ptr<const std::vector<u64>> keys)
+{
+	for (u64 key : *keys)
+		m_ds->Precompile(key);
+}
+
 int GSRasterizer::GetPixels(bool reset)
 {
 	int pixels = m_pixels.sum;
@@ -140,11 +165,84 @@ int GSRasterizer::GetPixels(bool reset)
 	return pixels;
 }
 
+void GSRasterizer::ReportBusyTime()
+{
+	g_perfmon.PutThreadBusy(m_id, Common::Timer::ConvertValueToMilliseconds(m_busy_ticks));
+	m_busy_ticks = 0;
+}
+
+void GSRasterizer::DrawBinned(const GSRingHeap::SharedPtr<GSRasterizerData>& data, bool last)
+{
+	const GSVector4i r = data->bbox.rintersect(data->scissor);
+	const int vertices = (data->index != NULL) ? data->index_count : data->vertex_count;
+
+	if (r.height() <= m_tile_height || vertices > BIN_MAX_DRAW_VERTICES)
+	{
+		// Keeps the order, everything batched so far has to land first.
+		FlushBatch();
+		Draw(data.get());
+		return;
+	}
+
+	m_batch.push_back(data);
+	m_batch_vertices += vertices;
+
+	if (last || m_batch.size() >= static_cast<size_t>(BIN_MAX_DRAWS) || m_batch_vertices >= BIN_MAX_BATCH_VERTICES)
+		FlushBatch();
+}
+
+void GSRasterizer::FlushBatch()
+{
+	if (m_batch.empty())
+		return;
+
+	if (m_batch.size() == 1)
+	{
+		Draw(m_batch[0].get());
+	}
+	else
+	{
+		GSVector4i area = m_batch[0]->bbox.rintersect(m_batch[0]->scissor);
+		for (size_t i = 1; i < m_batch.size(); i++)
+			area = area.runion(m_batch[i]->bbox.rintersect(m_batch[i]->scissor));
+
+		// Every draw is rendered one tile at a time, restricted by the scissor. The rasterizer steps each
+		// line from the vertices, not from the previous line, so splitting a primitive doesn't change its output.
+		// Anything that reads back what an earlier draw wrote has already made the renderer sync between them.
+		for (int top = area.top - area.top % m_tile_height; top < area.bottom; top += m_tile_height)
+		{
+			const int bottom = top + m_tile_height;
+
+			for (const auto& data : m_batch)
+			{
+				GSVector4i scissor = data->scissor;
+				scissor.top = std::max(scissor.top, top);
+				scissor.bottom = std::min(scissor.bottom, bottom);
+
+				if (scissor.top >= scissor.bottom || data->bbox.top > bottom || data->bbox.bottom < top)
+					continue;
+
+				Draw(data.get(), scissor);
+			}
+		}
+	}
+
+	m_batch.clear();
+	m_batch_vertices = 0;
+}
+
 void GSRasterizer::Draw(GSRasterizerData* data)
+{
+	Draw(data, data->scissor);
+}
+
+void GSRasterizer::Draw(GSRasterizerData* data, const GSVector4i& scissor)
 {
 	if (data->vertex != NULL && data->vertex_count == 0 || data->index != NULL && data->index_count == 0)
 		return;
 
+	const Common::Timer::Value busy_start = Common::Timer::GetCurrentValue();
+
 	m_pixels.actual = 0;
 	m_pixels.total = 0;
 	m_primcount = 0;
@@ -162,11 +260,11 @@ void GSRasterizer::Draw(GSRasterizerData* data)
 
 	u32 tmp_index[] = {0, 1, 2};
 
-	bool scissor_test = !data->bbox.eq(data->bbox.rintersect(data->scissor));
+	bool scissor_test = !data->bbox.eq(data->bbox.rintersect(scissor));
 
-	m_scissor = data->scissor;
-	m_fscissor_x = GSVector4(data->scissor).xzxz();
-	m_fscissor_y = GSVector4(data->scissor).ywyw();
+	m_scissor = scissor;
+	m_fscissor_x = GSVector4(scissor).xzxz();
+	m_fscissor_y = GSVector4(scissor).ywyw();
 	m_scanmsk_value = data->scanmsk_value;
 
 	switch (data->primclass)
@@ -259,6 +357,8 @@ void GSRasterizer::Draw(GSRasterizerData* data)
 
 	m_pixels.sum += m_pixels.actual;
 
+	m_busy_ticks += Common::Timer::GetCurrentValue() - busy_start;
+
 	if constexpr (ENABLE_DRAW_STATS)
 		m_ds->EndDraw(data->frame, __rdtsc() - data->start, m_pixels.actual, m_pixels.total, m_primcount);
 }
@@ -1159,6 +1259,7 @@ void GSRasterizer::DrawEdge(int pixels, int left, int top, const GSVertexSW& sca
 GSRasterizerList::GSRasterizerList(int threads)
 {
 	m_thread_height = compute_best_thread_height(threads);
+	m_tile_binning = theApp.GetConfigB("sw_tile_binning");
 
 	const int rows = (2048 >> m_thread_height) + 16;
 	m_scanline = static_cast<u8*>(_aligned_malloc(rows, 64));
@@ -1233,6 +1334,59 @@ void GSRasterizerList::Sync()
 	}
 }
 
+void GSRasterizerList::RunJob(GSRasterizerJob* job)
+{
+	job->Process();
+
+	// Last access, the queuing thread may return as soon as this hits zero.
+	job->active.fetch_sub(1, std::memory_order_release);
+}
+
+bool GSRasterizerList::ParallelFor(int count, const std::function<void(int)>& func)
+{
+	// Only worth it when the workers are idle, otherwise we'd end up waiting for their draws to finish.
+	if (count < 2 || !IsSynced())
+		return false;
+
+	const int helpers = std::min<int>(count - 1, static_cast<int>(m_workers.size()));
+
+	auto job = m_job_heap.make_shared<GSRasterizerJob>();
+	GSRasterizerJob* job_ptr = job.get();
+	job_ptr->func = func;
+	job_ptr->count = count;
+	job_ptr->active.store(helpers, std::memory_order_relaxed);
+
+	const GSRingHeap::SharedPtr<GSRasterizerData> data = std::move(job).cast<GSRasterizerData>();
+	for (int i = 0; i < helpers; i++)
+		m_workers[i]->Push(data);
+
+	job_ptr->Process();
+
+	while (job_ptr->active.load(std::memory_order_acquire) != 0)
+		ShortSpin();
+
+	return true;
+}
+
+void GSRasterizerList::Precompile(std::shared_ptr<const std::vector<u64>> keys)
+{
+	if (keys->empty())
+		return;
+
+	// Generated code is per thread, so every worker gets the whole list. Nobody waits for these.
+	for (size_t i = 0; i < m_workers.size(); i++)
+	{
+		IDrawScanline* ds = m_r[i]->GetDrawScanline();
+
+		auto job = m_job_heap.make_shared<GSRasterizerJob>();
+		job->func = [ds, keys](int j) { ds->Precompile((*keys)[j]); };
+		job->count = static_cast<int>(keys->size());
+		job->active.store(1, std::memory_order_relaxed);
+
+		m_workers[i]->Push(std::move(job).cast<GSRasterizerData>());
+	}
+}
+
 bool GSRasterizerList::IsSynced() const
 {
 	for (size_t i = 0; i < m_workers.size(); i++)
@@ -1257,3 +1411,11 @@ int GSRasterizerList::GetPixels(bool reset)
 
 	return pixels;
 }
+
+void GSRasterizerList::ReportBusyTime()
+{
+	for (size_t i = 0; i < m_workers.size(); i++)
+	{
+		m_r[i]->ReportBusyTime();
+	}
+}
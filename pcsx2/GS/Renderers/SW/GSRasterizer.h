@@ -40,6 +40,7 @@ public:
 	int pixels;
 	int counter;
 	u8 scanmsk_value;
+	bool job;
 
 	GSRasterizerData()
 		: scissor(GSVector4i::zero())
@@ -54,6 +55,7 @@ public:
 		, start(0)
 		, pixels(0)
 		, scanmsk_value(0)
+		, job(false)
 	{
 		counter = s_counter++;
 	}
@@ -65,6 +67,26 @@ public:
 	}
 };
 
+/// Work which isn't a draw, split across the rasterizer threads by GSRasterizerList::ParallelFor().
+class GSRasterizerJob : public GSRasterizerData
+{
+public:
+	std::function<void(int)> func;
+	int count = 0;
+	std::atomic<int> next{0};
+	std::atomic<int> active{0};
+
+	GSRasterizerJob() { job = true; }
+
+	/// Runs items until there are none left to claim.
+	void Process()
+	{
+		int i;
+		while ((i = next.fetch_add(1, std::memory_order_relaxed)) < count)
+			func(i);
+	}
+};
+
 class IDrawScanline : public GSAlignedClass<32>
 {
 public:
@@ -91,6 +113,9 @@ public:
 	virtual void BeginDraw(const GSRasterizerData* data) = 0;
 	virtual void EndDraw(u64 frame, u64 ticks, int actual, int total, int prims) = 0;
 
+	/// Generates the functions a draw with this scanline selector would use, without drawing anything.
+	virtual void Precompile(u64 key) = 0;
+
 #ifdef ENABLE_JIT_RASTERIZER
 
 	__forceinline void SetupPrim(const GSVertexSW* vertex, const u32* index, const GSVertexSW& dscan) { m_sp(vertex, index, dscan); }
@@ -122,7 +147,15 @@ public:
 	virtual void Sync() = 0;
 	virtual bool IsSynced() const = 0;
 	virtual int GetPixels(bool reset = true) = 0;
+	/// Hands the time spent drawing since the last call to GSPerfMon, per thread.
+	virtual void ReportBusyTime() = 0;
 	virtual void PrintStats() = 0;
+	/// Runs func(0..count-1) on the calling thread and any idle rasterizer threads, returning once all are done.
+	/// Returns false without running anything if there's nobody to share with, the caller should do it itself.
+	virtual bool ParallelFor(int count, const std::function<void(int)>& func) = 0;
+	/// Generates the scanline functions for these selectors ahead of the draws which need them.
+	/// With rasterizer threads it returns right away and each thread compiles its own copy before its next draw.
+	virtual void Precompile(std::shared_ptr<const std::vector<u64>> keys) = 0;
 };
 
 class alignas(32) GSRasterizer : public IRasterizer
@@ -140,6 +173,12 @@ protected:
 	struct { GSVertexSW* buff; int count; } m_edge;
 	struct { int sum, actual, total; } m_pixels;
 	int m_primcount;
+	u64 m_busy_ticks;
+
+	// Tile binning, draws held back by DrawBinned() until FlushBatch().
+	std::vector<GSRingHeap::SharedPtr<GSRasterizerData>> m_batch;
+	int m_batch_vertices;
+	int m_tile_height;
 
 	typedef void (GSRasterizer::*DrawPrimPtr)(const GSVertexSW* v, int count);
 
@@ -171,7 +210,15 @@ public:
 	__forceinline bool IsOneOfMyScanlines(int top, int bottom) const;
 	__forceinline int FindMyNextScanline(int top) const;
 
+	IDrawScanline* GetDrawScanline() const { return m_ds; }
+
 	void Draw(GSRasterizerData* data);
+	void Draw(GSRasterizerData* data, const GSVector4i& scissor);
+
+	/// Same as Draw(), but may hold on to the draw so a run of large ones can be rendered tile by tile.
+	/// last must be set when nothing else is queued behind it, so the batch is finished before the queue reports empty.
+	void DrawBinned(const GSRingHeap::SharedPtr<GSRasterizerData>& data, bool last);
+	void FlushBatch();
 
 	// IRasterizer
 
@@ -179,7 +226,10 @@ public:
 	void Sync() {}
 	bool IsSynced() const { return true; }
 	int GetPixels(bool reset);
+	void ReportBusyTime();
 	void PrintStats() { m_ds->PrintStats(); }
+	bool ParallelFor(int count, const std::function<void(int)>& func) { return false; }
+	void Precompile(std::shared_ptr<const std::vector<u64>> keys);
 };
 
 class GSRasterizerList : public IRasterizer
@@ -187,16 +237,21 @@ class GSRasterizerList : public IRasterizer
 protected:
 	using GSWorker = GSJobQueue<GSRingHeap::SharedPtr<GSRasterizerData>, 65536>;
 
+	// Jobs can still be referenced by the workers' queues, so this has to outlive them.
+	GSRingHeap m_job_heap;
+
 	// Worker threads depend on the rasterizers, so don't change the order.
 	std::vector<std::unique_ptr<GSRasterizer>> m_r;
 	std::vector<std::unique_ptr<GSWorker>> m_workers;
 	u8* m_scanline;
 	int m_thread_height;
+	bool m_tile_binning;
 
 	GSRasterizerList(int threads);
 
 	static void OnWorkerStartup(int i);
 	static void OnWorkerShutdown(int i);
+	static void RunJob(GSRasterizerJob* job);
 
 public:
 	virtual ~GSRasterizerList();
@@ -212,6 +267,9 @@ public:
 		}
 
 		std::unique_ptr<GSRasterizerList> rl(new GSRasterizerList(threads));
+		GSRasterizerList* list = rl.get();
+
+		rl->m_workers.reserve(threads);
 
 		for (int i = 0; i < threads; i++)
 		{
@@ -219,7 +277,22 @@ public:
 			auto& r = *rl->m_r[i];
 			rl->m_workers.push_back(std::unique_ptr<GSWorker>(new GSWorker(
 				[i]() { GSRasterizerList::OnWorkerStartup(i); },
-				[&r](GSRingHeap::SharedPtr<GSRasterizerData>& item) { r.Draw(item.get()); },
+				[list, i, &r](GSRingHeap::SharedPtr<GSRasterizerData>& item) {
+					if (item->job)
+					{
+						r.FlushBatch();
+						RunJob(static_cast<GSRasterizerJob*>(item.get()));
+					}
+					else if (list->m_tile_binning)
+					{
+						// The item being processed is still counted by the queue.
+						r.DrawBinned(item, list->m_workers[i]->GetPendingCount() <= 1);
+					}
+					else
+					{
+						r.Draw(item.get());
+					}
+				},
 				[i]() { GSRasterizerList::OnWorkerShutdown(i); })));
 		}
 
@@ -232,5 +305,8 @@ public:
 	void Sync();
 	bool IsSynced() const;
 	int GetPixels(bool reset);
+	void ReportBusyTime();
 	void PrintStats() {}
+	bool ParallelFor(int count, const std::function<void(int)>& func);
+	void Precompile(std::shared_ptr<const std::vector<u64>> keys);
 };
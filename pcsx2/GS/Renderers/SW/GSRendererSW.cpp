@@ -16,6 +16,8 @@
 #include "PrecompiledHeader.h"
 #include "GSRendererSW.h"
 #include "GS/GSGL.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
 #include "common/StringUtil.h"
 
 #define LOG 0
@@ -39,6 +41,7 @@ GSRendererSW::GSRendererSW(int threads)
 
 	std::fill(std::begin(m_fzb_pages), std::end(m_fzb_pages), 0);
 	std::fill(std::begin(m_tex_pages), std::end(m_tex_pages), 0);
+	std::fill(std::begin(m_wait_pages), std::end(m_wait_pages), 0);
 
 	m_dump_root = root_sw;
 }
@@ -62,6 +65,9 @@ void GSRendererSW::Reset(bool hardware_reset)
 
 void GSRendererSW::Destroy()
 {
+	SaveSelectorManifest();
+	m_selector_manifest_crc = 0;
+
 	// Need to destroy worker queue first to stop any pending thread work
 	m_rl.reset();
 	m_tc.reset();
@@ -76,7 +82,95 @@ void GSRendererSW::Destroy()
 	m_output = nullptr;
 }
 
-void GSRendererSW::VSync(u32 field, bool registers_written)
+// Scanline functions are generated the first time a selector is drawn with, which hitches the same
+// way pipeline compiles do on the hardware renderers. The selectors are kept in a per-CRC manifest
+// next to the pipeline ones (see GSDevice::SavePipelineManifest()) and generated again at boot.
+// Bump the version whenever the GSScanlineSelector layout changes.
+static constexpr u32 SELECTOR_MANIFEST_SIGNATURE = 0x4D535347; // GSSM
+static constexpr u32 SELECTOR_MANIFEST_VERSION = 1;
+static constexpr u32 SELECTOR_MANIFEST_MAX_ENTRIES = 0x10000;
+
+static std::string GetSelectorManifestFilename(u32 crc)
+{
+	return Path::Combine(EmuFolders::Cache, fmt::format("sw_scanline_{:08X}.bin", crc));
+}
+
+void GSRendererSW::SetGameCRC(u32 crc, int options)
+{
+	GSRenderer::SetGameCRC(crc, options);
+
+	if (crc != m_selector_manifest_crc)
+		LoadSelectorManifest(crc);
+}
+
+static bool ReadSelectorManifest(u32 crc, std::vector<u64>* keys)
+{
+	auto fp = FileSystem::OpenManagedCFile(GetSelectorManifestFilename(crc).c_str(), "rb");
+	if (!fp)
+		return false;
+
+	u32 header[3];
+	if (std::fread(header, sizeof(header), 1, fp.get()) != 1 || header[0] != SELECTOR_MANIFEST_SIGNATURE ||
+		header[1] != SELECTOR_MANIFEST_VERSION || header[2] > SELECTOR_MANIFEST_MAX_ENTRIES)
+	{
+		return false;
+	}
+
+	keys->resize(header[2]);
+	if (header[2] > 0 && std::fread(keys->data(), sizeof(u64), header[2], fp.get()) != header[2])
+	{
+		keys->clear();
+		return false;
+	}
+
+	return true;
+}
+
+void GSRendererSW::LoadSelectorManifest(u32 crc)
+{
+	SaveSelectorManifest();
+
+	m_selector_manifest.clear();
+	m_selector_manifest_crc = crc;
+
+	auto keys = std::make_shared<std::vector<u64>>();
+	if (crc == 0 || !ReadSelectorManifest(crc, keys.get()))
+		return;
+
+	m_selector_manifest.insert(keys->begin(), keys->end());
+
+	DevCon.WriteLn("Queued %zu scanline selectors for CRC %08X", keys->size(), crc);
+	m_rl->Precompile(std::move(keys));
+}
+
+void GSRendererSW::SaveSelectorManifest()
+{
+	if (m_selector_manifest_crc == 0 || m_selector_manifest_pending.empty())
+		return;
+
+	// Loaded selectors are never recorded again, so the pending list can be appended without deduplicating.
+	std::vector<u64> keys;
+	ReadSelectorManifest(m_selector_manifest_crc, &keys);
+	keys.insert(keys.end(), m_selector_manifest_pending.begin(), m_selector_manifest_pending.end());
+	m_selector_manifest_pending.clear();
+
+	auto fp = FileSystem::OpenManagedCFile(GetSelectorManifestFilename(m_selector_manifest_crc).c_str(), "wb");
+	if (!fp)
+		return;
+
+	const u32 count = std::min<u32>(static_cast<u32>(keys.size()), SELECTOR_MANIFEST_MAX_ENTRIES);
+	const u32 header[3] = {SELECTOR_MANIFEST_SIGNATURE, SELECTOR_MANIFEST_VERSION, count};
+	if (std::fwrite(header, sizeof(header), 1, fp.get()) != 1 ||
+		(count > 0 && std::fwrite(keys.data(), sizeof(u64), count, fp.get()) != count))
+	{
+		Console.Error("Failed to write scanline selector manifest for CRC %08X", m_selector_manifest_crc);
+		return;
+	}
+
+	DevCon.WriteLn("Saved %u scanline selectors for CRC %08X", count, m_selector_manifest_crc);
+}
+
+void GSRendererSW::VSync(u32 field, bool registers_written, bool hidden)
 {
 	Sync(0); // IncAge might delete a cached texture in use
 
@@ -113,7 +207,7 @@ void GSRendererSW::VSync(u32 field, bool registers_written)
 	//
 	*/
 
-	GSRenderer::VSync(field, registers_written);
+	GSRenderer::VSync(field, registers_written, hidden);
 
 	m_tc->IncAge();
 
@@ -224,7 +318,7 @@ GSTexture* GSRendererSW::GetFeedbackOutput()
 }
 
 
-template <u32 primclass, u32 tme, u32 fst, u32 q_div>
+template <u32 primclass, u32 tme, u32 fst, u32 q_div, u32 stream>
 void GSVertexSW::ConvertVertexBuffer(GSDrawingContext* RESTRICT ctx, GSVertexSW* RESTRICT dst, const GSVertex* RESTRICT src, size_t count)
 {
 	// FIXME q_div wasn't added to AVX2 code path.
@@ -241,7 +335,7 @@ void GSVertexSW::ConvertVertexBuffer(GSDrawingContext* RESTRICT ctx, GSVertexSW*
 
 		GSVector4i xy = xyzuvf.upl16() - off;
 
-		dst->c = GSVector4(GSVector4i::cast(stcq).zzzz().u8to32() << 7);
+		const GSVector4 c = GSVector4(GSVector4i::cast(stcq).zzzz().u8to32() << 7);
 
 		GSVector4 t = GSVector4::zero();
 
@@ -272,9 +366,11 @@ void GSVertexSW::ConvertVertexBuffer(GSDrawingContext* RESTRICT ctx, GSVertexSW*
 			}
 		}
 
+		GSVector4 p;
+
 		if (primclass == GS_SPRITE_CLASS)
 		{
-			dst->p = GSVector4(xy).xyyw(GSVector4(xyzuvf)) * m_pos_scale;
+			p = GSVector4(xy).xyyw(GSVector4(xyzuvf)) * m_pos_scale;
 
 			xyzuvf = xyzuvf.min_u32(z_max);
 			t = t.insert32<1, 3>(GSVector4::cast(xyzuvf));
@@ -282,11 +378,24 @@ void GSVertexSW::ConvertVertexBuffer(GSDrawingContext* RESTRICT ctx, GSVertexSW*
 		else
 		{
 			double z = static_cast<double>(static_cast<u32>(xyzuvf.extract32<1>()));
-			dst->p = (GSVector4(xy) * m_pos_scale).upld(GSVector4::f64(z, 0.0));
+			p = (GSVector4(xy) * m_pos_scale).upld(GSVector4::f64(z, 0.0));
 			t = t.blend32<8>(GSVector4(xyzuvf << 7));
 		}
 
-		dst->t = t;
+		if (stream)
+		{
+			// Write the whole line, including the padding, so the write-combining buffer goes out in one burst.
+			GSVector4::storent(&dst->p, p);
+			GSVector4::storent(&dst->_pad, GSVector4::zero());
+			GSVector4::storent(&dst->t, t);
+			GSVector4::storent(&dst->c, c);
+		}
+		else
+		{
+			dst->p = p;
+			dst->t = t;
+			dst->c = c;
+		}
 
 #if 0 //_M_SSE >= 0x501
 
@@ -294,11 +403,18 @@ void GSVertexSW::ConvertVertexBuffer(GSDrawingContext* RESTRICT ctx, GSVertexSW*
 
 #endif
 	}
+
+	if (stream)
+	{
+		// The rasterizer threads pick this up next, make sure they see it.
+		_mm_sfence();
+	}
 }
 
 // clang-format off
-GSVertexSW::ConvertVertexBufferPtr GSVertexSW::s_cvb[4][2][2][2] = {
-#define InitCVB3(P, T, F) { &GSVertexSW::ConvertVertexBuffer<P, T, F, 0>, &GSVertexSW::ConvertVertexBuffer<P, T, F, 1> }
+GSVertexSW::ConvertVertexBufferPtr GSVertexSW::s_cvb[4][2][2][2][2] = {
+#define InitCVB4(P, T, F, Q) { &GSVertexSW::ConvertVertexBuffer<P, T, F, Q, 0>, &GSVertexSW::ConvertVertexBuffer<P, T, F, Q, 1> }
+#define InitCVB3(P, T, F) { InitCVB4(P, T, F, 0), InitCVB4(P, T, F, 1) }
 #define InitCVB2(P, T) { InitCVB3(P, T, 0), InitCVB3(P, T, 1) }
 #define InitCVB(P) { InitCVB2(static_cast<u32>(P), 0), InitCVB2(static_cast<u32>(P), 1) }
 
@@ -310,6 +426,7 @@ GSVertexSW::ConvertVertexBufferPtr GSVertexSW::s_cvb[4][2][2][2] = {
 #undef InitCVB
 #undef InitCVB2
 #undef InitCVB3
+#undef InitCVB4
 };
 // clang-format on
 
@@ -351,9 +468,21 @@ void GSRendererSW::Draw()
 	// If you have both GS_SPRITE_CLASS && m_vt.m_eq.q, it will depends on the first part of the 'OR'
 	u32 q_div = !IsMipMapActive() && ((m_vt.m_eq.q && m_vt.m_min.t.z != 1.0f) || (!m_vt.m_eq.q && m_vt.m_primclass == GS_SPRITE_CLASS));
 
-	GSVertexSW::s_cvb[m_vt.m_primclass][PRIM->TME][PRIM->FST][q_div](m_context, sd->vertex, m_vertex.buff, m_vertex.next);
+	// Big draws don't fit in cache by the time a rasterizer thread reads them back, so bypass it
+	// instead of evicting everything the GS thread is working with.
+	const u32 stream = (m_vertex.next >= STREAM_VERTEX_THRESHOLD);
+
+	GSVertexSW::s_cvb[m_vt.m_primclass][PRIM->TME][PRIM->FST][q_div][stream](m_context, sd->vertex, m_vertex.buff, m_vertex.next);
 
-	memcpy(sd->index, m_index.buff, sizeof(u32) * m_index.tail);
+	if (stream)
+	{
+		GSVector4i::storent(sd->index, m_index.buff, sizeof(u32) * m_index.tail);
+		_mm_sfence();
+	}
+	else
+	{
+		memcpy(sd->index, m_index.buff, sizeof(u32) * m_index.tail);
+	}
 
 	GSVector4i scissor = GSVector4i(context->scissor.in);
 	GSVector4i bbox = GSVector4i(m_vt.m_min.p.floor().xyxy(m_vt.m_max.p.ceil()));
@@ -379,6 +508,9 @@ void GSRendererSW::Draw()
 		return;
 	}
 
+	if (m_selector_manifest_crc != 0 && m_selector_manifest.insert(sd->global.sel.key).second)
+		m_selector_manifest_pending.push_back(sd->global.sel.key);
+
 	if (0) if (LOG)
 	{
 		int n = GSUtil::GetVertexCount(PRIM->PRIM);
@@ -424,17 +556,17 @@ void GSRendererSW::Draw()
 
 	if (CheckTargetPages(fb_pages, zb_pages, r))
 	{
-		sd->m_syncpoint = SharedData::SyncTarget;
+		WaitForPages(GSPerfMon::SyncTarget);
 	}
 
 	// check if the texture is not part of a target currently in use
 
 	if (CheckSourcePages(sd))
 	{
-		sd->m_syncpoint = SharedData::SyncSource;
+		WaitForPages(GSPerfMon::SyncSource);
 	}
 
-	// addref source and target pages
+	// addref source and target pages, has to come after waiting or we'd be waiting for ourself
 
 	sd->UsePages(fb_pages, m_context->offset.fb.psm(), zb_pages, m_context->offset.zb.psm());
 
@@ -535,20 +667,10 @@ void GSRendererSW::Queue(GSRingHeap::SharedPtr<GSRasterizerData>& item)
 {
 	SharedData* sd = (SharedData*)item.get();
 
-	if (sd->m_syncpoint == SharedData::SyncSource)
-	{
-		Sync(4);
-	}
-
 	// update previously invalidated parts
 
 	sd->UpdateSource();
 
-	if (sd->m_syncpoint == SharedData::SyncTarget)
-	{
-		Sync(5);
-	}
-
 	if (LOG)
 	{
 		GSScanlineGlobalData& gd = ((SharedData*)item.get())->global;
@@ -616,6 +738,7 @@ void GSRendererSW::Sync(int reason)
 	}
 
 	g_perfmon.Put(GSPerfMon::Fillrate, pixels);
+	m_rl->ReportBusyTime();
 }
 
 void GSRendererSW::InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r)
@@ -633,19 +756,18 @@ void GSRendererSW::InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 
 	if (!m_rl->IsSynced())
 	{
-		pages.loopPagesWithBreak([&](u32 page)
-		{
-			if (m_fzb_pages[page] | m_tex_pages[page])
-			{
-				Sync(6);
+		bool waited = false;
 
-				return false;
-			}
-			return true;
+		pages.loopPages([&](u32 page)
+		{
+			waited |= WaitForPage(page, true);
 		});
+
+		if (waited)
+			g_perfmon.Put(GSPerfMon::SyncTransfer, 1);
 	}
 
-	m_tc->InvalidatePages(pages, off.psm()); // if texture update runs on a thread and Sync(5) happens then this must come later
+	m_tc->InvalidatePages(pages, off.psm()); // if texture update runs on a thread, this must come after the pages are free
 }
 
 void GSRendererSW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r, bool clut)
@@ -661,17 +783,50 @@ void GSRendererSW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 		GSOffset off = m_mem.GetOffset(BITBLTBUF.SBP, BITBLTBUF.SBW, BITBLTBUF.SPSM);
 		GSOffset::PageLooper pages = off.pageLooperForRect(r);
 
-		pages.loopPagesWithBreak([&](u32 page)
-		{
-			if (m_fzb_pages[page])
-			{
-				Sync(7);
+		bool waited = false;
 
-				return false;
-			}
-			return true;
+		pages.loopPages([&](u32 page)
+		{
+			waited |= WaitForPage(page, false);
 		});
+
+		if (waited)
+			g_perfmon.Put(GSPerfMon::SyncTransfer, 1);
+	}
+}
+
+bool GSRendererSW::WaitForPage(u32 page, bool tex)
+{
+	// The counters drop as the rasterizer threads let go of the draws, see SharedData::ReleasePages().
+	auto busy = [&]() {
+		return m_fzb_pages[page].load(std::memory_order_acquire) != 0 ||
+			   (tex && m_tex_pages[page].load(std::memory_order_acquire) != 0);
+	};
+
+	if (!busy())
+		return false;
+
+	while (busy())
+		ShortSpin();
+
+	return true;
+}
+
+void GSRendererSW::WaitForPages(GSPerfMon::counter_t cause)
+{
+	bool waited = false;
+
+	for (u32 row = 0; row < std::size(m_wait_pages); row++)
+	{
+		unsigned long bit;
+		for (u32 bits = m_wait_pages[row]; _BitScanForward(&bit, bits); bits &= bits - 1)
+			waited |= WaitForPage((row << 5) | static_cast<u32>(bit), true);
+
+		m_wait_pages[row] = 0;
 	}
+
+	if (waited)
+		g_perfmon.Put(cause, 1);
 }
 
 void GSRendererSW::UsePages(const GSOffset::PageLooper& pages, const int type)
@@ -766,8 +921,11 @@ bool GSRendererSW::CheckTargetPages(const GSOffset::PageLooper* fb_pages, const
 
 			m_fzb_cur_pages[row] |= col;
 
-			used |= m_fzb_pages[i];
-			used |= m_tex_pages[i];
+			if (m_fzb_pages[i] | m_tex_pages[i])
+			{
+				m_wait_pages[row] |= col;
+				used = 1;
+			}
 		});
 
 		zb_pages->loopPages([&](u32 i)
@@ -777,8 +935,11 @@ bool GSRendererSW::CheckTargetPages(const GSOffset::PageLooper* fb_pages, const
 
 			m_fzb_cur_pages[row] |= col;
 
-			used |= m_fzb_pages[i];
-			used |= m_tex_pages[i];
+			if (m_fzb_pages[i] | m_tex_pages[i])
+			{
+				m_wait_pages[row] |= col;
+				used = 1;
+			}
 		});
 
 		if (!synced)
@@ -824,7 +985,11 @@ bool GSRendererSW::CheckTargetPages(const GSOffset::PageLooper* fb_pages, const
 				{
 					m_fzb_cur_pages[row] |= col;
 
-					used |= m_fzb_pages[i];
+					if (m_fzb_pages[i])
+					{
+						m_wait_pages[row] |= col;
+						used = 1;
+					}
 				}
 			});
 
@@ -837,7 +1002,11 @@ bool GSRendererSW::CheckTargetPages(const GSOffset::PageLooper* fb_pages, const
 				{
 					m_fzb_cur_pages[row] |= col;
 
-					used |= m_fzb_pages[i];
+					if (m_fzb_pages[i])
+					{
+						m_wait_pages[row] |= col;
+						used = 1;
+					}
 				}
 			});
 
@@ -861,77 +1030,74 @@ bool GSRendererSW::CheckTargetPages(const GSOffset::PageLooper* fb_pages, const
 			// chross-check frame and z-buffer pages, they cannot overlap with eachother and with previous batches in queue,
 			// have to be careful when the two buffers are mutually enabled/disabled and alternating (Bully FBP/ZBP = 0x2300)
 
-			if (fb && !res)
+			if (fb)
 			{
-				fb_pages->loopPagesWithBreak([&](u32 page)
+				fb_pages->loopPages([&](u32 page)
 				{
 					if (m_fzb_pages[page] & 0xffff0000)
 					{
-						if (LOG)
+						if (LOG && !res)
 						{
 							fprintf(s_fp, "syncpoint 2\n");
 							fflush(s_fp);
 						}
 
+						m_wait_pages[page >> 5] |= 1 << (page & 31);
 						res = true;
-
-						return false;
 					}
-					return true;
 				});
 			}
 
-			if (zb && !res)
+			if (zb)
 			{
-				zb_pages->loopPagesWithBreak([&](u32 page)
+				zb_pages->loopPages([&](u32 page)
 				{
 					if (m_fzb_pages[page] & 0x0000ffff)
 					{
-						if (LOG)
+						if (LOG && !res)
 						{
 							fprintf(s_fp, "syncpoint 3\n");
 							fflush(s_fp);
 						}
 
+						m_wait_pages[page >> 5] |= 1 << (page & 31);
 						res = true;
-
-						return false;
 					}
-					return true;
 				});
 			}
 		}
 	}
 
+	if (!res)
+		memset(m_wait_pages, 0, sizeof(m_wait_pages));
+
 	return res;
 }
 
 bool GSRendererSW::CheckSourcePages(SharedData* sd)
 {
+	bool ret = false;
+
 	if (!m_rl->IsSynced())
 	{
 		for (size_t i = 0; sd->m_tex[i].t != NULL; i++)
 		{
 			GSOffset::PageLooper pages = sd->m_tex[i].t->m_offset.pageLooperForRect(sd->m_tex[i].r);
 
-			bool ret = false;
-			pages.loopPagesWithBreak([&](u32 pages)
+			pages.loopPages([&](u32 page)
 			{
 				// TODO: 8H 4HL 4HH texture at the same place as the render target (24 bit, or 32-bit where the alpha channel is masked, Valkyrie Profile 2)
 
-				if (m_fzb_pages[pages]) // currently being drawn to? => sync
+				if (m_fzb_pages[page]) // currently being drawn to? => wait for it
 				{
+					m_wait_pages[page >> 5] |= 1 << (page & 31);
 					ret = true;
-					return false;
 				}
-				return true;
 			});
-			if (ret)
-				return true;
 		}
 	}
 
-	return false;
+	return ret;
 }
 
 #include "GSTextureSW.h"
@@ -1423,7 +1589,6 @@ GSRendererSW::SharedData::SharedData()
 	: m_fpsm(0)
 	, m_zpsm(0)
 	, m_using_pages(false)
-	, m_syncpoint(SyncNone)
 {
 	m_tex[0].t = NULL;
 
@@ -1530,7 +1695,7 @@ void GSRendererSW::SharedData::UpdateSource()
 {
 	for (size_t i = 0; m_tex[i].t != NULL; i++)
 	{
-		if (m_tex[i].t->Update(m_tex[i].r))
+		if (m_tex[i].t->Update(m_tex[i].r, GSRendererSW::GetInstance()->m_rl.get()))
 		{
 			global.tex[i] = m_tex[i].t->m_buff;
 		}
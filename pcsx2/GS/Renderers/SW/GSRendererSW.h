@@ -18,6 +18,7 @@
 #include "GSTextureCacheSW.h"
 #include "GSDrawScanline.h"
 #include "GS/GSRingHeap.h"
+#include <unordered_set>
 
 class GSRendererSW final : public GSRenderer
 {
@@ -37,12 +38,6 @@ public:
 		int m_zpsm;
 		bool m_using_pages;
 		TextureLevel m_tex[7 + 1]; // NULL terminated
-		enum
-		{
-			SyncNone,
-			SyncSource,
-			SyncTarget
-		} m_syncpoint;
 
 	public:
 		SharedData();
@@ -56,6 +51,9 @@ public:
 	};
 
 protected:
+	// Draws with at least this many vertices (256KB converted) are converted with streaming stores.
+	static constexpr u32 STREAM_VERTEX_THRESHOLD = 4096;
+
 	std::unique_ptr<IRasterizer> m_rl;
 	std::unique_ptr<GSTextureCacheSW> m_tc;
 	GSRingHeap m_vertex_heap;
@@ -64,14 +62,24 @@ protected:
 	GSPixelOffset4* m_fzb;
 	GSVector4i m_fzb_bbox;
 	u32 m_fzb_cur_pages[16];
+	u32 m_wait_pages[16]; // conflicts found by CheckTargetPages()/CheckSourcePages()
 	std::atomic<u32> m_fzb_pages[512]; // u16 frame/zbuf pages interleaved
 	std::atomic<u16> m_tex_pages[512];
 
+	// Scanline selectors drawn with, persisted per CRC so the next boot can generate them up front.
+	std::unordered_set<u64> m_selector_manifest;
+	std::vector<u64> m_selector_manifest_pending;
+	u32 m_selector_manifest_crc = 0;
+
+	void LoadSelectorManifest(u32 crc);
+	void SaveSelectorManifest();
+
 	void Reset(bool hardware_reset) override;
-	void VSync(u32 field, bool registers_written) override;
+	void VSync(u32 field, bool registers_written, bool hidden) override;
 	GSTexture* GetOutput(int i, int& y_offset) override;
 	GSTexture* GetFeedbackOutput() override;
 
+	void SetGameCRC(u32 crc, int options) override;
 	void Draw() override;
 	void Queue(GSRingHeap::SharedPtr<GSRasterizerData>& item);
 	void Sync(int reason);
@@ -84,6 +92,11 @@ protected:
 	bool CheckTargetPages(const GSOffset::PageLooper* fb_pages, const GSOffset::PageLooper* zb_pages, const GSVector4i& r);
 	bool CheckSourcePages(SharedData* sd);
 
+	/// Waits until no queued draw references the page any more, the draws which don't touch it keep going.
+	/// Returns false if it was already free. tex also waits for draws sampling from it.
+	bool WaitForPage(u32 page, bool tex);
+	void WaitForPages(GSPerfMon::counter_t cause);
+
 	bool GetScanlineGlobalData(SharedData* data);
 
 public:
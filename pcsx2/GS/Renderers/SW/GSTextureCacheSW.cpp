@@ -207,7 +207,7 @@ void GSTextureCacheSW::Texture::Reset(u32 tw0, const GIFRegTEX0& TEX0, const GIF
 	}
 }
 
-bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
+bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect, IRasterizer* parallel)
 {
 	if (m_complete)
 	{
@@ -248,8 +248,6 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 
 	GSOffset off = m_offset;
 
-	u32 blocks = 0;
-
 	GSLocalMemory::readTextureBlock rtxbP = psm.rtxbP;
 
 	u32 pitch = (1 << m_tw) << shift;
@@ -264,6 +262,12 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 
 	GSOffset::BNHelper bn = off.bnMulti(r.left, r.top);
 
+	// The valid bits are updated here, and only the invalid blocks are collected, so the actual
+	// unswizzling can be split across threads without them sharing any state.
+	// Only ever used from the GS thread, so reusing the storage is fine.
+	static std::vector<std::pair<u32, u8*>> pending;
+	pending.clear();
+
 	if (m_repeating)
 	{
 		for (; bn.blkY() < bottom; bn.nextBlockY(), dst += block_pitch)
@@ -279,10 +283,7 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 				if ((m_valid[row] & col) == 0)
 				{
 					m_valid[row] |= col;
-
-					(mem.*rtxbP)(block, &dst[bn.blkX() << shift], pitch, m_TEXA);
-
-					blocks++;
+					pending.emplace_back(block, &dst[bn.blkX() << shift]);
 				}
 			}
 		}
@@ -301,15 +302,32 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 				if ((m_valid[row] & col) == 0)
 				{
 					m_valid[row] |= col;
-
-					(mem.*rtxbP)(block, &dst[bn.blkX() << shift], pitch, m_TEXA);
-
-					blocks++;
+					pending.emplace_back(block, &dst[bn.blkX() << shift]);
 				}
 			}
 		}
 	}
 
+	const u32 blocks = static_cast<u32>(pending.size());
+	const GIFRegTEXA TEXA = m_TEXA;
+
+	// One page worth of blocks per work item, anything smaller isn't worth waking the workers for.
+	constexpr u32 BLOCKS_PER_ITEM = 32;
+	constexpr u32 MIN_PARALLEL_BLOCKS = 8 * BLOCKS_PER_ITEM;
+	const std::function<void(int)> read_blocks = [&mem, rtxbP, pitch, &TEXA, blocks](int item) {
+		const u32 start = static_cast<u32>(item) * BLOCKS_PER_ITEM;
+		const u32 end = std::min(start + BLOCKS_PER_ITEM, blocks);
+		for (u32 i = start; i < end; i++)
+			(mem.*rtxbP)(pending[i].first, pending[i].second, pitch, TEXA);
+	};
+
+	const int items = static_cast<int>((blocks + BLOCKS_PER_ITEM - 1) / BLOCKS_PER_ITEM);
+	if (!parallel || blocks < MIN_PARALLEL_BLOCKS || !parallel->ParallelFor(items, read_blocks))
+	{
+		for (int i = 0; i < items; i++)
+			read_blocks(i);
+	}
+
 	if (blocks > 0)
 	{
 		g_perfmon.Put(GSPerfMon::Unswizzle, bs.x * bs.y * blocks << shift);
@@ -17,6 +17,7 @@
 
 #include "GS/Renderers/Common/GSRenderer.h"
 #include "GS/Renderers/Common/GSFastList.h"
+#include "GSRasterizer.h"
 #include <unordered_set>
 
 class GSTextureCacheSW
@@ -48,7 +49,8 @@ public:
 
 		void Reset(u32 tw0, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
 
-		bool Update(const GSVector4i& r);
+		/// Unswizzles the invalid blocks in r, splitting large updates across the rasterizer threads if given.
+		bool Update(const GSVector4i& r, IRasterizer* parallel = nullptr);
 		bool Save(const std::string& fn, bool dds = false) const;
 	};
 
@@ -248,9 +248,9 @@ struct alignas(32) GSVertexSW
 
 	typedef void (*ConvertVertexBufferPtr)(GSDrawingContext* RESTRICT ctx, GSVertexSW* RESTRICT dst, const GSVertex* RESTRICT src, size_t count);
 
-	static ConvertVertexBufferPtr s_cvb[4][2][2][2];
+	static ConvertVertexBufferPtr s_cvb[4][2][2][2][2];
 
-	template <u32 primclass, u32 tme, u32 fst, u32 q_div>
+	template <u32 primclass, u32 tme, u32 fst, u32 q_div, u32 stream>
 	static void ConvertVertexBuffer(GSDrawingContext* RESTRICT ctx, GSVertexSW* RESTRICT dst, const GSVertex* RESTRICT src, size_t count);
 
 	static const GSVector4 m_pos_scale;
@@ -21,6 +21,8 @@
 #include "common/Vulkan/Util.h"
 #include "common/Align.h"
 #include "common/ScopedGuard.h"
+#include "common/Threading.h"
+#include "common/Timer.h"
 #include "GS.h"
 #include "GSDeviceVK.h"
 #include "GS/GSGL.h"
@@ -129,6 +131,9 @@ bool GSDeviceVK::Create(HostDisplay* display)
 		return false;
 	}
 
+	if (GSConfig.AsyncPipelineCompilation)
+		StartPipelineCompileThread();
+
 	InitializeState();
 	return true;
 }
@@ -140,6 +145,8 @@ void GSDeviceVK::Destroy()
 
 	EndRenderPass();
 	ExecuteCommandBuffer(true);
+	StopPipelineCompileThread();
+	SavePipelineManifest("vulkan", sizeof(PipelineSelector));
 	DestroyResources();
 	GSDevice::Destroy();
 }
@@ -240,7 +247,7 @@ bool GSDeviceVK::CheckFeatures()
 	const bool isAMD = (vendorID == 0x1002 || vendorID == 0x1022);
 	// const bool isNVIDIA = (vendorID == 0x10DE);
 
-	m_features.framebuffer_fetch = g_vulkan_context->GetOptionalExtensions().vk_arm_rasterization_order_attachment_access && !GSConfig.DisableFramebufferFetch;
+	m_features.framebuffer_fetch = g_vulkan_context->GetOptionalExtensions().vk_ext_rasterization_order_attachment_access && !GSConfig.DisableFramebufferFetch;
 	m_features.texture_barrier = GSConfig.OverrideTextureBarriers != 0;
 	m_features.broken_point_sampler = isAMD;
 	m_features.geometry_shader = features.geometryShader && GSConfig.OverrideGeometryShaders != 0;
@@ -2141,15 +2148,138 @@ VkPipeline GSDeviceVK::CreateTFXPipeline(const PipelineSelector& p)
 
 VkPipeline GSDeviceVK::GetTFXPipeline(const PipelineSelector& p)
 {
-	const auto it = m_tfx_pipelines.find(p);
+	auto it = m_tfx_pipelines.find(p);
 	if (it != m_tfx_pipelines.end())
 		return it->second;
 
+	if (m_pipeline_compile_thread.joinable())
+	{
+		ProcessCompiledPipelines();
+		it = m_tfx_pipelines.find(p);
+		if (it != m_tfx_pipelines.end())
+			return it->second;
+
+		// Draw is skipped until the compile thread catches up.
+		QueuePipelineCompile(p, true);
+		return VK_NULL_HANDLE;
+	}
+
 	VkPipeline pipeline = CreateTFXPipeline(p);
 	m_tfx_pipelines.emplace(p, pipeline);
+	RecordPipeline(&p, sizeof(p));
 	return pipeline;
 }
 
+void GSDeviceVK::SetGameCRC(u32 crc)
+{
+	if (crc == m_pipeline_manifest_crc)
+		return;
+
+	SavePipelineManifest("vulkan", sizeof(PipelineSelector));
+	m_pipeline_manifest_crc = crc;
+
+	std::vector<u8> data;
+	if (crc == 0 || !LoadPipelineManifest("vulkan", crc, sizeof(PipelineSelector), &data))
+		return;
+
+	// Without the compile thread this runs on the GS thread, as the shader module caches aren't
+	// thread safe. It happens while the game is booting, where a pause is far less noticeable
+	// than a mid-game hitch.
+	Common::Timer timer;
+	u32 compiled = 0;
+	for (size_t pos = 0; pos < data.size(); pos += sizeof(PipelineSelector))
+	{
+		PipelineSelector p;
+		std::memcpy(&p, &data[pos], sizeof(p));
+		if (m_tfx_pipelines.find(p) != m_tfx_pipelines.end())
+			continue;
+
+		if (m_pipeline_compile_thread.joinable())
+			QueuePipelineCompile(p, false);
+		else
+			m_tfx_pipelines.emplace(p, CreateTFXPipeline(p));
+		compiled++;
+	}
+
+	DevCon.WriteLn("%s %u Vulkan pipelines for CRC %08X in %.2f ms", m_pipeline_compile_thread.joinable() ? "Queued" : "Precompiled",
+		compiled, crc, timer.GetTimeMilliseconds());
+}
+
+void GSDeviceVK::StartPipelineCompileThread()
+{
+	m_pipeline_compile_quit = false;
+	m_pipeline_compile_thread = std::thread(&GSDeviceVK::PipelineCompileThreadEntryPoint, this);
+}
+
+void GSDeviceVK::StopPipelineCompileThread()
+{
+	if (!m_pipeline_compile_thread.joinable())
+		return;
+
+	{
+		std::unique_lock lock(m_pipeline_compile_mutex);
+		m_pipeline_compile_quit = true;
+		m_pipeline_compile_queue.clear();
+		m_pipeline_compile_cv.notify_one();
+	}
+
+	m_pipeline_compile_thread.join();
+
+	// Take ownership of anything which finished, so it gets destroyed with the rest.
+	ProcessCompiledPipelines();
+	m_pipeline_compile_pending.clear();
+}
+
+void GSDeviceVK::PipelineCompileThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("GS Pipeline Compiler");
+
+	std::unique_lock lock(m_pipeline_compile_mutex);
+	for (;;)
+	{
+		m_pipeline_compile_cv.wait(lock, [this]() { return m_pipeline_compile_quit || !m_pipeline_compile_queue.empty(); });
+		if (m_pipeline_compile_quit)
+			break;
+
+		const PipelineCompileRequest req = m_pipeline_compile_queue.front();
+		m_pipeline_compile_queue.pop_front();
+		lock.unlock();
+
+		VkPipeline pipeline = CreateTFXPipeline(req.p);
+
+		lock.lock();
+		m_pipeline_compile_results.emplace_back(req, pipeline);
+		m_pipeline_compile_results_ready.store(true, std::memory_order_release);
+	}
+}
+
+void GSDeviceVK::QueuePipelineCompile(const PipelineSelector& p, bool record)
+{
+	if (!m_pipeline_compile_pending.insert(p).second)
+		return;
+
+	std::unique_lock lock(m_pipeline_compile_mutex);
+	m_pipeline_compile_queue.push_back({p, record});
+	m_pipeline_compile_cv.notify_one();
+}
+
+void GSDeviceVK::ProcessCompiledPipelines()
+{
+	if (!m_pipeline_compile_results_ready.load(std::memory_order_acquire))
+		return;
+
+	std::unique_lock lock(m_pipeline_compile_mutex);
+	for (const auto& [req, pipeline] : m_pipeline_compile_results)
+	{
+		m_pipeline_compile_pending.erase(req.p);
+		m_tfx_pipelines.emplace(req.p, pipeline);
+		if (req.record)
+			RecordPipeline(&req.p, sizeof(req.p));
+	}
+	m_pipeline_compile_results.clear();
+	m_pipeline_compile_results_ready.store(false, std::memory_order_relaxed);
+}
+
 bool GSDeviceVK::BindDrawPipeline(const PipelineSelector& p)
 {
 	VkPipeline pipeline = GetTFXPipeline(p);
@@ -2586,25 +2716,43 @@ bool GSDeviceVK::ApplyTFXState(bool already_execed)
 		dirty_descriptor_set_start = 0;
 	}
 
+	if ((flags & (DIRTY_FLAG_TFX_SAMPLERS_DS | DIRTY_FLAG_TFX_RT_TEXTURE_DS)) &&
+		m_tfx_ds_cache_fence_counter != g_vulkan_context->GetCurrentFenceCounter())
+	{
+		m_tfx_sampler_ds_cache.clear();
+		m_tfx_rt_texture_ds_cache.clear();
+		m_tfx_ds_cache_fence_counter = g_vulkan_context->GetCurrentFenceCounter();
+	}
+
 	if ((flags & DIRTY_FLAG_TFX_SAMPLERS_DS) || m_tfx_descriptor_sets[1] == VK_NULL_HANDLE)
 	{
-		VkDescriptorSet ds = g_vulkan_context->AllocateDescriptorSet(m_tfx_sampler_ds_layout);
-		if (ds == VK_NULL_HANDLE)
+		const TFXDescriptorSetKey key = {{m_tfx_textures[0], m_tfx_textures[1]}, {m_tfx_samplers[0], m_tfx_samplers[1]}};
+		VkDescriptorSet ds;
+		if (auto it = m_tfx_sampler_ds_cache.find(key); it != m_tfx_sampler_ds_cache.end())
 		{
-			if (already_execed)
+			ds = it->second;
+		}
+		else
+		{
+			ds = g_vulkan_context->AllocateDescriptorSet(m_tfx_sampler_ds_layout);
+			if (ds == VK_NULL_HANDLE)
 			{
-				Console.Error("Failed to allocate TFX texture descriptors");
-				return false;
+				if (already_execed)
+				{
+					Console.Error("Failed to allocate TFX texture descriptors");
+					return false;
+				}
+
+				ExecuteCommandBufferAndRestartRenderPass("Ran out of TFX texture descriptors");
+				return ApplyTFXState(true);
 			}
 
-			ExecuteCommandBufferAndRestartRenderPass("Ran out of TFX texture descriptors");
-			return ApplyTFXState(true);
+			dsub.AddCombinedImageSamplerDescriptorWrites(
+				ds, 0, m_tfx_textures.data(), m_tfx_samplers.data(), NUM_TFX_SAMPLERS);
+			dsub.Update(dev);
+			m_tfx_sampler_ds_cache.emplace(key, ds);
 		}
 
-		dsub.AddCombinedImageSamplerDescriptorWrites(
-			ds, 0, m_tfx_textures.data(), m_tfx_samplers.data(), NUM_TFX_SAMPLERS);
-		dsub.Update(dev);
-
 		m_tfx_descriptor_sets[1] = ds;
 		dirty_descriptor_set_start = std::min(dirty_descriptor_set_start, 1u);
 		dirty_descriptor_set_end = 1u;
@@ -2612,26 +2760,36 @@ bool GSDeviceVK::ApplyTFXState(bool already_execed)
 
 	if ((flags & DIRTY_FLAG_TFX_RT_TEXTURE_DS) || m_tfx_descriptor_sets[2] == VK_NULL_HANDLE)
 	{
-		VkDescriptorSet ds = g_vulkan_context->AllocateDescriptorSet(m_tfx_rt_texture_ds_layout);
-		if (ds == VK_NULL_HANDLE)
+		const TFXDescriptorSetKey key = {{m_tfx_textures[NUM_TFX_SAMPLERS], m_tfx_textures[NUM_TFX_SAMPLERS + 1]}, {}};
+		VkDescriptorSet ds;
+		if (auto it = m_tfx_rt_texture_ds_cache.find(key); it != m_tfx_rt_texture_ds_cache.end())
 		{
-			if (already_execed)
+			ds = it->second;
+		}
+		else
+		{
+			ds = g_vulkan_context->AllocateDescriptorSet(m_tfx_rt_texture_ds_layout);
+			if (ds == VK_NULL_HANDLE)
 			{
-				Console.Error("Failed to allocate TFX sampler descriptors");
-				return false;
+				if (already_execed)
+				{
+					Console.Error("Failed to allocate TFX sampler descriptors");
+					return false;
+				}
+
+				ExecuteCommandBufferAndRestartRenderPass("Ran out of TFX sampler descriptors");
+				return ApplyTFXState(true);
 			}
 
-			ExecuteCommandBufferAndRestartRenderPass("Ran out of TFX sampler descriptors");
-			return ApplyTFXState(true);
+			if (m_features.texture_barrier)
+				dsub.AddInputAttachmentDescriptorWrite(ds, 0, m_tfx_textures[NUM_TFX_SAMPLERS]);
+			else
+				dsub.AddImageDescriptorWrite(ds, 0, m_tfx_textures[NUM_TFX_SAMPLERS]);
+			dsub.AddImageDescriptorWrite(ds, 1, m_tfx_textures[NUM_TFX_SAMPLERS + 1]);
+			dsub.Update(dev);
+			m_tfx_rt_texture_ds_cache.emplace(key, ds);
 		}
 
-		if (m_features.texture_barrier)
-			dsub.AddInputAttachmentDescriptorWrite(ds, 0, m_tfx_textures[NUM_TFX_SAMPLERS]);
-		else
-			dsub.AddImageDescriptorWrite(ds, 0, m_tfx_textures[NUM_TFX_SAMPLERS]);
-		dsub.AddImageDescriptorWrite(ds, 1, m_tfx_textures[NUM_TFX_SAMPLERS + 1]);
-		dsub.Update(dev);
-
 		m_tfx_descriptor_sets[2] = ds;
 		dirty_descriptor_set_start = std::min(dirty_descriptor_set_start, 2u);
 		dirty_descriptor_set_end = 2u;
@@ -3018,8 +3176,10 @@ void GSDeviceVK::RenderHW(GSHWDrawConfig& config)
 		PSSetShaderResource(0, nullptr, false);
 	}
 
-	const bool render_area_okay =
-		(!hdr_rt && DATE_rp != DATE_RENDER_PASS_STENCIL_ONE && CheckRenderPassArea(render_area));
+	// DATE one only needs the stencil set to 1, which we can do with an attachment clear inside the current pass,
+	// rather than storing and reloading the attachments (expensive on tilers) just to use a clear load op.
+	const bool render_area_okay = (!hdr_rt && (DATE_rp != DATE_RENDER_PASS_STENCIL_ONE || m_features.stencil_buffer) &&
+								   CheckRenderPassArea(render_area));
 
 	// render pass restart optimizations
 	if (render_area_okay)
@@ -3075,6 +3235,17 @@ void GSDeviceVK::RenderHW(GSHWDrawConfig& config)
 			BeginRenderPass(rp, render_area);
 		}
 	}
+	else if (DATE_rp == DATE_RENDER_PASS_STENCIL_ONE)
+	{
+		VkClearAttachment ca;
+		ca.aspectMask = VK_IMAGE_ASPECT_STENCIL_BIT;
+		ca.colorAttachment = 0;
+		ca.clearValue.depthStencil = {0.0f, 1u};
+		const VkClearRect cr = {{{render_area.left, render_area.top},
+									{static_cast<u32>(render_area.width()), static_cast<u32>(render_area.height())}},
+			0u, 1u};
+		vkCmdClearAttachments(g_vulkan_context->GetCurrentCommandBuffer(), 1, &ca, 1, &cr);
+	}
 
 	// rt -> hdr blit if enabled
 	if (hdr_rt && config.rt->GetState() == GSTexture::State::Dirty)
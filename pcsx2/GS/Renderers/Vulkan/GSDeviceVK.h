@@ -22,7 +22,13 @@
 #include "common/HashCombine.h"
 #include "vk_mem_alloc.h"
 #include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 class GSDeviceVK final : public GSDevice
 {
@@ -68,6 +74,26 @@ public:
 		}
 	};
 
+	/// Contents of a TFX texture descriptor set, up to two views and samplers.
+	struct TFXDescriptorSetKey
+	{
+		VkImageView views[2];
+		VkSampler samplers[2];
+
+		__fi bool operator==(const TFXDescriptorSetKey& rhs) const { return (std::memcmp(this, &rhs, sizeof(*this)) == 0); }
+		__fi bool operator!=(const TFXDescriptorSetKey& rhs) const { return (std::memcmp(this, &rhs, sizeof(*this)) != 0); }
+	};
+
+	struct TFXDescriptorSetKeyHash
+	{
+		std::size_t operator()(const TFXDescriptorSetKey& e) const noexcept
+		{
+			std::size_t hash = 0;
+			HashCombine(hash, e.views[0], e.views[1], e.samplers[0], e.samplers[1]);
+			return hash;
+		}
+	};
+
 	enum : u32
 	{
 		NUM_TFX_DESCRIPTOR_SETS = 3,
@@ -132,6 +158,23 @@ private:
 	std::unordered_map<GSHWDrawConfig::PSSelector, VkShaderModule, GSHWDrawConfig::PSSelectorHash> m_tfx_fragment_shaders;
 	std::unordered_map<PipelineSelector, VkPipeline, PipelineSelectorHash> m_tfx_pipelines;
 
+	// Background TFX pipeline compilation, only running when GSConfig.AsyncPipelineCompilation is set.
+	// While it runs, the GS thread never creates TFX pipelines itself, so the shader caches stay
+	// single threaded. Pending is only touched by the GS thread, everything else is under the mutex.
+	struct PipelineCompileRequest
+	{
+		PipelineSelector p;
+		bool record;
+	};
+	std::thread m_pipeline_compile_thread;
+	std::mutex m_pipeline_compile_mutex;
+	std::condition_variable m_pipeline_compile_cv;
+	std::deque<PipelineCompileRequest> m_pipeline_compile_queue;
+	std::vector<std::pair<PipelineCompileRequest, VkPipeline>> m_pipeline_compile_results;
+	std::unordered_set<PipelineSelector, PipelineSelectorHash> m_pipeline_compile_pending;
+	std::atomic_bool m_pipeline_compile_results_ready{false};
+	bool m_pipeline_compile_quit = false;
+
 	VkRenderPass m_utility_color_render_pass_load = VK_NULL_HANDLE;
 	VkRenderPass m_utility_color_render_pass_clear = VK_NULL_HANDLE;
 	VkRenderPass m_utility_color_render_pass_discard = VK_NULL_HANDLE;
@@ -167,6 +210,12 @@ private:
 	VkPipeline CreateTFXPipeline(const PipelineSelector& p);
 	VkPipeline GetTFXPipeline(const PipelineSelector& p);
 
+	void StartPipelineCompileThread();
+	void StopPipelineCompileThread();
+	void PipelineCompileThreadEntryPoint();
+	void QueuePipelineCompile(const PipelineSelector& p, bool record);
+	void ProcessCompiledPipelines();
+
 	VkShaderModule GetUtilityVertexShader(const std::string& source, const char* replace_main);
 	VkShaderModule GetUtilityFragmentShader(const std::string& source, const char* replace_main);
 
@@ -204,6 +253,8 @@ public:
 	bool Create(HostDisplay* display) override;
 	void Destroy() override;
 
+	void SetGameCRC(u32 crc) override;
+
 	void ResetAPIState() override;
 	void RestoreAPIState() override;
 
@@ -365,6 +416,12 @@ private:
 	std::array<VkSampler, NUM_TFX_SAMPLERS> m_tfx_samplers{};
 	std::array<u32, NUM_TFX_SAMPLERS> m_tfx_sampler_sel{};
 	std::array<VkDescriptorSet, NUM_TFX_DESCRIPTOR_SETS> m_tfx_descriptor_sets{};
+
+	// Sets written in the current command buffer, so going back to a previous combination of textures doesn't
+	// allocate and write another one. They come from the per-frame pool, so are dropped when the fence moves on.
+	std::unordered_map<TFXDescriptorSetKey, VkDescriptorSet, TFXDescriptorSetKeyHash> m_tfx_sampler_ds_cache;
+	std::unordered_map<TFXDescriptorSetKey, VkDescriptorSet, TFXDescriptorSetKeyHash> m_tfx_rt_texture_ds_cache;
+	u64 m_tfx_ds_cache_fence_counter = 0;
 	std::array<u32, NUM_TFX_DYNAMIC_OFFSETS> m_tfx_dynamic_offsets{};
 
 	VkImageView m_utility_texture = VK_NULL_HANDLE;
@@ -15,6 +15,7 @@
 
 #include "PrecompiledHeader.h"
 
+#include <algorithm>
 #include <atomic>
 
 #include "fmt/core.h"
@@ -36,6 +37,7 @@
 #include "GS/GSLzma.h"
 #include "GS.h"
 #include "Host.h"
+#include "PerformanceMetrics.h"
 #include "R3000A.h"
 #include "R5900.h"
 #include "VMManager.h"
@@ -61,6 +63,15 @@ static bool s_needs_state_loaded = false;
 static u64 s_frame_ticks = 0;
 static u64 s_next_frame_time = 0;
 
+static u32 s_seek_frame = 0;
+static bool s_seek_pending = false;
+static bool s_seeking = false;
+
+static u32 s_benchmark_loops = 0;
+static u32 s_benchmark_loops_done = 0;
+static bool s_benchmark_started = false;
+static std::string s_benchmark_output;
+
 R5900cpu GSDumpReplayerCpu = {
 	GSDumpReplayerCpuReserve,
 	GSDumpReplayerCpuShutdown,
@@ -120,6 +131,29 @@ void GSDumpReplayer::Shutdown()
 	CpuVU0 = nullptr;
 	CpuVU1 = nullptr;
 	s_dump_file.reset();
+
+	s_benchmark_loops = 0;
+	s_benchmark_started = false;
+	std::string().swap(s_benchmark_output);
+}
+
+void GSDumpReplayer::SetBenchmark(u32 loops, std::string output_path)
+{
+	s_benchmark_loops = loops;
+	s_benchmark_loops_done = 0;
+	s_benchmark_started = false;
+	s_benchmark_output = std::move(output_path);
+}
+
+bool GSDumpReplayer::IsRunningBenchmark()
+{
+	return (s_benchmark_loops > 0);
+}
+
+void GSDumpReplayer::SeekToFrame(u32 frame)
+{
+	s_seek_frame = std::min(frame, s_dump_file->GetFrameCount());
+	s_seek_pending = true;
 }
 
 std::string GSDumpReplayer::GetDumpSerial()
@@ -161,6 +195,17 @@ void GSDumpReplayerCpuReset()
 	s_needs_state_loaded = true;
 	s_current_packet = 0;
 	s_dump_frame_number = 0;
+	s_seek_pending = false;
+	s_seeking = false;
+}
+
+static void GSDumpReplayerLoadState(const u8* data, size_t size)
+{
+	freezeData fd = {static_cast<int>(size), const_cast<u8*>(data)};
+	MTGS_FreezeData mfd = {&fd, 0};
+	GetMTGS().Freeze(FreezeAction::Load, mfd);
+	if (mfd.retval != 0)
+		Host::ReportFormattedErrorAsync("GSDumpReplayer", "Failed to load GS state.");
 }
 
 static void GSDumpReplayerLoadInitialState()
@@ -170,12 +215,42 @@ static void GSDumpReplayerLoadInitialState()
 		std::min(Ps2MemSize::GSregs, static_cast<u32>(s_dump_file->GetRegsData().size())));
 
 	// load GS state
-	freezeData fd = {static_cast<int>(s_dump_file->GetStateData().size()),
-		const_cast<u8*>(s_dump_file->GetStateData().data())};
-	MTGS_FreezeData mfd = {&fd, 0};
-	GetMTGS().Freeze(FreezeAction::Load, mfd);
-	if (mfd.retval != 0)
-		Host::ReportFormattedErrorAsync("GSDumpReplayer", "Failed to load GS state.");
+	GSDumpReplayerLoadState(s_dump_file->GetStateData().data(), s_dump_file->GetStateData().size());
+}
+
+static void GSDumpReplayerBeginSeek()
+{
+	s_seek_pending = false;
+
+	// Find the last keyframe at or before the target frame.
+	const GSDumpFile::KeyframeArray& keyframes = s_dump_file->GetKeyframes();
+	auto it = std::upper_bound(keyframes.begin(), keyframes.end(), s_seek_frame,
+		[](u32 frame, const GSDumpFile::Keyframe& kf) { return frame < kf.frame; });
+	const GSDumpFile::Keyframe* keyframe = (it != keyframes.begin()) ? &*(it - 1) : nullptr;
+	const u32 restart_frame = keyframe ? keyframe->frame : 0;
+
+	// Carry on from where we are if that's closer than any restart point.
+	if (s_dump_frame_number > s_seek_frame || s_dump_frame_number < restart_frame)
+	{
+		if (keyframe)
+		{
+			// The keyframe packet is followed by the registers that go with it, which the next step loads.
+			const GSDumpFile::GSData& packet = s_dump_file->GetPackets()[keyframe->packet];
+			GSDumpReplayerLoadState(packet.data, packet.length);
+			s_needs_state_loaded = false;
+			s_current_packet = keyframe->packet + 1;
+			s_dump_frame_number = keyframe->frame;
+		}
+		else
+		{
+			s_needs_state_loaded = true;
+			s_current_packet = 0;
+			s_dump_frame_number = 0;
+		}
+	}
+
+	s_seeking = (s_dump_frame_number < s_seek_frame);
+	Console.WriteLn("(GSDumpReplayer) Seeking to frame %u from frame %u.", s_seek_frame, s_dump_frame_number);
 }
 
 static void GSDumpReplayerSendPacketToMTGS(GIF_PATH path, const u8* data, u32 length)
@@ -192,6 +267,29 @@ static void GSDumpReplayerSendPacketToMTGS(GIF_PATH path, const u8* data, u32 le
 	Gif_AddCompletedGSPacket(gsPack, path);
 }
 
+static void GSDumpReplayerStartBenchmark()
+{
+	s_benchmark_started = true;
+	Console.WriteLn("(GSDumpReplayer) Benchmarking %u loop(s) of %u packets.", s_benchmark_loops,
+		static_cast<u32>(s_dump_file->GetPackets().size()));
+
+	GetMTGS().RunOnGSThread([output = s_benchmark_output]() {
+		if (!output.empty())
+			PerformanceMetrics::StartFrameTrace(output);
+	});
+}
+
+static void GSDumpReplayerFinishBenchmark()
+{
+	Console.WriteLn("(GSDumpReplayer) Benchmark finished after %u loop(s).", s_benchmark_loops_done);
+
+	// Close the trace after the last frame is presented, rather than when the GS shuts down.
+	GetMTGS().RunOnGSThread([]() { PerformanceMetrics::StopFrameTrace(); });
+	s_benchmark_loops = 0;
+	s_dump_running = false;
+	Host::RequestVMShutdown(false, false);
+}
+
 static void GSDumpReplayerUpdateFrameLimit()
 {
 	constexpr u32 default_frame_limit = 60;
@@ -221,6 +319,9 @@ static void GSDumpReplayerFrameLimit()
 
 void GSDumpReplayerCpuStep()
 {
+	if (s_seek_pending)
+		GSDumpReplayerBeginSeek();
+
 	if (s_needs_state_loaded)
 	{
 		GSDumpReplayerLoadInitialState();
@@ -230,7 +331,11 @@ void GSDumpReplayerCpuStep()
 	const GSDumpFile::GSData& packet = s_dump_file->GetPackets()[s_current_packet];
 	s_current_packet = (s_current_packet + 1) % static_cast<u32>(s_dump_file->GetPackets().size());
 	if (s_current_packet == 0)
+	{
 		s_dump_frame_number = 0;
+		if (s_benchmark_loops > 0 && ++s_benchmark_loops_done == s_benchmark_loops)
+			GSDumpReplayerFinishBenchmark();
+	}
 
 	switch (packet.id)
 	{
@@ -267,7 +372,10 @@ void GSDumpReplayerCpuStep()
 			s_dump_frame_number++;
 			GSDumpReplayerCpuCheckExecutionState();
 			GSDumpReplayerUpdateFrameLimit();
-			GSDumpReplayerFrameLimit();
+			if (s_seeking)
+				s_seeking = (s_dump_frame_number < s_seek_frame);
+			else
+				GSDumpReplayerFrameLimit();
 			GetMTGS().PostVsyncStart(false);
 			VMManager::Internal::VSyncOnCPUThread();
 		}
@@ -288,6 +396,10 @@ void GSDumpReplayerCpuStep()
 			std::memcpy(PS2MEM_GS, packet.data, std::min<s32>(packet.length, Ps2MemSize::GSregs));
 		}
 		break;
+
+		case GSDumpTypes::GSType::Keyframe:
+			// Only used as a restart point when seeking, the state already matches when playing through.
+			break;
 	}
 }
 
@@ -296,6 +408,9 @@ void GSDumpReplayerCpuExecute()
 	s_dump_running = true;
 	s_next_frame_time = GetCPUTicks();
 
+	if (s_benchmark_loops > 0 && !s_benchmark_started)
+		GSDumpReplayerStartBenchmark();
+
 	while (s_dump_running)
 	{
 		GSDumpReplayerCpuStep();
@@ -352,7 +467,11 @@ void GSDumpReplayer::RenderUI()
 		position_y += text_size.y + spacing; \
 	} while (0)
 
-	fmt::format_to(std::back_inserter(text), "Dump Frame: {}", s_dump_frame_number);
+	if (s_dump_file->GetKeyframes().empty())
+		fmt::format_to(std::back_inserter(text), "Dump Frame: {}/{}", s_dump_frame_number, s_dump_file->GetFrameCount());
+	else
+		fmt::format_to(std::back_inserter(text), "Dump Frame: {}/{} ({} keyframes)", s_dump_frame_number,
+			s_dump_file->GetFrameCount(), s_dump_file->GetKeyframes().size());
 	DRAW_LINE(font, text.c_str(), IM_COL32(255, 255, 255, 255));
 
 	text.clear();
@@ -30,5 +30,14 @@ void Shutdown();
 std::string GetDumpSerial();
 u32 GetDumpCRC();
 
+/// Replays the dump the given number of times without frame limiting, writing a per-frame timing
+/// trace to output_path (JSON when it ends in .json, otherwise CSV), then shuts the VM down.
+void SetBenchmark(u32 loops, std::string output_path);
+bool IsRunningBenchmark();
+
+/// Jumps to the start of the given frame. Restarts from the nearest keyframe when the dump has them,
+/// then plays the remaining frames unthrottled. Call on the CPU thread.
+void SeekToFrame(u32 frame);
+
 void RenderUI();
 }
\ No newline at end of file
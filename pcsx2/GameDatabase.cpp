@@ -696,6 +696,10 @@ void GameDatabase::initDatabase()
 		ryml::Tree tree = ryml::parse_in_arena(c4::to_csubstr(buf.value()));
 		ryml::NodeRef root = tree.rootref();
 
+		// the tree has its own copy of the source in its arena, no need to keep both around while inserting
+		buf.reset();
+		s_game_db.reserve(root.num_children());
+
 		for (const ryml::NodeRef& n : root.children())
 		{
 			auto serial = StringUtil::toLower(std::string(n.key().str, n.key().len));
@@ -736,12 +740,12 @@ const GameDatabaseSchema::GameEntry* GameDatabase::findGame(const std::string_vi
 {
 	GameDatabase::ensureLoaded();
 
+	// this is called for every entry when populating the game list, so keep the successful path quiet
 	std::string serialLower = StringUtil::toLower(serial);
-	Console.WriteLn(fmt::format("[GameDB] Searching for '{}' in GameDB", serialLower));
 	const auto gameEntry = s_game_db.find(serialLower);
 	if (gameEntry != s_game_db.end())
 	{
-		Console.WriteLn(fmt::format("[GameDB] Found '{}' in GameDB", serialLower));
+		DevCon.WriteLn("[GameDB] Found '%s' in GameDB", serialLower.c_str());
 		return &gameEntry->second;
 	}
 
@@ -15,6 +15,7 @@
 
 #pragma once
 #include <deque>
+#include <thread>
 #include "Gif.h"
 #include "Vif.h"
 #include "GS.h"
@@ -480,8 +481,9 @@ struct Gif_Path
 		// Performance note: fetch_add atomic operation might create some stall for atomic
 		// operation in gsPack.push
 		readAmount.fetch_add(gsPack.size + gsPack.readAmount, std::memory_order_acq_rel);
+		// Queue is full when the MTGS is far behind, let it run instead of burning the core it may need
 		while (!mtvu.gsPackQueue.push(gsPack))
-			;
+			std::this_thread::yield();
 
 		gsPack.Reset();
 		gsPack.offset = curOffset;
@@ -644,37 +644,42 @@ static void ipuSETTH(u32 val)
 // --------------------------------------------------------------------------------------
 //  CORE Functions (referenced from MPEG library)
 // --------------------------------------------------------------------------------------
-__fi void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
+// Per pixel "R, G and B are all below thresh" mask, for a 9 bit threshold.
+static __fi __m128i ipu_csc_below(__m128i rgba, u16 thresh)
 {
-	int i;
-	u8* p = (u8*)&rgb32;
+	if (thresh == 0)
+		return _mm_setzero_si128();
+
+	const __m128i limit = _mm_set1_epi8(static_cast<s8>(std::min<u16>(thresh, 256) - 1));
+	const __m128i below = _mm_cmpeq_epi8(_mm_max_epu8(rgba, limit), limit);
+	return _mm_cmpeq_epi32(_mm_or_si128(below, _mm_set1_epi32(0xFF000000)), _mm_set1_epi32(-1));
+}
 
+__fi void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
+{
 	yuv2rgb();
 
-	if (s_thresh[0] > 0)
-	{
-		for (i = 0; i < 16*16; i++, p += 4)
-		{
-			if ((p[0] < s_thresh[0]) && (p[1] < s_thresh[0]) && (p[2] < s_thresh[0]))
-				*(u32*)p = 0;
-			else if ((p[0] < s_thresh[1]) && (p[1] < s_thresh[1]) && (p[2] < s_thresh[1]))
-				p[3] = 0x40;
-		}
-	}
-	else if (s_thresh[1] > 0)
-	{
-		for (i = 0; i < 16*16; i++, p += 4)
-		{
-			if ((p[0] < s_thresh[1]) && (p[1] < s_thresh[1]) && (p[2] < s_thresh[1]))
-				p[3] = 0x40;
-		}
-	}
-	if (sgn)
+	if (s_thresh[0] == 0 && s_thresh[1] == 0 && !sgn)
+		return;
+
+	// Pixels below the second threshold get an alpha of 0x40, pixels below the first one become
+	// transparent black; both tests look at the unsigned colour, before the sign flip.
+	const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+	const __m128i alpha_40 = _mm_set1_epi32(0x40000000);
+	const __m128i sign = _mm_set1_epi32(sgn ? 0x808080 : 0);
+
+	__m128i* p = reinterpret_cast<__m128i*>(&rgb32);
+	for (int i = 0; i < 16 * 16 / 4; i++)
 	{
-		for (i = 0; i < 16*16; i++, p += 4)
-		{
-			*(u32*)p ^= 0x808080;
-		}
+		__m128i rgba = _mm_load_si128(&p[i]);
+		const __m128i transparent = ipu_csc_below(rgba, s_thresh[0]);
+		const __m128i translucent = ipu_csc_below(rgba, s_thresh[1]);
+
+		rgba = _mm_blendv_epi8(rgba, _mm_or_si128(_mm_and_si128(rgba, rgb_mask), alpha_40), translucent);
+		rgba = _mm_andnot_si128(transparent, rgba);
+		rgba = _mm_xor_si128(rgba, sign);
+
+		_mm_store_si128(&p[i], rgba);
 	}
 }
 
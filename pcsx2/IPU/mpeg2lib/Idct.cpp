@@ -45,9 +45,6 @@
  * to +-3826 - this is the worst case for a column IDCT where the
  * column inputs are 16-bit values.
  */
-alignas(16) static u8 clip_lut[1024];
-
-#define CLIP(i) ((clip_lut+384)[(i)])
 
 static __fi void BUTTERFLY(int& t0, int& t1, int w0, int w1, int d0, int d1)
 {
@@ -114,72 +111,97 @@ static __fi void idct_row (s16 * const block)
     block[7] = (a0 - b0) >> 8;
 }
 
-static __fi void idct_col (s16 * const block)
+// Column pass, four columns per call in 32-bit lanes. The arithmetic is identical to the
+// scalar mpeg2dec column IDCT, including the truncation back to 16 bits.
+static __fi __m128i idct_col_load(const s16* block, int row)
 {
-    int d0, d1, d2, d3;
-    int a0, a1, a2, a3, b0, b1, b2, b3;
-    int t0, t1, t2, t3;
+	return _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(block + 8 * row)));
+}
 
-    d0 = (block[8*0] << 11) + 65536;
-    d1 = block[8*1];
-    d2 = block[8*2] << 11;
-    d3 = block[8*3];
-    t0 = d0 + d2;
-    t1 = d0 - d2;
-    BUTTERFLY (t2, t3, W6, W2, d3, d1);
-    a0 = t0 + t2;
-    a1 = t1 + t3;
-    a2 = t1 - t3;
-    a3 = t0 - t2;
+static __fi void idct_col_store(s16* block, int row, __m128i value, int shift)
+{
+	value = _mm_srai_epi32(value, shift);
+	value = _mm_srai_epi32(_mm_slli_epi32(value, 16), 16);
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(block + 8 * row), _mm_packs_epi32(value, value));
+}
 
-    d0 = block[8*4];
-    d1 = block[8*5];
-    d2 = block[8*6];
-    d3 = block[8*7];
-    BUTTERFLY (t0, t1, W7, W1, d3, d0);
-    BUTTERFLY (t2, t3, W3, W5, d1, d2);
-    b0 = t0 + t2;
-    b3 = t1 + t3;
-    t0 = (t0 - t2) >> 8;
-    t1 = (t1 - t3) >> 8;
-    b1 = (t0 + t1) * 181;
-    b2 = (t0 - t1) * 181;
-
-    block[8*0] = (a0 + b0) >> 17;
-    block[8*1] = (a1 + b1) >> 17;
-    block[8*2] = (a2 + b2) >> 17;
-    block[8*3] = (a3 + b3) >> 17;
-    block[8*4] = (a3 - b3) >> 17;
-    block[8*5] = (a2 - b2) >> 17;
-    block[8*6] = (a1 - b1) >> 17;
-    block[8*7] = (a0 - b0) >> 17;
+static __fi __m128i idct_mul(__m128i value, int w)
+{
+	return _mm_mullo_epi32(value, _mm_set1_epi32(w));
 }
 
-__ri void mpeg2_idct_copy(s16 * block, u8 * dest, const int stride)
+static __fi void BUTTERFLY4(__m128i& t0, __m128i& t1, int w0, int w1, __m128i d0, __m128i d1)
+{
+	const __m128i tmp = idct_mul(_mm_add_epi32(d0, d1), w0);
+	t0 = _mm_add_epi32(tmp, idct_mul(d1, w1 - w0));
+	t1 = _mm_sub_epi32(tmp, idct_mul(d0, w1 + w0));
+}
+
+static __fi void idct_col4 (s16 * const block)
 {
-    int i;
+	__m128i d0, d1, d2, d3;
+	__m128i a0, a1, a2, a3, b0, b1, b2, b3;
+	__m128i t0, t1, t2, t3;
+
+	d0 = _mm_add_epi32(_mm_slli_epi32(idct_col_load(block, 0), 11), _mm_set1_epi32(65536));
+	d1 = idct_col_load(block, 1);
+	d2 = _mm_slli_epi32(idct_col_load(block, 2), 11);
+	d3 = idct_col_load(block, 3);
+	t0 = _mm_add_epi32(d0, d2);
+	t1 = _mm_sub_epi32(d0, d2);
+	BUTTERFLY4 (t2, t3, W6, W2, d3, d1);
+	a0 = _mm_add_epi32(t0, t2);
+	a1 = _mm_add_epi32(t1, t3);
+	a2 = _mm_sub_epi32(t1, t3);
+	a3 = _mm_sub_epi32(t0, t2);
+
+	d0 = idct_col_load(block, 4);
+	d1 = idct_col_load(block, 5);
+	d2 = idct_col_load(block, 6);
+	d3 = idct_col_load(block, 7);
+	BUTTERFLY4 (t0, t1, W7, W1, d3, d0);
+	BUTTERFLY4 (t2, t3, W3, W5, d1, d2);
+	b0 = _mm_add_epi32(t0, t2);
+	b3 = _mm_add_epi32(t1, t3);
+	t0 = _mm_srai_epi32(_mm_sub_epi32(t0, t2), 8);
+	t1 = _mm_srai_epi32(_mm_sub_epi32(t1, t3), 8);
+	b1 = idct_mul(_mm_add_epi32(t0, t1), 181);
+	b2 = idct_mul(_mm_sub_epi32(t0, t1), 181);
+
+	idct_col_store(block, 0, _mm_add_epi32(a0, b0), 17);
+	idct_col_store(block, 1, _mm_add_epi32(a1, b1), 17);
+	idct_col_store(block, 2, _mm_add_epi32(a2, b2), 17);
+	idct_col_store(block, 3, _mm_add_epi32(a3, b3), 17);
+	idct_col_store(block, 4, _mm_sub_epi32(a3, b3), 17);
+	idct_col_store(block, 5, _mm_sub_epi32(a2, b2), 17);
+	idct_col_store(block, 6, _mm_sub_epi32(a1, b1), 17);
+	idct_col_store(block, 7, _mm_sub_epi32(a0, b0), 17);
+}
 
-    for (i = 0; i < 8; i++)
+static __fi void idct (s16 * const block)
+{
+	for (int i = 0; i < 8; i++)
 		idct_row (block + 8 * i);
-    for (i = 0; i < 8; i++)
-		idct_col (block + i);
-
-	__m128 zero = _mm_setzero_ps();
-    do {
-		dest[0] = CLIP (block[0]);
-		dest[1] = CLIP (block[1]);
-		dest[2] = CLIP (block[2]);
-		dest[3] = CLIP (block[3]);
-		dest[4] = CLIP (block[4]);
-		dest[5] = CLIP (block[5]);
-		dest[6] = CLIP (block[6]);
-		dest[7] = CLIP (block[7]);
-
-		_mm_store_ps((float*)block, zero);
+
+	idct_col4 (block);
+	idct_col4 (block + 4);
+}
+
+__ri void mpeg2_idct_copy(s16 * block, u8 * dest, const int stride)
+{
+	idct (block);
+
+	// packus saturates to 0..255, which is the clamp the output needs.
+	const __m128i zero = _mm_setzero_si128();
+	for (int i = 0; i < 8; i++)
+	{
+		const __m128i row = _mm_load_si128(reinterpret_cast<const __m128i*>(block));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(dest), _mm_packus_epi16(row, row));
+		_mm_store_si128(reinterpret_cast<__m128i*>(block), zero);
 
 		dest += stride;
 		block += 8;
-    } while (--i);
+	}
 }
 
 
@@ -190,11 +212,8 @@ __ri void mpeg2_idct_add (const int last, s16 * block, s16 * dest, const int str
 
     if (last != 129 || (block[0] & 7) == 4)
     {
-		int i;
-		for (i = 0; i < 8; i++)
-			idct_row (block + 8 * i);
-		for (i = 0; i < 8; i++)
-			idct_col (block + i);
+		int i = 8;
+		idct (block);
 
 		__m128 zero = _mm_setzero_ps();
 		do {
@@ -237,9 +256,6 @@ mpeg2_scan_pack::mpeg2_scan_pack()
 		53, 61, 22, 30,  7, 15, 23, 31, 38, 46, 54, 62, 39, 47, 55, 63
 	};
 
-	for (int i = -384; i < 640; i++)
-		clip_lut[i+384] = (i < 0) ? 0 : ((i > 255) ? 255 : i);
-
 	for (int i = 0; i < 64; i++) {
 		int j = mpeg2_scan_norm[i];
 		norm[i] = ((j & 0x36) >> 1) | ((j & 0x09) << 2);
@@ -27,6 +27,7 @@ FlatFileReader::FlatFileReader(bool shareWrite)
 	m_blocksize = 2048;
 	m_fd = -1;
 	m_aio_context = 0;
+	m_aio_pending = 0;
 }
 
 FlatFileReader::~FlatFileReader(void)
@@ -55,27 +56,54 @@ int FlatFileReader::ReadSync(void* pBuffer, uint sector, uint count)
 
 void FlatFileReader::BeginRead(void* pBuffer, uint sector, uint count)
 {
-	u64 offset;
-	offset = sector * (s64)m_blocksize + m_dataoffset;
+	const uint segment_blocks = GetSegmentBlocks(count);
 
-	u32 bytesToRead = count * m_blocksize;
+	struct iocb cbs[MaxSegments];
+	struct iocb* iocbs[MaxSegments];
+	int nr = 0;
 
-	struct iocb iocb;
-	struct iocb* iocbs = &iocb;
+	for (uint done = 0; done < count; done += segment_blocks, nr++)
+	{
+		const uint blocks = std::min(segment_blocks, count - done);
+		const u64 offset = (sector + done) * (s64)m_blocksize + m_dataoffset;
 
-	io_prep_pread(&iocb, m_fd, pBuffer, bytesToRead, offset);
-	io_submit(m_aio_context, 1, &iocbs);
+		io_prep_pread(&cbs[nr], m_fd, static_cast<u8*>(pBuffer) + done * m_blocksize, blocks * m_blocksize, offset);
+		iocbs[nr] = &cbs[nr];
+	}
+
+	// A negative count is the submission error, reported by FinishRead.
+	m_aio_pending = (nr > 0) ? io_submit(m_aio_context, nr, iocbs) : 0;
 }
 
 int FlatFileReader::FinishRead(void)
 {
-	struct io_event event;
-
-	int nevents = io_getevents(m_aio_context, 1, 1, &event, NULL);
-	if (nevents < 1)
-		return -1;
-
-	return event.res;
+	const int pending = m_aio_pending;
+	m_aio_pending = 0;
+	if (pending <= 0)
+		return pending;
+
+	struct io_event events[MaxSegments];
+	int nevents = 0;
+	while (nevents < pending)
+	{
+		const int ret = io_getevents(m_aio_context, pending - nevents, pending - nevents, &events[nevents], NULL);
+		if (ret < 1)
+			return -1;
+		nevents += ret;
+	}
+
+	// Segments complete in any order, but a short read can only come from the end of the file,
+	// so the sum is still the number of contiguous bytes read.
+	int bytes = 0;
+	for (int i = 0; i < nevents; i++)
+	{
+		const long res = static_cast<long>(events[i].res);
+		if (res < 0)
+			return -1;
+		bytes += static_cast<int>(res);
+	}
+
+	return bytes;
 }
 
 void FlatFileReader::CancelRead(void)
@@ -96,6 +124,7 @@ void FlatFileReader::Close(void)
 
 	m_fd = -1;
 	m_aio_context = 0;
+	m_aio_pending = 0;
 }
 
 uint FlatFileReader::GetBlockCount(void) const
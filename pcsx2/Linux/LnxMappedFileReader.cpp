@@ -0,0 +1,161 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "AsyncFileReader.h"
+#include "common/FileSystem.h"
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+MappedFileReader::MappedFileReader()
+{
+	m_blocksize = 2048;
+	m_fd = -1;
+	m_data = nullptr;
+	m_size = 0;
+	m_async_buffer = nullptr;
+	m_async_sector = 0;
+	m_async_count = 0;
+}
+
+MappedFileReader::~MappedFileReader(void)
+{
+	Close();
+}
+
+bool MappedFileReader::Open(std::string fileName)
+{
+	Close();
+	m_filename = std::move(fileName);
+
+	m_fd = FileSystem::OpenFDFile(m_filename.c_str(), O_RDONLY, 0);
+	if (m_fd == -1)
+		return false;
+
+	struct stat sysStatData;
+	if (fstat(m_fd, &sysStatData) < 0 || sysStatData.st_size <= 0)
+	{
+		Close();
+		return false;
+	}
+
+	void* data = mmap(nullptr, static_cast<size_t>(sysStatData.st_size), PROT_READ, MAP_SHARED, m_fd, 0);
+	if (data == MAP_FAILED)
+	{
+		Close();
+		return false;
+	}
+
+	m_data = static_cast<u8*>(data);
+	m_size = sysStatData.st_size;
+	return true;
+}
+
+void MappedFileReader::Prefetch(s64 offset, s64 length)
+{
+	// Start the readahead now, so the page faults on the copy in FinishRead don't stall on the disk.
+	const s64 page_size = static_cast<s64>(__pagesize);
+	const s64 start = std::max<s64>(offset, 0) & ~(page_size - 1);
+	const s64 end = std::min(offset + length, m_size);
+	if (end > start)
+		madvise(m_data + start, static_cast<size_t>(end - start), MADV_WILLNEED);
+}
+
+int MappedFileReader::CopyBlocks(void* pBuffer, uint sector, uint count)
+{
+	const s64 offset = sector * static_cast<s64>(m_blocksize) + m_dataoffset;
+	const s64 length = count * static_cast<s64>(m_blocksize);
+	if (offset >= m_size)
+		return 0;
+
+	// Images detected with a negative data offset start before the file, that part reads as zeros.
+	u8* dst = static_cast<u8*>(pBuffer);
+	s64 src = offset;
+	s64 copy = std::min(length, m_size - offset);
+	if (src < 0)
+	{
+		const s64 zeros = std::min(-src, length);
+		std::memset(dst, 0, static_cast<size_t>(zeros));
+		dst += zeros;
+		copy -= zeros;
+		src = 0;
+	}
+
+	if (copy > 0)
+		std::memcpy(dst, m_data + src, static_cast<size_t>(copy));
+
+	return static_cast<int>(std::min(length, m_size - offset));
+}
+
+int MappedFileReader::ReadSync(void* pBuffer, uint sector, uint count)
+{
+	return CopyBlocks(pBuffer, sector, count);
+}
+
+void MappedFileReader::BeginRead(void* pBuffer, uint sector, uint count)
+{
+	m_async_buffer = pBuffer;
+	m_async_sector = sector;
+	m_async_count = count;
+	Prefetch(sector * static_cast<s64>(m_blocksize) + m_dataoffset, count * static_cast<s64>(m_blocksize));
+}
+
+int MappedFileReader::FinishRead(void)
+{
+	if (!m_async_buffer)
+		return -1;
+
+	const int ret = CopyBlocks(m_async_buffer, m_async_sector, m_async_count);
+	m_async_buffer = nullptr;
+	return ret;
+}
+
+void MappedFileReader::CancelRead(void)
+{
+	m_async_buffer = nullptr;
+}
+
+const u8* MappedFileReader::GetBlockPointer(uint sector, uint count)
+{
+	const s64 offset = sector * static_cast<s64>(m_blocksize) + m_dataoffset;
+	const s64 length = count * static_cast<s64>(m_blocksize);
+	if (!m_data || offset < 0 || offset + length > m_size)
+		return nullptr;
+
+	Prefetch(offset, length);
+	return m_data + offset;
+}
+
+void MappedFileReader::Close(void)
+{
+	if (m_data)
+		munmap(m_data, static_cast<size_t>(m_size));
+
+	if (m_fd != -1)
+		close(m_fd);
+
+	m_fd = -1;
+	m_data = nullptr;
+	m_size = 0;
+	m_async_buffer = nullptr;
+}
+
+uint MappedFileReader::GetBlockCount(void) const
+{
+	return static_cast<uint>(m_size / m_blocksize);
+}
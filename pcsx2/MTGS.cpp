@@ -20,11 +20,13 @@
 
 #include "common/ScopedGuard.h"
 #include "common/StringUtil.h"
+#include "common/Timer.h"
 
 #include "GS.h"
 #include "Gif_Unit.h"
 #include "MTVU.h"
 #include "Elfheader.h"
+#include "PerformanceMetrics.h"
 
 #include "Host.h"
 #include "HostDisplay.h"
@@ -69,6 +71,10 @@ SysMtgsThread::SysMtgsThread()
 	m_packet_size = 0;
 	m_packet_writepos = 0;
 
+	m_pending_gspacket_offset = 0;
+	m_pending_gspacket_size = 0;
+	m_pending_gspacket_path = GIF_PATH_1;
+
 	m_QueuedFrameCount = 0;
 	m_VsyncSignalListener = false;
 	m_SignalRingEnable = false;
@@ -175,6 +181,7 @@ void SysMtgsThread::ResetGS(bool hardware_reset)
 	//  * Signal a reset.
 	//  * clear the path and byRegs structs (used by GIFtagDummy)
 
+	m_pending_gspacket_size = 0;
 	m_ReadPos = m_WritePos.load();
 	m_QueuedFrameCount = 0;
 	m_VsyncSignalListener = 0;
@@ -193,7 +200,9 @@ struct RingCmdPacket_Vsync
 
 	// must be 16 byte aligned
 	u32 registers_written;
-	u32 pad[3];
+	u32 pad;
+	u64 queued_ticks; // GetCPUTicks() when the EE finished the frame
+
 };
 
 void SysMtgsThread::PostVsyncStart(bool registers_written)
@@ -212,6 +221,8 @@ void SysMtgsThread::PostVsyncStart(bool registers_written)
 	remainder[1] = GSIMR._u32;
 	(GSRegSIGBLID&)remainder[2] = GSSIGLBLID;
 	remainder[4] = static_cast<u32>(registers_written);
+	remainder[5] = static_cast<u32>(m_frames_hidden);
+	*reinterpret_cast<u64*>(&remainder[6]) = GetCPUTicks();
 	m_packet_writepos = (m_packet_writepos + 2) & RingBufferMask;
 
 	SendDataPacket();
@@ -237,7 +248,10 @@ void SysMtgsThread::PostVsyncStart(bool registers_written)
 	m_VsyncSignalListener.store(true, std::memory_order_release);
 	//Console.WriteLn( Color_Blue, "(EEcore Sleep) Vsync\t\tringpos=0x%06x, writepos=0x%06x", m_ReadPos.load(), m_WritePos.load() );
 
+	const Common::Timer::Value start = Common::Timer::GetCurrentValue();
 	m_sem_Vsync.Wait();
+	m_VsyncWaitNs.fetch_add(static_cast<u64>(Common::Timer::ConvertValueToNanoseconds(Common::Timer::GetCurrentValue() - start)),
+		std::memory_order_relaxed);
 }
 
 void SysMtgsThread::InitAndReadFIFO(u8* mem, u32 qwc)
@@ -248,8 +262,15 @@ void SysMtgsThread::InitAndReadFIFO(u8* mem, u32 qwc)
 		return;
 	}
 
+	m_ReadbackCount.fetch_add(1, std::memory_order_relaxed);
+	if (m_QueuedFrameCount.load(std::memory_order_relaxed) > 0)
+		m_ReadbackDrainCount.fetch_add(1, std::memory_order_relaxed);
+
+	const Common::Timer::Value start = Common::Timer::GetCurrentValue();
 	SendPointerPacket(GS_RINGTYPE_INIT_AND_READ_FIFO, qwc, mem);
 	WaitGS(false, false, false);
+	m_ReadbackWaitNs.fetch_add(static_cast<u64>(Common::Timer::ConvertValueToNanoseconds(Common::Timer::GetCurrentValue() - start)),
+		std::memory_order_relaxed);
 }
 
 union PacketTagType
@@ -296,8 +317,11 @@ void SysMtgsThread::MainLoop()
 		// is very optimized (only 1 instruction test in most cases), so no point in trying
 		// to avoid it.
 
+		// Spin for a little while before sleeping. Under heavy GIF traffic the EE usually has the
+		// next batch ready within a few microseconds, and catching it while spinning saves both
+		// threads a trip through the kernel semaphore.
 		mtvu_lock.unlock();
-		m_sem_event.WaitForWork();
+		m_sem_event.WaitForWorkWithSpin();
 		mtvu_lock.lock();
 
 		if (!m_open_flag.load(std::memory_order_acquire))
@@ -425,7 +449,7 @@ void SysMtgsThread::MainLoop()
 					{
 						mtvu_lock.unlock();
 						// Wait for MTVU to complete vu1 program
-						vu1Thread.semaXGkick.Wait();
+						vu1Thread.WaitXGkick();
 						mtvu_lock.lock();
 					}
 					Gif_Path& path = gifUnit.gifPath[GIF_PATH_1];
@@ -460,8 +484,10 @@ void SysMtgsThread::MainLoop()
 							((u32&)RingBuffer.Regs[0x1010]) = remainder[1];
 							((GSRegSIGBLID&)RingBuffer.Regs[0x1080]) = (GSRegSIGBLID&)remainder[2];
 
+							PerformanceMetrics::OnFrameQueued(*reinterpret_cast<const u64*>(&remainder[6]));
+
 							// CSR & 0x2000; is the pageflip id.
-							GSvsync((((u32&)RingBuffer.Regs[0x1000]) & 0x2000) ? 0 : 1, remainder[4] != 0);
+							GSvsync((((u32&)RingBuffer.Regs[0x1000]) & 0x2000) ? 0 : 1, remainder[4] != 0, remainder[5] != 0);
 
 							m_QueuedFrameCount.fetch_sub(1);
 							if (m_VsyncSignalListener.exchange(false))
@@ -592,6 +618,11 @@ void SysMtgsThread::WaitGS(bool syncRegs, bool weakWait, bool isMTVU)
 
 	Gif_Path& path = gifUnit.gifPath[GIF_PATH_1];
 
+	// The MTVU thread never produces ring packets, and only waits on PATH1 data
+	// that is already in the ring.
+	if (!isMTVU)
+		FlushPendingGSPacket();
+
 	// Both m_ReadPos and m_WritePos can be relaxed as we only want to test if the queue is empty but
 	// we don't want to access the content of the queue
 
@@ -619,7 +650,7 @@ void SysMtgsThread::WaitGS(bool syncRegs, bool weakWait, bool isMTVU)
 	}
 	else
 	{
-		if (!m_sem_event.WaitForEmpty())
+		if (!m_sem_event.WaitForEmptyWithSpin())
 			pxFailRel("MTGS Thread Died");
 	}
 
@@ -666,7 +697,7 @@ void SysMtgsThread::SendDataPacket()
 	else
 	{
 		m_CopyDataTally += m_packet_size;
-		if (m_CopyDataTally > 0x2000)
+		if (m_CopyDataTally > RingBufferWakeThreshold)
 			SetEvent();
 	}
 
@@ -766,6 +797,8 @@ void SysMtgsThread::GenericStall(uint size)
 
 void SysMtgsThread::PrepDataPacket(MTGS_RingCommand cmd, u32 size)
 {
+	FlushPendingGSPacket();
+
 	m_packet_size = size;
 	++size; // takes into account our RingCommand QWC.
 	GenericStall(size);
@@ -805,7 +838,7 @@ __fi void SysMtgsThread::_FinishSimplePacket()
 		++m_CopyDataTally;
 }
 
-void SysMtgsThread::SendSimplePacket(MTGS_RingCommand type, int data0, int data1, int data2)
+void SysMtgsThread::_SendSimplePacket(MTGS_RingCommand type, int data0, int data1, int data2)
 {
 	//ScopedLock locker( m_PacketLocker );
 
@@ -820,14 +853,60 @@ void SysMtgsThread::SendSimplePacket(MTGS_RingCommand type, int data0, int data1
 	_FinishSimplePacket();
 }
 
+void SysMtgsThread::SendSimplePacket(MTGS_RingCommand type, int data0, int data1, int data2)
+{
+	FlushPendingGSPacket();
+	_SendSimplePacket(type, data0, data1, data2);
+}
+
+void SysMtgsThread::FlushPendingGSPacket()
+{
+	if (!m_pending_gspacket_size)
+		return;
+
+	const u32 size = m_pending_gspacket_size;
+	m_pending_gspacket_size = 0;
+	_SendSimplePacket(GS_RINGTYPE_GSPACKET, (int)m_pending_gspacket_offset, (int)size, (int)m_pending_gspacket_path);
+
+	if (!EmuConfig.GS.SynchronousMTGS)
+	{
+		m_CopyDataTally += size / 16;
+		if (m_CopyDataTally > RingBufferWakeThreshold)
+			SetEvent();
+	}
+}
+
 void SysMtgsThread::SendSimpleGSPacket(MTGS_RingCommand type, u32 offset, u32 size, GIF_PATH path)
 {
+	// Packets of the same path that continue where the pending one ends are read by
+	// the GS thread as one transfer: they are complete (EOP) GIF packets, so parsing
+	// them back to back is the same as parsing them one by one.
+	if (type == GS_RINGTYPE_GSPACKET && offset != ~0u && !EmuConfig.GS.SynchronousMTGS)
+	{
+		if (m_pending_gspacket_size && m_pending_gspacket_path == path &&
+			m_pending_gspacket_offset + m_pending_gspacket_size == offset)
+		{
+			m_pending_gspacket_size += size;
+		}
+		else
+		{
+			FlushPendingGSPacket();
+			m_pending_gspacket_offset = offset;
+			m_pending_gspacket_size = size;
+			m_pending_gspacket_path = path;
+		}
+
+		if (m_pending_gspacket_size >= GSPacketMergeLimit)
+			FlushPendingGSPacket();
+		return;
+	}
+
 	SendSimplePacket(type, (int)offset, (int)size, (int)path);
 
 	if (!EmuConfig.GS.SynchronousMTGS)
 	{
 		m_CopyDataTally += size / 16;
-		if (m_CopyDataTally > 0x2000)
+		if (m_CopyDataTally > RingBufferWakeThreshold)
 			SetEvent();
 	}
 }
@@ -836,6 +915,8 @@ void SysMtgsThread::SendPointerPacket(MTGS_RingCommand type, u32 data0, void* da
 {
 	//ScopedLock locker( m_PacketLocker );
 
+	FlushPendingGSPacket();
+
 	GenericStall(1);
 	PacketTagType& tag = (PacketTagType&)RingBuffer[m_WritePos.load(std::memory_order_relaxed)];
 
@@ -851,19 +932,32 @@ void SysMtgsThread::SendGameCRC(u32 crc)
 	SendSimplePacket(GS_RINGTYPE_CRC, crc, 0, 0);
 }
 
-bool SysMtgsThread::WaitForOpen()
+void SysMtgsThread::BeginOpen()
 {
-	if (IsOpen())
-		return true;
+	if (m_open_pending || IsOpen())
+		return;
 
 	StartThread();
 
 	// request open, and kick the thread.
 	m_open_flag.store(true, std::memory_order_release);
 	m_sem_event.NotifyOfWork();
+	m_open_pending = true;
+}
+
+bool SysMtgsThread::WaitForOpen()
+{
+	if (!m_open_pending)
+	{
+		if (IsOpen())
+			return true;
+
+		BeginOpen();
+	}
 
 	// wait for it to finish its stuff
 	m_open_or_close_done.Wait();
+	m_open_pending = false;
 
 	// did we succeed?
 	const bool result = m_open_flag.load(std::memory_order_acquire);
@@ -880,6 +974,10 @@ bool SysMtgsThread::WaitForOpen()
 
 void SysMtgsThread::WaitForClose()
 {
+	// an open still in progress has to finish before it can be undone
+	if (m_open_pending)
+		WaitForOpen();
+
 	if (!IsOpen())
 		return;
 
@@ -991,14 +1089,15 @@ void SysMtgsThread::ToggleSoftwareRendering()
 	SetSoftwareRendering(GSConfig.Renderer != GSRendererType::SW);
 }
 
-bool SysMtgsThread::SaveMemorySnapshot(u32 width, u32 height, std::vector<u32>* pixels)
+std::future<bool> SysMtgsThread::SaveMemorySnapshot(u32 width, u32 height, std::vector<u32>* pixels)
 {
-	bool result = false;
-	RunOnGSThread([width, height, pixels, &result]() {
-		result = GSSaveSnapshotToMemory(width, height, pixels);
+	// RunOnGSThread() needs a copyable functor, hence the shared promise.
+	std::shared_ptr<std::promise<bool>> promise = std::make_shared<std::promise<bool>>();
+	std::future<bool> future = promise->get_future();
+	RunOnGSThread([width, height, pixels, promise]() {
+		promise->set_value(GSSaveSnapshotToMemory(width, height, pixels));
 	});
-	WaitGS(false, false, false);
-	return result;
+	return future;
 }
 
 void SysMtgsThread::PresentCurrentFrame()
@@ -19,6 +19,7 @@
 #include "newVif.h"
 #include "Gif_Unit.h"
 #include "common/Threading.h"
+#include "common/Timer.h"
 #include <thread>
 
 VU_Thread vu1Thread;
@@ -88,6 +89,24 @@ void SaveStateBase::mtvuFreeze()
 	Freeze(vu1Thread.vuCycleIdx);
 }
 
+// Waits shorter than this are cheaper to spin through than to sleep and be woken from.
+static constexpr u64 MTVU_SPIN_THRESHOLD_NS = 50000;
+
+static u64 UpdateWaitAverage(u64 avg, u64 ns)
+{
+	return (avg * 7 + ns) / 8;
+}
+
+void VU_Thread::WaitStats::Add(u64 ns)
+{
+	u32 bucket = 0;
+	for (u64 limit = 10000; bucket < WAIT_HISTOGRAM_BUCKETS - 1 && ns >= limit; limit *= 10)
+		bucket++;
+
+	total_ns.fetch_add(ns, std::memory_order_relaxed);
+	histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
 VU_Thread::VU_Thread()
 {
 	Reset();
@@ -103,6 +122,7 @@ void VU_Thread::Open()
 	if (m_thread.Joinable())
 		return;
 
+	ResizeBuffer();
 	Reset();
 	semaEvent.Reset();
 	m_shutdown_flag.store(false, std::memory_order_release);
@@ -119,8 +139,24 @@ void VU_Thread::Close()
 	m_thread.Join();
 }
 
+void VU_Thread::ResizeBuffer()
+{
+	// Only safe while the ring is empty, i.e. on open or reset.
+	const s32 size = (_1mb * std::clamp<s32>(EmuConfig.Speedhacks.vuThreadRingSize, 4, 64)) / sizeof(s32);
+	if (size == buffer_size)
+		return;
+
+	DevCon.WriteLn("MTVU: Using a %d MB ring buffer", (size * sizeof(s32)) / _1mb);
+	buffer = std::make_unique<u32[]>(size);
+	buffer_size = size;
+}
+
 void VU_Thread::Reset()
 {
+	// The constructor runs before the config is loaded, the buffer is created on Open().
+	if (m_thread.Joinable())
+		ResizeBuffer();
+
 	vuCycleIdx = 0;
 	m_ato_write_pos = 0;
 	m_write_pos = 0;
@@ -139,7 +175,7 @@ void VU_Thread::ExecuteRingBuffer()
 
 	for (;;)
 	{
-		semaEvent.WaitForWork();
+		WaitForWork();
 		if (m_shutdown_flag.load(std::memory_order_acquire))
 			break;
 
@@ -215,10 +251,25 @@ void VU_Thread::ExecuteRingBuffer()
 	semaEvent.Kill();
 }
 
+void VU_Thread::WaitForWork()
+{
+	const Common::Timer::Value start = Common::Timer::GetCurrentValue();
+
+	if (EmuConfig.Speedhacks.vuThreadSpin && m_vu_idle_avg_ns < MTVU_SPIN_THRESHOLD_NS)
+		semaEvent.WaitForWorkWithSpin();
+	else
+		semaEvent.WaitForWork();
+
+	const u64 ns = static_cast<u64>(Common::Timer::ConvertValueToNanoseconds(Common::Timer::GetCurrentValue() - start));
+	m_vu_idle_avg_ns = UpdateWaitAverage(m_vu_idle_avg_ns, ns);
+	vuIdleStats.Add(ns);
+}
+
 
 // Should only be called by ReserveSpace()
 __ri void VU_Thread::WaitOnSize(s32 size)
 {
+	Common::Timer::Value start = 0;
 	for (;;)
 	{
 		s32 readPos = GetReadPos();
@@ -232,6 +283,8 @@ __ri void VU_Thread::WaitOnSize(s32 size)
 		if (readPos > m_write_pos + size + _4kb)
 			break; // Enough free front space
 		{          // Let MTVU run to free up buffer space
+			if (start == 0)
+				start = Common::Timer::GetCurrentValue();
 			KickStart();
 			// Locking might trigger a full flush of the ring buffer. Yield
 			// will be more aggressive, and only flush the minimal size.
@@ -240,6 +293,9 @@ __ri void VU_Thread::WaitOnSize(s32 size)
 			std::this_thread::yield();
 		}
 	}
+
+	if (start != 0)
+		eeWaitStats.Add(static_cast<u64>(Common::Timer::ConvertValueToNanoseconds(Common::Timer::GetCurrentValue() - start)));
 }
 
 // Makes sure theres enough room in the ring buffer
@@ -440,10 +496,46 @@ bool VU_Thread::IsDone()
 	return GetReadPos() == GetWritePos();
 }
 
+void VU_Thread::WaitXGkick()
+{
+	const Common::Timer::Value start = Common::Timer::GetCurrentValue();
+
+	// Most VU1 programs finish within a few microseconds of the GS reaching their packet,
+	// so spin for a bit before putting the GS thread to sleep.
+	bool done = false;
+	if (EmuConfig.Speedhacks.vuThreadSpin && m_xgkick_wait_avg_ns < MTVU_SPIN_THRESHOLD_NS)
+	{
+		const Common::Timer::Value spin_end = start + Common::Timer::ConvertNanosecondsToValue(MTVU_SPIN_THRESHOLD_NS);
+		while (!(done = semaXGkick.TryWait()) && Common::Timer::GetCurrentValue() < spin_end)
+			Threading::SpinWait();
+	}
+	if (!done)
+		semaXGkick.Wait();
+
+	const u64 ns = static_cast<u64>(Common::Timer::ConvertValueToNanoseconds(Common::Timer::GetCurrentValue() - start));
+	m_xgkick_wait_avg_ns = UpdateWaitAverage(m_xgkick_wait_avg_ns, ns);
+}
+
 void VU_Thread::WaitVU()
 {
 	MTVU_LOG("MTVU - WaitVU!");
-	semaEvent.WaitForEmpty();
+	if (IsDone())
+	{
+		// Nothing left to run, this only waits for the thread to go back to sleep.
+		semaEvent.WaitForEmpty();
+		return;
+	}
+
+	const Common::Timer::Value start = Common::Timer::GetCurrentValue();
+
+	if (EmuConfig.Speedhacks.vuThreadSpin && m_ee_wait_avg_ns < MTVU_SPIN_THRESHOLD_NS)
+		semaEvent.WaitForEmptyWithSpin();
+	else
+		semaEvent.WaitForEmpty();
+
+	const u64 ns = static_cast<u64>(Common::Timer::ConvertValueToNanoseconds(Common::Timer::GetCurrentValue() - start));
+	m_ee_wait_avg_ns = UpdateWaitAverage(m_ee_wait_avg_ns, ns);
+	eeWaitStats.Add(ns);
 }
 
 void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop, u32 fbrst)
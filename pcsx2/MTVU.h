@@ -19,6 +19,7 @@
 #include "Vif_Dma.h"
 #include "VUmicro.h"
 
+#include <memory>
 #include <thread>
 
 #define MTVU_LOG(...) do{} while(0)
@@ -26,12 +27,10 @@
 
 // Notes:
 // - This class should only be accessed from the EE thread...
-// - buffer_size must be power of 2
 // - ring-buffer has no complete pending packets when read_pos==write_pos
 class VU_Thread final {
-	static const s32 buffer_size = (_1mb * 16) / sizeof(s32);
-
-	u32 buffer[buffer_size];
+	std::unique_ptr<u32[]> buffer;
+	s32 buffer_size = 0; // in u32s, sized from EmuConfig.Speedhacks.vuThreadRingSize
 	// Note: keep atomic on separate cache line to avoid CPU conflict
 	alignas(64) std::atomic<int> m_ato_read_pos; // Only modified by VU thread
 	alignas(64) std::atomic<int> m_ato_write_pos;    // Only modified by EE thread
@@ -40,6 +39,11 @@ class VU_Thread final {
 	Threading::WorkSema semaEvent;
 	std::atomic_bool m_shutdown_flag{false};
 
+	// Running averages of recent wait lengths, used to decide whether spinning is worth it.
+	u64 m_ee_wait_avg_ns = 0; // EE thread only
+	u64 m_vu_idle_avg_ns = 0; // VU thread only
+	u64 m_xgkick_wait_avg_ns = 0; // MTGS thread only
+
 	Threading::Thread m_thread;
 
 public:
@@ -62,6 +66,21 @@ public:
 	std::atomic<u64> gsLabel; // Used for GS Label command
 	std::atomic<u64> gsSignal; // Used for GS Signal command
 
+	// Histogram buckets are <10us, <100us, <1ms, <10ms and everything longer.
+	static constexpr u32 WAIT_HISTOGRAM_BUCKETS = 5;
+	struct WaitStats
+	{
+		std::atomic<u64> total_ns{0};
+		std::atomic<u32> histogram[WAIT_HISTOGRAM_BUCKETS] = {};
+
+		void Add(u64 ns);
+	};
+
+	// Time the EE spends blocked on the VU thread, and time the VU thread sits without work.
+	// Accumulated until PerformanceMetrics collects and resets them.
+	WaitStats eeWaitStats;
+	WaitStats vuIdleStats;
+
 	VU_Thread();
 	~VU_Thread();
 
@@ -84,6 +103,9 @@ public:
 	// Waits till MTVU is done processing
 	void WaitVU();
 
+	// Called by the MTGS thread: waits for the VU1 program behind the next PATH1 packet to finish
+	void WaitXGkick();
+
 	void Get_MTVUChanges();
 
 	void ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop, u32 fbrst);
@@ -107,6 +129,9 @@ public:
 private:
 	void ExecuteRingBuffer();
 
+	void ResizeBuffer();
+	void WaitForWork();
+
 	void WaitOnSize(s32 size);
 	void ReserveSpace(s32 size);
 
@@ -58,115 +58,103 @@ static void idct1(int *block)
 		block[i]=val;
 }
 
+// One 1-D pass of the AAN IDCT, over four columns (or rows, once transposed) at a time.
+// The scalar code this replaced skipped the butterfly when all AC coefficients were zero,
+// but that gives the same result as running it, so there's no need to branch per lane.
+static __fi __m128i idct_mul(__m128i value, int constant)
+{
+	return _mm_srai_epi32(_mm_mullo_epi32(value, _mm_set1_epi32(constant)), CONST_BITS);
+}
+
+static __fi void idct_pass(__m128i* v)
+{
+	__m128i z10 = _mm_add_epi32(v[0], v[4]);
+	__m128i z11 = _mm_sub_epi32(v[0], v[4]);
+	__m128i z13 = _mm_add_epi32(v[2], v[6]);
+	__m128i z12 = _mm_sub_epi32(idct_mul(_mm_sub_epi32(v[2], v[6]), FIX_1_414213562), z13);
+
+	const __m128i tmp0 = _mm_add_epi32(z10, z13);
+	const __m128i tmp3 = _mm_sub_epi32(z10, z13);
+	const __m128i tmp1 = _mm_add_epi32(z11, z12);
+	const __m128i tmp2 = _mm_sub_epi32(z11, z12);
+
+	z13 = _mm_add_epi32(v[3], v[5]);
+	z10 = _mm_sub_epi32(v[3], v[5]);
+	z11 = _mm_add_epi32(v[1], v[7]);
+	z12 = _mm_sub_epi32(v[1], v[7]);
+
+	const __m128i z5 = idct_mul(_mm_sub_epi32(z12, z10), FIX_1_847759065);
+	const __m128i tmp7 = _mm_add_epi32(z11, z13);
+	const __m128i tmp6 = _mm_sub_epi32(_mm_add_epi32(idct_mul(z10, FIX_2_613125930), z5), tmp7);
+	const __m128i tmp5 = _mm_sub_epi32(idct_mul(_mm_sub_epi32(z11, z13), FIX_1_414213562), tmp6);
+	const __m128i tmp4 = _mm_add_epi32(_mm_sub_epi32(idct_mul(z12, FIX_1_082392200), z5), tmp5);
+
+	v[0] = _mm_add_epi32(tmp0, tmp7);
+	v[7] = _mm_sub_epi32(tmp0, tmp7);
+	v[1] = _mm_add_epi32(tmp1, tmp6);
+	v[6] = _mm_sub_epi32(tmp1, tmp6);
+	v[2] = _mm_add_epi32(tmp2, tmp5);
+	v[5] = _mm_sub_epi32(tmp2, tmp5);
+	v[4] = _mm_add_epi32(tmp3, tmp4);
+	v[3] = _mm_sub_epi32(tmp3, tmp4);
+}
+
+static __fi void idct_transpose(__m128i* v)
+{
+	const __m128i t0 = _mm_unpacklo_epi32(v[0], v[1]);
+	const __m128i t1 = _mm_unpacklo_epi32(v[2], v[3]);
+	const __m128i t2 = _mm_unpackhi_epi32(v[0], v[1]);
+	const __m128i t3 = _mm_unpackhi_epi32(v[2], v[3]);
+	v[0] = _mm_unpacklo_epi64(t0, t1);
+	v[1] = _mm_unpackhi_epi64(t0, t1);
+	v[2] = _mm_unpacklo_epi64(t2, t3);
+	v[3] = _mm_unpackhi_epi64(t2, t3);
+}
+
 void idct(int *block,int k)
 {
-  int tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;
-  int z5, z10, z11, z12, z13;
-  int *ptr;
-  int i;
-
-  if (!k) { idct1(block); return; }
-
-  ptr = block;
-  for (i = 0; i< DCTSIZE; i++,ptr++) {
-
-    if ((ptr[DCTSIZE*1] | ptr[DCTSIZE*2] | ptr[DCTSIZE*3] |
-	 ptr[DCTSIZE*4] | ptr[DCTSIZE*5] | ptr[DCTSIZE*6] |
-	 ptr[DCTSIZE*7]) == 0) {
-      ptr[DCTSIZE*0] =
-      ptr[DCTSIZE*1] =
-      ptr[DCTSIZE*2] =
-      ptr[DCTSIZE*3] =
-      ptr[DCTSIZE*4] =
-      ptr[DCTSIZE*5] =
-      ptr[DCTSIZE*6] =
-      ptr[DCTSIZE*7] =
-      	ptr[DCTSIZE*0];
-
-      continue;
-    }
-
-    z10 = ptr[DCTSIZE*0] + ptr[DCTSIZE*4];
-    z11 = ptr[DCTSIZE*0] - ptr[DCTSIZE*4];
-    z13 = ptr[DCTSIZE*2] + ptr[DCTSIZE*6];
-    z12 = MULTIPLY(ptr[DCTSIZE*2] - ptr[DCTSIZE*6], FIX_1_414213562) - z13;
-
-    tmp0 = z10 + z13;
-    tmp3 = z10 - z13;
-    tmp1 = z11 + z12;
-    tmp2 = z11 - z12;
-
-    z13 = ptr[DCTSIZE*3] + ptr[DCTSIZE*5];
-    z10 = ptr[DCTSIZE*3] - ptr[DCTSIZE*5];
-    z11 = ptr[DCTSIZE*1] + ptr[DCTSIZE*7];
-    z12 = ptr[DCTSIZE*1] - ptr[DCTSIZE*7];
-
-    z5 = MULTIPLY(z12 - z10, FIX_1_847759065);
-    tmp7 = z11 + z13;
-    tmp6 = MULTIPLY(z10, FIX_2_613125930) + z5 - tmp7;
-    tmp5 = MULTIPLY(z11 - z13, FIX_1_414213562) - tmp6;
-    tmp4 = MULTIPLY(z12, FIX_1_082392200) - z5 + tmp5;
-
-    ptr[DCTSIZE*0] = (tmp0 + tmp7);
-    ptr[DCTSIZE*7] = (tmp0 - tmp7);
-    ptr[DCTSIZE*1] = (tmp1 + tmp6);
-    ptr[DCTSIZE*6] = (tmp1 - tmp6);
-    ptr[DCTSIZE*2] = (tmp2 + tmp5);
-    ptr[DCTSIZE*5] = (tmp2 - tmp5);
-    ptr[DCTSIZE*4] = (tmp3 + tmp4);
-    ptr[DCTSIZE*3] = (tmp3 - tmp4);
-
-  }
-
-  ptr = block;
-  for (i = 0; i < DCTSIZE; i++ ,ptr+=DCTSIZE) {
-
-    if ((ptr[1] | ptr[2] | ptr[3] | ptr[4] | ptr[5] | ptr[6] |
-	 ptr[7]) == 0) {
-      ptr[0] =
-      ptr[1] =
-      ptr[2] =
-      ptr[3] =
-      ptr[4] =
-      ptr[5] =
-      ptr[6] =
-      ptr[7] =
-      	RANGE(DESCALE(ptr[0], PASS1_BITS+3));;
-
-      continue;
-    }
-
-    z10 = ptr[0] + ptr[4];
-    z11 = ptr[0] - ptr[4];
-    z13 = ptr[2] + ptr[6];
-    z12 = MULTIPLY(ptr[2] - ptr[6], FIX_1_414213562) - z13;
-
-    tmp0 = z10 + z13;
-    tmp3 = z10 - z13;
-    tmp1 = z11 + z12;
-    tmp2 = z11 - z12;
-
-    z13 = ptr[3] + ptr[5];
-    z10 = ptr[3] - ptr[5];
-    z11 = ptr[1] + ptr[7];
-    z12 = ptr[1] - ptr[7];
-
-    z5 = MULTIPLY(z12 - z10, FIX_1_847759065);
-    tmp7 = z11 + z13;
-    tmp6 = MULTIPLY(z10, FIX_2_613125930) + z5 - tmp7;
-    tmp5 = MULTIPLY(z11 - z13, FIX_1_414213562) - tmp6;
-    tmp4 = MULTIPLY(z12, FIX_1_082392200) - z5 + tmp5;
-
-    ptr[0] = RANGE(DESCALE(tmp0 + tmp7, PASS1_BITS+3));;
-    ptr[7] = RANGE(DESCALE(tmp0 - tmp7, PASS1_BITS+3));;
-    ptr[1] = RANGE(DESCALE(tmp1 + tmp6, PASS1_BITS+3));;
-    ptr[6] = RANGE(DESCALE(tmp1 - tmp6, PASS1_BITS+3));;
-    ptr[2] = RANGE(DESCALE(tmp2 + tmp5, PASS1_BITS+3));;
-    ptr[5] = RANGE(DESCALE(tmp2 - tmp5, PASS1_BITS+3));;
-    ptr[4] = RANGE(DESCALE(tmp3 + tmp4, PASS1_BITS+3));;
-    ptr[3] = RANGE(DESCALE(tmp3 - tmp4, PASS1_BITS+3));;
-
-  }
+	if (!k) { idct1(block); return; }
+
+	// columns, left and right halves of the block
+	for (int half = 0; half < 2; half++)
+	{
+		__m128i v[DCTSIZE];
+		for (int row = 0; row < DCTSIZE; row++)
+			v[row] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&block[row * DCTSIZE + half * 4]));
+
+		idct_pass(v);
+
+		for (int row = 0; row < DCTSIZE; row++)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&block[row * DCTSIZE + half * 4]), v[row]);
+	}
+
+	// rows, top and bottom halves, transposing each 4x4 quadrant so lanes hold rows
+	for (int half = 0; half < 2; half++)
+	{
+		int* const ptr = &block[half * 4 * DCTSIZE];
+
+		__m128i v[DCTSIZE];
+		for (int i = 0; i < 4; i++)
+		{
+			v[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&ptr[i * DCTSIZE]));
+			v[i + 4] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&ptr[i * DCTSIZE + 4]));
+		}
+		idct_transpose(&v[0]);
+		idct_transpose(&v[4]);
+
+		idct_pass(v);
+
+		for (int i = 0; i < DCTSIZE; i++)
+			v[i] = _mm_srai_epi32(v[i], PASS1_BITS + 3);
+		idct_transpose(&v[0]);
+		idct_transpose(&v[4]);
+
+		for (int i = 0; i < 4; i++)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&ptr[i * DCTSIZE]), v[i]);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&ptr[i * DCTSIZE + 4]), v[i + 4]);
+		}
+	}
 }
 
 void mdecInit(void) {
@@ -913,6 +913,17 @@ struct vtlb_PageProtectionInfo
 	u32 ReverseRamMap;
 
 	vtlb_ProtectionMode Mode;
+
+	// Byte range of the page covered by recompiled blocks, [CodeStart, CodeEnd). Empty when
+	// CodeEnd is zero. Only ever grows until the next block tracking reset.
+	u16 CodeStart;
+	u16 CodeEnd;
+
+	// Invalidation counters, for finding pages that keep getting recompiled. DataFaults
+	// counts the write faults which landed outside of the code range.
+	u32 WriteFaults;
+	u32 DataFaults;
+	u32 Reprotects;
 };
 
 alignas(16) static vtlb_PageProtectionInfo m_PageProtectInfo[Ps2MemSize::MainRam >> 12];
@@ -957,6 +968,9 @@ void mmap_MarkCountedRamPage( u32 paddr )
 	if( m_PageProtectInfo[rampage].Mode == ProtMode_Write )
 		return;		// skip town if we're already protected.
 
+	if( m_PageProtectInfo[rampage].Mode == ProtMode_Manual )
+		m_PageProtectInfo[rampage].Reprotects++;
+
 	eeRecPerfLog.Write( (m_PageProtectInfo[rampage].Mode == ProtMode_Manual) ?
 		"Re-protecting page @ 0x%05x" : "Protected page @ 0x%05x",
 		paddr>>12
@@ -966,6 +980,46 @@ void mmap_MarkCountedRamPage( u32 paddr )
 	HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, PageAccess_ReadOnly() );
 }
 
+// paddr - physically mapped PS2 address of a recompiled block, size - its length in bytes.
+// Blocks never cross a page, so this only has to widen the code range of a single page.
+void mmap_MarkRamPageCode( u32 paddr, u32 size )
+{
+	pxAssert( eeMem );
+
+	uptr offset = (uptr)PSM( paddr ) - (uptr)eeMem->Main;
+	if( offset >= Ps2MemSize::MainRam )
+		return;
+
+	vtlb_PageProtectionInfo& info = m_PageProtectInfo[offset >> 12];
+	const u16 start = offset & 0xfff;
+	const u16 end = std::min<u32>( start + size, __pagesize );
+
+	if( info.CodeEnd == 0 )
+	{
+		info.CodeStart = start;
+		info.CodeEnd = end;
+	}
+	else
+	{
+		info.CodeStart = std::min( info.CodeStart, start );
+		info.CodeEnd = std::max( info.CodeEnd, end );
+	}
+}
+
+// Returns the number of write faults on the page which didn't touch its recompiled code,
+// ie. data that lives next to code. The recompiler uses this to stop re-protecting pages
+// which would only fault again.
+u32 mmap_GetRamPageDataFaults( u32 paddr )
+{
+	pxAssert( eeMem );
+
+	uptr offset = (uptr)PSM( paddr & ~0xfff ) - (uptr)eeMem->Main;
+	if( offset >= Ps2MemSize::MainRam )
+		return 0;
+
+	return m_PageProtectInfo[offset >> 12].DataFaults;
+}
+
 // offset - offset of address relative to psM.
 // All recompiled blocks belonging to the page are cleared, and any new blocks recompiled
 // from code residing in this page will use manual protection.
@@ -975,6 +1029,14 @@ static __fi void mmap_ClearCpuBlock( uint offset )
 
 	int rampage = offset >> 12;
 
+	// The faulting write hasn't happened yet, so the blocks still have to go: once the page is
+	// writable nothing would catch a later store into the code. Just note where it landed
+	// (allowing for a 128-bit store straddling the start of the range).
+	const uint inpage = offset & 0xfff;
+	m_PageProtectInfo[rampage].WriteFaults++;
+	if( (inpage + 16) <= m_PageProtectInfo[rampage].CodeStart || inpage >= m_PageProtectInfo[rampage].CodeEnd )
+		m_PageProtectInfo[rampage].DataFaults++;
+
 	// Assertion: This function should never be run on a block that's already under
 	// manual protection.  Indicates a logic error in the recompiler or protection code.
 	pxAssertMsg( m_PageProtectInfo[rampage].Mode != ProtMode_Manual,
@@ -1001,9 +1063,35 @@ void mmap_PageFaultHandler::OnPageFaultEvent( const PageFaultInfo& info, bool& h
 // This does not clear any recompiler blocks.  It is assumed (and necessary) for the caller
 // to ensure the EErec is also reset in conjunction with calling this function.
 //  (this function is called by default from the eerecReset).
+static void mmap_LogPageInvalidations()
+{
+	std::vector<u32> pages;
+	for( u32 i = 0; i < std::size(m_PageProtectInfo); i++ )
+	{
+		if( m_PageProtectInfo[i].WriteFaults > 0 )
+			pages.push_back( i );
+	}
+
+	if( pages.empty() )
+		return;
+
+	std::sort( pages.begin(), pages.end(), []( u32 lhs, u32 rhs ) {
+		return m_PageProtectInfo[lhs].WriteFaults > m_PageProtectInfo[rhs].WriteFaults;
+	} );
+
+	DevCon.WriteLn( "vtlb/mmap: %zu pages invalidated by writes since the last reset, most frequent:", pages.size() );
+	for( size_t i = 0; i < std::min<size_t>( pages.size(), 8 ); i++ )
+	{
+		const vtlb_PageProtectionInfo& info = m_PageProtectInfo[pages[i]];
+		DevCon.WriteLn( "  page 0x%05x: %u faults (%u data), %u reprotects, code 0x%03x-0x%03x",
+			info.ReverseRamMap >> 12, info.WriteFaults, info.DataFaults, info.Reprotects, info.CodeStart, info.CodeEnd );
+	}
+}
+
 void mmap_ResetBlockTracking()
 {
 	//DbgCon.WriteLn( "vtlb/mmap: Block Tracking reset..." );
+	mmap_LogPageInvalidations();
 	memzero( m_PageProtectInfo );
 	if (eeMem) HostSys::MemProtect( eeMem->Main, Ps2MemSize::MainRam, PageAccess_ReadWrite() );
 }
@@ -126,6 +126,8 @@ enum vtlb_ProtectionMode
 
 extern vtlb_ProtectionMode mmap_GetRamPageInfo( u32 paddr );
 extern void mmap_MarkCountedRamPage( u32 paddr );
+extern void mmap_MarkRamPageCode( u32 paddr, u32 size );
+extern u32 mmap_GetRamPageDataFaults( u32 paddr );
 extern void mmap_ResetBlockTracking();
 
 #define memRead8 vtlb_memRead<mem8_t>
@@ -165,14 +165,24 @@ static bool ConvertRAWtoNoECC(const char* file_in, const char* file_out)
 class FileMemoryCard
 {
 protected:
+	// frames without a write before the dirty blocks are written back to the file
+	static constexpr int FramesAfterWriteUntilFlush = 60;
+
 	std::FILE* m_file[8];
 	std::string m_filenames[8];
 	u8 m_effeffs[528 * 16];
-	SafeArray<u8> m_currentdata;
 	u64 m_chksum[8];
 	bool m_ispsx[8];
 	u32 m_chkaddr;
 
+	// the whole card file, reads and writes are served from here and written back in NextFrame()
+	std::vector<u8> m_data[8];
+	// one flag per erase block (sizeof(m_effeffs)) of m_data that differs from the file
+	std::vector<bool> m_dirty[8];
+	// size of the header some card formats have in front of the data, see Seek()
+	u32 m_headersize[8];
+	int m_framesUntilFlush[8];
+
 public:
 	FileMemoryCard();
 	virtual ~FileMemoryCard() = default;
@@ -190,10 +200,16 @@ public:
 	s32 Save(uint slot, const u8* src, u32 adr, int size);
 	s32 EraseBlock(uint slot, u32 adr);
 	u64 GetCRC(uint slot);
+	void NextFrame(uint slot);
 
 protected:
 	bool Seek(std::FILE* f, u32 adr);
 	bool Create(const char* mcdFile, uint sizeInMB);
+
+	bool LoadData(uint slot);
+	u8* GetDataPointer(uint slot, u32 adr, int size);
+	void MarkDirty(uint slot, u32 adr, int size);
+	void Flush(uint slot);
 };
 
 uint FileMcd_GetMtapPort(uint slot)
@@ -268,6 +284,13 @@ FileMemoryCard::FileMemoryCard()
 {
 	memset8<0xff>(m_effeffs);
 	m_chkaddr = 0;
+
+	for (int slot = 0; slot < 8; ++slot)
+	{
+		m_file[slot] = nullptr;
+		m_headersize[slot] = 0;
+		m_framesUntilFlush[slot] = 0;
+	}
 }
 
 void FileMemoryCard::Open()
@@ -365,6 +388,15 @@ void FileMemoryCard::Open()
 
 			if (!m_ispsx[slot] && FileSystem::FSeek64(m_file[slot], m_chkaddr, SEEK_SET) == 0)
 				std::fread(&m_chksum[slot], sizeof(m_chksum[slot]), 1, m_file[slot]);
+
+			if (!LoadData(slot))
+			{
+				Host::ReportFormattedErrorAsync("Memory Card", "Failed to read memory card: \n\n%s\n\n"
+					"The PS2-slot %d has been automatically disabled.", m_filenames[slot].c_str(), slot);
+				std::fclose(m_file[slot]);
+				m_file[slot] = nullptr;
+				m_filenames[slot] = {};
+			}
 		}
 	}
 }
@@ -376,6 +408,8 @@ void FileMemoryCard::Close()
 		if (!m_file[slot])
 			continue;
 
+		Flush(slot);
+
 		// Store checksum
 		if (!m_ispsx[slot] && FileSystem::FSeek64(m_file[slot], m_chkaddr, SEEK_SET) == 0)
 			std::fwrite(&m_chksum[slot], sizeof(m_chksum[slot]), 1, m_file[slot]);
@@ -391,9 +425,105 @@ void FileMemoryCard::Close()
 		}
 
 		m_filenames[slot] = {};
+		m_data[slot] = {};
+		m_dirty[slot] = {};
 	}
 }
 
+bool FileMemoryCard::LoadData(uint slot)
+{
+	std::FILE* mcfp = m_file[slot];
+	const s64 size = FileSystem::FSize64(mcfp);
+	if (size <= 0 || FileSystem::FSeek64(mcfp, 0, SEEK_SET) != 0)
+		return false;
+
+	m_data[slot].resize(static_cast<size_t>(size));
+	if (std::fread(m_data[slot].data(), m_data[slot].size(), 1, mcfp) != 1)
+		return false;
+
+	// same header detection as Seek()
+	if (size == MCD_SIZE + 64)
+		m_headersize[slot] = 64;
+	else if (size == MCD_SIZE + 3904)
+		m_headersize[slot] = 3904;
+	else
+		m_headersize[slot] = 0;
+
+	m_dirty[slot].assign((m_data[slot].size() + sizeof(m_effeffs) - 1) / sizeof(m_effeffs), false);
+	m_framesUntilFlush[slot] = 0;
+	return true;
+}
+
+// Returns nullptr if the range is outside of the card.
+u8* FileMemoryCard::GetDataPointer(uint slot, u32 adr, int size)
+{
+	const u64 start = static_cast<u64>(adr) + m_headersize[slot];
+	if (size < 0 || start + static_cast<u64>(size) > m_data[slot].size())
+		return nullptr;
+
+	return m_data[slot].data() + start;
+}
+
+void FileMemoryCard::MarkDirty(uint slot, u32 adr, int size)
+{
+	if (size <= 0)
+		return;
+
+	const u64 start = static_cast<u64>(adr) + m_headersize[slot];
+	const size_t first = static_cast<size_t>(start / sizeof(m_effeffs));
+	const size_t last = static_cast<size_t>((start + size - 1) / sizeof(m_effeffs));
+	for (size_t i = first; i <= last; i++)
+		m_dirty[slot][i] = true;
+
+	m_framesUntilFlush[slot] = FramesAfterWriteUntilFlush;
+}
+
+void FileMemoryCard::Flush(uint slot)
+{
+	std::FILE* mcfp = m_file[slot];
+	std::vector<bool>& dirty = m_dirty[slot];
+	m_framesUntilFlush[slot] = 0;
+
+	bool written = false;
+	for (size_t i = 0; i < dirty.size();)
+	{
+		if (!dirty[i])
+		{
+			i++;
+			continue;
+		}
+
+		// write runs of consecutive dirty blocks at once
+		size_t end = i + 1;
+		while (end < dirty.size() && dirty[end])
+			end++;
+
+		const size_t offset = i * sizeof(m_effeffs);
+		const size_t length = std::min(end * sizeof(m_effeffs), m_data[slot].size()) - offset;
+		if (FileSystem::FSeek64(mcfp, static_cast<s64>(offset), SEEK_SET) != 0 ||
+			std::fwrite(m_data[slot].data() + offset, length, 1, mcfp) != 1)
+		{
+			// leave the blocks dirty, the next flush tries again
+			Console.Error("(FileMcd) Failed to write memory card data for slot %u.", slot);
+			m_framesUntilFlush[slot] = FramesAfterWriteUntilFlush;
+			break;
+		}
+
+		std::fill(dirty.begin() + i, dirty.begin() + end, false);
+		written = true;
+		i = end;
+	}
+
+	if (written)
+		std::fflush(mcfp);
+}
+
+void FileMemoryCard::NextFrame(uint slot)
+{
+	if (m_file[slot] && m_framesUntilFlush[slot] > 0 && --m_framesUntilFlush[slot] == 0)
+		Flush(slot);
+}
+
 // Returns FALSE if the seek failed (is outside the bounds of the file).
 bool FileMemoryCard::Seek(std::FILE* f, u32 adr)
 {
@@ -448,7 +578,7 @@ void FileMemoryCard::GetSizeInfo(uint slot, McdSizeInfo& outways)
 	outways.Xor = 18;                     // 0x12, XOR 02 00 00 10
 
 	if (pxAssert(m_file[slot]))
-		outways.McdSizeInSectors = static_cast<u32>(FileSystem::FSize64(m_file[slot])) / (outways.SectorSize + outways.EraseBlockSizeInSectors);
+		outways.McdSizeInSectors = static_cast<u32>(m_data[slot].size()) / (outways.SectorSize + outways.EraseBlockSizeInSectors);
 	else
 		outways.McdSizeInSectors = 0x4000;
 
@@ -463,126 +593,119 @@ bool FileMemoryCard::IsPSX(uint slot)
 
 s32 FileMemoryCard::Read(uint slot, u8* dest, u32 adr, int size)
 {
-	std::FILE* mcfp = m_file[slot];
-	if (!mcfp)
+	if (!m_file[slot])
 	{
 		DevCon.Error("(FileMcd) Ignoring attempted read from disabled slot.");
 		memset(dest, 0, size);
 		return 1;
 	}
-	if (!Seek(mcfp, adr))
+
+	const u8* data = GetDataPointer(slot, adr, size);
+	if (!data)
 		return 0;
-	return std::fread(dest, size, 1, mcfp) == 1;
+
+	std::memcpy(dest, data, size);
+	return 1;
 }
 
 s32 FileMemoryCard::Save(uint slot, const u8* src, u32 adr, int size)
 {
-	std::FILE* mcfp = m_file[slot];
-
-	if (!mcfp)
+	if (!m_file[slot])
 	{
 		DevCon.Error("(FileMcd) Ignoring attempted save/write to disabled slot.");
 		return 1;
 	}
 
+	u8* data = GetDataPointer(slot, adr, size);
+	if (!data)
+		return 0;
+
 	if (m_ispsx[slot])
 	{
-		m_currentdata.MakeRoomFor(size);
-		for (int i = 0; i < size; i++)
-			m_currentdata[i] = src[i];
+		std::memcpy(data, src, size);
 	}
 	else
 	{
-		if (!Seek(mcfp, adr))
-			return 0;
-		m_currentdata.MakeRoomFor(size);
-		std::fread(m_currentdata.GetPtr(), size, 1, mcfp);
-
+		if (adr == m_chkaddr)
+			Console.Warning("(FileMcd) Warning: checksum sector overwritten. (%d)", slot);
 
-		for (int i = 0; i < size; i++)
+		// Flash can only clear bits, so the page is ANDed in, a word at a time along with the checksum.
+		bool uncleared = false;
+		const u32 loops = size / 8;
+		for (u32 i = 0; i < loops; i++)
 		{
-			if ((m_currentdata[i] & src[i]) != src[i])
-				Console.Warning("(FileMcd) Warning: writing to uncleared data. (%d) [%08X]", slot, adr);
-			m_currentdata[i] &= src[i];
+			u64 value, src_value;
+			std::memcpy(&value, data + i * 8, sizeof(value));
+			std::memcpy(&src_value, src + i * 8, sizeof(src_value));
+			uncleared |= (value & src_value) != src_value;
+			value &= src_value;
+			std::memcpy(data + i * 8, &value, sizeof(value));
+			m_chksum[slot] ^= value;
 		}
-
-		// Checksumness
+		for (int i = loops * 8; i < size; i++)
 		{
-			if (adr == m_chkaddr)
-				Console.Warning("(FileMcd) Warning: checksum sector overwritten. (%d)", slot);
-
-			u64* pdata = (u64*)&m_currentdata[0];
-			u32 loops = size / 8;
-
-			for (u32 i = 0; i < loops; i++)
-				m_chksum[slot] ^= pdata[i];
+			uncleared |= (data[i] & src[i]) != src[i];
+			data[i] &= src[i];
 		}
+
+		if (uncleared)
+			Console.Warning("(FileMcd) Warning: writing to uncleared data. (%d) [%08X]", slot, adr);
 	}
 
-	if (!Seek(mcfp, adr))
-		return 0;
+	MarkDirty(slot, adr, size);
 
-	if (std::fwrite(m_currentdata.GetPtr(), size, 1, mcfp) == 1)
-	{
-		static auto last = std::chrono::time_point<std::chrono::system_clock>();
+	static auto last = std::chrono::time_point<std::chrono::system_clock>();
 
-		std::chrono::duration<float> elapsed = std::chrono::system_clock::now() - last;
-		if (elapsed > std::chrono::seconds(5))
-		{
-			const std::string_view filename(Path::GetFileName(m_filenames[slot]));
-			Host::AddKeyedFormattedOSDMessage(StringUtil::StdStringFromFormat("MemoryCardSave%u", slot), 10.0f,
-				"Memory Card %.*s written.", static_cast<int>(filename.size()), static_cast<const char*>(filename.data()));
-			last = std::chrono::system_clock::now();
-		}
-		return 1;
+	std::chrono::duration<float> elapsed = std::chrono::system_clock::now() - last;
+	if (elapsed > std::chrono::seconds(5))
+	{
+		const std::string_view filename(Path::GetFileName(m_filenames[slot]));
+		Host::AddKeyedFormattedOSDMessage(StringUtil::StdStringFromFormat("MemoryCardSave%u", slot), 10.0f,
+			"Memory Card %.*s written.", static_cast<int>(filename.size()), static_cast<const char*>(filename.data()));
+		last = std::chrono::system_clock::now();
 	}
-
-	return 0;
+	return 1;
 }
 
 s32 FileMemoryCard::EraseBlock(uint slot, u32 adr)
 {
-	std::FILE* mcfp = m_file[slot];
-	if (!mcfp)
+	if (!m_file[slot])
 	{
 		DevCon.Error("MemoryCard: Ignoring erase for disabled slot.");
 		return 1;
 	}
 
-	if (!Seek(mcfp, adr))
+	u8* data = GetDataPointer(slot, adr, sizeof(m_effeffs));
+	if (!data)
 		return 0;
-	return std::fwrite(m_effeffs, sizeof(m_effeffs), 1, mcfp) == 1;
+
+	std::memcpy(data, m_effeffs, sizeof(m_effeffs));
+	MarkDirty(slot, adr, sizeof(m_effeffs));
+	return 1;
 }
 
 u64 FileMemoryCard::GetCRC(uint slot)
 {
-	std::FILE* mcfp = m_file[slot];
-	if (!mcfp)
+	if (!m_file[slot])
 		return 0;
 
 	u64 retval = 0;
 
 	if (m_ispsx[slot])
 	{
-		if (!Seek(mcfp, 0))
-			return 0;
+		// Process the card in 4k chunks, starting past the header like the file based version did.
+		constexpr size_t chunk_size = 528 * 8 * sizeof(u64); // use 528 (sector size), ensures even divisibility
 
-		const s64 mcfpsize = FileSystem::FSize64(mcfp);
-		if (mcfpsize < 0)
+		const uint chunks = static_cast<uint>(m_data[slot].size() / chunk_size);
+		const u8* data = m_data[slot].data() + m_headersize[slot];
+		if (m_headersize[slot] + static_cast<size_t>(chunks) * chunk_size > m_data[slot].size())
 			return 0;
 
-		// Process the file in 4k chunks.  Speeds things up significantly.
-
-		u64 buffer[528 * 8]; // use 528 (sector size), ensures even divisibility
-
-		const uint filesize = static_cast<uint>(mcfpsize) / sizeof(buffer);
-		for (uint i = filesize; i; --i)
+		for (size_t i = 0; i < static_cast<size_t>(chunks) * chunk_size; i += sizeof(u64))
 		{
-			if (std::fread(buffer, sizeof(buffer), 1, mcfp) != 1)
-				return 0;
-
-			for (uint t = 0; t < std::size(buffer); ++t)
-				retval ^= buffer[t];
+			u64 value;
+			std::memcpy(&value, data + i, sizeof(value));
+			retval ^= value;
 		}
 	}
 	else
@@ -754,9 +877,9 @@ void FileMcd_NextFrame(uint port, uint slot)
 	const uint combinedSlot = FileMcd_ConvertToSlot(port, slot);
 	switch (EmuConfig.Mcd[combinedSlot].Type)
 	{
-		//case MemoryCardType::MemoryCard_File:
-		//	Mcd::impl.NextFrame( combinedSlot );
-		//	break;
+		case MemoryCardType::File:
+			Mcd::impl.NextFrame(combinedSlot);
+			break;
 		case MemoryCardType::Folder:
 			Mcd::implFolder.NextFrame(combinedSlot);
 			break;
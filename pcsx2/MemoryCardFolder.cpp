@@ -1153,9 +1153,10 @@ void FolderMemoryCard::Flush()
 	FlushDeletedFilesAndRemoveUnchangedDataFromCache(oldFileEntryTree);
 
 	// and finally, flush everything that hasn't been flushed yet
-	for (uint i = 0; i < pageCount; ++i)
+	// m_cache only holds the touched pages, in ascending order, so walk it rather than every page of the card
+	while (!m_cache.empty() && m_cache.begin()->first < pageCount)
 	{
-		FlushPage(i);
+		FlushPage(m_cache.begin()->first);
 	}
 
 	m_lastAccessedFile.FlushAll();
@@ -1234,8 +1235,12 @@ void FolderMemoryCard::FlushFileEntries()
 	}
 }
 
-void FolderMemoryCard::FlushFileEntries(const u32 dirCluster, const u32 remainingFiles, const std::string& dirPath, MemoryCardFileMetadataReference* parent)
+void FolderMemoryCard::FlushFileEntries(const u32 dirCluster, const u32 remainingFiles, const std::string& dirPath, MemoryCardFileMetadataReference* parent, bool parentChanged)
 {
+	// keep the entries as they were before this flush, the index and metadata files of
+	// unchanged entries are already up to date and rewriting them is most of the flush time
+	const MemoryCardFileEntryCluster oldEntries = m_fileEntryDict[dirCluster];
+
 	// flush the current cluster
 	FlushCluster(dirCluster + m_superBlock.data.alloc_offset);
 
@@ -1247,6 +1252,9 @@ void FolderMemoryCard::FlushFileEntries(const u32 dirCluster, const u32 remainin
 		MemoryCardFileEntry* entry = &entries->entries[i];
 		if (entry->IsValid() && entry->IsUsed())
 		{
+			const bool entryChanged = parentChanged ||
+				std::memcmp(entry->entry.raw, oldEntries.entries[i].entry.raw, sizeof(entry->entry.raw)) != 0;
+
 			if (entry->IsDir())
 			{
 				if (!entry->IsDotDir())
@@ -1258,13 +1266,18 @@ void FolderMemoryCard::FlushFileEntries(const u32 dirCluster, const u32 remainin
 
 					if (m_performFileWrites)
 					{
-						// if this directory has nonstandard metadata, write that to the file system
 						const std::string fullSubDirPath(Path::Combine(m_folderName, subDirPath));
-						std::string metaFileName(Path::Combine(fullSubDirPath, "_pcsx2_meta_directory"));
 						if (!FileSystem::DirectoryExists(fullSubDirPath.c_str()))
 						{
 							FileSystem::CreateDirectoryPath(fullSubDirPath.c_str(), false);
 						}
+					}
+
+					if (m_performFileWrites && entryChanged)
+					{
+						// if this directory has nonstandard metadata, write that to the file system
+						const std::string fullSubDirPath(Path::Combine(m_folderName, subDirPath));
+						std::string metaFileName(Path::Combine(fullSubDirPath, "_pcsx2_meta_directory"));
 
 						// TODO: This logic doesn't make sense. If it's not a directory, create it, then open it as a file?!
 						if (filenameCleaned || entry->entry.data.mode != MemoryCardFileEntry::DefaultDirMode || entry->entry.data.attr != 0)
@@ -1333,7 +1346,7 @@ void FolderMemoryCard::FlushFileEntries(const u32 dirCluster, const u32 remainin
 
 					MemoryCardFileMetadataReference* dirRef = AddDirEntryToMetadataQuickAccess(entry, parent);
 
-					FlushFileEntries(entry->entry.data.cluster, entry->entry.data.length, subDirPath, dirRef);
+					FlushFileEntries(entry->entry.data.cluster, entry->entry.data.length, subDirPath, dirRef, entryChanged);
 				}
 			}
 			else if (entry->IsFile())
@@ -1363,7 +1376,7 @@ void FolderMemoryCard::FlushFileEntries(const u32 dirCluster, const u32 remainin
 					}
 				}
 
-				if (m_performFileWrites)
+				if (m_performFileWrites && entryChanged)
 				{
 					FileAccessHelper::WriteIndex(m_folderName, entry, parent);
 				}
@@ -1375,7 +1388,7 @@ void FolderMemoryCard::FlushFileEntries(const u32 dirCluster, const u32 remainin
 	const u32 nextCluster = m_fat.data[0][0][dirCluster];
 	if (nextCluster != (LastDataCluster | DataClusterInUseMask))
 	{
-		FlushFileEntries(nextCluster & NextDataClusterMask, remainingFiles - 2, dirPath, parent);
+		FlushFileEntries(nextCluster & NextDataClusterMask, remainingFiles - 2, dirPath, parent, parentChanged);
 	}
 }
 
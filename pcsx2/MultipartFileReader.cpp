@@ -14,7 +14,7 @@
  */
 
 #include "PrecompiledHeader.h"
-#include "AsyncFileReader.h"
+#include "MultipartFileReader.h"
 #include "common/Assertions.h"
 #include "common/FileSystem.h"
 #include "common/Path.h"
@@ -43,43 +43,14 @@ static bool pxFileExists_WithExt( std::string& filename, const std::string& ext
 
 AsyncFileReader* MultipartFileReader::DetectMultipart(AsyncFileReader* reader)
 {
-	MultipartFileReader* multi = new MultipartFileReader(reader);
+	Part parts[MaxParts] = {};
+	parts[0].reader = reader;
+	parts[0].end = reader->GetBlockCount();
 
-	multi->FindParts();
-	if (multi->m_numparts > 1)
-	{
-		Console.WriteLn( Color_Blue, "isoFile: multi-part ISO detected.  %u parts found.", multi->m_numparts);
-
-		return multi;
-	}
-
-	multi->m_parts[0].reader = NULL;
-	delete multi;
-	return reader;
-}
-
-MultipartFileReader::MultipartFileReader(AsyncFileReader* firstPart)
-{
-	memset(m_parts,0,sizeof(m_parts));
-
-	m_filename = firstPart->GetFilename();
-
-	m_numparts = 1;
-
-	m_parts[0].reader = firstPart;
-	m_parts[0].end = firstPart->GetBlockCount();
-}
-
-MultipartFileReader::~MultipartFileReader(void)
-{
-	Close();
-}
-
-void MultipartFileReader::FindParts()
-{
-	std::string curext(Path::GetExtension(m_filename));
+	const std::string& filename = reader->GetFilename();
+	std::string curext(Path::GetExtension(filename));
 	if (curext.empty())
-		return;
+		return reader;
 
 	char prefixch = std::tolower(curext[0]);
 
@@ -98,63 +69,86 @@ void MultipartFileReader::FindParts()
 	}
 
 	std::string extbuf(StringUtil::StdStringFromFormat("%c%02u", prefixch, i));
-	std::string nameparts(Path::ReplaceExtension(m_filename, extbuf));
+	std::string nameparts(Path::ReplaceExtension(filename, extbuf));
 	if (!pxFileExists_WithExt(nameparts, extbuf))
-		return;
+		return reader;
 
 	DevCon.WriteLn( Color_Blue, "isoFile: multi-part %s detected...", StringUtil::toUpper(curext).c_str() );
-	ConsoleIndentScope indent;
-
-	int bsize = m_parts[0].reader->GetBlockSize();
-	int blocks = m_parts[0].end;
 
-	m_numparts = 1;
-
-	for (; i < MaxParts; ++i)
+	uint numparts = 1;
 	{
-		extbuf = StringUtil::StdStringFromFormat("%c%02u", prefixch, i );
-		nameparts = Path::ReplaceExtension(m_filename, extbuf);
-		if (!pxFileExists_WithExt(nameparts, extbuf))
-			break;
+		ConsoleIndentScope indent;
 
-		Part* thispart = m_parts + m_numparts;
-		AsyncFileReader* thisreader = new FlatFileReader();
+		int bsize = reader->GetBlockSize();
+		int blocks = parts[0].end;
 
-		if (!thisreader->Open(nameparts))
+		for (; i < MaxParts; ++i)
 		{
-			delete thisreader;
-			break;
-		}
+			extbuf = StringUtil::StdStringFromFormat("%c%02u", prefixch, i );
+			nameparts = Path::ReplaceExtension(filename, extbuf);
+			if (!pxFileExists_WithExt(nameparts, extbuf))
+				break;
+
+			Part* thispart = parts + numparts;
+			AsyncFileReader* thisreader = new FlatFileReader();
+
+			if (!thisreader->Open(nameparts))
+			{
+				delete thisreader;
+				break;
+			}
 
-		thisreader->SetBlockSize(bsize);
+			thisreader->SetBlockSize(bsize);
 
-		thispart->reader = thisreader;
-		thispart->start = blocks;
+			thispart->reader = thisreader;
+			thispart->start = blocks;
 
-		uint bcount =  thisreader->GetBlockCount();
-		blocks += bcount;
+			uint bcount =  thisreader->GetBlockCount();
+			blocks += bcount;
 
-		thispart->end = blocks;
+			thispart->end = blocks;
 
-		DevCon.WriteLn( Color_Blue, "\tblocks %u - %u in: %s",
-			thispart->start, thispart->end,
-			nameparts.c_str()
-		);
+			DevCon.WriteLn( Color_Blue, "\tblocks %u - %u in: %s",
+				thispart->start, thispart->end,
+				nameparts.c_str()
+			);
 
-		++m_numparts;
+			++numparts;
+		}
 	}
 
-	//Console.WriteLn( Color_Blue, "isoFile: multi-part ISO loaded (%u parts found)", m_numparts );
+	if (numparts == 1)
+		return reader;
+
+	Console.WriteLn( Color_Blue, "isoFile: multi-part ISO detected.  %u parts found.", numparts);
+
+	MultipartFileReader* multi = new MultipartFileReader(parts, numparts);
+	multi->Open(filename);
+	return multi;
 }
 
-bool MultipartFileReader::Open(std::string fileName)
+MultipartFileReader::MultipartFileReader(const Part* parts, uint numparts)
 {
-	// Cannot open a MultipartFileReader directly,
-	// use DetectMultipart to convert a FlatFileReader
-	return false;
+	memset(m_parts,0,sizeof(m_parts));
+	std::copy(parts, parts + numparts, m_parts);
+	m_numparts = numparts;
+
+	m_blocksize = m_parts[0].reader->GetBlockSize();
+}
+
+MultipartFileReader::~MultipartFileReader(void)
+{
+	Close();
 }
 
-uint MultipartFileReader::GetFirstPart(uint lsn)
+bool MultipartFileReader::Open2(std::string fileName)
+{
+	// The parts are opened by DetectMultipart, ThreadedFileReader::Open only has to set up the buffers.
+	m_filename = std::move(fileName);
+	return m_numparts > 0;
+}
+
+uint MultipartFileReader::GetFirstPart(uint lsn) const
 {
 	pxAssertMsg(lsn < GetBlockCount(),	"Invalid lsn passed into MultipartFileReader::GetFirstPart.");
 	pxAssertMsg(m_numparts, "Invalid object state; multi-part iso file needs at least one part!");
@@ -169,63 +163,42 @@ uint MultipartFileReader::GetFirstPart(uint lsn)
 	return 0xBAAAAAAD;
 }
 
-int MultipartFileReader::ReadSync(void* pBuffer, uint sector, uint count)
-{
-	BeginRead(pBuffer,sector,count);
-	return FinishRead();
-}
-
-void MultipartFileReader::BeginRead(void* pBuffer, uint sector, uint count)
+ThreadedFileReader::Chunk MultipartFileReader::ChunkForOffset(u64 offset)
 {
-	u8* lBuffer = (u8*)pBuffer;
-
-	for(uint i = GetFirstPart(sector); i < m_numparts; i++)
+	Chunk chunk = {0};
+	const u64 lsn = offset / m_blocksize;
+	if (lsn >= GetBlockCount())
 	{
-		uint num = std::min(count, m_parts[i].end - sector);
-
-		m_parts[i].reader->BeginRead(lBuffer, sector - m_parts[i].start, num);
-		m_parts[i].isReading = true;
-
-		lBuffer += num * m_blocksize;
-		sector += num;
-		count -= num;
-
-		if(count <= 0)
-			break;
+		chunk.chunkID = -1;
+	}
+	else
+	{
+		// Chunks are aligned to the start of their part, so the last one of each part may be short.
+		const Part& part = m_parts[GetFirstPart(static_cast<uint>(lsn))];
+		const uint start = part.start + (static_cast<uint>(lsn) - part.start) / ChunkBlocks * ChunkBlocks;
+		chunk.chunkID = start;
+		chunk.offset = static_cast<u64>(start) * m_blocksize;
+		chunk.length = std::min(ChunkBlocks, part.end - start) * m_blocksize;
 	}
+	return chunk;
 }
 
-int MultipartFileReader::FinishRead(void)
+int MultipartFileReader::ReadChunk(void* dst, s64 chunkID)
 {
-	int ret = 0;
-	for(uint i=0;i<m_numparts;i++)
-	{
-		if(m_parts[i].isReading)
-		{
-			ret = std::min(ret, m_parts[i].reader->FinishRead());
-			m_parts[i].isReading = false;
+	if (chunkID < 0 || chunkID >= GetBlockCount())
+		return -1;
 
-			if(ret < 0)
-				ret = -1;
-		}
-	}
+	const uint start = static_cast<uint>(chunkID);
+	const Part& part = m_parts[GetFirstPart(start)];
+	const uint count = std::min(ChunkBlocks, part.end - start);
 
-	return ret;
-}
+	if (part.reader->ReadSync(dst, start - part.start, count) < 0)
+		return -1;
 
-void MultipartFileReader::CancelRead(void)
-{
-	for(uint i=0;i<m_numparts;i++)
-	{
-		if(m_parts[i].isReading)
-		{
-			m_parts[i].reader->CancelRead();
-			m_parts[i].isReading = false;
-		}
-	}
+	return static_cast<int>(count * m_blocksize);
 }
 
-void MultipartFileReader::Close(void)
+void MultipartFileReader::Close2(void)
 {
 	for(uint i=0;i<m_numparts;i++)
 	{
@@ -233,6 +206,7 @@ void MultipartFileReader::Close(void)
 		{
 			m_parts[i].reader->Close();
 			delete m_parts[i].reader;
+			m_parts[i].reader = nullptr;
 		}
 	}
 }
@@ -244,9 +218,16 @@ uint MultipartFileReader::GetBlockCount(void) const
 
 void MultipartFileReader::SetBlockSize(uint bytes)
 {
+	// Chunk offsets are in blocks, so anything read ahead with the old size is wrong now.
+	DiscardBuffers();
+	m_blocksize = bytes;
+
 	uint last_end = 0;
 	for(uint i=0;i<m_numparts;i++)
 	{
+		if (!m_parts[i].reader)
+			continue;
+
 		m_parts[i].reader->SetBlockSize(bytes);
 		uint count = m_parts[i].reader->GetBlockCount();
 
@@ -254,4 +235,3 @@ void MultipartFileReader::SetBlockSize(uint bytes)
 		m_parts[i].end = last_end = m_parts[i].start + count;
 	}
 }
-
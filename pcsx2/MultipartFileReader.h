@@ -0,0 +1,61 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CDVD/ThreadedFileReader.h"
+
+// Split images (.I00, .I01, ...) read as one, with each part behind a synchronous reader.
+// Chunks never cross a part boundary, and reads go through the ThreadedFileReader thread
+// and buffers like the compressed formats.
+class MultipartFileReader : public ThreadedFileReader
+{
+	DeclareNoncopyableObject(MultipartFileReader);
+
+	static const int MaxParts = 8;
+
+	/// Blocks per chunk, read ahead to the end of the part at most
+	static constexpr u32 ChunkBlocks = 32;
+
+	struct Part
+	{
+		uint start;
+		uint end; // exclusive
+		AsyncFileReader* reader;
+	} m_parts[MaxParts];
+	uint m_numparts;
+
+	uint GetFirstPart(uint lsn) const;
+
+	MultipartFileReader(const Part* parts, uint numparts);
+
+public:
+	~MultipartFileReader() override;
+
+	bool Open2(std::string fileName) override;
+
+	Chunk ChunkForOffset(u64 offset) override;
+	int ReadChunk(void* dst, s64 chunkID) override;
+
+	void Close2(void) override;
+
+	uint GetBlockCount(void) const override;
+
+	void SetBlockSize(uint bytes) override;
+	// The first part keeps the data offset it was detected with, the others have none.
+	void SetDataOffset(int bytes) override {}
+
+	static AsyncFileReader* DetectMultipart(AsyncFileReader* reader);
+};
@@ -336,6 +336,29 @@ PINEServer::IPCBuffer PINEServer::ParseCommand(char* buf, char* ret_buffer, u32
 				buf_cnt += 4;
 				break;
 			}
+			case MsgReadBlock:
+			{
+				// Memory address (4 byte), size (4 byte), replies with size bytes. Lets clients
+				// read whole structures in one command instead of one per value.
+				if (!m_vm->HasActiveMachine())
+					goto error;
+				if (!SafetyChecks(buf_cnt, 4 + 4, ret_cnt, 0, buf_size))
+					goto error;
+				const u32 a = FromArray<u32>(&buf[buf_cnt], 0);
+				const u32 size = FromArray<u32>(&buf[buf_cnt], 4);
+				if (size >= MAX_IPC_RETURN_SIZE || !SafetyChecks(buf_cnt, 4 + 4, ret_cnt, size, buf_size))
+					goto error;
+				u32 i = 0;
+				for (; i < size && ((a + i) & 3) != 0; i++)
+					ret_buffer[ret_cnt + i] = memRead8(a + i);
+				for (; (i + 4) <= size; i += 4)
+					ToArray(ret_buffer, memRead32(a + i), ret_cnt + i);
+				for (; i < size; i++)
+					ret_buffer[ret_cnt + i] = memRead8(a + i);
+				ret_cnt += size;
+				buf_cnt += 8;
+				break;
+			}
 			case MsgWrite8:
 			{
 				if (!m_vm->HasActiveMachine())
@@ -107,6 +107,7 @@ protected:
 		MsgUUID = 0xD, /**< Returns the game UUID. */
 		MsgGameVersion = 0xE, /**< Returns the game verion. */
 		MsgStatus = 0xF, /**< Returns the emulator status. */
+		MsgReadBlock = 0x10, /**< Reads a block of memory. */
 		MsgUnimplemented = 0xFF /**< Unimplemented IPC message. */
 	};
 
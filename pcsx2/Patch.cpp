@@ -25,6 +25,7 @@
 #include "Config.h"
 #include "Patch.h"
 
+#include <array>
 #include <memory>
 #include <sstream>
 #include <vector>
@@ -34,7 +35,18 @@
 // Applies a single patch line to emulation memory regardless of its "place" value.
 extern void _ApplyPatch(IniPatch* p);
 
-static std::vector<IniPatch> Patch;
+// Loaded patches, bucketed by place so applying one place never walks the others.
+// Load order is kept within a place, since extended codes depend on it.
+static std::array<std::vector<IniPatch>, _PPT_END_MARKER> Patch;
+
+static size_t GetLoadedPatchCount()
+{
+	size_t count = 0;
+	for (const std::vector<IniPatch>& place : Patch)
+		count += place.size();
+
+	return count;
+}
 
 struct PatchTextTable
 {
@@ -122,7 +134,7 @@ static void inifile_command(const std::string& cmd)
 
 int LoadPatchesFromString(const std::string& patches)
 {
-	const size_t before = Patch.size();
+	const size_t before = GetLoadedPatchCount();
 
 	std::istringstream ss(patches);
 	std::string line;
@@ -133,12 +145,13 @@ int LoadPatchesFromString(const std::string& patches)
 			inifile_command(line);
 	}
 
-	return static_cast<int>(Patch.size() - before);
+	return static_cast<int>(GetLoadedPatchCount() - before);
 }
 
 void ForgetLoadedPatches()
 {
-	Patch.clear();
+	for (std::vector<IniPatch>& place : Patch)
+		place.clear();
 }
 
 // This routine loads patches from a zip file
@@ -270,8 +283,30 @@ namespace PatchFunc
 			return;
 		}
 
+		// Swap little endian EE values once here rather than on every application.
+		if (iPatch.cpu == CPU_EE)
+		{
+			switch (iPatch.type)
+			{
+			case SHORT_LE_T:
+				iPatch.type = SHORT_T;
+				iPatch.data = SwapEndian(iPatch.data, 16);
+				break;
+			case WORD_LE_T:
+				iPatch.type = WORD_T;
+				iPatch.data = SwapEndian(iPatch.data, 32);
+				break;
+			case DOUBLE_LE_T:
+				iPatch.type = DOUBLE_T;
+				iPatch.data = SwapEndian(iPatch.data, 64);
+				break;
+			default:
+				break;
+			}
+		}
+
 		iPatch.enabled = 1;
-		Patch.push_back(iPatch);
+		Patch[iPatch.placetopatch].push_back(iPatch);
 
 #undef PATCH_ERROR
 	}
@@ -280,9 +315,6 @@ namespace PatchFunc
 // This is for applying patches directly to memory
 void ApplyLoadedPatches(patch_place_type place)
 {
-	for (auto& i : Patch)
-	{
-		if (i.placetopatch == place)
-			_ApplyPatch(&i);
-	}
+	for (IniPatch& i : Patch[place])
+		_ApplyPatch(&i);
 }
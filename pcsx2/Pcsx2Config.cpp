@@ -70,7 +70,8 @@ const char* const tbl_SpeedhackNames[] =
 {
 	"mvuFlag",
 	"InstantVU1",
-	"MTVU"
+	"MTVU",
+	"InstantVU0"
 };
 
 const char* EnumToString(SpeedhackId id)
@@ -92,6 +93,9 @@ void Pcsx2Config::SpeedhackOptions::Set(SpeedhackId id, bool enabled)
 		case Speedhack_MTVU:
 			vuThread = enabled;
 			break;
+		case Speedhack_InstantVU0:
+			vu0Instant = enabled;
+			break;
         jNO_DEFAULT;
 	}
 }
@@ -100,6 +104,8 @@ Pcsx2Config::SpeedhackOptions::SpeedhackOptions()
 {
 	DisableAll();
 
+	vuThreadRingSize = 16;
+
 	// Set recommended speedhacks to enabled by default. They'll still be off globally on resets.
 	WaitLoop = true;
 	IntcStat = true;
@@ -127,7 +133,10 @@ void Pcsx2Config::SpeedhackOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(WaitLoop);
 	SettingsWrapBitBool(vuFlagHack);
 	SettingsWrapBitBool(vuThread);
+	SettingsWrapBitBool(vuThreadSpin);
 	SettingsWrapBitBool(vu1Instant);
+	SettingsWrapBitBool(vu0Instant);
+	SettingsWrapBitfield(vuThreadRingSize);
 }
 
 void Pcsx2Config::ProfilerOptions::LoadSave(SettingsWrapper& wrap)
@@ -209,6 +218,10 @@ void Pcsx2Config::RecompilerOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(EnableEE);
 	SettingsWrapBitBool(EnableIOP);
 	SettingsWrapBitBool(EnableEECache);
+	SettingsWrapBitBool(EnableEEBlockList);
+	SettingsWrapBitBool(EnableEEBlockProfile);
+	SettingsWrapBitBool(EnableIOPBlockList);
+	SettingsWrapBitBool(EEPipelineStalls);
 	SettingsWrapBitBool(EnableVU0);
 	SettingsWrapBitBool(EnableVU1);
 
@@ -311,8 +324,10 @@ Pcsx2Config::GSOptions::GSOptions()
 	UseBlitSwapChain = false;
 	DisableShaderCache = false;
 	DisableFramebufferFetch = false;
+	AsyncPipelineCompilation = false;
 	ThreadedPresentation = false;
 	SkipDuplicateFrames = false;
+	FrameLimiterLowLatency = false;
 	OsdShowMessages = true;
 	OsdShowSpeed = false;
 	OsdShowFPS = false;
@@ -326,10 +341,12 @@ Pcsx2Config::GSOptions::GSOptions()
 	AccurateDATE = true;
 	GPUPaletteConversion = false;
 	AutoFlushSW = true;
+	SWTileBinning = false;
 	PreloadFrameWithGSData = false;
 	WrapGSMem = false;
 	Mipmap = true;
 	PointListPalette = false;
+	DynamicResolution = false;
 
 	ManualUserHacks = false;
 	UserHacks_AlignSpriteX = false;
@@ -408,9 +425,12 @@ bool Pcsx2Config::GSOptions::OptionsAreEqual(const GSOptions& right) const
 		OpEqu(MaxAnisotropy) &&
 		OpEqu(SWExtraThreads) &&
 		OpEqu(SWExtraThreadsHeight) &&
+		OpEqu(TextureCacheBudget) &&
+		OpEqu(TextureReplacementCacheBudget) &&
 		OpEqu(TVShader) &&
 		OpEqu(SkipDrawEnd) &&
 		OpEqu(SkipDrawStart) &&
+		OpEqu(FrameSkip) &&
 
 		OpEqu(UserHacks_HalfBottomOverride) &&
 		OpEqu(UserHacks_HalfPixelOffset) &&
@@ -446,6 +466,7 @@ bool Pcsx2Config::GSOptions::RestartOptionsAreEqual(const GSOptions& right) cons
 		   OpEqu(DisableShaderCache) &&
 		   OpEqu(DisableDualSourceBlend) &&
 		   OpEqu(DisableFramebufferFetch) &&
+		   OpEqu(AsyncPipelineCompilation) &&
 		   OpEqu(ThreadedPresentation) &&
 		   OpEqu(OverrideTextureBarriers) &&
 		   OpEqu(OverrideGeometryShaders);
@@ -531,8 +552,10 @@ void Pcsx2Config::GSOptions::ReloadIniSettings()
 	GSSettingBoolEx(DisableShaderCache, "disable_shader_cache");
 	GSSettingBool(DisableDualSourceBlend);
 	GSSettingBool(DisableFramebufferFetch);
+	GSSettingBoolEx(AsyncPipelineCompilation, "async_pipeline_compilation");
 	GSSettingBool(ThreadedPresentation);
 	GSSettingBool(SkipDuplicateFrames);
+	GSSettingBool(FrameLimiterLowLatency);
 	GSSettingBool(OsdShowMessages);
 	GSSettingBool(OsdShowSpeed);
 	GSSettingBool(OsdShowFPS);
@@ -546,9 +569,11 @@ void Pcsx2Config::GSOptions::ReloadIniSettings()
 	GSSettingBoolEx(AccurateDATE, "accurate_date");
 	GSSettingBoolEx(GPUPaletteConversion, "paltex");
 	GSSettingBoolEx(AutoFlushSW, "autoflush_sw");
+	GSSettingBoolEx(SWTileBinning, "sw_tile_binning");
 	GSSettingBoolEx(PreloadFrameWithGSData, "preload_frame_with_gs_data");
 	GSSettingBoolEx(WrapGSMem, "wrap_gs_mem");
 	GSSettingBoolEx(Mipmap, "mipmap");
+	GSSettingBool(DynamicResolution);
 	GSSettingBoolEx(ManualUserHacks, "UserHacks");
 	GSSettingBoolEx(UserHacks_AlignSpriteX, "UserHacks_align_sprite_X");
 	GSSettingBoolEx(UserHacks_AutoFlush, "UserHacks_AutoFlush");
@@ -594,10 +619,14 @@ void Pcsx2Config::GSOptions::ReloadIniSettings()
 	GSSettingIntEx(MaxAnisotropy, "MaxAnisotropy");
 	GSSettingIntEx(SWExtraThreads, "extrathreads");
 	GSSettingIntEx(SWExtraThreadsHeight, "extrathreads_height");
+	GSSettingIntEx(TextureCacheBudget, "texture_cache_budget");
+	GSSettingIntEx(TextureReplacementCacheBudget, "texture_replacement_cache_budget");
 	GSSettingIntEx(TVShader, "TVShader");
 	GSSettingIntEx(SkipDrawStart, "UserHacks_SkipDraw_Start");
 	GSSettingIntEx(SkipDrawEnd, "UserHacks_SkipDraw_End");
 	SkipDrawEnd = std::max(SkipDrawStart, SkipDrawEnd);
+	GSSettingInt(FrameSkip);
+	FrameSkip = std::clamp(FrameSkip, 0, 9);
 
 	GSSettingIntEx(UserHacks_HalfBottomOverride, "UserHacks_Half_Bottom_Override");
 	GSSettingIntEx(UserHacks_HalfPixelOffset, "UserHacks_HalfPixelOffset");
@@ -1047,6 +1076,10 @@ Pcsx2Config::Pcsx2Config()
 	}
 
 	GzipIsoIndexTemplate = "$(f).pindex.tmp";
+	CdvdReadaheadBuffers = 2;
+	RewindSaveFrequency = 60;
+	RewindBufferSize = 256;
+	RunAheadFrames = 0;
 }
 
 void Pcsx2Config::LoadSave(SettingsWrapper& wrap)
@@ -1068,11 +1101,17 @@ void Pcsx2Config::LoadSave(SettingsWrapper& wrap)
 #endif
 	SettingsWrapBitBool(ConsoleToStdio);
 	SettingsWrapBitBool(HostFs);
+	SettingsWrapBitBool(UseBootSnapshot);
 	SettingsWrapBitBool(PatchBios);
 	SettingsWrapEntry(PatchRegion);
 
 	SettingsWrapBitBool(BackupSavestate);
 	SettingsWrapBitBool(SavestateZstdCompression);
+	SettingsWrapBitBool(EnableRewind);
+	SettingsWrapEntry(RewindSaveFrequency);
+	SettingsWrapEntry(RewindBufferSize);
+	SettingsWrapEntry(RunAheadFrames);
+	SettingsWrapEntry(MetricsExportPath);
 	SettingsWrapBitBool(McdEnableEjection);
 	SettingsWrapBitBool(McdFolderAutoManage);
 #ifndef PCSX2_CORE
@@ -1098,6 +1137,7 @@ void Pcsx2Config::LoadSave(SettingsWrapper& wrap)
 	Trace.LoadSave(wrap);
 
 	SettingsWrapEntry(GzipIsoIndexTemplate);
+	SettingsWrapEntry(CdvdReadaheadBuffers);
 
 	// For now, this in the derived config for backwards ini compatibility.
 #ifdef PCSX2_CORE
@@ -1173,7 +1213,12 @@ bool Pcsx2Config::operator==(const Pcsx2Config& right) const
 		OpEqu(Framerate) &&
 		OpEqu(Trace) &&
 		OpEqu(BaseFilenames) &&
-		OpEqu(GzipIsoIndexTemplate);
+		OpEqu(GzipIsoIndexTemplate) &&
+		OpEqu(CdvdReadaheadBuffers) &&
+		OpEqu(RewindSaveFrequency) &&
+		OpEqu(RewindBufferSize) &&
+		OpEqu(RunAheadFrames) &&
+		OpEqu(MetricsExportPath);
 	for (u32 i = 0; i < sizeof(Mcd) / sizeof(Mcd[0]); i++)
 	{
 		equal &= OpEqu(Mcd[i].Enabled);
@@ -1205,6 +1250,11 @@ void Pcsx2Config::CopyConfig(const Pcsx2Config& cfg)
 	}
 
 	GzipIsoIndexTemplate = cfg.GzipIsoIndexTemplate;
+	CdvdReadaheadBuffers = cfg.CdvdReadaheadBuffers;
+	RewindSaveFrequency = cfg.RewindSaveFrequency;
+	RewindBufferSize = cfg.RewindBufferSize;
+	RunAheadFrames = cfg.RunAheadFrames;
+	MetricsExportPath = cfg.MetricsExportPath;
 
 	CdvdVerboseReads = cfg.CdvdVerboseReads;
 	CdvdDumpBlocks = cfg.CdvdDumpBlocks;
@@ -1216,10 +1266,12 @@ void Pcsx2Config::CopyConfig(const Pcsx2Config& cfg)
 	EnableNoInterlacingPatches = cfg.EnableNoInterlacingPatches;
 	EnableRecordingTools = cfg.EnableRecordingTools;
 	UseBOOT2Injection = cfg.UseBOOT2Injection;
+	UseBootSnapshot = cfg.UseBootSnapshot;
 	PatchBios = cfg.PatchBios;
 	PatchRegion = cfg.PatchRegion;
 	BackupSavestate = cfg.BackupSavestate;
 	SavestateZstdCompression = cfg.SavestateZstdCompression;
+	EnableRewind = cfg.EnableRewind;
 	McdEnableEjection = cfg.McdEnableEjection;
 	McdFolderAutoManage = cfg.McdFolderAutoManage;
 	MultitapPort0_Enabled = cfg.MultitapPort0_Enabled;
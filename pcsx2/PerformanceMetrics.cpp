@@ -15,17 +15,27 @@
 
 #include "PrecompiledHeader.h"
 
+#include <array>
 #include <chrono>
 #include <vector>
 
+#include "common/Console.h"
+#include "common/FileSystem.h"
+#include "common/StringUtil.h"
 #include "common/Timer.h"
 #include "common/Threading.h"
+#include "fmt/core.h"
 
 #include "PerformanceMetrics.h"
 #include "System.h"
 
 #include "GS.h"
+#include "GS/GS.h"
+#include "GS/GSPerfMon.h"
+#include "Host.h"
+#include "HostDisplay.h"
 #include "MTVU.h"
+#include "SPU2/spu2.h"
 
 #ifdef PCSX2_CORE
 #include "VMManager.h"
@@ -41,11 +51,37 @@ static float s_average_frame_time = 0.0f;
 static float s_average_frame_time_accumulator = 0.0f;
 static float s_worst_frame_time_accumulator = 0.0f;
 static u32 s_frames_since_last_update = 0;
+static float s_average_present_latency = 0.0f;
+static float s_worst_present_latency = 0.0f;
+static float s_present_latency_accumulator = 0.0f;
+static float s_worst_present_latency_accumulator = 0.0f;
+static u32 s_latency_samples_since_last_update = 0;
+static u64 s_queued_frame_ticks = 0;
+static float s_last_present_latency = 0.0f;
+static float s_last_gpu_time = 0.0f;
+
+static std::array<float, PerformanceMetrics::FRAME_TIME_HISTORY_SIZE> s_frame_time_history = {};
+static u32 s_frame_time_history_pos = 0;
+
+// per-frame trace
+static constexpr const char* s_frame_trace_columns[] = {"frame_ms", "present_latency_ms", "gpu_ms", "ee_ms", "gs_ms", "vu_ms",
+	"draw_calls", "prims", "readbacks", "uploads", "copies"};
+static constexpr u32 FRAME_TRACE_TIME_COLUMNS = 6;
+static std::FILE* s_frame_trace_file = nullptr;
+static bool s_frame_trace_json = false;
+static u64 s_frame_trace_frames = 0;
+static std::array<double, std::size(s_frame_trace_columns)> s_frame_trace_totals = {};
+static u64 s_trace_last_cpu_time = 0;
+static u64 s_trace_last_gs_time = 0;
+static u64 s_trace_last_vu_time = 0;
+
+static void WriteFrameTraceLine(float frame_time);
 static Common::Timer s_last_update_time;
 static Common::Timer s_last_frame_time;
 
 // frame number, updated by the GS thread
 static u64 s_frame_number = 0;
+static u64 s_update_count = 0;
 
 // internal fps heuristics
 static PerformanceMetrics::InternalFPSMethod s_internal_fps_method = PerformanceMetrics::InternalFPSMethod::None;
@@ -65,6 +101,16 @@ static float s_gs_thread_time = 0.0f;
 static float s_vu_thread_usage = 0.0f;
 static float s_vu_thread_time = 0.0f;
 
+static float s_vu_ee_wait_time = 0.0f;
+static float s_vu_idle_time = 0.0f;
+static std::array<u32, VU_Thread::WAIT_HISTOGRAM_BUCKETS> s_vu_ee_wait_histogram = {};
+static std::array<u32, VU_Thread::WAIT_HISTOGRAM_BUCKETS> s_vu_idle_histogram = {};
+
+static float s_gs_vsync_wait_time = 0.0f;
+static float s_gs_readback_wait_time = 0.0f;
+static u32 s_gs_readbacks = 0;
+static u32 s_gs_readback_drains = 0;
+
 struct GSSWThreadStats
 {
 	Threading::ThreadHandle handle;
@@ -79,6 +125,17 @@ static float s_accumulated_gpu_time = 0.0f;
 static float s_gpu_usage = 0.0f;
 static u32 s_presents_since_last_update = 0;
 
+static float s_audio_latency = 0.0f;
+static float s_audio_target_latency = 0.0f;
+static u32 s_audio_underruns = 0;
+
+// Metrics export. Counts which are only kept per update interval are summed here, so they can be
+// exported as counters.
+static std::string s_metrics_export_path;
+static u64 s_metrics_gs_readbacks_total = 0;
+static u64 s_metrics_gs_readback_drains_total = 0;
+static void WriteMetricsExport();
+
 void PerformanceMetrics::Clear()
 {
 	Reset();
@@ -87,6 +144,8 @@ void PerformanceMetrics::Clear()
 	s_internal_fps = 0.0f;
 	s_worst_frame_time = 0.0f;
 	s_average_frame_time = 0.0f;
+	s_average_present_latency = 0.0f;
+	s_worst_present_latency = 0.0f;
 	s_internal_fps_method = PerformanceMetrics::InternalFPSMethod::None;
 
 	s_cpu_thread_usage = 0.0f;
@@ -95,11 +154,25 @@ void PerformanceMetrics::Clear()
 	s_gs_thread_time = 0.0f;
 	s_vu_thread_usage = 0.0f;
 	s_vu_thread_time = 0.0f;
+	s_vu_ee_wait_time = 0.0f;
+	s_vu_idle_time = 0.0f;
+	s_vu_ee_wait_histogram.fill(0);
+	s_vu_idle_histogram.fill(0);
+	s_gs_vsync_wait_time = 0.0f;
+	s_gs_readback_wait_time = 0.0f;
+	s_gs_readbacks = 0;
+	s_gs_readback_drains = 0;
 
 	s_average_gpu_time = 0.0f;
 	s_gpu_usage = 0.0f;
 
+	s_audio_latency = 0.0f;
+	s_audio_target_latency = 0.0f;
+	s_audio_underruns = 0;
+
 	s_frame_number = 0;
+	s_frame_time_history.fill(0.0f);
+	s_frame_time_history_pos = 0;
 }
 
 void PerformanceMetrics::Reset()
@@ -109,6 +182,10 @@ void PerformanceMetrics::Reset()
 	s_gs_privileged_register_writes_since_last_update = 0;
 	s_average_frame_time_accumulator = 0.0f;
 	s_worst_frame_time_accumulator = 0.0f;
+	s_present_latency_accumulator = 0.0f;
+	s_worst_present_latency_accumulator = 0.0f;
+	s_latency_samples_since_last_update = 0;
+	s_queued_frame_ticks = 0;
 
 	s_accumulated_gpu_time = 0.0f;
 	s_presents_since_last_update = 0;
@@ -121,6 +198,13 @@ void PerformanceMetrics::Reset()
 	s_last_vu_time = THREAD_VU1 ? vu1Thread.GetThreadHandle().GetCPUTime() : 0;
 	s_last_ticks = GetCPUTicks();
 
+	for (VU_Thread::WaitStats* stats : {&vu1Thread.eeWaitStats, &vu1Thread.vuIdleStats})
+	{
+		stats->total_ns.store(0, std::memory_order_relaxed);
+		for (std::atomic<u32>& count : stats->histogram)
+			count.store(0, std::memory_order_relaxed);
+	}
+
 	for (GSSWThreadStats& stat : s_gs_sw_threads)
 		stat.last_cpu_time = stat.handle.GetCPUTime();
 }
@@ -135,6 +219,23 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit)
 	s_gs_framebuffer_blits_since_last_update += static_cast<u32>(fb_blit);
 	s_frame_number++;
 
+	if (s_queued_frame_ticks != 0)
+	{
+		const float latency = static_cast<float>(static_cast<double>(GetCPUTicks() - s_queued_frame_ticks) * 1000.0 /
+												 static_cast<double>(GetTickFrequency()));
+		s_present_latency_accumulator += latency;
+		s_worst_present_latency_accumulator = std::max(s_worst_present_latency_accumulator, latency);
+		s_latency_samples_since_last_update++;
+		s_queued_frame_ticks = 0;
+		s_last_present_latency = latency;
+	}
+
+	s_frame_time_history[s_frame_time_history_pos] = frame_time;
+	s_frame_time_history_pos = (s_frame_time_history_pos + 1) % FRAME_TIME_HISTORY_SIZE;
+
+	if (s_frame_trace_file)
+		WriteFrameTraceLine(frame_time);
+
 	const Common::Timer::Value now_ticks = Common::Timer::GetCurrentValue();
 	const Common::Timer::Value ticks_diff = now_ticks - s_last_update_time.GetStartValue();
 	const float time = Common::Timer::ConvertValueToSeconds(ticks_diff);
@@ -142,10 +243,17 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit)
 		return;
 
 	s_last_update_time.ResetTo(now_ticks);
+	s_update_count++;
 	s_worst_frame_time = s_worst_frame_time_accumulator;
 	s_worst_frame_time_accumulator = 0.0f;
 	s_average_frame_time = s_average_frame_time_accumulator / static_cast<float>(s_frames_since_last_update);
 	s_average_frame_time_accumulator = 0.0f;
+	s_average_present_latency = s_latency_samples_since_last_update ?
+		(s_present_latency_accumulator / static_cast<float>(s_latency_samples_since_last_update)) : 0.0f;
+	s_worst_present_latency = s_worst_present_latency_accumulator;
+	s_present_latency_accumulator = 0.0f;
+	s_worst_present_latency_accumulator = 0.0f;
+	s_latency_samples_since_last_update = 0;
 	s_fps = static_cast<float>(s_frames_since_last_update) / time;
 	s_average_gpu_time = s_accumulated_gpu_time / static_cast<float>(s_frames_since_last_update);
 	s_gpu_usage = s_accumulated_gpu_time / (time * 10.0f);
@@ -171,6 +279,10 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit)
 	s_gs_privileged_register_writes_since_last_update = 0;
 	s_gs_framebuffer_blits_since_last_update = 0;
 
+	s_audio_latency = SPU2GetOutputLatencyMS();
+	s_audio_target_latency = SPU2GetTargetLatencyMS();
+	s_audio_underruns = SPU2GetUnderrunCount();
+
 	const u64 ticks = GetCPUTicks();
 	const u64 ticks_delta = ticks - s_last_ticks;
 	s_last_ticks = ticks;
@@ -199,6 +311,23 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit)
 	s_gs_thread_time = static_cast<double>(gs_delta) * time_divider;
 	s_vu_thread_time = static_cast<double>(vu_delta) * time_divider;
 
+	const auto collect_wait_stats = [](VU_Thread::WaitStats& stats, float* time, std::array<u32, VU_Thread::WAIT_HISTOGRAM_BUCKETS>* histogram) {
+		*time = static_cast<float>(static_cast<double>(stats.total_ns.exchange(0, std::memory_order_relaxed)) / 1000000.0 /
+								   static_cast<double>(s_frames_since_last_update));
+		for (u32 i = 0; i < VU_Thread::WAIT_HISTOGRAM_BUCKETS; i++)
+			(*histogram)[i] = stats.histogram[i].exchange(0, std::memory_order_relaxed);
+	};
+	collect_wait_stats(vu1Thread.eeWaitStats, &s_vu_ee_wait_time, &s_vu_ee_wait_histogram);
+	collect_wait_stats(vu1Thread.vuIdleStats, &s_vu_idle_time, &s_vu_idle_histogram);
+
+	SysMtgsThread& mtgs = GetMTGS();
+	s_gs_vsync_wait_time = static_cast<float>(static_cast<double>(mtgs.m_VsyncWaitNs.exchange(0, std::memory_order_relaxed)) /
+											  1000000.0 / static_cast<double>(s_frames_since_last_update));
+	s_gs_readback_wait_time = static_cast<float>(static_cast<double>(mtgs.m_ReadbackWaitNs.exchange(0, std::memory_order_relaxed)) /
+												 1000000.0 / static_cast<double>(s_frames_since_last_update));
+	s_gs_readbacks = mtgs.m_ReadbackCount.exchange(0, std::memory_order_relaxed);
+	s_gs_readback_drains = mtgs.m_ReadbackDrainCount.exchange(0, std::memory_order_relaxed);
+
 	for (GSSWThreadStats& thread : s_gs_sw_threads)
 	{
 		const u64 time = thread.handle.GetCPUTime();
@@ -208,6 +337,9 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit)
 		thread.time = static_cast<double>(delta) * time_divider;
 	}
 
+	if (!s_metrics_export_path.empty())
+		WriteMetricsExport();
+
 	s_frames_since_last_update = 0;
 	s_presents_since_last_update = 0;
 
@@ -220,6 +352,237 @@ void PerformanceMetrics::OnGPUPresent(float gpu_time)
 {
 	s_accumulated_gpu_time += gpu_time;
 	s_presents_since_last_update++;
+	s_last_gpu_time = gpu_time;
+}
+
+static void WriteFrameTraceLine(float frame_time)
+{
+	const double ms_per_tick = 1000.0 / static_cast<double>(Threading::GetThreadTicksPerSecond());
+	const u64 cpu_time = s_cpu_thread_handle.GetCPUTime();
+	const u64 gs_time = GetMTGS().GetThreadHandle().GetCPUTime();
+	const u64 vu_time = THREAD_VU1 ? vu1Thread.GetThreadHandle().GetCPUTime() : 0;
+
+	const double values[std::size(s_frame_trace_columns)] = {frame_time, s_last_present_latency, s_last_gpu_time,
+		static_cast<double>(cpu_time - s_trace_last_cpu_time) * ms_per_tick,
+		static_cast<double>(gs_time - s_trace_last_gs_time) * ms_per_tick,
+		static_cast<double>(vu_time - s_trace_last_vu_time) * ms_per_tick,
+		g_perfmon.GetLastFrame(GSPerfMon::DrawCalls), g_perfmon.GetLastFrame(GSPerfMon::Prim),
+		g_perfmon.GetLastFrame(GSPerfMon::Readbacks), g_perfmon.GetLastFrame(GSPerfMon::TextureUploads),
+		g_perfmon.GetLastFrame(GSPerfMon::TextureCopies)};
+
+	if (s_frame_trace_json)
+	{
+		std::fprintf(s_frame_trace_file, "%s\n\t\t{\"frame\": %llu", (s_frame_trace_frames > 0) ? "," : "",
+			static_cast<unsigned long long>(s_frame_number));
+		for (u32 i = 0; i < std::size(values); i++)
+			std::fprintf(s_frame_trace_file, ", \"%s\": %.*f", s_frame_trace_columns[i], (i < FRAME_TRACE_TIME_COLUMNS) ? 3 : 0, values[i]);
+		std::fputc('}', s_frame_trace_file);
+	}
+	else
+	{
+		std::fprintf(s_frame_trace_file, "%llu", static_cast<unsigned long long>(s_frame_number));
+		for (u32 i = 0; i < std::size(values); i++)
+			std::fprintf(s_frame_trace_file, ",%.*f", (i < FRAME_TRACE_TIME_COLUMNS) ? 3 : 0, values[i]);
+		std::fputc('\n', s_frame_trace_file);
+	}
+
+	for (u32 i = 0; i < std::size(values); i++)
+		s_frame_trace_totals[i] += values[i];
+	s_frame_trace_frames++;
+
+	s_trace_last_cpu_time = cpu_time;
+	s_trace_last_gs_time = gs_time;
+	s_trace_last_vu_time = vu_time;
+	s_last_gpu_time = 0.0f;
+	s_last_present_latency = 0.0f;
+}
+
+bool PerformanceMetrics::StartFrameTrace(const std::string& path)
+{
+	StopFrameTrace();
+
+	s_frame_trace_file = FileSystem::OpenCFile(path.c_str(), "wb");
+	if (!s_frame_trace_file)
+	{
+		Console.Error("Failed to open frame trace '%s'", path.c_str());
+		return false;
+	}
+
+	s_frame_trace_json = StringUtil::EndsWithNoCase(path, ".json");
+	s_frame_trace_frames = 0;
+	s_frame_trace_totals = {};
+
+	// GPU times are only collected while something is asking for them.
+	HostDisplay* const display = Host::GetHostDisplay();
+	if (display)
+		display->SetGPUTimingEnabled(true);
+
+	if (s_frame_trace_json)
+	{
+		const char* api_name = display ? HostDisplay::RenderAPIToString(display->GetRenderAPI()) : "None";
+		const char* hw_sw_name = (GSConfig.Renderer == GSRendererType::Null) ? " Null" : (GSConfig.UseHardwareRenderer() ? " HW" : " SW");
+		std::fprintf(s_frame_trace_file, "{\n\t\"renderer\": \"%s%s\",\n\t\"frames\": [", api_name, hw_sw_name);
+	}
+	else
+	{
+		std::fputs("frame", s_frame_trace_file);
+		for (const char* column : s_frame_trace_columns)
+			std::fprintf(s_frame_trace_file, ",%s", column);
+		std::fputc('\n', s_frame_trace_file);
+	}
+
+	s_trace_last_cpu_time = s_cpu_thread_handle.GetCPUTime();
+	s_trace_last_gs_time = GetMTGS().GetThreadHandle().GetCPUTime();
+	s_trace_last_vu_time = THREAD_VU1 ? vu1Thread.GetThreadHandle().GetCPUTime() : 0;
+	Console.WriteLn("Writing frame trace to '%s'", path.c_str());
+	return true;
+}
+
+void PerformanceMetrics::StopFrameTrace()
+{
+	if (!s_frame_trace_file)
+		return;
+
+	if (s_frame_trace_json)
+	{
+		// Averages per frame, plus the wall time of the whole run so benchmarks can compare totals.
+		const double frames = static_cast<double>(std::max<u64>(s_frame_trace_frames, 1));
+		std::fprintf(s_frame_trace_file, "\n\t],\n\t\"summary\": {\"frames\": %llu, \"total_ms\": %.3f",
+			static_cast<unsigned long long>(s_frame_trace_frames), s_frame_trace_totals[0]);
+		for (u32 i = 0; i < std::size(s_frame_trace_columns); i++)
+			std::fprintf(s_frame_trace_file, ", \"%s\": %.3f", s_frame_trace_columns[i], s_frame_trace_totals[i] / frames);
+		std::fputs("}\n}\n", s_frame_trace_file);
+	}
+
+	std::fclose(s_frame_trace_file);
+	s_frame_trace_file = nullptr;
+
+	if (HostDisplay* const display = Host::GetHostDisplay(); display && !GSConfig.OsdShowGPU && !GSConfig.DynamicResolution)
+		display->SetGPUTimingEnabled(false);
+}
+
+bool PerformanceMetrics::IsFrameTraceActive()
+{
+	return s_frame_trace_file != nullptr;
+}
+
+static void WriteMetricsExport()
+{
+	s_metrics_gs_readbacks_total += s_gs_readbacks;
+	s_metrics_gs_readback_drains_total += s_gs_readback_drains;
+
+	std::string out;
+	out.reserve(4096);
+	auto out_it = std::back_inserter(out);
+	const auto family = [&out_it](const char* name, const char* type, const char* help) {
+		fmt::format_to(out_it, "# HELP {} {}\n# TYPE {} {}\n", name, help, name, type);
+	};
+	const auto sample = [&out_it](const char* name, const char* labels, double value) {
+		if (labels)
+			fmt::format_to(out_it, "{}{{{}}} {}\n", name, labels, value);
+		else
+			fmt::format_to(out_it, "{} {}\n", name, value);
+	};
+	const auto metric = [&family, &sample](const char* name, const char* type, const char* help, double value) {
+		family(name, type, help);
+		sample(name, nullptr, value);
+	};
+
+#ifdef PCSX2_CORE
+	const std::string serial(VMManager::GetGameSerial());
+#else
+	const std::string serial;
+#endif
+	HostDisplay* const display = Host::GetHostDisplay();
+	family("pcsx2_info", "gauge", "Running game and renderer.");
+	fmt::format_to(out_it, "pcsx2_info{{serial=\"{}\",renderer=\"{}{}\"}} 1\n", serial,
+		display ? HostDisplay::RenderAPIToString(display->GetRenderAPI()) : "None",
+		(GSConfig.Renderer == GSRendererType::Null) ? " Null" : (GSConfig.UseHardwareRenderer() ? " HW" : " SW"));
+
+	metric("pcsx2_frames_total", "counter", "Frames presented.", static_cast<double>(s_frame_number));
+	metric("pcsx2_fps", "gauge", "Frames presented per second.", s_fps);
+	metric("pcsx2_internal_fps", "gauge", "Frames the game rendered per second, 0 when unknown.", s_internal_fps);
+	metric("pcsx2_speed_percent", "gauge", "Emulation speed relative to the console.", PerformanceMetrics::GetSpeed());
+
+	family("pcsx2_frame_time_ms", "gauge", "Frame time over the last update interval.");
+	sample("pcsx2_frame_time_ms", "stat=\"average\"", s_average_frame_time);
+	sample("pcsx2_frame_time_ms", "stat=\"worst\"", s_worst_frame_time);
+	family("pcsx2_present_latency_ms", "gauge", "Time from the EE finishing a frame to it being presented.");
+	sample("pcsx2_present_latency_ms", "stat=\"average\"", s_average_present_latency);
+	sample("pcsx2_present_latency_ms", "stat=\"worst\"", s_worst_present_latency);
+
+	family("pcsx2_thread_usage_percent", "gauge", "CPU usage of the emulation threads.");
+	sample("pcsx2_thread_usage_percent", "thread=\"ee\"", s_cpu_thread_usage);
+	sample("pcsx2_thread_usage_percent", "thread=\"gs\"", s_gs_thread_usage);
+	if (THREAD_VU1)
+		sample("pcsx2_thread_usage_percent", "thread=\"vu\"", s_vu_thread_usage);
+	for (u32 i = 0; i < s_gs_sw_threads.size(); i++)
+		sample("pcsx2_thread_usage_percent", fmt::format("thread=\"sw{}\"", i).c_str(), s_gs_sw_threads[i].usage);
+	family("pcsx2_thread_time_ms", "gauge", "CPU time of the emulation threads per frame.");
+	sample("pcsx2_thread_time_ms", "thread=\"ee\"", s_cpu_thread_time);
+	sample("pcsx2_thread_time_ms", "thread=\"gs\"", s_gs_thread_time);
+	if (THREAD_VU1)
+		sample("pcsx2_thread_time_ms", "thread=\"vu\"", s_vu_thread_time);
+	for (u32 i = 0; i < s_gs_sw_threads.size(); i++)
+		sample("pcsx2_thread_time_ms", fmt::format("thread=\"sw{}\"", i).c_str(), s_gs_sw_threads[i].time);
+
+	// GPU times are only collected while the OSD or dynamic resolution use them.
+	if (GSConfig.OsdShowGPU || GSConfig.DynamicResolution || s_frame_trace_file)
+	{
+		metric("pcsx2_gpu_usage_percent", "gauge", "Host GPU usage.", s_gpu_usage);
+		metric("pcsx2_gpu_time_ms", "gauge", "Host GPU time per frame.", s_average_gpu_time);
+	}
+
+	family("pcsx2_ee_wait_ms", "gauge", "EE time per frame spent waiting on another thread.");
+	sample("pcsx2_ee_wait_ms", "on=\"vu\"", s_vu_ee_wait_time);
+	sample("pcsx2_ee_wait_ms", "on=\"gs_vsync\"", s_gs_vsync_wait_time);
+	sample("pcsx2_ee_wait_ms", "on=\"gs_readback\"", s_gs_readback_wait_time);
+	metric("pcsx2_vu_idle_ms", "gauge", "VU thread time per frame spent waiting for work.", s_vu_idle_time);
+	metric("pcsx2_gs_readbacks_total", "counter", "GS local memory readbacks.", static_cast<double>(s_metrics_gs_readbacks_total));
+	metric("pcsx2_gs_readback_drains_total", "counter", "GS readbacks which waited for queued frames.",
+		static_cast<double>(s_metrics_gs_readback_drains_total));
+
+	// GS counters are averaged per frame over the GSPerfMon update period.
+	family("pcsx2_gs_per_frame", "gauge", "GS work per frame.");
+	static constexpr std::pair<GSPerfMon::counter_t, const char*> gs_counters[] = {{GSPerfMon::DrawCalls, "draw_calls"},
+		{GSPerfMon::Prim, "primitives"}, {GSPerfMon::Readbacks, "readbacks"}, {GSPerfMon::Barriers, "barriers"},
+		{GSPerfMon::TextureUploads, "texture_uploads"}, {GSPerfMon::TextureCopies, "texture_copies"}};
+	for (const auto& [counter, name] : gs_counters)
+		sample("pcsx2_gs_per_frame", fmt::format("counter=\"{}\"", name).c_str(), g_perfmon.Get(counter));
+
+	metric("pcsx2_audio_latency_ms", "gauge", "Audio buffered for output.", s_audio_latency);
+	metric("pcsx2_audio_target_latency_ms", "gauge", "Audio buffering target.", s_audio_target_latency);
+	metric("pcsx2_audio_underruns_total", "counter", "Audio output underruns.", static_cast<double>(s_audio_underruns));
+
+	// Scrapers can catch the file half written, so write a temporary one and rename it over the old.
+	const std::string temp_path(s_metrics_export_path + ".tmp");
+	if (!FileSystem::WriteStringToFile(temp_path.c_str(), out) ||
+		!FileSystem::RenamePath(temp_path.c_str(), s_metrics_export_path.c_str()))
+	{
+		Console.Error("Failed to write metrics to '%s', stopping export.", s_metrics_export_path.c_str());
+		s_metrics_export_path.clear();
+	}
+}
+
+void PerformanceMetrics::SetMetricsExportPath(std::string path)
+{
+	if (s_metrics_export_path == path)
+		return;
+
+	// Don't leave the last values behind for something to keep alerting on.
+	if (!s_metrics_export_path.empty())
+		FileSystem::DeleteFilePath(s_metrics_export_path.c_str());
+
+	s_metrics_export_path = std::move(path);
+	s_metrics_gs_readbacks_total = 0;
+	s_metrics_gs_readback_drains_total = 0;
+	if (!s_metrics_export_path.empty())
+		Console.WriteLn("Exporting metrics to '%s'", s_metrics_export_path.c_str());
+}
+
+void PerformanceMetrics::OnFrameQueued(u64 queued_ticks)
+{
+	s_queued_frame_ticks = queued_ticks;
 }
 
 void PerformanceMetrics::SetCPUThread(Threading::ThreadHandle thread)
@@ -250,6 +613,11 @@ u64 PerformanceMetrics::GetFrameNumber()
 	return s_frame_number;
 }
 
+u64 PerformanceMetrics::GetUpdateCount()
+{
+	return s_update_count;
+}
+
 PerformanceMetrics::InternalFPSMethod PerformanceMetrics::GetInternalFPSMethod()
 {
 	return s_internal_fps_method;
@@ -275,6 +643,11 @@ float PerformanceMetrics::GetSpeed()
 	return (s_fps / s_vertical_frequency) * 100.0;
 }
 
+float PerformanceMetrics::GetVerticalFrequency()
+{
+	return s_vertical_frequency;
+}
+
 float PerformanceMetrics::GetAverageFrameTime()
 {
 	return s_average_frame_time;
@@ -285,6 +658,26 @@ float PerformanceMetrics::GetWorstFrameTime()
 	return s_worst_frame_time;
 }
 
+const std::array<float, PerformanceMetrics::FRAME_TIME_HISTORY_SIZE>& PerformanceMetrics::GetFrameTimeHistory()
+{
+	return s_frame_time_history;
+}
+
+u32 PerformanceMetrics::GetFrameTimeHistoryPos()
+{
+	return s_frame_time_history_pos;
+}
+
+float PerformanceMetrics::GetAveragePresentLatency()
+{
+	return s_average_present_latency;
+}
+
+float PerformanceMetrics::GetWorstPresentLatency()
+{
+	return s_worst_present_latency;
+}
+
 double PerformanceMetrics::GetCPUThreadUsage()
 {
 	return s_cpu_thread_usage;
@@ -315,6 +708,46 @@ float PerformanceMetrics::GetVUThreadAverageTime()
 	return s_vu_thread_time;
 }
 
+float PerformanceMetrics::GetVUThreadEEWaitTime()
+{
+	return s_vu_ee_wait_time;
+}
+
+float PerformanceMetrics::GetVUThreadIdleTime()
+{
+	return s_vu_idle_time;
+}
+
+u32 PerformanceMetrics::GetVUThreadEEWaitHistogram(u32 bucket)
+{
+	return s_vu_ee_wait_histogram[bucket];
+}
+
+float PerformanceMetrics::GetGSVsyncWaitTime()
+{
+	return s_gs_vsync_wait_time;
+}
+
+float PerformanceMetrics::GetGSReadbackWaitTime()
+{
+	return s_gs_readback_wait_time;
+}
+
+u32 PerformanceMetrics::GetGSReadbackCount()
+{
+	return s_gs_readbacks;
+}
+
+u32 PerformanceMetrics::GetGSReadbackDrainCount()
+{
+	return s_gs_readback_drains;
+}
+
+u32 PerformanceMetrics::GetVUThreadIdleHistogram(u32 bucket)
+{
+	return s_vu_idle_histogram[bucket];
+}
+
 u32 PerformanceMetrics::GetGSSWThreadCount()
 {
 	return static_cast<u32>(s_gs_sw_threads.size());
@@ -339,3 +772,18 @@ float PerformanceMetrics::GetGPUAverageTime()
 {
 	return s_average_gpu_time;
 }
+
+float PerformanceMetrics::GetAudioLatency()
+{
+	return s_audio_latency;
+}
+
+float PerformanceMetrics::GetAudioTargetLatency()
+{
+	return s_audio_target_latency;
+}
+
+u32 PerformanceMetrics::GetAudioUnderrunCount()
+{
+	return s_audio_underruns;
+}
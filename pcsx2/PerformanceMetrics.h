@@ -16,6 +16,9 @@
 #pragma once
 #include "common/Threading.h"
 
+#include <array>
+#include <string>
+
 namespace PerformanceMetrics
 {
 	enum class InternalFPSMethod
@@ -30,6 +33,10 @@ namespace PerformanceMetrics
 	void Update(bool gs_register_write, bool fb_blit);
 	void OnGPUPresent(float gpu_time);
 
+	/// Called on the GS thread with the GetCPUTicks() value at which the EE queued the frame
+	/// about to be presented.
+	void OnFrameQueued(u64 queued_ticks);
+
 	/// Sets the EE thread for CPU usage calculations.
 	void SetCPUThread(Threading::ThreadHandle thread);
 
@@ -42,15 +49,39 @@ namespace PerformanceMetrics
 
 	u64 GetFrameNumber();
 
+	/// Incremented each time the averaged metrics below are recalculated.
+	u64 GetUpdateCount();
+
 	InternalFPSMethod GetInternalFPSMethod();
 	bool IsInternalFPSValid();
 
 	float GetFPS();
 	float GetInternalFPS();
 	float GetSpeed();
+	float GetVerticalFrequency();
 	float GetAverageFrameTime();
 	float GetWorstFrameTime();
 
+	/// Frame times in milliseconds of the most recent frames, as a ring buffer. The oldest sample
+	/// is at GetFrameTimeHistoryPos(). Only read from the GS thread.
+	static constexpr u32 FRAME_TIME_HISTORY_SIZE = 150;
+	const std::array<float, FRAME_TIME_HISTORY_SIZE>& GetFrameTimeHistory();
+	u32 GetFrameTimeHistoryPos();
+
+	/// Per-frame trace (frame/present/GPU/thread times and GS counters). GS thread only.
+	/// Written as CSV, or as JSON with a per-frame average summary when the path ends in .json.
+	bool StartFrameTrace(const std::string& path);
+	void StopFrameTrace();
+	bool IsFrameTraceActive();
+
+	/// Rewrites the file with the metrics below in the Prometheus text format at each update, for a
+	/// textfile collector to pick up. An empty path stops exporting and removes the old file. GS thread only.
+	void SetMetricsExportPath(std::string path);
+
+	/// Time from the EE finishing a frame to the GS thread presenting it, in milliseconds.
+	float GetAveragePresentLatency();
+	float GetWorstPresentLatency();
+
 	double GetCPUThreadUsage();
 	double GetCPUThreadAverageTime();
 	float GetGSThreadUsage();
@@ -58,10 +89,30 @@ namespace PerformanceMetrics
 	float GetVUThreadUsage();
 	float GetVUThreadAverageTime();
 
+	/// MTVU waits over the last update interval: average milliseconds per frame, and the number
+	/// of waits in each MTVU.h histogram bucket.
+	float GetVUThreadEEWaitTime();
+	float GetVUThreadIdleTime();
+	u32 GetVUThreadEEWaitHistogram(u32 bucket);
+	u32 GetVUThreadIdleHistogram(u32 bucket);
+
+	/// EE waits on the GS thread over the last update interval, in average milliseconds per frame: at vsync
+	/// when VsyncQueueSize frames are already in flight, and at readbacks. Also the number of readbacks, and
+	/// of those that had to wait for queued frames to be presented first.
+	float GetGSVsyncWaitTime();
+	float GetGSReadbackWaitTime();
+	u32 GetGSReadbackCount();
+	u32 GetGSReadbackDrainCount();
+
 	u32 GetGSSWThreadCount();
 	double GetGSSWThreadUsage(u32 index);
 	double GetGSSWThreadAverageTime(u32 index);
 
 	float GetGPUUsage();
 	float GetGPUAverageTime();
+
+	/// Audio output buffering, sampled at the same interval as the other metrics.
+	float GetAudioLatency();
+	float GetAudioTargetLatency();
+	u32 GetAudioUnderrunCount();
 } // namespace PerformanceMetrics
@@ -89,6 +89,7 @@ void cpuReset()
 	memzero(cpuRegs);
 	memzero(fpuRegs);
 	memzero(tlb);
+	vtlb_UpdateCacheableRanges();
 
 	cpuRegs.pc				= 0xbfc00000; //set pc reg to stack
 	cpuRegs.CP0.n.Config	= 0x440;
@@ -630,6 +631,11 @@ void eeloadHook()
 	const std::string elf_override(StringUtil::wxStringToUTF8String(GetCoreThread().GetElfOverride()));
 #else
 	const std::string& elf_override(VMManager::Internal::GetElfOverride());
+
+	// The BIOS has finished initializing and is calling EELOAD for the first time. Nothing about
+	// the game has been touched yet, so this is the point a boot snapshot resumes from.
+	if (g_SkipBiosHack && !g_GameStarted && cpuRegs.GPR.n.a0.SD[0] == 0)
+		VMManager::Internal::EELOADStartingOnCPUThread();
 #endif
 
 	if (!elf_override.empty())
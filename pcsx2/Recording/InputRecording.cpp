@@ -809,6 +809,30 @@ bool InputRecording::Play(const std::string_view& filename)
 	return true;
 }
 
+bool InputRecording::PlayFromBoot(const std::string_view& filename)
+{
+	if (!inputRecordingData.OpenExisting(filename))
+		return false;
+
+	if (inputRecordingData.FromSaveState())
+	{
+		inputRec::consoleLog("Input recording starts on a save-state, it can't be replayed from boot.");
+		inputRecordingData.Close();
+		return false;
+	}
+
+	// The VM was just reset, so the recording and the internal frame counter both start at zero
+	// and there's nothing to lock or wait for.
+	startingFrame = 0;
+	frameCounter = 0;
+	initialLoad = false;
+	incrementUndo = false;
+	SetToReplayMode();
+	inputRec::consoleMultiLog({fmt::format("File: {}", inputRecordingData.GetFilename()),
+		fmt::format("Total Frames: {}", inputRecordingData.GetTotalFrames())});
+	return true;
+}
+
 std::string InputRecording::resolveGameName()
 {
 	std::string gameName;
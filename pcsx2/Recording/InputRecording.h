@@ -217,6 +217,9 @@ public:
 	// Play an existing input recording from a file
 	// TODO - Vaser - Calls a file dialog if it fails to locate the default base savestate
 	bool Play(const std::string_view& path);
+	// Replay a power-on recording on a VM that is booting right now, without restarting it
+	// Used for unattended regression runs from the command line
+	bool PlayFromBoot(const std::string_view& path);
 	// Stop the active input recording
 	void Stop();
 	// Logs the padData and redraws the virtualPad windows of active pads
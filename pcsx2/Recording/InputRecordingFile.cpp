@@ -61,9 +61,12 @@ bool InputRecordingFile::Close()
 	{
 		return false;
 	}
+	flushFrameData();
 	fclose(recordingFile);
 	recordingFile = nullptr;
 	filename = "";
+	frameData.clear();
+	dirtyBegin = dirtyEnd = 0;
 	return true;
 }
 
@@ -113,12 +116,14 @@ bool InputRecordingFile::open(const wxString path, bool newRecording)
 			totalFrames = 0;
 			undoCount = 0;
 			header.Init();
+			frameData.clear();
+			dirtyBegin = dirtyEnd = 0;
 			return true;
 		}
 	}
 	else if ((recordingFile = wxFopen(path, L"rb+")) != nullptr)
 	{
-		if (verifyRecordingFileHeader())
+		if (verifyRecordingFileHeader() && readFrameData())
 		{
 			filename = path;
 			return true;
@@ -151,12 +156,13 @@ bool InputRecordingFile::ReadKeyBuffer(u8& result, const uint& frame, const uint
 		return false;
 	}
 
-	long seek = getRecordingBlockSeekPoint(frame) + controllerInputBytes * port + bufIndex;
-	if (fseek(recordingFile, seek, SEEK_SET) != 0 || fread(&result, 1, 1, recordingFile) != 1)
+	const size_t offset = static_cast<size_t>(frame) * inputBytesPerFrame + controllerInputBytes * port + bufIndex;
+	if (offset >= frameData.size())
 	{
 		return false;
 	}
 
+	result = frameData[offset];
 	return true;
 }
 
@@ -167,8 +173,10 @@ void InputRecordingFile::SetTotalFrames(long frame)
 		return;
 	}
 	totalFrames = frame;
+	flushFrameData();
 	fseek(recordingFile, seekpointTotalFrames, SEEK_SET);
 	fwrite(&totalFrames, 4, 1, recordingFile);
+	fflush(recordingFile);
 }
 
 bool InputRecordingFile::WriteHeader()
@@ -192,14 +200,23 @@ bool InputRecordingFile::WriteKeyBuffer(const uint& frame, const uint port, cons
 		return false;
 	}
 
-	long seek = getRecordingBlockSeekPoint(frame) + 18 * port + bufIndex;
-
-	if (fseek(recordingFile, seek, SEEK_SET) != 0 || fwrite(&buf, 1, 1, recordingFile) != 1)
+	const size_t offset = static_cast<size_t>(frame) * inputBytesPerFrame + controllerInputBytes * port + bufIndex;
+	if (offset >= frameData.size())
 	{
-		return false;
+		frameData.resize((static_cast<size_t>(frame) + 1) * inputBytesPerFrame, 0);
 	}
 
-	fflush(recordingFile);
+	frameData[offset] = buf;
+	if (dirtyBegin == dirtyEnd)
+	{
+		dirtyBegin = offset;
+		dirtyEnd = offset + 1;
+	}
+	else
+	{
+		dirtyBegin = std::min(dirtyBegin, offset);
+		dirtyEnd = std::max(dirtyEnd, offset + 1);
+	}
 	return true;
 }
 
@@ -208,6 +225,42 @@ long InputRecordingFile::getRecordingBlockSeekPoint(const long& frame)
 	return headerSize + sizeof(bool) + frame * inputBytesPerFrame;
 }
 
+bool InputRecordingFile::flushFrameData()
+{
+	if (dirtyBegin == dirtyEnd)
+	{
+		return true;
+	}
+
+	const size_t begin = dirtyBegin;
+	const size_t size = dirtyEnd - dirtyBegin;
+	dirtyBegin = dirtyEnd = 0;
+	return fseek(recordingFile, getRecordingBlockSeekPoint(0) + static_cast<long>(begin), SEEK_SET) == 0 &&
+		fwrite(&frameData[begin], size, 1, recordingFile) == 1;
+}
+
+bool InputRecordingFile::readFrameData()
+{
+	dirtyBegin = dirtyEnd = 0;
+	frameData.clear();
+
+	const long start = getRecordingBlockSeekPoint(0);
+	if (fseek(recordingFile, 0, SEEK_END) != 0)
+	{
+		return false;
+	}
+
+	const long end = ftell(recordingFile);
+	if (end <= start)
+	{
+		return true;
+	}
+
+	frameData.resize(static_cast<size_t>(end - start));
+	return fseek(recordingFile, start, SEEK_SET) == 0 &&
+		fread(frameData.data(), frameData.size(), 1, recordingFile) == 1;
+}
+
 bool InputRecordingFile::verifyRecordingFileHeader()
 {
 	if (recordingFile == nullptr)
@@ -276,9 +329,12 @@ bool InputRecordingFile::Close()
 	{
 		return false;
 	}
+	flushFrameData();
 	fclose(recordingFile);
 	recordingFile = nullptr;
 	filename = "";
+	frameData.clear();
+	dirtyBegin = dirtyEnd = 0;
 	return true;
 }
 
@@ -328,12 +384,14 @@ bool InputRecordingFile::open(const std::string_view& path, bool newRecording)
 			totalFrames = 0;
 			undoCount = 0;
 			header.Init();
+			frameData.clear();
+			dirtyBegin = dirtyEnd = 0;
 			return true;
 		}
 	}
 	else if ((recordingFile = FileSystem::OpenCFile(path.data(), "rb+")) != nullptr)
 	{
-		if (verifyRecordingFileHeader())
+		if (verifyRecordingFileHeader() && readFrameData())
 		{
 			filename = path;
 			return true;
@@ -366,12 +424,13 @@ bool InputRecordingFile::ReadKeyBuffer(u8& result, const uint& frame, const uint
 		return false;
 	}
 
-	long seek = getRecordingBlockSeekPoint(frame) + controllerInputBytes * port + bufIndex;
-	if (fseek(recordingFile, seek, SEEK_SET) != 0 || fread(&result, 1, 1, recordingFile) != 1)
+	const size_t offset = static_cast<size_t>(frame) * inputBytesPerFrame + controllerInputBytes * port + bufIndex;
+	if (offset >= frameData.size())
 	{
 		return false;
 	}
 
+	result = frameData[offset];
 	return true;
 }
 
@@ -382,8 +441,10 @@ void InputRecordingFile::SetTotalFrames(long frame)
 		return;
 	}
 	totalFrames = frame;
+	flushFrameData();
 	fseek(recordingFile, seekpointTotalFrames, SEEK_SET);
 	fwrite(&totalFrames, 4, 1, recordingFile);
+	fflush(recordingFile);
 }
 
 bool InputRecordingFile::WriteHeader()
@@ -407,14 +468,23 @@ bool InputRecordingFile::WriteKeyBuffer(const uint& frame, const uint port, cons
 		return false;
 	}
 
-	long seek = getRecordingBlockSeekPoint(frame) + 18 * port + bufIndex;
-
-	if (fseek(recordingFile, seek, SEEK_SET) != 0 || fwrite(&buf, 1, 1, recordingFile) != 1)
+	const size_t offset = static_cast<size_t>(frame) * inputBytesPerFrame + controllerInputBytes * port + bufIndex;
+	if (offset >= frameData.size())
 	{
-		return false;
+		frameData.resize((static_cast<size_t>(frame) + 1) * inputBytesPerFrame, 0);
 	}
 
-	fflush(recordingFile);
+	frameData[offset] = buf;
+	if (dirtyBegin == dirtyEnd)
+	{
+		dirtyBegin = offset;
+		dirtyEnd = offset + 1;
+	}
+	else
+	{
+		dirtyBegin = std::min(dirtyBegin, offset);
+		dirtyEnd = std::max(dirtyEnd, offset + 1);
+	}
 	return true;
 }
 
@@ -423,6 +493,42 @@ long InputRecordingFile::getRecordingBlockSeekPoint(const long& frame)
 	return headerSize + sizeof(bool) + frame * inputBytesPerFrame;
 }
 
+bool InputRecordingFile::flushFrameData()
+{
+	if (dirtyBegin == dirtyEnd)
+	{
+		return true;
+	}
+
+	const size_t begin = dirtyBegin;
+	const size_t size = dirtyEnd - dirtyBegin;
+	dirtyBegin = dirtyEnd = 0;
+	return fseek(recordingFile, getRecordingBlockSeekPoint(0) + static_cast<long>(begin), SEEK_SET) == 0 &&
+		fwrite(&frameData[begin], size, 1, recordingFile) == 1;
+}
+
+bool InputRecordingFile::readFrameData()
+{
+	dirtyBegin = dirtyEnd = 0;
+	frameData.clear();
+
+	const long start = getRecordingBlockSeekPoint(0);
+	if (fseek(recordingFile, 0, SEEK_END) != 0)
+	{
+		return false;
+	}
+
+	const long end = ftell(recordingFile);
+	if (end <= start)
+	{
+		return true;
+	}
+
+	frameData.resize(static_cast<size_t>(end - start));
+	return fseek(recordingFile, start, SEEK_SET) == 0 &&
+		fread(frameData.data(), frameData.size(), 1, recordingFile) == 1;
+}
+
 bool InputRecordingFile::verifyRecordingFileHeader()
 {
 	if (recordingFile == nullptr)
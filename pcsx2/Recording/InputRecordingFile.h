@@ -105,8 +105,17 @@ private:
 	long totalFrames = 0;
 	unsigned long undoCount = 0;
 
+	// All frames of the recording, read in when opened. Key buffer reads and writes only touch this,
+	// written bytes are committed to the file once per frame in SetTotalFrames and on Close
+	std::vector<u8> frameData;
+	size_t dirtyBegin = 0;
+	size_t dirtyEnd = 0;
+
 	// Calculates the position of the current frame in the input recording
 	long getRecordingBlockSeekPoint(const long& frame);
+	// Writes the dirty range of frameData back to the file
+	bool flushFrameData();
+	bool readFrameData();
 	bool open(const wxString path, bool newRecording);
 	bool verifyRecordingFileHeader();
 };
@@ -200,8 +209,17 @@ private:
 	long totalFrames = 0;
 	unsigned long undoCount = 0;
 
+	// All frames of the recording, read in when opened. Key buffer reads and writes only touch this,
+	// written bytes are committed to the file once per frame in SetTotalFrames and on Close
+	std::vector<u8> frameData;
+	size_t dirtyBegin = 0;
+	size_t dirtyEnd = 0;
+
 	// Calculates the position of the current frame in the input recording
 	long getRecordingBlockSeekPoint(const long& frame);
+	// Writes the dirty range of frameData back to the file
+	bool flushFrameData();
+	bool readFrameData();
 	bool open(const std::string_view& path, bool newRecording);
 	bool verifyRecordingFileHeader();
 };
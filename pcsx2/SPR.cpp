@@ -462,35 +462,44 @@ void _dmaSPR1()   // toSPR work function
 			}
 			// Chain Mode
 
-			ptag = SPRdmaGetAddr(spr1ch.tadr, false); // Set memory pointer to TADR
-
-			if (!spr1ch.transfer("SPR1 Tag", ptag))
+			// Tags which don't move any data take no time, so walk straight on to the next one
+			// rather than bouncing through the event scheduler for each of them.
+			// Capped in case a game leaves an empty NEXT loop running.
+			for (int tags = 0; tags < 64; tags++)
 			{
-				done = true;
-				spr1finished = done;
-			}
+				ptag = SPRdmaGetAddr(spr1ch.tadr, false); // Set memory pointer to TADR
 
-			spr1ch.madr = ptag[1]._u32;	// MADR = ADDR field + SPR
+				if (!spr1ch.transfer("SPR1 Tag", ptag))
+				{
+					done = true;
+					spr1finished = done;
+				}
 
-			// Transfer dma tag if tte is set
-			if (spr1ch.chcr.TTE)
-			{
-				SPR_LOG("SPR TTE: %x_%x\n", ptag[3]._u32, ptag[2]._u32);
-				SPR1transfer(ptag, 1); // Transfer Tag
-			}
+				spr1ch.madr = ptag[1]._u32;	// MADR = ADDR field + SPR
+
+				// Transfer dma tag if tte is set
+				if (spr1ch.chcr.TTE)
+				{
+					SPR_LOG("SPR TTE: %x_%x\n", ptag[3]._u32, ptag[2]._u32);
+					SPR1transfer(ptag, 1); // Transfer Tag
+				}
 
-			SPR_LOG("spr1 dmaChain %8.8x_%8.8x size=%d, id=%d, addr=%lx taddr=%lx saddr=%lx",
-				ptag[1]._u32, ptag[0]._u32, spr1ch.qwc, ptag->ID, spr1ch.madr, spr1ch.tadr, spr1ch.sadr);
+				SPR_LOG("spr1 dmaChain %8.8x_%8.8x size=%d, id=%d, addr=%lx taddr=%lx saddr=%lx",
+					ptag[1]._u32, ptag[0]._u32, spr1ch.qwc, ptag->ID, spr1ch.madr, spr1ch.tadr, spr1ch.sadr);
 
-			done = hwDmacSrcChain(spr1ch, ptag->ID);
-			SPR1chain(); // Transfers the data set by the switch
+				done = hwDmacSrcChain(spr1ch, ptag->ID);
+				SPR1chain(); // Transfers the data set by the switch
 
-			if (spr1ch.chcr.TIE && ptag->IRQ) // Check TIE bit of CHCR and IRQ bit of tag
-			{
-				SPR_LOG("dmaIrq Set");
+				if (spr1ch.chcr.TIE && ptag->IRQ) // Check TIE bit of CHCR and IRQ bit of tag
+				{
+					SPR_LOG("dmaIrq Set");
 
-				//Console.WriteLn("SPR1 TIE");
-				done = true;
+					//Console.WriteLn("SPR1 TIE");
+					done = true;
+				}
+
+				if (done || cpuRegs.eCycle[DMAC_TO_SPR] != 0)
+					break;
 			}
 
 			spr1finished = done;
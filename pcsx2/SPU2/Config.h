@@ -83,6 +83,8 @@ extern int dplLevel;
 extern u32 OutputModule;
 extern int SndOutLatencyMS;
 extern int SynchMode;
+extern bool ThreadedOutput; // Run the timestretcher and output buffering on their own thread.
+extern bool AdaptiveLatency; // Let the timestretcher trim its target latency below SndOutLatencyMS.
 
 #if defined(_WIN32) && !defined(PCSX2_CORE)
 extern wchar_t dspPlugin[];
@@ -64,6 +64,8 @@ bool _visual_debug_enabled = false; // Windows-only feature
 u32 OutputModule = 0;
 int SndOutLatencyMS = 100;
 int SynchMode = 0; // Time Stretch, Async or Disabled.
+bool ThreadedOutput = false;
+bool AdaptiveLatency = false;
 
 int numSpeakers = 0;
 int dplLevel = 0;
@@ -101,6 +103,8 @@ void ReadSettings()
 
 	SndOutLatencyMS = Host::GetIntSettingValue("SPU2/Output", "Latency", 100);
 	SynchMode = Host::GetIntSettingValue("SPU2/Output", "SynchMode", 0);
+	ThreadedOutput = Host::GetBoolSettingValue("SPU2/Output", "ThreadedOutput", false);
+	AdaptiveLatency = Host::GetBoolSettingValue("SPU2/Output", "AdaptiveLatency", false);
 	numSpeakers = Host::GetIntSettingValue("SPU2/Output", "SpeakerConfiguration", 0);
 	dplLevel = Host::GetIntSettingValue("SPU2/Output", "DplDecodingLevel", 0);
 
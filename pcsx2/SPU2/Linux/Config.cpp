@@ -65,6 +65,8 @@ bool _visual_debug_enabled = false; // Windows-only feature
 u32 OutputModule = 0;
 int SndOutLatencyMS = 100;
 int SynchMode = 0; // Time Stretch, Async or Disabled.
+bool ThreadedOutput = false;
+bool AdaptiveLatency = false;
 
 int numSpeakers = 0;
 int dplLevel = 0;
@@ -114,6 +116,8 @@ void ReadSettings()
 
 	SndOutLatencyMS = CfgReadInt(L"OUTPUT", L"Latency", 100);
 	SynchMode = CfgReadInt(L"OUTPUT", L"Synch_Mode", 0);
+	ThreadedOutput = CfgReadBool(L"OUTPUT", L"Threaded_Output", false);
+	AdaptiveLatency = CfgReadBool(L"OUTPUT", L"Adaptive_Latency", false);
 	numSpeakers = CfgReadInt(L"OUTPUT", L"SpeakerConfiguration", 0);
 
 	SoundtouchCfg::ReadSettings();
@@ -161,6 +165,8 @@ void WriteSettings()
 	CfgWriteStr(L"OUTPUT", L"Output_Module", mods[OutputModule]->GetIdent());
 	CfgWriteInt(L"OUTPUT", L"Latency", SndOutLatencyMS);
 	CfgWriteInt(L"OUTPUT", L"Synch_Mode", SynchMode);
+	CfgWriteBool(L"OUTPUT", L"Threaded_Output", ThreadedOutput);
+	CfgWriteBool(L"OUTPUT", L"Adaptive_Latency", AdaptiveLatency);
 	CfgWriteInt(L"OUTPUT", L"SpeakerConfiguration", numSpeakers);
 
 	SoundtouchCfg::WriteSettings();
@@ -16,6 +16,7 @@
 #include "PrecompiledHeader.h"
 #include "Global.h"
 #include "common/Assertions.h"
+#include <immintrin.h>
 
 void ADMAOutLogWrite(void* lpData, u32 ulSize);
 
@@ -555,7 +556,9 @@ static __forceinline void spu2M_WriteFast(u32 addr, s16 value)
 }
 
 
-static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
+// Returns the voice sample with ADSR applied; the stereo volume and the output gates are
+// applied for all voices at once by MixCoreVoices.
+static __forceinline s32 MixVoice(uint coreidx, uint voiceidx)
 {
 	V_Core& thiscore(Cores[coreidx]);
 	V_Voice& vc(thiscore.Voices[voiceidx]);
@@ -576,7 +579,6 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 
 	UpdatePitch(coreidx, voiceidx);
 
-	StereoOut32 voiceOut(0, 0);
 	s32 Value = 0;
 
 	if (vc.ADSR.Phase > 0)
@@ -626,8 +628,6 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 
 		if (IsDevBuild)
 			DebugCores[coreidx].Voices[voiceidx].displayPeak = std::max(DebugCores[coreidx].Voices[voiceidx].displayPeak, (s32)vc.OutX);
-
-		voiceOut = ApplyVolume(StereoOut32(Value, Value), vc.Volume);
 	}
 	else
 	{
@@ -641,26 +641,84 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 	else if (voiceidx == 3)
 		spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + OutPos, Value);
 
-	return voiceOut;
+	return Value;
 }
 
 const VoiceMixSet VoiceMixSet::Empty((StereoOut32()), (StereoOut32())); // Don't use SteroOut32::Empty because C++ doesn't make any dep/order checks on global initializers.
 
+// Four lanes of MulShr32 (SSE4.1 pmuldq only multiplies the even lanes, so the odd ones are
+// shifted down, multiplied separately and blended back in).
+static __forceinline __m128i MulShr32x4(__m128i srcval, __m128i mulval)
+{
+	const __m128i even = _mm_srli_epi64(_mm_mul_epi32(srcval, mulval), 32);
+	const __m128i odd = _mm_mul_epi32(_mm_srli_epi64(srcval, 32), _mm_srli_epi64(mulval, 32));
+	return _mm_blend_epi16(even, odd, 0xCC);
+}
+
+static __forceinline s32 HorizontalSum(__m128i v)
+{
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(v);
+}
+
 static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
 {
 	V_Core& thiscore(Cores[coreidx]);
 
+	static_assert((V_Core::NumVoices % 4) == 0, "Voice count must be a multiple of the vector width");
+
+	// Decoding, pitch and ADSR have to stay per voice (they branch heavily and can raise
+	// IRQs), but the volume and gate stage is identical for every voice, so it's gathered
+	// into flat arrays and done four voices at a time. Same integer ops as the scalar
+	// ApplyVolume/gate path, so the result is bit-identical.
+	alignas(16) s32 values[V_Core::NumVoices];
+	alignas(16) s32 vol_l[V_Core::NumVoices];
+	alignas(16) s32 vol_r[V_Core::NumVoices];
+	alignas(16) s32 gate_dry_l[V_Core::NumVoices];
+	alignas(16) s32 gate_dry_r[V_Core::NumVoices];
+	alignas(16) s32 gate_wet_l[V_Core::NumVoices];
+	alignas(16) s32 gate_wet_r[V_Core::NumVoices];
+
 	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
 	{
-		StereoOut32 VVal(MixVoice(coreidx, voiceidx));
+		// Inactive voices return 0, which the volume stage keeps at 0.
+		values[voiceidx] = MixVoice(coreidx, voiceidx) << 1;
+
+		const V_Voice& vc = thiscore.Voices[voiceidx];
+		vol_l[voiceidx] = vc.Volume.Left.Value;
+		vol_r[voiceidx] = vc.Volume.Right.Value;
+
+		const V_VoiceGates& gates = thiscore.VoiceGates[voiceidx];
+		gate_dry_l[voiceidx] = gates.DryL;
+		gate_dry_r[voiceidx] = gates.DryR;
+		gate_wet_l[voiceidx] = gates.WetL;
+		gate_wet_r[voiceidx] = gates.WetR;
+	}
 
-		// Note: Results from MixVoice are ranged at 16 bits.
+	__m128i dry_l = _mm_setzero_si128();
+	__m128i dry_r = _mm_setzero_si128();
+	__m128i wet_l = _mm_setzero_si128();
+	__m128i wet_r = _mm_setzero_si128();
 
-		dest.Dry.Left += VVal.Left & thiscore.VoiceGates[voiceidx].DryL;
-		dest.Dry.Right += VVal.Right & thiscore.VoiceGates[voiceidx].DryR;
-		dest.Wet.Left += VVal.Left & thiscore.VoiceGates[voiceidx].WetL;
-		dest.Wet.Right += VVal.Right & thiscore.VoiceGates[voiceidx].WetR;
+	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; voiceidx += 4)
+	{
+		const __m128i value = _mm_load_si128(reinterpret_cast<const __m128i*>(&values[voiceidx]));
+		const __m128i left = MulShr32x4(value, _mm_load_si128(reinterpret_cast<const __m128i*>(&vol_l[voiceidx])));
+		const __m128i right = MulShr32x4(value, _mm_load_si128(reinterpret_cast<const __m128i*>(&vol_r[voiceidx])));
+
+		// Note: Results from the volume stage are ranged at 16 bits.
+
+		dry_l = _mm_add_epi32(dry_l, _mm_and_si128(left, _mm_load_si128(reinterpret_cast<const __m128i*>(&gate_dry_l[voiceidx]))));
+		dry_r = _mm_add_epi32(dry_r, _mm_and_si128(right, _mm_load_si128(reinterpret_cast<const __m128i*>(&gate_dry_r[voiceidx]))));
+		wet_l = _mm_add_epi32(wet_l, _mm_and_si128(left, _mm_load_si128(reinterpret_cast<const __m128i*>(&gate_wet_l[voiceidx]))));
+		wet_r = _mm_add_epi32(wet_r, _mm_and_si128(right, _mm_load_si128(reinterpret_cast<const __m128i*>(&gate_wet_r[voiceidx]))));
 	}
+
+	dest.Dry.Left += HorizontalSum(dry_l);
+	dest.Dry.Right += HorizontalSum(dry_r);
+	dest.Wet.Left += HorizontalSum(wet_l);
+	dest.Wet.Right += HorizontalSum(wet_r);
 }
 
 StereoOut32 V_Core::Mix(const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext)
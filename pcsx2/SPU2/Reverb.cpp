@@ -16,6 +16,7 @@
 #include "PrecompiledHeader.h"
 #include "Global.h"
 #include <array>
+#include <immintrin.h>
 
 __forceinline s32 V_Core::RevbGetIndexer(s32 offset)
 {
@@ -93,18 +94,55 @@ static constexpr std::array<s32, NUM_TAPS> filter_coefs = {
 	-1,
 };
 
-s32 __forceinline V_Core::ReverbDownsample(bool right)
+// The downsampler runs every tap (the zeros cost nothing in a vector), padded to a multiple of 4.
+static constexpr u32 NUM_DOWN_TAPS = 40;
+// The upsampler only runs the even taps, the odd ones only contribute on the other phase.
+static constexpr u32 NUM_UP_TAPS = 20;
+
+alignas(16) static constexpr std::array<s32, NUM_DOWN_TAPS> down_coefs = []() {
+	std::array<s32, NUM_DOWN_TAPS> ret = {};
+	for (u32 i = 0; i < NUM_TAPS; i++)
+		ret[i] = filter_coefs[i];
+	return ret;
+}();
+
+alignas(16) static constexpr std::array<s32, NUM_UP_TAPS> up_coefs = []() {
+	std::array<s32, NUM_UP_TAPS> ret = {};
+	for (u32 i = 0; i < NUM_UP_TAPS; i++)
+		ret[i] = filter_coefs[i * 2];
+	return ret;
+}();
+
+// Writes to one of the mirrored filter histories.
+static __forceinline void RevbPushSample(s32* buf, u32 pos, s32 value)
+{
+	buf[pos & 63] = value;
+	buf[(pos & 63) + 64] = value;
+}
+
+template <u32 count>
+static __forceinline s32 RevbFilter(const s32* samples, const s32* coefs)
 {
-	s32 out = 0;
+	static_assert((count % 4) == 0, "Tap count must be a multiple of the vector width");
 
-	// Skipping the 0 coefs.
-	for (u32 i = 0; i < NUM_TAPS; i += 2)
+	__m128i acc = _mm_setzero_si128();
+	for (u32 i = 0; i < count; i += 4)
 	{
-		out += RevbDownBuf[right][((RevbSampleBufPos - NUM_TAPS) + i) & 63] * filter_coefs[i];
+		const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+		const __m128i c = _mm_load_si128(reinterpret_cast<const __m128i*>(coefs + i));
+		acc = _mm_add_epi32(acc, _mm_mullo_epi32(s, c));
 	}
 
-	// We also skipped the middle so add that in.
-	out += RevbDownBuf[right][((RevbSampleBufPos - NUM_TAPS) + 19) & 63] * filter_coefs[19];
+	acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+	acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(acc);
+}
+
+s32 __forceinline V_Core::ReverbDownsample(bool right)
+{
+	// The window never runs past the mirrored half, so no per-tap wrapping is needed.
+	const s32* samples = &RevbDownBuf[right][(RevbSampleBufPos - NUM_TAPS) & 63];
+	s32 out = RevbFilter<NUM_DOWN_TAPS>(samples, down_coefs.data());
 
 	out >>= 15;
 	Clampify(out, (s32)INT16_MIN, (s32)INT16_MAX);
@@ -115,24 +153,18 @@ s32 __forceinline V_Core::ReverbDownsample(bool right)
 
 StereoOut32 __forceinline V_Core::ReverbUpsample(bool phase)
 {
-	s32 ls = 0, rs = 0;
+	const u32 start = ((RevbSampleBufPos - NUM_TAPS) >> 1) & 63;
+	s32 ls, rs;
 
 	if (phase)
 	{
-		ls += RevbUpBuf[0][(((RevbSampleBufPos - NUM_TAPS) >> 1) + 9) & 63] * filter_coefs[19];
-		rs += RevbUpBuf[1][(((RevbSampleBufPos - NUM_TAPS) >> 1) + 9) & 63] * filter_coefs[19];
+		ls = RevbUpBuf[0][start + 9] * filter_coefs[19];
+		rs = RevbUpBuf[1][start + 9] * filter_coefs[19];
 	}
 	else
 	{
-
-		for (u32 i = 0; i < (NUM_TAPS >> 1) + 1; i++)
-		{
-			ls += RevbUpBuf[0][(((RevbSampleBufPos - NUM_TAPS) >> 1) + i) & 63] * filter_coefs[i * 2];
-		}
-		for (u32 i = 0; i < (NUM_TAPS >> 1) + 1; i++)
-		{
-			rs += RevbUpBuf[1][(((RevbSampleBufPos - NUM_TAPS) >> 1) + i) & 63] * filter_coefs[i * 2];
-		}
+		ls = RevbFilter<NUM_UP_TAPS>(&RevbUpBuf[0][start], up_coefs.data());
+		rs = RevbFilter<NUM_UP_TAPS>(&RevbUpBuf[1][start], up_coefs.data());
 	}
 
 	ls >>= 14;
@@ -152,8 +184,8 @@ StereoOut32 V_Core::DoReverb(const StereoOut32& Input)
 		return StereoOut32::Empty;
 	}
 
-	RevbDownBuf[0][RevbSampleBufPos & 63] = Input.Left;
-	RevbDownBuf[1][RevbSampleBufPos & 63] = Input.Right;
+	RevbPushSample(RevbDownBuf[0], RevbSampleBufPos, Input.Left);
+	RevbPushSample(RevbDownBuf[1], RevbSampleBufPos, Input.Right);
 
 	bool R = Cycles & 1;
 
@@ -233,7 +265,7 @@ StereoOut32 V_Core::DoReverb(const StereoOut32& Input)
 		_spu2mem[apf2_dst] = clamp_mix(apf2);
 	}
 
-	RevbUpBuf[R][(RevbSampleBufPos >> 1) & 63] = clamp_mix(out);
+	RevbPushSample(RevbUpBuf[R], RevbSampleBufPos >> 1, clamp_mix(out));
 
 	RevbSampleBufPos++;
 
@@ -16,6 +16,11 @@
 #include "PrecompiledHeader.h"
 #include "Global.h"
 #include "common/Assertions.h"
+#include "common/boost_spsc_queue.hpp"
+#include "common/Threading.h"
+
+#include <atomic>
+#include <thread>
 
 
 StereoOut32 StereoOut32::Empty(0, 0);
@@ -99,6 +104,7 @@ alignas(4) volatile s32 SndBuffer::m_rpos;
 alignas(4) volatile s32 SndBuffer::m_wpos;
 
 bool SndBuffer::m_underrun_freeze;
+static std::atomic<u32> s_underrun_count{0};
 StereoOut32* SndBuffer::sndTempBuffer = nullptr;
 StereoOut16* SndBuffer::sndTempBuffer16 = nullptr;
 int SndBuffer::sndTempProgress = 0;
@@ -139,6 +145,7 @@ bool SndBuffer::CheckUnderrunStatus(int& nSamples, int& quietSampleCount)
 		quietSampleCount = nSamples - data;
 		nSamples = data;
 		m_underrun_freeze = true;
+		s_underrun_count.fetch_add(1, std::memory_order_relaxed);
 
 		if (SynchMode == 0) // TimeStrech on
 			timeStretchUnderrun();
@@ -149,6 +156,19 @@ bool SndBuffer::CheckUnderrunStatus(int& nSamples, int& quietSampleCount)
 	return true;
 }
 
+u32 SndBuffer::GetUnderrunCount()
+{
+	return s_underrun_count.load(std::memory_order_relaxed);
+}
+
+float SndBuffer::GetBufferedLatencyMS()
+{
+	if (!m_buffer)
+		return 0.0f;
+
+	return static_cast<float>(_GetApproximateDataInBuffer()) * 1000.0f / static_cast<float>(SampleRate);
+}
+
 int SndBuffer::_GetApproximateDataInBuffer()
 {
 	// WARNING: not necessarily 100% up to date by the time it's used, but it will have to do.
@@ -349,6 +369,67 @@ void SndBuffer::_WriteSamples(StereoOut32* bData, int nSamples)
 	_WriteSamples_Safe(bData, nSamples);
 }
 
+struct SndOutPacket
+{
+	StereoOut32 samples[SndOutPacketSize];
+};
+
+// ~340ms of audio at 48KHz; the EE only blocks if the output thread falls that far behind.
+static constexpr u32 OUTPUT_QUEUE_SIZE = 256;
+
+static std::thread s_output_thread;
+static Threading::WorkSema s_output_sema;
+static ringbuffer_base<SndOutPacket, OUTPUT_QUEUE_SIZE> s_output_queue;
+static std::atomic_bool s_output_thread_exit{false};
+
+void SndBuffer::ProcessPacket(StereoOut32* packet)
+{
+	if (SynchMode == 0) // TimeStrech on
+		timeStretchWrite(packet);
+	else
+		_WriteSamples(packet, SndOutPacketSize);
+}
+
+void SndBuffer::OutputThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("SPU2 Output");
+
+	// The timestretcher converts and receives in place, so it needs its own packet buffer.
+	SndOutPacket packet;
+	for (;;)
+	{
+		s_output_sema.WaitForWorkWithSpin();
+		if (s_output_thread_exit.load(std::memory_order_acquire))
+			break;
+
+		while (s_output_queue.pop(packet))
+			ProcessPacket(packet.samples);
+	}
+}
+
+void SndBuffer::StartOutputThread()
+{
+	s_output_thread_exit.store(false, std::memory_order_release);
+	s_output_thread = std::thread(&SndBuffer::OutputThreadEntryPoint);
+}
+
+void SndBuffer::StopOutputThread()
+{
+	if (!s_output_thread.joinable())
+		return;
+
+	WaitForOutputThread();
+	s_output_thread_exit.store(true, std::memory_order_release);
+	s_output_sema.NotifyOfWork();
+	s_output_thread.join();
+}
+
+void SndBuffer::WaitForOutputThread()
+{
+	if (s_output_thread.joinable())
+		s_output_sema.WaitForEmptyWithSpin();
+}
+
 bool SndBuffer::Init()
 {
 	if (!mods[OutputModule])
@@ -379,11 +460,21 @@ bool SndBuffer::Init()
 		return false;
 	}
 
+	// The DSP plugin path processes packets inline, so it can't share the writer with the thread.
+	bool threaded_output = ThreadedOutput && mods[OutputModule] != NullOut;
+#if defined(_WIN32) && !defined(PCSX2_CORE)
+	threaded_output &= !dspPluginEnabled;
+#endif
+	if (threaded_output)
+		StartOutputThread();
+
 	return true;
 }
 
 void SndBuffer::Cleanup()
 {
+	StopOutputThread();
+
 	mods[OutputModule]->Close();
 
 	soundtouchCleanup();
@@ -397,9 +488,13 @@ int SndBuffer::m_dsp_progress = 0;
 
 int SndBuffer::m_timestretch_progress = 0;
 int SndBuffer::ssFreeze = 0;
+bool SndBuffer::m_muted = false;
 
 void SndBuffer::ClearContents()
 {
+	// The timestretcher belongs to the output thread while it has packets queued.
+	WaitForOutputThread();
+
 	SndBuffer::soundtouchClearContents();
 	SndBuffer::ssFreeze = 256; //Delays sound output for about 1 second.
 }
@@ -409,8 +504,21 @@ void SndBuffer::SetPaused(bool paused)
 	mods[OutputModule]->SetPaused(paused);
 }
 
+void SndBuffer::SetMuted(bool muted)
+{
+	m_muted = muted;
+}
+
+bool SndBuffer::IsMuted()
+{
+	return m_muted;
+}
+
 void SndBuffer::Write(const StereoOut32& Sample)
 {
+	if (m_muted)
+		return;
+
 	// Log final output to wavefile.
 	WaveDump::WriteCore(1, CoreSrc_External, Sample.DownSample());
 
@@ -455,10 +563,7 @@ void SndBuffer::Write(const StereoOut32& Sample)
 				sndTempBuffer[i] = sndTempBuffer16[ei].UpSample();
 			}
 
-			if (SynchMode == 0) // TimeStrech on
-				timeStretchWrite();
-			else
-				_WriteSamples(sndTempBuffer, SndOutPacketSize);
+			ProcessPacket(sndTempBuffer);
 
 			m_dsp_progress -= SndOutPacketSize;
 		}
@@ -471,11 +576,15 @@ void SndBuffer::Write(const StereoOut32& Sample)
 		}
 	}
 #endif
+	else if (s_output_thread.joinable())
+	{
+		SndOutPacket& packet = *reinterpret_cast<SndOutPacket*>(sndTempBuffer);
+		while (!s_output_queue.push(packet))
+			std::this_thread::yield();
+		s_output_sema.NotifyOfWork();
+	}
 	else
 	{
-		if (SynchMode == 0) // TimeStrech on
-			timeStretchWrite();
-		else
-			_WriteSamples(sndTempBuffer, SndOutPacketSize);
+		ProcessPacket(sndTempBuffer);
 	}
 }
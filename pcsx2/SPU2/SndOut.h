@@ -585,13 +585,14 @@ private:
 	static float cTempo;
 	static float eTempo;
 	static int ssFreeze;
+	static bool m_muted;
 
 	static bool CheckUnderrunStatus(int& nSamples, int& quietSampleCount);
 
 	static void soundtouchInit();
 	static void soundtouchClearContents();
 	static void soundtouchCleanup();
-	static void timeStretchWrite();
+	static void timeStretchWrite(StereoOut32* packet);
 	static void timeStretchUnderrun();
 	static s32 timeStretchOverrun();
 
@@ -599,6 +600,7 @@ private:
 	static float GetStatusPct();
 	static void UpdateTempoChangeSoundTouch();
 	static void UpdateTempoChangeSoundTouch2();
+	static void UpdateAdaptiveLatency(int data);
 
 	static void _WriteSamples(StereoOut32* bData, int nSamples);
 
@@ -611,6 +613,13 @@ private:
 
 	static int _GetApproximateDataInBuffer();
 
+	// Optional output thread, which takes the timestretcher and buffer writes off the EE thread.
+	static void StartOutputThread();
+	static void StopOutputThread();
+	static void WaitForOutputThread();
+	static void OutputThreadEntryPoint();
+	static void ProcessPacket(StereoOut32* packet);
+
 public:
 	static void UpdateTempoChangeAsyncMixing();
 	static bool Init();
@@ -618,6 +627,13 @@ public:
 	static void Write(const StereoOut32& Sample);
 	static void ClearContents();
 	static void SetPaused(bool paused);
+	static void SetMuted(bool muted);
+	static bool IsMuted();
+
+	// Output statistics, safe to call from any thread.
+	static float GetTargetLatencyMS();
+	static float GetBufferedLatencyMS();
+	static u32 GetUnderrunCount();
 
 	// Note: When using with 32 bit output buffers, the user of this function is responsible
 	// for shifting the values to where they need to be manually.  The fixed point depth of
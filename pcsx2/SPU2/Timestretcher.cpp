@@ -18,6 +18,8 @@
 #include "SoundTouch.h"
 #include "common/Timer.h"
 #include <algorithm>
+#include <atomic>
+#include <climits>
 #include <cmath>
 
 //Uncomment the next line to use the old time stretcher
@@ -147,11 +149,73 @@ bool IsInRange(const T& val, const T& min, const T& max)
 	return (min <= val && val <= max);
 }
 
+// Adaptive latency: instead of aiming for a fixed SndOutLatencyMS reservoir, the target starts
+// there and is trimmed by 1ms for every second of clean playback. An underrun grows it by half,
+// and a near miss (the buffer dipping under a quarter of the target) grows it by a little.
+// SndOutLatencyMS stays the upper bound.
+static constexpr float ADAPTIVE_LATENCY_MIN_MS = 10.0f;
+static constexpr float ADAPTIVE_LATENCY_SHRINK_MS = 1.0f;
+static constexpr float ADAPTIVE_LATENCY_JITTER_GROW_MS = 2.0f;
+static constexpr float ADAPTIVE_LATENCY_UNDERRUN_GROW = 1.5f;
+
+static std::atomic<float> s_target_latency_ms{0.0f};
+static u64 s_adaptive_last_update = 0;
+static u32 s_adaptive_last_underruns = 0;
+static int s_adaptive_min_data = 0;
+
+float SndBuffer::GetTargetLatencyMS()
+{
+	const float target = s_target_latency_ms.load(std::memory_order_relaxed);
+	return (target > 0.0f) ? target : static_cast<float>(SndOutLatencyMS);
+}
+
+static void ResetAdaptiveLatency()
+{
+	s_target_latency_ms.store(static_cast<float>(SndOutLatencyMS), std::memory_order_relaxed);
+	s_adaptive_last_update = Common::Timer::GetCurrentValue();
+	s_adaptive_last_underruns = SndBuffer::GetUnderrunCount();
+	s_adaptive_min_data = INT_MAX;
+}
+
+void SndBuffer::UpdateAdaptiveLatency(int data)
+{
+	if (!AdaptiveLatency)
+		return;
+
+	s_adaptive_min_data = std::min(s_adaptive_min_data, data);
+
+	const u64 now = Common::Timer::GetCurrentValue();
+	if (Common::Timer::ConvertValueToSeconds(now - s_adaptive_last_update) < 1.0)
+		return;
+
+	const u32 underruns = GetUnderrunCount();
+	const float max_latency = static_cast<float>(SndOutLatencyMS);
+	const float min_latency = std::min(ADAPTIVE_LATENCY_MIN_MS, max_latency);
+	const float min_buffered_ms = static_cast<float>(s_adaptive_min_data) / 48.0f;
+	float target = GetTargetLatencyMS();
+
+	if (underruns != s_adaptive_last_underruns)
+		target *= ADAPTIVE_LATENCY_UNDERRUN_GROW;
+	else if (min_buffered_ms < target * 0.25f)
+		target += ADAPTIVE_LATENCY_JITTER_GROW_MS;
+	else
+		target -= ADAPTIVE_LATENCY_SHRINK_MS;
+
+	target = std::clamp(target, min_latency, max_latency);
+	if (MsgOverruns() && target != GetTargetLatencyMS())
+		ConLog(" * SPU2 > Adaptive latency: %.0f ms (min buffered %.1f ms, %u underruns)\n", (double)target, (double)min_buffered_ms, underruns - s_adaptive_last_underruns);
+
+	s_target_latency_ms.store(target, std::memory_order_relaxed);
+	s_adaptive_last_update = now;
+	s_adaptive_last_underruns = underruns;
+	s_adaptive_min_data = INT_MAX;
+}
+
 //actual stretch algorithm implementation
 void SndBuffer::UpdateTempoChangeSoundTouch2()
 {
 
-	long targetSamplesReservoir = 48 * SndOutLatencyMS; //48000*SndOutLatencyMS/1000
+	long targetSamplesReservoir = (long)(48 * GetTargetLatencyMS()); //48000*SndOutLatencyMS/1000
 	//base aim at buffer filled %
 	float baseTargetFullness = (double)targetSamplesReservoir; ///(double)m_size;//0.05;
 
@@ -169,6 +233,7 @@ void SndBuffer::UpdateTempoChangeSoundTouch2()
 
 	int data = _GetApproximateDataInBuffer();
 	float bufferFullness = (float)data; ///(float)m_size;
+	UpdateAdaptiveLatency(data);
 
 #ifdef NEWSTRETCHER_USE_DYNAMIC_TUNING
 	{ //test current iterations/sec every 0.5s, and change algo params accordingly if different than previous IPS more than 30%
@@ -485,7 +550,7 @@ static void CvtPacketToInt(StereoOut32* srcdest, uint size)
 		*dest = (StereoOut32)*src;
 }
 
-void SndBuffer::timeStretchWrite()
+void SndBuffer::timeStretchWrite(StereoOut32* packet)
 {
 	// data prediction helps keep the tempo adjustments more accurate.
 	// The timestretcher returns packets in belated "clump" form.
@@ -494,19 +559,19 @@ void SndBuffer::timeStretchWrite()
 	// data prediction to make the timestretcher more responsive.
 
 	PredictDataWrite((int)(SndOutPacketSize / eTempo));
-	CvtPacketToFloat(sndTempBuffer);
+	CvtPacketToFloat(packet);
 
-	pSoundTouch->putSamples((float*)sndTempBuffer, SndOutPacketSize);
+	pSoundTouch->putSamples((float*)packet, SndOutPacketSize);
 
 	int tempProgress;
-	while (tempProgress = pSoundTouch->receiveSamples((float*)sndTempBuffer, SndOutPacketSize),
+	while (tempProgress = pSoundTouch->receiveSamples((float*)packet, SndOutPacketSize),
 		   tempProgress != 0)
 	{
 		// Hint: It's assumed that pSoundTouch will return chunks of 128 bytes (it always does as
 		// long as the SSE optimizations are enabled), which means we can do our own SSE opts here.
 
-		CvtPacketToInt(sndTempBuffer, tempProgress);
-		_WriteSamples(sndTempBuffer, tempProgress);
+		CvtPacketToInt(packet, tempProgress);
+		_WriteSamples(packet, tempProgress);
 	}
 
 #ifdef SPU2X_USE_OLD_STRETCHER
@@ -529,6 +594,8 @@ void SndBuffer::soundtouchInit()
 
 	pSoundTouch->setTempo(1);
 
+	ResetAdaptiveLatency();
+
 	// some timestretch management vars:
 
 	cTempo = 1.0;
@@ -60,6 +60,8 @@ float VolumeAdjustLFE;
 // OUTPUT
 int SndOutLatencyMS = 100;
 int SynchMode = 0; // Time Stretch, Async or Disabled.
+bool ThreadedOutput = false;
+bool AdaptiveLatency = false;
 
 u32 OutputModule = 0;
 
@@ -103,6 +105,8 @@ void ReadSettings()
 	VolumeAdjustLFE = powf(10, VolumeAdjustLFEdb / 10);
 
 	SynchMode = CfgReadInt(L"OUTPUT", L"Synch_Mode", 0);
+	ThreadedOutput = CfgReadBool(L"OUTPUT", L"Threaded_Output", false);
+	AdaptiveLatency = CfgReadBool(L"OUTPUT", L"Adaptive_Latency", false);
 	numSpeakers = CfgReadInt(L"OUTPUT", L"SpeakerConfiguration", 0);
 	dplLevel = CfgReadInt(L"OUTPUT", L"DplDecodingLevel", 0);
 	SndOutLatencyMS = CfgReadInt(L"OUTPUT", L"Latency", 100);
@@ -165,6 +169,8 @@ void WriteSettings()
 	CfgWriteStr(L"OUTPUT", L"Output_Module", mods[OutputModule]->GetIdent());
 	CfgWriteInt(L"OUTPUT", L"Latency", SndOutLatencyMS);
 	CfgWriteInt(L"OUTPUT", L"Synch_Mode", SynchMode);
+	CfgWriteBool(L"OUTPUT", L"Threaded_Output", ThreadedOutput);
+	CfgWriteBool(L"OUTPUT", L"Adaptive_Latency", AdaptiveLatency);
 	CfgWriteInt(L"OUTPUT", L"SpeakerConfiguration", numSpeakers);
 	CfgWriteInt(L"OUTPUT", L"DplDecodingLevel", dplLevel);
 
@@ -417,8 +417,10 @@ struct V_Core
 	V_Reverb Revb;              // Reverb Registers
 	V_ReverbBuffers RevBuffers; // buffer pointers for reverb, pre-calculated and pre-clipped.
 
-	s32 RevbDownBuf[2][64]; // Downsample buffer for reverb, one for each channel
-	s32 RevbUpBuf[2][64]; // Upsample buffer for reverb, one for each channel
+	// Reverb filter history, one for each channel. Each 64 entry ring is mirrored into the
+	// upper half so the filter taps can always be read as one contiguous run.
+	s32 RevbDownBuf[2][128]; // Downsample buffer for reverb
+	s32 RevbUpBuf[2][128];   // Upsample buffer for reverb
 	u32 RevbSampleBufPos;
 	u32 EffectsStartA;
 	u32 EffectsEndA;
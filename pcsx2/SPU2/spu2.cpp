@@ -401,6 +401,26 @@ void SPU2SetOutputPaused(bool paused)
 	SndBuffer::SetPaused(paused);
 }
 
+void SPU2SetOutputMuted(bool muted)
+{
+	SndBuffer::SetMuted(muted);
+}
+
+float SPU2GetOutputLatencyMS()
+{
+	return SndBuffer::GetBufferedLatencyMS();
+}
+
+float SPU2GetTargetLatencyMS()
+{
+	return SndBuffer::GetTargetLatencyMS();
+}
+
+u32 SPU2GetUnderrunCount()
+{
+	return SndBuffer::GetUnderrunCount();
+}
+
 #ifdef DEBUG_KEYS
 static u32 lastTicks;
 static bool lState[6];
@@ -33,7 +33,14 @@ s32 SPU2open();
 void SPU2close();
 void SPU2shutdown();
 void SPU2SetOutputPaused(bool paused);
+// Drops mixed samples instead of queueing them, for frames that are emulated but not shown.
+void SPU2SetOutputMuted(bool muted);
 void SPU2SetDeviceSampleRateMultiplier(double multiplier);
+
+// Output statistics for the performance overlay.
+float SPU2GetOutputLatencyMS();
+float SPU2GetTargetLatencyMS();
+u32 SPU2GetUnderrunCount();
 void SPU2write(u32 mem, u16 value);
 u16 SPU2read(u32 mem);
 
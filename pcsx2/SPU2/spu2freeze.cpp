@@ -24,7 +24,7 @@ namespace SPU2Savestate
 
 	// versioning for saves.
 	// Increment this when changes to the savestate system are made.
-	static const u32 SAVE_VERSION = 0x000e;
+	static const u32 SAVE_VERSION = 0x000f;
 
 	static void wipe_the_cache()
 	{
@@ -102,7 +102,10 @@ s32 SPU2Savestate::ThawIt(DataBlock& spud)
 	}
 	else
 	{
-		SndBuffer::ClearContents();
+		// Muted loads are run-ahead rewinding a frame, the output never stopped so there's no
+		// static to cover up.
+		if (!SndBuffer::IsMuted())
+			SndBuffer::ClearContents();
 
 		pxAssertMsg(spu2regs && _spu2mem, "Looks like PCSX2 is trying to loadstate while components are shut down.  That's a no-no!  It shouldn't crash, but the savestate will probably be corrupted.");
 
@@ -53,18 +53,21 @@
 
 #include "fmt/core.h"
 
+#include <atomic>
 #include <csetjmp>
 #include <png.h>
+#include <thread>
 
 using namespace R5900;
 
-static void PreLoadPrep()
+static void PreLoadPrep(bool clear_execution_cache = true)
 {
 	// ensure everything is in sync before we start overwriting stuff.
 	if (THREAD_VU1)
 		vu1Thread.WaitVU();
 	GetMTGS().WaitGS(false);
-	SysClearExecutionCache();
+	if (clear_execution_cache)
+		SysClearExecutionCache();
 #ifndef PCSX2_CORE
 	PatchesVerboseReset();
 #endif
@@ -422,6 +425,21 @@ static void SysState_ComponentFreezeIn(zip_file_t* zf, SysState_Component comp)
 		throw std::runtime_error(std::string(" * ") + comp.name + std::string(": Error loading state!\n"));
 }
 
+static void SysState_ComponentFreezeIn(const u8* data, u32 size, SysState_Component comp)
+{
+	freezeData fP = { 0, nullptr };
+	if (comp.freeze(FreezeAction::Size, &fP) != 0)
+		fP.size = 0;
+
+	Console.Indent().WriteLn("Loading %s", comp.name);
+
+	// The component only reads from the buffer when loading.
+	fP.data = const_cast<u8*>(data);
+
+	if (size < static_cast<u32>(fP.size) || comp.freeze(FreezeAction::Load, &fP) != 0)
+		throw std::runtime_error(std::string(" * ") + comp.name + std::string(": Error loading state!\n"));
+}
+
 static void SysState_ComponentFreezeOut(SaveStateBase& writer, SysState_Component comp)
 {
 	freezeData fP = { 0, NULL };
@@ -448,6 +466,7 @@ public:
 
 	virtual const char* GetFilename() const = 0;
 	virtual void FreezeIn(zip_file_t* zf) const = 0;
+	virtual void FreezeIn(const u8* data, u32 size) const = 0;
 	virtual void FreezeOut(SaveStateBase& writer) const = 0;
 	virtual bool IsRequired() const = 0;
 };
@@ -460,15 +479,25 @@ protected:
 
 public:
 	virtual void FreezeIn(zip_file_t* zf) const;
+	virtual void FreezeIn(const u8* data, u32 size) const;
 	virtual void FreezeOut(SaveStateBase& writer) const;
 	virtual bool IsRequired() const { return true; }
 
+	// Decompresses straight into the emulated memory, without any of the entry's side effects.
+	// Safe to call from another thread while the VM is stopped.
+	void ReadFrom(zip_file_t* zf) const;
+
 protected:
 	virtual u8* GetDataPtr() const = 0;
 	virtual u32 GetDataSize() const = 0;
 };
 
 void MemorySavestateEntry::FreezeIn(zip_file_t* zf) const
+{
+	ReadFrom(zf);
+}
+
+void MemorySavestateEntry::ReadFrom(zip_file_t* zf) const
 {
 	const u32 expectedSize = GetDataSize();
 	const s64 bytesRead = zip_fread(zf, GetDataPtr(), expectedSize);
@@ -479,6 +508,18 @@ void MemorySavestateEntry::FreezeIn(zip_file_t* zf) const
 	}
 }
 
+void MemorySavestateEntry::FreezeIn(const u8* data, u32 size) const
+{
+	const u32 expectedSize = GetDataSize();
+	if (size != expectedSize)
+	{
+		Console.WriteLn(Color_Yellow, " '%s' is incomplete (expected 0x%x bytes, loading only 0x%x bytes)",
+			GetFilename(), expectedSize, std::min(size, expectedSize));
+	}
+
+	std::memcpy(GetDataPtr(), data, std::min(size, expectedSize));
+}
+
 void MemorySavestateEntry::FreezeOut(SaveStateBase& writer) const
 {
 	writer.FreezeMem(GetDataPtr(), GetDataSize());
@@ -507,6 +548,12 @@ public:
 		SysClearExecutionCache();
 		MemorySavestateEntry::FreezeIn(zf);
 	}
+
+	virtual void FreezeIn(const u8* data, u32 size) const
+	{
+		SysClearExecutionCache();
+		MemorySavestateEntry::FreezeIn(data, size);
+	}
 };
 
 class SavestateEntry_IopMemory : public MemorySavestateEntry
@@ -596,6 +643,7 @@ public:
 
 	const char* GetFilename() const { return "SPU2.bin"; }
 	void FreezeIn(zip_file_t* zf) const { return SysState_ComponentFreezeIn(zf, SPU2); }
+	void FreezeIn(const u8* data, u32 size) const { return SysState_ComponentFreezeIn(data, size, SPU2); }
 	void FreezeOut(SaveStateBase& writer) const { return SysState_ComponentFreezeOut(writer, SPU2); }
 	bool IsRequired() const { return true; }
 };
@@ -607,6 +655,7 @@ public:
 
 	const char* GetFilename() const { return "USB.bin"; }
 	void FreezeIn(zip_file_t* zf) const { return SysState_ComponentFreezeIn(zf, USB); }
+	void FreezeIn(const u8* data, u32 size) const { return SysState_ComponentFreezeIn(data, size, USB); }
 	void FreezeOut(SaveStateBase& writer) const { return SysState_ComponentFreezeOut(writer, USB); }
 	bool IsRequired() const { return false; }
 };
@@ -618,6 +667,7 @@ public:
 
 	const char* GetFilename() const { return "PAD.bin"; }
 	void FreezeIn(zip_file_t* zf) const { return SysState_ComponentFreezeIn(zf, PAD_); }
+	void FreezeIn(const u8* data, u32 size) const { return SysState_ComponentFreezeIn(data, size, PAD_); }
 	void FreezeOut(SaveStateBase& writer) const { return SysState_ComponentFreezeOut(writer, PAD_); }
 	bool IsRequired() const { return true; }
 };
@@ -629,6 +679,7 @@ public:
 
 	const char* GetFilename() const { return "GS.bin"; }
 	void FreezeIn(zip_file_t* zf) const { return SysState_ComponentFreezeIn(zf, GS); }
+	void FreezeIn(const u8* data, u32 size) const { return SysState_ComponentFreezeIn(data, size, GS); }
 	void FreezeOut(SaveStateBase& writer) const { return SysState_ComponentFreezeOut(writer, GS); }
 	bool IsRequired() const { return true; }
 };
@@ -668,8 +719,17 @@ std::unique_ptr<ArchiveEntryList> SaveState_DownloadState()
 #endif
 
 	std::unique_ptr<ArchiveEntryList> destlist = std::make_unique<ArchiveEntryList>(new VmStateBuffer("Zippable Savestate"));
+	SaveState_DownloadState(*destlist);
+	return destlist;
+}
+
+void SaveState_DownloadState(ArchiveEntryList& destlist)
+{
+	// Saving starts over at the beginning of the buffer, so a list that's downloaded into every
+	// frame only grows its allocation until it fits the largest state.
+	destlist.Clear();
 
-	memSavingState saveme(destlist->GetBuffer());
+	memSavingState saveme(destlist.GetBuffer());
 	ArchiveEntry internals(EntryFilename_InternalStructures);
 	internals.SetDataIndex(saveme.GetCurrentPos());
 
@@ -677,19 +737,17 @@ std::unique_ptr<ArchiveEntryList> SaveState_DownloadState()
 	saveme.FreezeInternals();
 
 	internals.SetDataSize(saveme.GetCurrentPos() - internals.GetDataIndex());
-	destlist->Add(internals);
+	destlist.Add(internals);
 
 	for (const std::unique_ptr<BaseSavestateEntry>& entry : SavestateEntries)
 	{
 		uint startpos = saveme.GetCurrentPos();
 		entry->FreezeOut(saveme);
-		destlist->Add(
+		destlist.Add(
 			ArchiveEntry(entry->GetFilename())
 				.SetDataIndex(startpos)
 				.SetDataSize(saveme.GetCurrentPos() - startpos));
 	}
-
-	return destlist;
 }
 
 std::unique_ptr<SaveStateScreenshotData> SaveState_SaveScreenshot()
@@ -697,17 +755,14 @@ std::unique_ptr<SaveStateScreenshotData> SaveState_SaveScreenshot()
 	static constexpr u32 SCREENSHOT_WIDTH = 640;
 	static constexpr u32 SCREENSHOT_HEIGHT = 480;
 
-	std::vector<u32> pixels(SCREENSHOT_WIDTH * SCREENSHOT_HEIGHT);
-	if (!GetMTGS().SaveMemorySnapshot(SCREENSHOT_WIDTH, SCREENSHOT_HEIGHT, &pixels))
-	{
-		// saving failed for some reason, device lost?
-		return nullptr;
-	}
-
+	// Don't wait for the readback here, the GS thread fills in the pixels behind the frame it's on,
+	// and whoever compresses the state waits for them. The struct is heap allocated, so the vector
+	// stays put while it's handed over to the zip thread.
 	std::unique_ptr<SaveStateScreenshotData> data = std::make_unique<SaveStateScreenshotData>();
 	data->width = SCREENSHOT_WIDTH;
 	data->height = SCREENSHOT_HEIGHT;
-	data->pixels = std::move(pixels);
+	data->pixels.resize(SCREENSHOT_WIDTH * SCREENSHOT_HEIGHT);
+	data->pending = GetMTGS().SaveMemorySnapshot(SCREENSHOT_WIDTH, SCREENSHOT_HEIGHT, &data->pixels);
 	return data;
 }
 
@@ -863,8 +918,10 @@ static bool SaveState_ReadScreenshot(zip_t* zf, u32* out_width, u32* out_height,
 static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateScreenshotData* screenshot)
 {
 	// use zstd compression, it can be 10x+ faster for saving.
+	// Level 1 roughly halves the time spent in zip_close() over the default of 3, for a few
+	// percent larger states. Most of the archive is EE memory, which compresses well regardless.
 	const u32 compression = EmuConfig.SavestateZstdCompression ? ZIP_CM_ZSTD : ZIP_CM_DEFLATE;
-	const u32 compression_level = 0;
+	const u32 compression_level = EmuConfig.SavestateZstdCompression ? 1 : 0;
 
 	// version indicator
 	{
@@ -904,7 +961,8 @@ static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateSc
 		zip_set_file_compression(zf, fi, compression, compression_level);
 	}
 
-	if (screenshot)
+	// saving the screenshot can fail for some reason (device lost?), the state is still usable without it
+	if (screenshot && screenshot->WaitForPixels())
 	{
 		if (!SaveState_CompressScreenshot(screenshot, zf))
 			return false;
@@ -940,6 +998,72 @@ bool SaveState_ZipToDisk(std::unique_ptr<ArchiveEntryList> srclist, std::unique_
 	return true;
 }
 
+// Copy of IOP RAM from before a restore that keeps the recompilers, see below.
+static std::unique_ptr<u8[]> s_upload_iop_ram;
+
+void SaveState_UploadState(const ArchiveEntryList& srclist, bool clear_execution_cache)
+{
+	// SaveState_DownloadState() always puts the internal structures first, at the start of the buffer.
+	if (srclist.GetLength() == 0 || srclist[0].GetFilename() != EntryFilename_InternalStructures)
+	{
+		throw Exception::SaveStateLoadError()
+			.SetDiagMsg("In-memory savestate is missing its internal structures.");
+	}
+
+	const ArchiveEntry* entries[std::size(SavestateEntries)] = {};
+	for (u32 i = 0; i < std::size(SavestateEntries); i++)
+	{
+		for (uint j = 1; j < srclist.GetLength(); j++)
+		{
+			if (srclist[j].GetFilename() == SavestateEntries[i]->GetFilename())
+			{
+				entries[i] = &srclist[j];
+				break;
+			}
+		}
+
+		if (!entries[i] && SavestateEntries[i]->IsRequired())
+		{
+			throw Exception::SaveStateLoadError()
+				.SetDiagMsg(fmt::format("In-memory savestate is missing '{}'.", SavestateEntries[i]->GetFilename()));
+		}
+	}
+
+	PreLoadPrep(clear_execution_cache);
+
+	// EE RAM is covered by the recompiler's page protection, which catches the memcpy below. IOP
+	// blocks are only invalidated by explicit clears, so compare the RAM and clear what changed.
+	// The VUs look their programs up again once they've been cleared, which is cheap.
+	if (!clear_execution_cache)
+	{
+		if (!s_upload_iop_ram)
+			s_upload_iop_ram = std::make_unique<u8[]>(Ps2MemSize::IopRam);
+		std::memcpy(s_upload_iop_ram.get(), iopMem->Main, Ps2MemSize::IopRam);
+	}
+
+	memLoadingState(srclist.GetBuffer()).FreezeBios().FreezeInternals();
+
+	for (u32 i = 0; i < std::size(SavestateEntries); i++)
+	{
+		if (entries[i])
+			SavestateEntries[i]->FreezeIn(srclist.GetPtr(entries[i]->GetDataIndex()), entries[i]->GetDataSize());
+	}
+
+	if (!clear_execution_cache)
+	{
+		for (u32 offset = 0; offset < Ps2MemSize::IopRam; offset += __pagesize)
+		{
+			if (std::memcmp(&s_upload_iop_ram[offset], &iopMem->Main[offset], __pagesize) != 0)
+				psxCpu->Clear(offset, __pagesize / 4);
+		}
+
+		CpuVU0->Clear(0, VU0_PROGSIZE);
+		CpuVU1->Clear(0, VU1_PROGSIZE);
+	}
+
+	PostLoadPrep();
+}
+
 bool SaveState_ReadScreenshot(const std::string& filename, u32* out_width, u32* out_height, std::vector<u32>* out_pixels)
 {
 	zip_error_t ze = {};
@@ -1048,9 +1172,54 @@ void SaveState_UnzipFromDisk(const std::string& filename)
 
 	if (!throwIt)
 	{
+		// Memory entries are plain reads into emulated memory, so they are decompressed on a second
+		// thread with its own handle on the archive, overlapping the component (SPU2/PAD/GS) restores.
+		std::vector<std::pair<const MemorySavestateEntry*, s64>> memory_entries;
+		for (u32 i = 0; i < std::size(SavestateEntries); ++i)
+		{
+			const MemorySavestateEntry* entry = dynamic_cast<const MemorySavestateEntry*>(SavestateEntries[i].get());
+			if (entry && entryIndices[i] >= 0)
+				memory_entries.emplace_back(entry, entryIndices[i]);
+		}
+
+		std::atomic_bool memory_failed{false};
+		std::thread memory_thread;
+		if (!memory_entries.empty())
+		{
+			// Normally done by the EE memory entry, which won't run its own FreezeIn() here.
+			SysClearExecutionCache();
+
+			memory_thread = std::thread([&filename, &memory_entries, &memory_failed]() {
+				zip_error_t mze = {};
+				auto mzf = zip_open_managed(filename.c_str(), ZIP_RDONLY, &mze);
+				if (!mzf)
+				{
+					memory_failed.store(true);
+					return;
+				}
+
+				for (const auto& [entry, index] : memory_entries)
+				{
+					auto zff = zip_fopen_index_managed(mzf.get(), index, 0);
+					if (!zff)
+					{
+						memory_failed.store(true);
+						return;
+					}
+
+					entry->ReadFrom(zff.get());
+				}
+			});
+		}
+
+		ScopedGuard memory_thread_guard([&memory_thread]() {
+			if (memory_thread.joinable())
+				memory_thread.join();
+		});
+
 		for (u32 i = 0; i < std::size(SavestateEntries); ++i)
 		{
-			if (entryIndices[i] < 0)
+			if (entryIndices[i] < 0 || dynamic_cast<const MemorySavestateEntry*>(SavestateEntries[i].get()))
 				continue;
 
 			auto zff = zip_fopen_index_managed(zf.get(), entryIndices[i], 0);
@@ -1062,6 +1231,10 @@ void SaveState_UnzipFromDisk(const std::string& filename)
 
 			SavestateEntries[i]->FreezeIn(zff.get());
 		}
+
+		if (memory_thread.joinable())
+			memory_thread.join();
+		throwIt |= memory_failed.load();
 	}
 
 	if (throwIt)
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <future>
 #include <vector>
 
 #include "System.h"
@@ -33,7 +34,7 @@ enum class FreezeAction
 // [SAVEVERSION+]
 // This informs the auto updater that the users savestates will be invalidated.
 
-static const u32 g_SaveVersion = (0x9A2E << 16) | 0x0000;
+static const u32 g_SaveVersion = (0x9A2F << 16) | 0x0000;
 
 
 // the freezing data between submodules and core
@@ -53,6 +54,33 @@ struct SaveStateScreenshotData
 	u32 width;
 	u32 height;
 	std::vector<u32> pixels;
+
+	// Set while the GS thread is still reading back the frame into pixels.
+	std::future<bool> pending;
+
+	~SaveStateScreenshotData() { WaitForPixels(); }
+
+	/// Blocks until the readback has finished, returns false if it failed.
+	bool WaitForPixels()
+	{
+		if (pending.valid())
+		{
+			// the promise is broken if the GS thread dropped the command without running it
+			bool result = false;
+			try
+			{
+				result = pending.get();
+			}
+			catch (const std::future_error&)
+			{
+			}
+
+			if (!result)
+				pixels.clear();
+		}
+
+		return !pixels.empty();
+	}
 };
 
 class ArchiveEntryList;
@@ -60,10 +88,15 @@ class ArchiveEntryList;
 // Wrappers to generate a save state compatible across all frontends.
 // These functions assume that the caller has paused the core thread.
 extern std::unique_ptr<ArchiveEntryList> SaveState_DownloadState();
+// Downloads into an existing list, reusing its buffer.
+extern void SaveState_DownloadState(ArchiveEntryList& destlist);
 extern std::unique_ptr<SaveStateScreenshotData> SaveState_SaveScreenshot();
 extern bool SaveState_ZipToDisk(std::unique_ptr<ArchiveEntryList> srclist, std::unique_ptr<SaveStateScreenshotData> screenshot, const char* filename);
 extern bool SaveState_ReadScreenshot(const std::string& filename, u32* out_width, u32* out_height, std::vector<u32>* out_pixels);
 extern void SaveState_UnzipFromDisk(const std::string& filename);
+// Restores a state captured with SaveState_DownloadState(), without going through a zip archive.
+// Keeping the execution cache skips recompiling everything, for states restored every frame.
+extern void SaveState_UploadState(const ArchiveEntryList& srclist, bool clear_execution_cache = true);
 
 // --------------------------------------------------------------------------------------
 //  SaveStateBase class
@@ -295,6 +328,11 @@ public:
 		return *this;
 	}
 
+	void Clear()
+	{
+		m_list.clear();
+	}
+
 	size_t GetLength() const
 	{
 		return m_list.size();
@@ -89,6 +89,39 @@ static __fi bool WriteIOPtoFifo()
 	return true;
 }
 
+// Both sides are mid-transfer with an empty fifo, so every round trip through the fifo would be
+// the IOP filling it completely and the EE draining it completely. Do those rounds as direct
+// copies instead, keeping the fifo state (junk words, cycle counts) the same as if we hadn't.
+static __fi void DirectIOPtoEE()
+{
+	while (sif0.iop.counter >= FIFO_SIF_W && sif0ch.qwc >= (FIFO_SIF_W >> 2))
+	{
+		tDMA_TAG* ptag = sif0ch.getAddr(sif0ch.madr, DMAC_SIF0, true);
+		if (ptag == NULL)
+			break;
+
+		SIF_LOG("Direct IOP to EE: =========== %lX of %lX", FIFO_SIF_W, sif0.iop.counter);
+
+		const u32* src = (u32*)iopPhysMem(hw_dma9.madr);
+		memcpy(ptag, src, FIFO_SIF_W << 2);
+		memcpy(sif0.fifo.junk, src, sizeof(sif0.fifo.junk));
+
+		hw_dma9.madr += FIFO_SIF_W << 2;
+		sif0.iop.cycles += FIFO_SIF_W;
+		sif0.iop.counter -= FIFO_SIF_W;
+
+		sif0ch.madr += FIFO_SIF_W << 2;
+		sif0.ee.cycles += FIFO_SIF_W >> 2;
+		sif0ch.qwc -= FIFO_SIF_W >> 2;
+	}
+
+	if (sif0ch.qwc == 0 && dmacRegs.ctrl.STS == STS_SIF0)
+	{
+		if ((sif0ch.chcr.MOD == NORMAL_MODE) || ((sif0ch.chcr.TAG >> 28) & 0x7) == TAG_CNTS)
+			dmacRegs.stadr.ADDR = sif0ch.madr;
+	}
+}
+
 // Read Fifo into an ee tag, transfer it to sif0ch, and process it.
 static __fi bool ProcessEETag()
 {
@@ -313,6 +346,9 @@ __fi void SIF0Dma()
 		//I realise this is very hacky in a way but its an easy way of checking if both are doing something
 		BusyCheck = 0;
 
+		if (sif0.iop.busy && sif0.ee.busy && sif0ch.chcr.STR && sif0.fifo.size == 0)
+			DirectIOPtoEE();
+
 		if (sif0.iop.counter == 0 && sif0.iop.writeJunk && sif0.fifo.sif_free() >= sif0.iop.writeJunk)
 		{
 			SIF_LOG("Writing Junk %d", sif0.iop.writeJunk);
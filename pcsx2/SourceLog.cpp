@@ -55,7 +55,6 @@ void __Log(const char* fmt, ...)
 	{
 		std::vfprintf(emuLog, fmt, list);
 		fputs("\n", emuLog);
-		fflush(emuLog);
 	}
 
 	va_end(list);
@@ -66,9 +65,10 @@ void SysTraceLog::DoWrite(const char* msg) const
 	if (emuLog == NULL)
 		return;
 
+	// No flush here, a write per trace line was the bulk of the cost of trace logging.
+	// The log is flushed once per frame by the VM, and when it's closed.
 	fputs(msg, emuLog);
 	fputs("\n", emuLog);
-	fflush(emuLog);
 }
 
 void SysTraceLog_EE::ApplyPrefix(std::string& ascii) const
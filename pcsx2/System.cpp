@@ -21,6 +21,7 @@
 #include "MTVU.h"
 
 #include "Elfheader.h"
+#include "DebugTools/SymbolMap.h"
 
 #include "System/RecTypes.h"
 
@@ -464,11 +465,29 @@ void SysMainMemory::ReleaseAll()
 // --------------------------------------------------------------------------------------
 //  SysCpuProviderPack  (implementations)
 // --------------------------------------------------------------------------------------
+// Names recompiled blocks after the guest function containing them, as "func+0x10", when
+// the game's symbols are loaded. Only called while a profiler is listening.
+static std::string GetPerfSymbol(const SymbolMap& map, u32 pc)
+{
+	const u32 start = map.GetFunctionStart(pc);
+	if (start == SymbolMap::INVALID_ADDRESS)
+		return std::string();
+
+	std::string name(map.GetLabelString(start));
+	if (name.empty() || pc == start)
+		return name;
+
+	return fmt::format("{}+0x{:x}", name, pc - start);
+}
+
 SysCpuProviderPack::SysCpuProviderPack()
 {
 	Console.WriteLn( Color_StrongBlue, "Reserving memory for recompilers..." );
 	ConsoleIndentScope indent(1);
 
+	Perf::ee.setSymbolizer([](u32 pc) { return GetPerfSymbol(R5900SymbolMap, pc); });
+	Perf::iop.setSymbolizer([](u32 pc) { return GetPerfSymbol(R3000SymbolMap, pc); });
+
 	CpuProviders = std::make_unique<CpuInitializerSet>();
 
 	try {
@@ -24,6 +24,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <vector>
 #include <assert.h>
 
 #include <fcntl.h>
@@ -76,13 +77,24 @@ namespace usb_eyetoy
 			mpeg_mutex.unlock();
 		}
 
+		// Scratch buffers reused across frames by the capture thread
+		static std::vector<unsigned char> compr_scratch;
+		static std::vector<unsigned char> rgb_scratch;
+
+		static unsigned char* get_scratch(std::vector<unsigned char>& scratch, size_t size)
+		{
+			if (scratch.size() < size)
+				scratch.resize(size);
+			return scratch.data();
+		}
+
 		static void process_image(const unsigned char* data, int size)
 		{
 			const int bytesPerPixel = 3;
 			int comprBufSize = frame_width * frame_height * bytesPerPixel;
 			if (pixelformat == V4L2_PIX_FMT_YUYV)
 			{
-				unsigned char* comprBuf = (unsigned char*)calloc(1, comprBufSize);
+				unsigned char* comprBuf = get_scratch(compr_scratch, comprBufSize);
 				int comprLen = 0;
 				if (frame_format == format_mpeg)
 				{
@@ -90,7 +102,7 @@ namespace usb_eyetoy
 				}
 				else if (frame_format == format_jpeg)
 				{
-					unsigned char* data2 = (unsigned char*)calloc(1, comprBufSize);
+					unsigned char* data2 = get_scratch(rgb_scratch, comprBufSize);
 					for (int y = 0; y < frame_height; y++)
 					{
 						for (int x = 0; x < frame_width; x += 2)
@@ -126,7 +138,6 @@ namespace usb_eyetoy
 					{
 						comprLen = 0;
 					}
-					free(data2);
 				}
 				else if (frame_format == format_yuv400)
 				{
@@ -151,7 +162,6 @@ namespace usb_eyetoy
 					comprLen = 80 * 64;
 				}
 				store_mpeg_frame(comprBuf, comprLen);
-				free(comprBuf);
 			}
 			else if (pixelformat == V4L2_PIX_FMT_JPEG)
 			{
@@ -159,11 +169,10 @@ namespace usb_eyetoy
 				{
 					int width, height, actual_comps;
 					unsigned char* rgbData = jpgd::decompress_jpeg_image_from_memory(data, size, &width, &height, &actual_comps, 3);
-					unsigned char* comprBuf = (unsigned char*)calloc(1, comprBufSize);
+					unsigned char* comprBuf = get_scratch(compr_scratch, comprBufSize);
 					int comprLen = jo_write_mpeg(comprBuf, rgbData, frame_width, frame_height, JO_RGB24, mirroring_enabled ? JO_FLIP_X : JO_NONE, JO_NONE);
 					free(rgbData);
 					store_mpeg_frame(comprBuf, comprLen);
-					free(comprBuf);
 				}
 				else if (frame_format == format_jpeg)
 				{
@@ -173,7 +182,7 @@ namespace usb_eyetoy
 				{
 					int width, height, actual_comps;
 					unsigned char* rgbData = jpgd::decompress_jpeg_image_from_memory(data, size, &width, &height, &actual_comps, 3);
-					unsigned char* comprBuf = (unsigned char*)calloc(1, comprBufSize);
+					unsigned char* comprBuf = get_scratch(compr_scratch, comprBufSize);
 					int comprLen = 0;
 					int in_pos = 0;
 					for (int my = 0; my < 8; my++)
@@ -199,7 +208,6 @@ namespace usb_eyetoy
 					comprLen = 80 * 64;
 					free(rgbData);
 					store_mpeg_frame(comprBuf, comprLen);
-					free(comprBuf);
 				}
 			}
 			else
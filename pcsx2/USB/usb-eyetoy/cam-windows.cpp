@@ -373,13 +373,24 @@ namespace usb_eyetoy
 			mpeg_mutex.unlock();
 		}
 
+		// Scratch buffers reused across frames by the capture thread
+		static std::vector<unsigned char> compr_scratch;
+		static std::vector<unsigned char> rgb_scratch;
+
+		static unsigned char* get_scratch(std::vector<unsigned char>& scratch, size_t size)
+		{
+			if (scratch.size() < size)
+				scratch.resize(size);
+			return scratch.data();
+		}
+
 		void dshow_callback(unsigned char* data, int len, int bitsperpixel)
 		{
 			if (bitsperpixel == 24)
 			{
 				const int bytesPerPixel = 3;
 				int comprBufSize = frame_width * frame_height * bytesPerPixel;
-				unsigned char* comprBuf = (unsigned char*)calloc(1, comprBufSize);
+				unsigned char* comprBuf = get_scratch(compr_scratch, comprBufSize);
 				int comprLen = 0;
 				if (frame_format == format_mpeg)
 				{
@@ -388,7 +399,7 @@ namespace usb_eyetoy
 				else if (frame_format == format_jpeg)
 				{
 					// flip Y - always required on windows
-					unsigned char* data2 = (unsigned char*)calloc(1, comprBufSize);
+					unsigned char* data2 = get_scratch(rgb_scratch, comprBufSize);
 					for (int y = 0; y < frame_height; y++)
 					{
 						for (int x = 0; x < frame_width; x++)
@@ -409,7 +420,6 @@ namespace usb_eyetoy
 					{
 						comprLen = 0;
 					}
-					free(data2);
 				}
 				else if (frame_format == format_yuv400)
 				{
@@ -437,7 +447,6 @@ namespace usb_eyetoy
 					comprLen = 80 * 64;
 				}
 				store_mpeg_frame(comprBuf, comprLen);
-				free(comprBuf);
 			}
 			else
 			{
@@ -18,7 +18,10 @@
 #include "VMManager.h"
 
 #include <atomic>
+#include <condition_variable>
+#include <ctime>
 #include <sstream>
+#include <unordered_map>
 #include <mutex>
 
 #include "common/Console.h"
@@ -30,6 +33,11 @@
 #include "common/Threading.h"
 #include "fmt/core.h"
 
+#define XXH_STATIC_LINKING_ONLY 1
+#define XXH_INLINE_ALL 1
+#include "xxhash.h"
+#include <zstd.h>
+
 #include "Counters.h"
 #include "CDVD/CDVD.h"
 #include "DEV9/DEV9.h"
@@ -51,8 +59,10 @@
 #include "PAD/Host/PAD.h"
 #include "Sio.h"
 #include "ps2/BiosTools.h"
+#include "Recording/InputRecording.h"
 #include "Recording/InputRecordingControls.h"
 
+#include "DebugTools/HwProfiler.h"
 #include "DebugTools/MIPSAnalyst.h"
 #include "DebugTools/SymbolMap.h"
 
@@ -98,7 +108,33 @@ namespace VMManager
 		const char* filename, s32 slot_for_message);
 	static void ZipSaveStateOnThread(std::unique_ptr<ArchiveEntryList> elist,
 		std::unique_ptr<SaveStateScreenshotData> screenshot, std::string osd_key,
-		std::string filename, s32 slot_for_message);
+		std::string filename, s32 slot_for_message, u32 ticket);
+	static void WaitForSaveStateZipTurn(u32 ticket);
+	static void FinishSaveStateZipTurn();
+	static void RemoveThisSaveStateThread();
+
+	static void LoadOrPrepareBootSnapshot();
+
+	static bool IsRegressionHarnessActive();
+	static void StartRegressionHarness();
+	static void UpdateRegressionHarness();
+	static void StopRegressionHarness();
+	static void AdvanceTuner();
+	static void FinishTuner(bool save);
+	static void SaveTunerResult();
+	static void ZipBootSnapshotOnThread(std::unique_ptr<ArchiveEntryList> elist, std::string filename, u32 ticket);
+
+	static void CaptureRewindState();
+	static bool LoadRewindState();
+	static void ClearRewindStates();
+	static void ShutdownRewindThread();
+	static void RewindThreadEntryPoint();
+
+	static void UpdateMetricsExport();
+
+	static bool IsRunAheadActive();
+	static void ExecuteRunAhead();
+	static bool ExecuteRunAheadFrame();
 
 	static void SetTimerResolutionIncreased(bool enabled);
 	static void EnsureCPUInfoInitialized();
@@ -117,6 +153,54 @@ static Threading::ThreadHandle s_vm_thread_handle;
 static std::deque<std::thread> s_save_state_threads;
 static std::mutex s_save_state_threads_mutex;
 
+// Save state threads compress one at a time, in the order the states were taken. Protected by the mutex above.
+static std::condition_variable s_save_state_zip_cv;
+static u32 s_save_state_zip_next_ticket = 0;
+static u32 s_save_state_zip_current_ticket = 0;
+
+namespace
+{
+	/// A compressed slice of a rewind snapshot. Pages which didn't change since the previous
+	/// snapshot are shared with it instead of being compressed again.
+	struct RewindPage
+	{
+		u64 hash;
+		u32 size;
+		std::vector<u8> data;
+	};
+
+	struct RewindSnapshot
+	{
+		std::vector<ArchiveEntry> entries;
+		u32 size;
+		std::vector<std::shared_ptr<const RewindPage>> pages;
+	};
+} // namespace
+
+static constexpr u32 REWIND_PAGE_SIZE = 16 * 1024;
+static constexpr int REWIND_COMPRESSION_LEVEL = 1;
+
+static std::mutex s_rewind_mutex;
+static std::condition_variable s_rewind_cv;
+static std::thread s_rewind_thread;
+static bool s_rewind_thread_quit = false;
+static bool s_rewind_busy = false;
+static std::unique_ptr<ArchiveEntryList> s_rewind_pending;
+static u32 s_rewind_pending_generation = 0;
+/// Bumped whenever the ring is modified from the CPU thread, so in-flight snapshots get discarded.
+static u32 s_rewind_generation = 0;
+static std::deque<RewindSnapshot> s_rewind_snapshots;
+static size_t s_rewind_memory_used = 0;
+static u32 s_rewind_frame_counter = 0;
+
+/// State at the last real frame, restored after every frame run ahead of it. Reused, so the buffer stays allocated.
+static std::unique_ptr<ArchiveEntryList> s_runahead_state;
+/// Set while ExecuteRunAhead() wants the CPU to return at the next vsync, and when it got there.
+static bool s_runahead_break_at_vsync = false;
+static bool s_runahead_vsync = false;
+/// Set while emulating the frames past the real one, which get thrown away.
+static bool s_running_ahead = false;
+
 static std::mutex s_info_mutex;
 static std::string s_disc_path;
 static u32 s_game_crc;
@@ -124,6 +208,8 @@ static u32 s_patches_crc;
 static std::string s_game_serial;
 static std::string s_game_name;
 static std::string s_elf_override;
+static std::string s_boot_snapshot_path;
+static std::optional<GSRendererType> s_renderer_override;
 static std::string s_input_profile_name;
 static u32 s_active_game_fixes = 0;
 static std::vector<u8> s_widescreen_cheats_data;
@@ -136,6 +222,74 @@ static s32 s_current_save_slot = 1;
 static u32 s_frame_advance_count = 0;
 static u32 s_mxcsr_saved;
 static std::optional<LimiterModeType> s_limiter_mode_prior_to_hold_interaction;
+static u32 s_benchmark_frames_remaining = 0;
+static std::string s_benchmark_output;
+static std::string s_hw_profile_output;
+
+// Regression harness: replays an input recording and hashes EE RAM at fixed frame intervals.
+static std::string s_replay_recording;
+static u32 s_hash_interval = 0;
+static std::string s_hash_output;
+static std::string s_hash_reference;
+static std::FILE* s_hash_output_file = nullptr;
+static std::unordered_map<u32, u64> s_hash_reference_values;
+static u32 s_hash_checkpoints = 0;
+static u32 s_hash_mismatches = 0;
+static u32 s_harness_start_frame = 0;
+static Common::Timer::Value s_harness_start_time = 0;
+
+// Settings tuner: reruns the harness from power-on once per candidate speedhack, keeping the ones that are
+// faster without changing any EE RAM hash from the first run, and saves the result to the game settings.
+struct TunerOverrides
+{
+	std::optional<s8> ee_cycle_rate;
+	std::optional<u8> ee_cycle_skip;
+	std::optional<bool> mtvu;
+	std::optional<bool> instant_vu1;
+};
+
+struct TunerCandidate
+{
+	const char* name;
+	void (*apply)(TunerOverrides& overrides);
+};
+
+static constexpr TunerCandidate s_tuner_candidates[] = {
+	{"Baseline", [](TunerOverrides&) {}},
+	{"MTVU", [](TunerOverrides& o) { o.mtvu = true; }},
+	{"Instant VU1", [](TunerOverrides& o) { o.instant_vu1 = true; }},
+	{"EE Cycle Rate -1", [](TunerOverrides& o) { o.ee_cycle_rate = -1; }},
+	{"EE Cycle Rate -2", [](TunerOverrides& o) { o.ee_cycle_rate = -2; }},
+	{"EE Cycle Skip 1", [](TunerOverrides& o) { o.ee_cycle_skip = 1; }},
+	{"EE Cycle Skip 2", [](TunerOverrides& o) { o.ee_cycle_skip = 2; }},
+};
+
+// Hash interval used when the tuner is started without one, and how much faster a candidate has to
+// be before it's kept, so run-to-run noise doesn't pick up hacks that do nothing.
+static constexpr u32 TUNER_DEFAULT_HASH_INTERVAL = 60;
+static constexpr double TUNER_MIN_SPEEDUP = 1.03;
+
+static bool s_tuner_active = false;
+static u32 s_tuner_run_frames = 0;
+static u32 s_tuner_candidate = 0;
+static TunerOverrides s_tuner_overrides;
+static TunerOverrides s_tuner_best;
+static double s_tuner_best_fps = 0.0;
+static double s_tuner_baseline_fps = 0.0;
+static Pcsx2Config::SpeedhackOptions s_tuner_base_speedhacks;
+
+static Pcsx2Config::SpeedhackOptions ApplyTunerOverrides(Pcsx2Config::SpeedhackOptions opts, const TunerOverrides& overrides)
+{
+	if (overrides.ee_cycle_rate.has_value())
+		opts.EECycleRate = overrides.ee_cycle_rate.value();
+	if (overrides.ee_cycle_skip.has_value())
+		opts.EECycleSkip = overrides.ee_cycle_skip.value();
+	if (overrides.mtvu.has_value())
+		opts.vuThread = overrides.mtvu.value();
+	if (overrides.instant_vu1.has_value())
+		opts.vu1Instant = overrides.instant_vu1.value();
+	return opts;
+}
 
 bool VMManager::PerformEarlyHardwareChecks(const char** error)
 {
@@ -328,6 +482,16 @@ void VMManager::LoadSettings()
 		EmuConfig.GS.AspectRatio = AspectRatioType::R16_9;
 	}
 
+	if (s_renderer_override.has_value())
+		EmuConfig.GS.Renderer = s_renderer_override.value();
+
+	// Keep the candidate being tuned across game settings reloads, which happen on every reset.
+	if (s_tuner_active)
+	{
+		s_tuner_base_speedhacks = EmuConfig.Speedhacks;
+		EmuConfig.Speedhacks = ApplyTunerOverrides(s_tuner_base_speedhacks, s_tuner_overrides);
+	}
+
 	// Force MTVU off when playing back GS dumps, it doesn't get used.
 	if (GSDumpReplayer::IsReplayingDump())
 		EmuConfig.Speedhacks.vuThread = false;
@@ -687,6 +851,9 @@ void VMManager::ReloadPatches(bool verbose, bool show_messages_when_disabled)
 
 static LimiterModeType GetInitialLimiterMode()
 {
+	if (GSDumpReplayer::IsRunningBenchmark() || s_benchmark_frames_remaining > 0 || VMManager::IsRegressionHarnessActive())
+		return LimiterModeType::Unlimited;
+
 	return EmuConfig.GS.FrameLimitEnable ? LimiterModeType::Nominal : LimiterModeType::Unlimited;
 }
 
@@ -738,6 +905,38 @@ bool VMManager::ApplyBootParameters(const VMBootParameters& params, std::string*
 
 	s_elf_override = params.elf_override;
 	s_disc_path.clear();
+
+	s_benchmark_frames_remaining = params.benchmark_frames;
+	s_benchmark_output = params.benchmark_output;
+	if (s_benchmark_frames_remaining > 0 && s_benchmark_output.empty())
+		s_benchmark_output = Path::Combine(EmuFolders::Logs, fmt::format("benchmark_{}.json", static_cast<u64>(std::time(nullptr))));
+	s_hw_profile_output = params.hw_profile_output;
+	s_replay_recording = params.input_recording;
+	s_hash_interval = params.hash_interval;
+	s_hash_output = params.hash_output;
+	s_hash_reference = params.hash_reference;
+
+	s_tuner_active = params.tune_settings;
+	s_tuner_run_frames = 0;
+	s_tuner_overrides = {};
+	if (s_tuner_active)
+	{
+		// Each candidate run ends after the frame count rather than shutting down, so there's no benchmark trace.
+		s_tuner_run_frames = std::exchange(s_benchmark_frames_remaining, 0);
+		if (s_replay_recording.empty() && s_tuner_run_frames == 0)
+		{
+			Console.Error("Settings tuner: An input recording or frame count is required.");
+			s_tuner_active = false;
+		}
+		else if (s_hash_interval == 0)
+		{
+			s_hash_interval = TUNER_DEFAULT_HASH_INTERVAL;
+		}
+	}
+
+	s_renderer_override = params.renderer;
+	if (s_renderer_override.has_value())
+		EmuConfig.GS.Renderer = s_renderer_override.value();
 	if (!params.save_state.empty())
 		*state_to_load = params.save_state;
 
@@ -791,6 +990,21 @@ bool VMManager::ApplyBootParameters(const VMBootParameters& params, std::string*
 		EmuConfig.UseBOOT2Injection = true;
 	}
 
+	if (params.gs_dump_benchmark_loops > 0)
+	{
+		if (!GSDumpReplayer::IsReplayingDump())
+		{
+			Host::ReportErrorAsync("Error", "Benchmarking requires a GS dump to be booted.");
+			return false;
+		}
+
+		std::string output(params.gs_dump_benchmark_output);
+		if (output.empty())
+			output = Path::Combine(EmuFolders::Logs, fmt::format("gsbench_{}.json", static_cast<u64>(std::time(nullptr))));
+
+		GSDumpReplayer::SetBenchmark(params.gs_dump_benchmark_loops, std::move(output));
+	}
+
 	return true;
 }
 
@@ -848,6 +1062,13 @@ bool VMManager::Initialize(const VMBootParameters& boot_params)
 	Console.WriteLn("Allocating memory map...");
 	s_vm_memory->CommitAll();
 
+	// Creating the GS device and compiling its shaders is the slowest part of startup. It
+	// runs on the GS thread, so let it happen while the components which don't need the
+	// display are opened. PAD and USB need the display's window, so they wait for it.
+	Console.WriteLn("Opening GS...");
+	GetMTGS().BeginOpen();
+	ScopedGuard close_gs = []() { GetMTGS().WaitForClose(); };
+
 	Console.WriteLn("Opening CDVD...");
 	if (!DoCDVDopen())
 	{
@@ -856,16 +1077,6 @@ bool VMManager::Initialize(const VMBootParameters& boot_params)
 	}
 	ScopedGuard close_cdvd = [] { DoCDVDclose(); };
 
-	Console.WriteLn("Opening GS...");
-	if (!GetMTGS().WaitForOpen())
-	{
-		// we assume GS is going to report its own error
-		Console.WriteLn("Failed to open GS.");
-		return false;
-	}
-
-	ScopedGuard close_gs = []() { GetMTGS().WaitForClose(); };
-
 	Console.WriteLn("Opening SPU2...");
 	if (SPU2init() != 0 || SPU2open() != 0)
 	{
@@ -878,17 +1089,6 @@ bool VMManager::Initialize(const VMBootParameters& boot_params)
 		SPU2shutdown();
 	};
 
-	Console.WriteLn("Opening PAD...");
-	if (PADinit() != 0 || PADopen(Host::GetHostDisplay()->GetWindowInfo()) != 0)
-	{
-		Host::ReportErrorAsync("Startup Error", "Failed to initialize PAD.");
-		return false;
-	}
-	ScopedGuard close_pad = []() {
-		PADclose();
-		PADshutdown();
-	};
-
 	Console.WriteLn("Opening DEV9...");
 	if (DEV9init() != 0 || DEV9open() != 0)
 	{
@@ -900,6 +1100,33 @@ bool VMManager::Initialize(const VMBootParameters& boot_params)
 		DEV9shutdown();
 	};
 
+	Console.WriteLn("Opening FW...");
+	if (FWopen() != 0)
+	{
+		Host::ReportErrorAsync("Startup Error", "Failed to initialize FW.");
+		return false;
+	}
+	ScopedGuard close_fw = []() { FWclose(); };
+
+	Console.WriteLn("Waiting for GS...");
+	if (!GetMTGS().WaitForOpen())
+	{
+		// we assume GS is going to report its own error
+		Console.WriteLn("Failed to open GS.");
+		return false;
+	}
+
+	Console.WriteLn("Opening PAD...");
+	if (PADinit() != 0 || PADopen(Host::GetHostDisplay()->GetWindowInfo()) != 0)
+	{
+		Host::ReportErrorAsync("Startup Error", "Failed to initialize PAD.");
+		return false;
+	}
+	ScopedGuard close_pad = []() {
+		PADclose();
+		PADshutdown();
+	};
+
 	Console.WriteLn("Opening USB...");
 	if (USBinit() != 0 || USBopen(Host::GetHostDisplay()->GetWindowInfo()) != 0)
 	{
@@ -911,24 +1138,16 @@ bool VMManager::Initialize(const VMBootParameters& boot_params)
 		USBshutdown();
 	};
 
-	Console.WriteLn("Opening FW...");
-	if (FWopen() != 0)
-	{
-		Host::ReportErrorAsync("Startup Error", "Failed to initialize FW.");
-		return false;
-	}
-	ScopedGuard close_fw = []() { FWclose(); };
-
 	FileMcd_EmuOpen();
 
 	// Don't close when we return
-	close_fw.Cancel();
 	close_usb.Cancel();
-	close_dev9.Cancel();
 	close_pad.Cancel();
+	close_fw.Cancel();
+	close_dev9.Cancel();
 	close_spu2.Cancel();
-	close_gs.Cancel();
 	close_cdvd.Cancel();
+	close_gs.Cancel();
 	close_state.Cancel();
 
 #if defined(_M_X86)
@@ -957,6 +1176,18 @@ bool VMManager::Initialize(const VMBootParameters& boot_params)
 	SetEmuThreadAffinities();
 
 	PerformanceMetrics::Clear();
+	UpdateMetricsExport();
+
+	if (s_benchmark_frames_remaining > 0)
+	{
+		Console.WriteLn("Benchmarking %u frame(s).", s_benchmark_frames_remaining);
+		GetMTGS().RunOnGSThread([output = s_benchmark_output]() { PerformanceMetrics::StartFrameTrace(output); });
+	}
+
+	if (!s_hw_profile_output.empty())
+		HwProfiler::Start();
+
+	StartRegressionHarness();
 
 	// do we want to load state?
 	if (!GSDumpReplayer::IsReplayingDump() && !state_to_load.empty())
@@ -967,6 +1198,14 @@ bool VMManager::Initialize(const VMBootParameters& boot_params)
 			return false;
 		}
 	}
+	else if (!GSDumpReplayer::IsReplayingDump() && !IsRegressionHarnessActive())
+	{
+		LoadOrPrepareBootSnapshot();
+	}
+	else if (boot_params.gs_dump_start_frame.has_value())
+	{
+		GSDumpReplayer::SeekToFrame(boot_params.gs_dump_start_frame.value());
+	}
 
 	return true;
 }
@@ -982,6 +1221,7 @@ void VMManager::Shutdown(bool save_resume_state)
 	// sync everything
 	if (THREAD_VU1)
 		vu1Thread.WaitVU();
+	GetMTGS().RunOnGSThread([]() { PerformanceMetrics::SetMetricsExportPath({}); });
 	GetMTGS().WaitGS();
 
 	if (!GSDumpReplayer::IsReplayingDump() && save_resume_state)
@@ -1013,6 +1253,16 @@ void VMManager::Shutdown(bool save_resume_state)
 
 	std::string().swap(s_elf_override);
 
+	if (HwProfiler::g_active)
+		HwProfiler::Stop(s_hw_profile_output);
+	StopRegressionHarness();
+	std::string().swap(s_hw_profile_output);
+	std::string().swap(s_boot_snapshot_path);
+	s_renderer_override.reset();
+
+	ShutdownRewindThread();
+	s_runahead_state.reset();
+
 #ifdef _M_X86
 	_mm_setcsr(s_mxcsr_saved);
 #elif defined(_M_ARM64)
@@ -1050,6 +1300,8 @@ void VMManager::Reset()
 	s_active_no_interlacing_patches = 0;
 	s_limiter_mode_prior_to_hold_interaction.reset();
 
+	ClearRewindStates();
+
 	SysClearExecutionCache();
 	memBindConditionalHandlers();
 	UpdateVSyncRate();
@@ -1131,6 +1383,7 @@ bool VMManager::DoLoadState(const char* filename)
 			cdvdReloadElfInfo();
 
 		UpdateRunningGame(false, false);
+		ClearRewindStates();
 		Host::OnSaveStateLoaded(filename, true);
 		return true;
 	}
@@ -1160,7 +1413,7 @@ bool VMManager::DoSaveState(const char* filename, s32 slot_for_message, bool zip
 			std::unique_lock lock(s_save_state_threads_mutex);
 			s_save_state_threads.emplace_back(&VMManager::ZipSaveStateOnThread,
 				std::move(elist), std::move(screenshot), std::move(osd_key), std::string(filename),
-				slot_for_message);
+				slot_for_message, s_save_state_zip_next_ticket++);
 		}
 		else
 		{
@@ -1199,10 +1452,33 @@ void VMManager::ZipSaveState(std::unique_ptr<ArchiveEntryList> elist,
 }
 
 void VMManager::ZipSaveStateOnThread(std::unique_ptr<ArchiveEntryList> elist, std::unique_ptr<SaveStateScreenshotData> screenshot,
-	std::string osd_key, std::string filename, s32 slot_for_message)
+	std::string osd_key, std::string filename, s32 slot_for_message, u32 ticket)
 {
+	WaitForSaveStateZipTurn(ticket);
 	ZipSaveState(std::move(elist), std::move(screenshot), std::move(osd_key), filename.c_str(), slot_for_message);
+	FinishSaveStateZipTurn();
+	RemoveThisSaveStateThread();
+}
 
+void VMManager::WaitForSaveStateZipTurn(u32 ticket)
+{
+	// Saving repeatedly would otherwise compress every state at once, and two saves to the
+	// same slot could finish out of order, leaving the older state on disk.
+	std::unique_lock lock(s_save_state_threads_mutex);
+	s_save_state_zip_cv.wait(lock, [ticket]() { return s_save_state_zip_current_ticket == ticket; });
+}
+
+void VMManager::FinishSaveStateZipTurn()
+{
+	{
+		std::unique_lock lock(s_save_state_threads_mutex);
+		s_save_state_zip_current_ticket++;
+	}
+	s_save_state_zip_cv.notify_all();
+}
+
+void VMManager::RemoveThisSaveStateThread()
+{
 	// remove ourselves from the thread list. if we're joining, we might not be in there.
 	const auto this_id = std::this_thread::get_id();
 	std::unique_lock lock(s_save_state_threads_mutex);
@@ -1217,6 +1493,73 @@ void VMManager::ZipSaveStateOnThread(std::unique_ptr<ArchiveEntryList> elist, st
 	}
 }
 
+void VMManager::LoadOrPrepareBootSnapshot()
+{
+	s_boot_snapshot_path.clear();
+
+	// The snapshot resumes at the start of EELOAD's main, which only the recompiler hooks on a
+	// fresh block. ELF overrides and BIOS-only boots have nothing to gain from it.
+	if (!EmuConfig.UseBootSnapshot || !EmuConfig.UseBOOT2Injection || !EmuConfig.Cpu.Recompiler.EnableEE ||
+		!s_elf_override.empty() || BiosChecksum == 0)
+	{
+		return;
+	}
+
+	// The BIOS may have probed the drive before EELOAD runs, so key on the disc as well as the BIOS.
+	cdvdReloadElfInfo();
+	std::string serial(SysGetDiscID());
+	if (serial.empty())
+		return;
+
+	Path::SanitizeFileName(serial);
+	const std::string dir(Path::Combine(EmuFolders::Cache, "bootsnapshots"));
+	std::string path(Path::Combine(dir, fmt::format("{}_{:08X}.p2s", serial, BiosChecksum)));
+	if (FileSystem::FileExists(path.c_str()))
+	{
+		try
+		{
+			Common::Timer timer;
+			SaveState_UnzipFromDisk(path);
+
+			// Execution resumes on the first instruction of EELOAD's main, so the recompiler hooks
+			// it and injects the game's ELF exactly as it would have after running the BIOS.
+			g_eeloadMain = cpuRegs.pc;
+
+			// Don't hand the game the wall clock from when the snapshot was taken.
+			cdvdResetRTC();
+
+			Console.WriteLn("Resumed from boot snapshot '%s' in %.2f ms", path.c_str(), timer.GetTimeMilliseconds());
+			return;
+		}
+		catch (Exception::BaseException& e)
+		{
+			// Most likely left over from an older save state version. The load may have been
+			// partial, so boot from scratch and replace it.
+			Console.Warning("Discarding boot snapshot '%s': %s", path.c_str(), e.DiagMsg().c_str());
+			FileSystem::DeleteFilePath(path.c_str());
+			SysClearExecutionCache();
+			cpuReset();
+		}
+	}
+
+	if (!FileSystem::EnsureDirectoryExists(dir.c_str(), false))
+		return;
+
+	s_boot_snapshot_path = std::move(path);
+}
+
+void VMManager::ZipBootSnapshotOnThread(std::unique_ptr<ArchiveEntryList> elist, std::string filename, u32 ticket)
+{
+	WaitForSaveStateZipTurn(ticket);
+	if (SaveState_ZipToDisk(std::move(elist), nullptr, filename.c_str()))
+		Console.WriteLn("Saved boot snapshot to '%s'", filename.c_str());
+	else
+		Console.Error("Failed to save boot snapshot to '%s'", filename.c_str());
+
+	FinishSaveStateZipTurn();
+	RemoveThisSaveStateThread();
+}
+
 void VMManager::WaitForSaveStateFlush()
 {
 	std::unique_lock lock(s_save_state_threads_mutex);
@@ -1232,6 +1575,315 @@ void VMManager::WaitForSaveStateFlush()
 	}
 }
 
+/// Bytes owned by `snap` alone, i.e. not shared with the snapshot taken before it.
+static size_t GetRewindSnapshotUniqueSize(const RewindSnapshot& snap, const RewindSnapshot* previous)
+{
+	size_t size = 0;
+	for (size_t i = 0; i < snap.pages.size(); i++)
+	{
+		if (!previous || i >= previous->pages.size() || previous->pages[i] != snap.pages[i])
+			size += snap.pages[i]->data.size();
+	}
+
+	return size;
+}
+
+static bool CompressRewindSnapshot(ZSTD_CCtx* cctx, ArchiveEntryList& elist,
+	const std::vector<std::shared_ptr<const RewindPage>>& previous, RewindSnapshot* snap)
+{
+	// The buffer grows in large chunks, so only compress up to the end of the last entry.
+	u32 size = 0;
+	snap->entries.reserve(elist.GetLength());
+	for (uint i = 0; i < elist.GetLength(); i++)
+	{
+		snap->entries.push_back(elist[i]);
+		size = std::max<u32>(size, elist[i].GetDataIndex() + elist[i].GetDataSize());
+	}
+
+	const u8* data = elist.GetPtr(0);
+	snap->size = size;
+
+	snap->pages.reserve((size + REWIND_PAGE_SIZE - 1) / REWIND_PAGE_SIZE);
+	for (u32 offset = 0, index = 0; offset < size; offset += REWIND_PAGE_SIZE, index++)
+	{
+		const u32 page_size = std::min(size - offset, REWIND_PAGE_SIZE);
+		const u64 hash = XXH64(data + offset, page_size, 0);
+		if (index < previous.size() && previous[index]->hash == hash && previous[index]->size == page_size)
+		{
+			snap->pages.push_back(previous[index]);
+			continue;
+		}
+
+		std::shared_ptr<RewindPage> page = std::make_shared<RewindPage>();
+		page->hash = hash;
+		page->size = page_size;
+		page->data.resize(ZSTD_compressBound(page_size));
+
+		const size_t compressed = ZSTD_compressCCtx(cctx, page->data.data(), page->data.size(),
+			data + offset, page_size, REWIND_COMPRESSION_LEVEL);
+		if (ZSTD_isError(compressed))
+		{
+			Console.Error("Failed to compress rewind snapshot: %s", ZSTD_getErrorName(compressed));
+			return false;
+		}
+
+		page->data.resize(compressed);
+		page->data.shrink_to_fit();
+		snap->pages.push_back(std::move(page));
+	}
+
+	return true;
+}
+
+void VMManager::RewindThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("Rewind Compression");
+
+	ZSTD_CCtx* cctx = ZSTD_createCCtx();
+	std::unique_lock lock(s_rewind_mutex);
+	for (;;)
+	{
+		s_rewind_cv.wait(lock, []() { return s_rewind_thread_quit || s_rewind_pending; });
+		if (s_rewind_thread_quit)
+			break;
+
+		std::unique_ptr<ArchiveEntryList> elist(std::move(s_rewind_pending));
+		const u32 generation = s_rewind_pending_generation;
+		std::vector<std::shared_ptr<const RewindPage>> previous;
+		if (!s_rewind_snapshots.empty())
+			previous = s_rewind_snapshots.back().pages;
+		lock.unlock();
+
+		Common::Timer timer;
+		RewindSnapshot snap;
+		const bool result = CompressRewindSnapshot(cctx, *elist, previous, &snap);
+		elist.reset();
+		previous.clear();
+
+		lock.lock();
+		s_rewind_busy = false;
+
+		// The ring was rewound or cleared while we were compressing, so the pages we shared may be gone.
+		if (!result || generation != s_rewind_generation)
+			continue;
+
+		const size_t added = GetRewindSnapshotUniqueSize(snap, s_rewind_snapshots.empty() ? nullptr : &s_rewind_snapshots.back());
+		s_rewind_snapshots.push_back(std::move(snap));
+		s_rewind_memory_used += added;
+
+		// Always keep the newest snapshot, even if it alone is over budget.
+		const size_t budget = static_cast<size_t>(EmuConfig.RewindBufferSize) * _1mb;
+		while (s_rewind_memory_used > budget && s_rewind_snapshots.size() > 1)
+		{
+			// Pages shared with the next snapshot stay alive, and are now accounted to it instead.
+			s_rewind_memory_used -= GetRewindSnapshotUniqueSize(s_rewind_snapshots[0], &s_rewind_snapshots[1]);
+			s_rewind_snapshots.pop_front();
+		}
+
+		DevCon.WriteLn("Rewind snapshot %u took %.2f ms, %.2f MB new, %.2f MB total",
+			static_cast<u32>(s_rewind_snapshots.size()), timer.GetTimeMilliseconds(),
+			static_cast<double>(added) / _1mb, static_cast<double>(s_rewind_memory_used) / _1mb);
+	}
+
+	ZSTD_freeCCtx(cctx);
+}
+
+void VMManager::CaptureRewindState()
+{
+	if (!EmuConfig.EnableRewind || GSDumpReplayer::IsReplayingDump())
+		return;
+
+	if (++s_rewind_frame_counter < std::max(EmuConfig.RewindSaveFrequency, 1u))
+		return;
+
+	{
+		// If the last snapshot is still being compressed, try again next frame rather than stalling.
+		std::unique_lock lock(s_rewind_mutex);
+		if (s_rewind_busy)
+			return;
+		s_rewind_busy = true;
+	}
+
+	s_rewind_frame_counter = 0;
+
+	std::unique_ptr<ArchiveEntryList> elist;
+	try
+	{
+		elist = SaveState_DownloadState();
+	}
+	catch (Exception::BaseException& e)
+	{
+		Console.Error("Failed to capture rewind snapshot: %s", e.DiagMsg().c_str());
+		std::unique_lock lock(s_rewind_mutex);
+		s_rewind_busy = false;
+		return;
+	}
+
+	std::unique_lock lock(s_rewind_mutex);
+	if (!s_rewind_thread.joinable())
+	{
+		s_rewind_thread_quit = false;
+		s_rewind_thread = std::thread(&VMManager::RewindThreadEntryPoint);
+	}
+
+	s_rewind_pending = std::move(elist);
+	s_rewind_pending_generation = s_rewind_generation;
+	s_rewind_cv.notify_one();
+}
+
+bool VMManager::LoadRewindState()
+{
+	std::unique_ptr<ArchiveEntryList> elist;
+	size_t remaining;
+	{
+		std::unique_lock lock(s_rewind_mutex);
+		if (s_rewind_snapshots.empty())
+		{
+			Host::AddKeyedOSDMessage("Rewind", "No rewind snapshots available.", 5.0f);
+			return false;
+		}
+
+		const RewindSnapshot& snap = s_rewind_snapshots.back();
+		elist = std::make_unique<ArchiveEntryList>(new VmStateBuffer(snap.size, "Rewind State"));
+		u8* data = elist->GetPtr(0);
+		for (size_t i = 0; i < snap.pages.size(); i++)
+		{
+			const RewindPage& page = *snap.pages[i];
+			const size_t result = ZSTD_decompress(data + i * REWIND_PAGE_SIZE, page.size, page.data.data(), page.data.size());
+			if (ZSTD_isError(result) || result != page.size)
+			{
+				Console.Error("Failed to decompress rewind snapshot.");
+				return false;
+			}
+		}
+		for (const ArchiveEntry& entry : snap.entries)
+			elist->Add(entry);
+
+		s_rewind_memory_used -= GetRewindSnapshotUniqueSize(snap,
+			(s_rewind_snapshots.size() > 1) ? &s_rewind_snapshots[s_rewind_snapshots.size() - 2] : nullptr);
+		s_rewind_snapshots.pop_back();
+		s_rewind_generation++;
+		remaining = s_rewind_snapshots.size();
+	}
+
+	try
+	{
+		SaveState_UploadState(*elist);
+	}
+	catch (Exception::BaseException& e)
+	{
+		Host::ReportErrorAsync("Failed to rewind", e.UserMsg());
+		return false;
+	}
+
+	// HACK: LastELF isn't in the save state...
+	if (!s_elf_override.empty())
+		cdvdReloadElfInfo(fmt::format("host:{}", s_elf_override));
+	else
+		cdvdReloadElfInfo();
+
+	UpdateRunningGame(false, false);
+
+	s_rewind_frame_counter = 0;
+	Host::AddKeyedOSDMessage("Rewind", fmt::format("Rewound, {} snapshots remaining.", remaining), 2.0f);
+	return true;
+}
+
+void VMManager::ClearRewindStates()
+{
+	std::unique_lock lock(s_rewind_mutex);
+	s_rewind_snapshots.clear();
+	s_rewind_memory_used = 0;
+	s_rewind_generation++;
+	s_rewind_frame_counter = 0;
+}
+
+void VMManager::ShutdownRewindThread()
+{
+	{
+		std::unique_lock lock(s_rewind_mutex);
+		s_rewind_thread_quit = true;
+		s_rewind_cv.notify_one();
+	}
+
+	if (s_rewind_thread.joinable())
+		s_rewind_thread.join();
+
+	std::unique_lock lock(s_rewind_mutex);
+	s_rewind_pending.reset();
+	s_rewind_busy = false;
+	s_rewind_snapshots.clear();
+	s_rewind_memory_used = 0;
+	s_rewind_generation++;
+	s_rewind_frame_counter = 0;
+}
+
+bool VMManager::IsRunAheadActive()
+{
+	// Loading a state drops the hardware renderers' texture cache and saving one doesn't read the
+	// targets back, so restoring every frame only holds up with the software renderer. Recordings,
+	// dumps and the harness need every frame emulated exactly once.
+	return (EmuConfig.RunAheadFrames > 0 && !EmuConfig.GS.UseHardwareRenderer() && !EmuConfig.EnableRecordingTools &&
+			!GSDumpReplayer::IsReplayingDump() && !IsRegressionHarnessActive());
+}
+
+bool VMManager::ExecuteRunAheadFrame()
+{
+	s_runahead_break_at_vsync = true;
+	Cpu->Execute();
+	s_runahead_break_at_vsync = false;
+	return std::exchange(s_runahead_vsync, false);
+}
+
+void VMManager::ExecuteRunAhead()
+{
+	// The real frame. Its audio is kept, but the picture is replaced by the last frame run ahead.
+	GetMTGS().SetFramesHidden(true);
+	const bool reached_vsync = ExecuteRunAheadFrame();
+	GetMTGS().SetFramesHidden(false);
+
+	// Don't run ahead into a pause or a shutdown, anything done to the VM there would see the future.
+	if (!reached_vsync || s_state.load(std::memory_order_relaxed) != VMState::Running || s_cpu_implementation_changed)
+		return;
+
+	if (!s_runahead_state)
+		s_runahead_state = std::make_unique<ArchiveEntryList>(new VmStateBuffer("Run-Ahead State"));
+
+	try
+	{
+		SaveState_DownloadState(*s_runahead_state);
+	}
+	catch (Exception::BaseException& e)
+	{
+		Console.Error("Run-ahead: Failed to save state: %s", e.DiagMsg().c_str());
+		return;
+	}
+
+	// The frames in between only need to be emulated, the last one is shown with the input just polled.
+	s_running_ahead = true;
+	SPU2SetOutputMuted(true);
+	for (u32 i = 1; i <= EmuConfig.RunAheadFrames; i++)
+	{
+		GetMTGS().SetFramesHidden(i < EmuConfig.RunAheadFrames);
+		if (!ExecuteRunAheadFrame())
+			break;
+	}
+	GetMTGS().SetFramesHidden(false);
+
+	try
+	{
+		// The recompilers are kept, the code is nearly always what was there a few frames ago.
+		SaveState_UploadState(*s_runahead_state, false);
+	}
+	catch (Exception::BaseException& e)
+	{
+		Console.Error("Run-ahead: Failed to restore state: %s", e.DiagMsg().c_str());
+	}
+
+	SPU2SetOutputMuted(false);
+	s_running_ahead = false;
+}
+
 bool VMManager::LoadState(const char* filename)
 {
 	// TODO: Save the current state so we don't need to reset.
@@ -1368,6 +2020,12 @@ void VMManager::Execute()
 		SysClearExecutionCache();
 	}
 
+	if (IsRunAheadActive())
+	{
+		ExecuteRunAhead();
+		return;
+	}
+
 	// Execute until we're asked to stop.
 	Cpu->Execute();
 }
@@ -1388,7 +2046,12 @@ const std::string& VMManager::Internal::GetElfOverride()
 
 bool VMManager::Internal::IsExecutionInterrupted()
 {
-	return s_state.load(std::memory_order_relaxed) != VMState::Running || s_cpu_implementation_changed;
+	return s_state.load(std::memory_order_relaxed) != VMState::Running || s_cpu_implementation_changed || s_runahead_vsync;
+}
+
+bool VMManager::Internal::IsRunningAhead()
+{
+	return s_running_ahead;
 }
 
 void VMManager::Internal::EntryPointCompilingOnCPUThread()
@@ -1401,6 +2064,303 @@ void VMManager::Internal::EntryPointCompilingOnCPUThread()
 	ApplyLoadedPatches(PPT_ONCE_ON_LOAD);
 }
 
+void VMManager::Internal::EELOADStartingOnCPUThread()
+{
+	if (s_boot_snapshot_path.empty())
+		return;
+
+	std::string filename(std::move(s_boot_snapshot_path));
+	s_boot_snapshot_path.clear();
+
+	try
+	{
+		std::unique_ptr<ArchiveEntryList> elist(SaveState_DownloadState());
+
+		std::unique_lock lock(s_save_state_threads_mutex);
+		s_save_state_threads.emplace_back(&VMManager::ZipBootSnapshotOnThread, std::move(elist), std::move(filename),
+			s_save_state_zip_next_ticket++);
+	}
+	catch (Exception::BaseException& e)
+	{
+		Console.Error("Failed to capture boot snapshot: %s", e.DiagMsg().c_str());
+	}
+}
+
+bool VMManager::IsRegressionHarnessActive()
+{
+	return !s_replay_recording.empty() || s_hash_interval > 0 || s_tuner_active;
+}
+
+void VMManager::StartRegressionHarness()
+{
+	if (!IsRegressionHarnessActive())
+		return;
+
+	if (!s_replay_recording.empty())
+	{
+		// The pad hooks only look at the recording when the tools are enabled.
+		EmuConfig.EnableRecordingTools = true;
+		if (!g_InputRecording.PlayFromBoot(s_replay_recording))
+			Console.Error("Regression harness: Failed to replay '%s'.", s_replay_recording.c_str());
+	}
+
+	if (s_tuner_active)
+	{
+		// Speedhacks don't do anything to a GS dump.
+		if (GSDumpReplayer::IsReplayingDump())
+		{
+			Console.Error("Settings tuner: GS dumps can't be tuned, use an input recording.");
+			s_tuner_active = false;
+		}
+		else
+		{
+			Console.WriteLn("Settings tuner: Trying %s (1/%zu)...", s_tuner_candidates[0].name, std::size(s_tuner_candidates));
+			s_tuner_candidate = 0;
+			s_tuner_best = {};
+			s_tuner_best_fps = 0.0;
+			s_tuner_baseline_fps = 0.0;
+		}
+	}
+
+	// The tuner's reference is its own first run.
+	if (s_hash_interval > 0 && !s_hash_reference.empty() && !s_tuner_active)
+	{
+		const std::optional<std::string> data(FileSystem::ReadFileToString(s_hash_reference.c_str()));
+		if (data.has_value())
+		{
+			for (const std::string_view& line : StringUtil::SplitString(data.value(), '\n'))
+			{
+				const std::vector<std::string_view> fields(StringUtil::SplitString(line, ','));
+				if (line.empty() || line[0] == '#' || fields.size() != 2)
+					continue;
+
+				const std::optional<u32> frame = StringUtil::FromChars<u32>(fields[0]);
+				const std::optional<u64> hash = StringUtil::FromChars<u64>(StringUtil::StripWhitespace(fields[1]), 16);
+				if (frame.has_value() && hash.has_value())
+					s_hash_reference_values[frame.value()] = hash.value();
+			}
+		}
+
+		Console.WriteLn("Regression harness: Loaded %zu reference hashes from '%s'.", s_hash_reference_values.size(), s_hash_reference.c_str());
+	}
+
+	if (s_hash_interval > 0 && !s_hash_output.empty())
+	{
+		s_hash_output_file = FileSystem::OpenCFile(s_hash_output.c_str(), "w");
+		if (!s_hash_output_file)
+			Console.Error("Regression harness: Failed to open '%s' for writing.", s_hash_output.c_str());
+	}
+
+	s_hash_checkpoints = 0;
+	s_hash_mismatches = 0;
+	s_harness_start_frame = g_FrameCount;
+	s_harness_start_time = Common::Timer::GetCurrentValue();
+}
+
+void VMManager::UpdateRegressionHarness()
+{
+	if (s_hash_interval > 0 && (g_FrameCount % s_hash_interval) == 0)
+	{
+		const u64 hash = XXH64(eeMem->Main, Ps2MemSize::MainRam, 0);
+		s_hash_checkpoints++;
+
+		if (s_hash_output_file)
+			std::fprintf(s_hash_output_file, "%u,%016llX\n", g_FrameCount, static_cast<unsigned long long>(hash));
+
+		if (s_tuner_active && s_tuner_candidate == 0)
+			s_hash_reference_values.emplace(g_FrameCount, hash);
+
+		const auto it = s_hash_reference_values.find(g_FrameCount);
+		if (it != s_hash_reference_values.end() && it->second != hash && s_hash_mismatches++ == 0)
+		{
+			Console.Error("Regression harness: EE RAM differs from the reference at frame %u (%016llX, expected %016llX).",
+				g_FrameCount, static_cast<unsigned long long>(hash), static_cast<unsigned long long>(it->second));
+		}
+	}
+
+	// Only ask once, the VM will pause at the end of the recording until the shutdown happens.
+	if (!s_replay_recording.empty() && s_benchmark_frames_remaining == 0 && g_InputRecording.IsReplaying() &&
+		g_InputRecording.GetFrameCounter() >= g_InputRecording.GetInputRecordingData().GetTotalFrames())
+	{
+		Console.WriteLn("Regression harness: Input recording finished.");
+		if (s_tuner_active)
+		{
+			AdvanceTuner();
+			return;
+		}
+
+		s_replay_recording.clear();
+		Host::RequestVMShutdown(false, false);
+	}
+
+	if (s_tuner_active && s_tuner_run_frames > 0 && (g_FrameCount - s_harness_start_frame) >= s_tuner_run_frames)
+		AdvanceTuner();
+}
+
+void VMManager::AdvanceTuner()
+{
+	const double seconds = Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - s_harness_start_time);
+	const u32 frames = g_FrameCount - s_harness_start_frame;
+	const double fps = (seconds > 0.0) ? (static_cast<double>(frames) / seconds) : 0.0;
+	const char* name = s_tuner_candidates[s_tuner_candidate].name;
+
+	if (s_tuner_candidate == 0)
+	{
+		if (s_hash_checkpoints == 0)
+		{
+			Console.Error("Settings tuner: The run ended before the first checkpoint, nothing to compare against.");
+			FinishTuner(false);
+			return;
+		}
+
+		Console.WriteLn("Settings tuner: Baseline ran at %.2f FPS with %u checkpoint(s).", fps, s_hash_checkpoints);
+		s_tuner_best_fps = fps;
+		s_tuner_baseline_fps = fps;
+	}
+	else if (s_hash_mismatches > 0)
+	{
+		Console.WriteLn("Settings tuner: %s changed the output at %u checkpoint(s), rejected.", name, s_hash_mismatches);
+	}
+	else if (fps < s_tuner_best_fps * TUNER_MIN_SPEEDUP)
+	{
+		Console.WriteLn("Settings tuner: %s ran at %.2f FPS against %.2f FPS, rejected.", name, fps, s_tuner_best_fps);
+	}
+	else
+	{
+		Console.WriteLn("Settings tuner: %s ran at %.2f FPS against %.2f FPS, kept.", name, fps, s_tuner_best_fps);
+		s_tuner_best = s_tuner_overrides;
+		s_tuner_best_fps = fps;
+	}
+
+	// Each candidate goes on top of what has been kept so far. Skip the ones the settings already match.
+	const Pcsx2Config::SpeedhackOptions best_speedhacks(ApplyTunerOverrides(s_tuner_base_speedhacks, s_tuner_best));
+	TunerOverrides next;
+	do
+	{
+		if (++s_tuner_candidate == std::size(s_tuner_candidates))
+		{
+			FinishTuner(true);
+			return;
+		}
+
+		next = s_tuner_best;
+		s_tuner_candidates[s_tuner_candidate].apply(next);
+	} while (ApplyTunerOverrides(s_tuner_base_speedhacks, next) == best_speedhacks);
+
+	Console.WriteLn("Settings tuner: Trying %s (%u/%zu)...", s_tuner_candidates[s_tuner_candidate].name,
+		s_tuner_candidate + 1, std::size(s_tuner_candidates));
+
+	s_tuner_overrides = next;
+	const Pcsx2Config old_config(EmuConfig);
+	EmuConfig.Speedhacks = ApplyTunerOverrides(s_tuner_base_speedhacks, s_tuner_overrides);
+	CheckForCPUConfigChanges(old_config);
+
+	// Every run starts from the same power-on state as the first, so the checkpoints line up.
+	Reset();
+	if (!s_replay_recording.empty())
+	{
+		g_InputRecording.Stop();
+		if (!g_InputRecording.PlayFromBoot(s_replay_recording))
+		{
+			Console.Error("Settings tuner: Failed to restart '%s'.", s_replay_recording.c_str());
+			FinishTuner(false);
+			return;
+		}
+	}
+
+	s_hash_checkpoints = 0;
+	s_hash_mismatches = 0;
+	s_harness_start_frame = g_FrameCount;
+	s_harness_start_time = Common::Timer::GetCurrentValue();
+}
+
+void VMManager::FinishTuner(bool save)
+{
+	if (save)
+		SaveTunerResult();
+
+	// Stops the end of run checks from firing again while the shutdown is pending.
+	s_tuner_active = false;
+	s_replay_recording.clear();
+	Host::RequestVMShutdown(false, false);
+}
+
+void VMManager::SaveTunerResult()
+{
+	if (ApplyTunerOverrides(s_tuner_base_speedhacks, s_tuner_best) == s_tuner_base_speedhacks)
+	{
+		Console.WriteLn("Settings tuner: Nothing beat the current settings, game settings left unchanged.");
+		return;
+	}
+
+	if (s_game_crc == 0)
+	{
+		Console.Error("Settings tuner: No game is running, can't save the result.");
+		return;
+	}
+
+	// Same lookup as UpdateGameSettingsLayer(), so an existing legacy crc.ini keeps being the one used.
+	std::string filename(GetGameSettingsPath(s_game_serial.c_str(), s_game_crc));
+	if (!FileSystem::FileExists(filename.c_str()) && FileSystem::FileExists(GetGameSettingsPath({}, s_game_crc).c_str()))
+		filename = GetGameSettingsPath({}, s_game_crc);
+
+	INISettingsInterface si(std::move(filename));
+	si.Load();
+	if (s_tuner_best.ee_cycle_rate.has_value())
+		si.SetIntValue("EmuCore/Speedhacks", "EECycleRate", s_tuner_best.ee_cycle_rate.value());
+	if (s_tuner_best.ee_cycle_skip.has_value())
+		si.SetIntValue("EmuCore/Speedhacks", "EECycleSkip", s_tuner_best.ee_cycle_skip.value());
+	if (s_tuner_best.mtvu.has_value())
+		si.SetBoolValue("EmuCore/Speedhacks", "vuThread", s_tuner_best.mtvu.value());
+	if (s_tuner_best.instant_vu1.has_value())
+		si.SetBoolValue("EmuCore/Speedhacks", "vu1Instant", s_tuner_best.instant_vu1.value());
+
+	if (!si.Save())
+	{
+		Console.Error("Settings tuner: Failed to save game settings to '%s'.", si.GetFileName().c_str());
+		return;
+	}
+
+	Console.WriteLn("Settings tuner: Saved %.2f FPS settings (%.2fx baseline) to '%s'.", s_tuner_best_fps,
+		(s_tuner_baseline_fps > 0.0) ? (s_tuner_best_fps / s_tuner_baseline_fps) : 1.0, si.GetFileName().c_str());
+}
+
+void VMManager::StopRegressionHarness()
+{
+	if (s_harness_start_time != 0)
+	{
+		const double seconds = Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - s_harness_start_time);
+		const u32 frames = g_FrameCount - s_harness_start_frame;
+		const double fps = (seconds > 0.0) ? (static_cast<double>(frames) / seconds) : 0.0;
+		Console.WriteLn("Regression harness: %u frames in %.2f seconds (%.2f FPS), %u checkpoint(s), %u mismatch(es).",
+			frames, seconds, fps, s_hash_checkpoints, s_hash_mismatches);
+
+		if (s_hash_output_file)
+		{
+			std::fprintf(s_hash_output_file, "# frames=%u seconds=%.3f fps=%.2f checkpoints=%u mismatches=%u\n",
+				frames, seconds, fps, s_hash_checkpoints, s_hash_mismatches);
+		}
+	}
+
+	if (s_hash_output_file)
+	{
+		std::fclose(s_hash_output_file);
+		s_hash_output_file = nullptr;
+	}
+
+	if (g_InputRecording.IsActive())
+		g_InputRecording.Stop();
+
+	std::string().swap(s_replay_recording);
+	std::string().swap(s_hash_output);
+	std::string().swap(s_hash_reference);
+	s_hash_reference_values.clear();
+	s_hash_interval = 0;
+	s_harness_start_time = 0;
+	s_tuner_active = false;
+	s_tuner_overrides = {};
+}
+
 void VMManager::Internal::GameStartingOnCPUThread()
 {
 	UpdateRunningGame(false, true);
@@ -1414,6 +2374,14 @@ void VMManager::Internal::VSyncOnCPUThread()
 	ApplyLoadedPatches(PPT_CONTINUOUSLY);
 	ApplyLoadedPatches(PPT_COMBINED_0_1);
 
+	s_runahead_vsync = s_runahead_break_at_vsync;
+
+	// Frames run ahead are thrown away, so input, messages and the like wait for the real frame.
+	if (s_running_ahead)
+		return;
+
+	CaptureRewindState();
+
 	// Frame advance must be done *before* pumping messages, because otherwise
 	// we'll immediately reduce the counter we just set.
 	if (s_frame_advance_count > 0)
@@ -1426,6 +2394,21 @@ void VMManager::Internal::VSyncOnCPUThread()
 		}
 	}
 
+	UpdateRegressionHarness();
+
+	if (s_benchmark_frames_remaining > 0 && --s_benchmark_frames_remaining == 0)
+	{
+		Console.WriteLn("Benchmark finished.");
+
+		// Close the trace after the last frame is presented, rather than when the GS shuts down.
+		GetMTGS().RunOnGSThread([]() { PerformanceMetrics::StopFrameTrace(); });
+		Host::RequestVMShutdown(false, false);
+	}
+
+	// Trace logs aren't flushed per line, keep at most a frame's worth in the buffer in case we crash.
+	if (emuLog)
+		std::fflush(emuLog);
+
 	Host::PumpMessagesOnCPUThread();
 	InputManager::PollSources();
 }
@@ -1618,6 +2601,21 @@ void VMManager::CheckForConfigChanges(const Pcsx2Config& old_config)
 	{
 		VMManager::ReloadPatches(true, true);
 	}
+
+	if (!EmuConfig.EnableRewind && old_config.EnableRewind)
+		ClearRewindStates();
+
+	if (EmuConfig.MetricsExportPath != old_config.MetricsExportPath)
+		UpdateMetricsExport();
+}
+
+void VMManager::UpdateMetricsExport()
+{
+	std::string path(EmuConfig.MetricsExportPath);
+	if (!path.empty() && !Path::IsAbsolute(path))
+		path = Path::Combine(EmuFolders::DataRoot, path);
+
+	GetMTGS().RunOnGSThread([path = std::move(path)]() mutable { PerformanceMetrics::SetMetricsExportPath(std::move(path)); });
 }
 
 void VMManager::ApplySettings()
@@ -1809,6 +2807,15 @@ DEFINE_HOTKEY("LoadStateFromSlot", "Save States", "Load State From Selected Slot
 	if (!pressed)
 		HotkeyLoadStateSlot(s_current_save_slot);
 })
+DEFINE_HOTKEY("Rewind", "Save States", "Rewind", [](s32 pressed) {
+	if (!pressed && VMManager::HasValidVM())
+	{
+		if (EmuConfig.EnableRewind)
+			VMManager::LoadRewindState();
+		else
+			Host::AddKeyedOSDMessage("Rewind", "Rewind is not enabled.", 5.0f);
+	}
+})
 
 #define DEFINE_HOTKEY_SAVESTATE_X(slotnum) DEFINE_HOTKEY("SaveStateToSlot" #slotnum, \
 	"Save States", "Save State To Slot " #slotnum, [](s32 pressed) { if (!pressed) HotkeySaveStateSlot(slotnum); })
@@ -1924,8 +2931,11 @@ static void InitializeCPUInfo()
 	// find the large and small clusters based on frequency
 	// this is assuming the large cluster is always clocked higher
 	// sort based on core, so that hyperthreads get pushed down
-	std::sort(ordered_processors.begin(), ordered_processors.end(), [](const cpuinfo_processor* lhs, const cpuinfo_processor* rhs) {
-		return (lhs->core->frequency > rhs->core->frequency || lhs->smt_id < rhs->smt_id);
+	// this has to be a strict weak ordering, and stable so processors which tie keep their cluster order
+	std::stable_sort(ordered_processors.begin(), ordered_processors.end(), [](const cpuinfo_processor* lhs, const cpuinfo_processor* rhs) {
+		if (lhs->core->frequency != rhs->core->frequency)
+			return lhs->core->frequency > rhs->core->frequency;
+		return lhs->smt_id < rhs->smt_id;
 	});
 
 	s_processor_list.reserve(ordered_processors.size());
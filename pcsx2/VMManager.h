@@ -48,6 +48,36 @@ struct VMBootParameters
 
 	std::optional<bool> fast_boot;
 	std::optional<bool> fullscreen;
+
+	/// Renderer to use for this session only, instead of the configured one.
+	std::optional<GSRendererType> renderer;
+
+	/// When booting a GS dump, replays it this many times unthrottled and writes a frame trace.
+	u32 gs_dump_benchmark_loops = 0;
+	std::string gs_dump_benchmark_output;
+
+	/// When booting a GS dump, starts replay at this frame instead of the beginning.
+	std::optional<u32> gs_dump_start_frame;
+
+	/// Runs this many frames unthrottled, writes a frame trace, then shuts down. Works for games and GS dumps.
+	u32 benchmark_frames = 0;
+	std::string benchmark_output;
+
+	/// Counts EE hardware register accesses for the session, and writes a report here on shutdown.
+	std::string hw_profile_output;
+
+	/// Replays this power-on input recording unthrottled and shuts down when it ends.
+	std::string input_recording;
+
+	/// Hashes EE RAM every this many frames, writing the hashes to hash_output and counting
+	/// mismatches against a previous run's output in hash_reference.
+	u32 hash_interval = 0;
+	std::string hash_output;
+	std::string hash_reference;
+
+	/// Reruns the input recording (or benchmark_frames) from power-on once per candidate speedhack, and saves
+	/// the fastest set that leaves every EE RAM hash identical to the first run into the game settings.
+	bool tune_settings = false;
 };
 
 namespace VMManager
@@ -186,7 +216,14 @@ namespace VMManager
 
 		const std::string& GetElfOverride();
 		bool IsExecutionInterrupted();
+
+		/// Returns true while emulating frames ahead of the real one, which aren't paced or shown.
+		bool IsRunningAhead();
 		void EntryPointCompilingOnCPUThread();
+
+		/// Called when the BIOS first enters EELOAD on fast boot, before the game's ELF is injected.
+		void EELOADStartingOnCPUThread();
+
 		void GameStartingOnCPUThread();
 		void VSyncOnCPUThread();
 	}
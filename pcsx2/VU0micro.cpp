@@ -79,5 +79,11 @@ void vu0ExecMicro(u32 addr) {
 
 	CpuVU0->SetStartPC(VU0.VI[REG_TPC].UL << 3);
 	_vuExecMicroDebug(VU0);
-	CpuVU0->ExecuteBlock(1);
+
+	// Instant VU0 runs the whole program now, leaving VU0.cycle ahead of the EE. The next COP2
+	// interlock or VPU_STAT poll then finds VU0 already stopped instead of stepping it in sync.
+	if (!INSTANT_VU0)
+		CpuVU0->ExecuteBlock(1);
+	else
+		CpuVU0->Execute(vu0RunCycles);
 }
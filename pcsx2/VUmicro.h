@@ -32,6 +32,7 @@ static const uint VU1_MEMMASK	= VU1_MEMSIZE-1;
 static const uint VU1_PROGMASK	= VU1_PROGSIZE-1;
 
 #define vu1RunCycles (3000000) // mVU1 uses this for inf loop detection on dev builds
+#define vu0RunCycles (3000000) // Upper bound for instant VU0 programs, which stop well before this
 
 // --------------------------------------------------------------------------------------
 //  BaseCpuProvider
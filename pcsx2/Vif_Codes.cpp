@@ -303,6 +303,9 @@ vifOp(vifCode_Mark)
 	return 1;
 }
 
+// Uploads up to this many bytes are compared against micro memory before invalidating
+static constexpr int MPG_COMPARE_SIZE = 256;
+
 static __fi void _vifCode_MPG(int idx, u32 addr, const u32* data, int size)
 {
 	VURegs& VUx = idx ? VU1 : VU0;
@@ -342,15 +345,27 @@ static __fi void _vifCode_MPG(int idx, u32 addr, const u32* data, int size)
 		memcpy(VUx.Micro + addr, data, vuMemSize - addr);
 		size -= (vuMemSize - addr) / 4;
 		data += (vuMemSize - addr) / 4;
+
+		// The wrapped part needs clearing too, or the recompiler's view of micro memory goes stale
+		if (!idx)
+			CpuVU0->Clear(0, size * 4);
+		else
+			CpuVU1->Clear(0, size * 4);
+
 		memcpy(VUx.Micro, data, size * 4);
 
 		vifX.tag.addr = size * 4;
 	}
+	else if (size * 4 <= MPG_COMPARE_SIZE && memcmp(VUx.Micro + addr, data, size * 4) == 0)
+	{
+		// Small uploads are usually games patching a few instructions or inline constants, often with the
+		// values already there. Leaving the current microprogram alone skips the clear and re-search.
+		vifX.tag.addr += size * 4;
+	}
 	else
 	{
-		//The compare is pretty much a waste of time, likelyhood is that the program isnt there, thats why its copying it.
-		//Faster without.
-		//if (memcmp(VUx.Micro + addr, data, size*4)) {
+		//The compare is pretty much a waste of time for whole programs, likelyhood is that the program isnt there,
+		//thats why its copying it. Faster without.
 		// Clear VU memory before writing!
 		if (!idx)
 			CpuVU0->Clear(addr, size * 4);
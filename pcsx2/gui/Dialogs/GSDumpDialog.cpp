@@ -479,6 +479,13 @@ void Dialogs::GSDumpDialog::GenPacketInfo(const GSDumpFile::GSData& dump)
 		case GSType::Registers:
 			m_gif_packet->AppendItem(rootId, "Registers");
 			break;
+		case GSType::Keyframe:
+		{
+			wxString s;
+			s.Printf("Keyframe: Size = %d byte", dump.length);
+			m_gif_packet->AppendItem(rootId, s);
+			break;
+		}
 	}
 }
 
@@ -793,6 +800,9 @@ void Dialogs::GSDumpDialog::ProcessDumpEvent(const GSDumpFile::GSData& event, u8
 		case GSType::Registers:
 			memcpy(regs, event.data, 8192);
 			break;
+		case GSType::Keyframe:
+			// The state already matches when replaying from the start.
+			break;
 	}
 }
 
@@ -16,6 +16,7 @@
 #pragma once
 
 #include "fmt/core.h"
+#include "DebugTools/HwProfiler.h"
 
 #define eeAddrInRange(name, addr) \
 	(addr >= EEMemoryMap::name##_Start && addr < EEMemoryMap::name##_End)
@@ -267,6 +268,8 @@ static __ri const char* _eelog_GetHwName( u32 addr, T val )
 template< typename T>
 static __ri void eeHwTraceLog( u32 addr, T val, bool mode )
 {
+	HwProfiler::Record(addr, sizeof(T), !mode);
+
 	if (!IsDevBuild) return;
 	if (!EmuConfig.Trace.Enabled || !EmuConfig.Trace.EE.m_EnableAll || !EmuConfig.Trace.EE.m_EnableRegisters) return;
 	if (!_eelog_enabled(addr)) return;
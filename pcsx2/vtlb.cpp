@@ -78,34 +78,41 @@ vtlb_private::VTLBVirtual::VTLBVirtual(VTLBPhysical phys, u32 paddr, u32 vaddr)
 	}
 }
 
-__inline int CheckCache(u32 addr)
+// Cacheable (C=3) TLB ranges, rebuilt whenever the TLB changes so the interpreter
+// memory handlers don't have to walk all 48 entries on every access.
+struct CacheableRange
+{
+	u32 start;
+	u32 end; // inclusive
+};
+static CacheableRange s_cacheableRanges[96];
+static int s_cacheableRangeCount = 0;
+
+void vtlb_UpdateCacheableRanges()
 {
-	u32 mask;
+	s_cacheableRangeCount = 0;
 
-	if(((cpuRegs.CP0.n.Config >> 16) & 0x1) == 0) 
+	for (int i = 1; i < 48; i++)
+	{
+		if (((tlb[i].EntryLo1 & 0x38) >> 3) == 0x3)
+			s_cacheableRanges[s_cacheableRangeCount++] = {tlb[i].PFN1, tlb[i].PFN1 + tlb[i].PageMask};
+		if (((tlb[i].EntryLo0 & 0x38) >> 3) == 0x3)
+			s_cacheableRanges[s_cacheableRangeCount++] = {tlb[i].PFN0, tlb[i].PFN0 + tlb[i].PageMask};
+	}
+}
+
+__inline int CheckCache(u32 addr)
+{
+	if(((cpuRegs.CP0.n.Config >> 16) & 0x1) == 0)
 	{
 		//DevCon.Warning("Data Cache Disabled! %x", cpuRegs.CP0.n.Config);
 		return false;//
 	}
 
-	for(int i = 1; i < 48; i++)
+	for (int i = 0; i < s_cacheableRangeCount; i++)
 	{
-		if (((tlb[i].EntryLo1 & 0x38) >> 3) == 0x3) {
-			mask  = tlb[i].PageMask;
-			
-			if ((addr >= tlb[i].PFN1) && (addr <= tlb[i].PFN1 + mask)) {
-				//DevCon.Warning("Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0); 
-				return true;
-			}
-		}
-		if (((tlb[i].EntryLo0 & 0x38) >> 3) == 0x3) {
-			mask  = tlb[i].PageMask;
-			
-			if ((addr >= tlb[i].PFN0) && (addr <= tlb[i].PFN0 + mask)) {
-				//DevCon.Warning("Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0); 
-				return true;
-			}
-		}
+		if (addr >= s_cacheableRanges[i].start && addr <= s_cacheableRanges[i].end)
+			return true;
 	}
 	return false;
 }
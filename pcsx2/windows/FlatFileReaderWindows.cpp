@@ -21,7 +21,9 @@ FlatFileReader::FlatFileReader(bool shareWrite) : shareWrite(shareWrite)
 {
 	m_blocksize = 2048;
 	hOverlappedFile = INVALID_HANDLE_VALUE;
-	hEvent = INVALID_HANDLE_VALUE;
+	for (HANDLE& event : hEvent)
+		event = INVALID_HANDLE_VALUE;
+	asyncSegments = 0;
 	asyncInProgress = false;
 }
 
@@ -34,7 +36,8 @@ bool FlatFileReader::Open(std::string fileName)
 {
 	m_filename = std::move(fileName);
 
-	hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+	for (HANDLE& event : hEvent)
+		event = CreateEvent(NULL, TRUE, FALSE, NULL);
 
 	DWORD shareMode = FILE_SHARE_READ;
 	if (shareWrite)
@@ -70,32 +73,45 @@ int FlatFileReader::ReadSync(void* pBuffer, uint sector, uint count)
 
 void FlatFileReader::BeginRead(void* pBuffer, uint sector, uint count)
 {
-	LARGE_INTEGER offset;
-	offset.QuadPart = sector * (s64)m_blocksize + m_dataoffset;
-	
-	DWORD bytesToRead = count * m_blocksize;
+	const uint segment_blocks = GetSegmentBlocks(count);
 
-	ZeroMemory(&asyncOperationContext, sizeof(asyncOperationContext));
-	asyncOperationContext.hEvent = hEvent;
-	asyncOperationContext.Offset = offset.LowPart;
-	asyncOperationContext.OffsetHigh = offset.HighPart;
+	asyncSegments = 0;
+	for (uint done = 0; done < count; done += segment_blocks, asyncSegments++)
+	{
+		LARGE_INTEGER offset;
+		offset.QuadPart = (sector + done) * (s64)m_blocksize + m_dataoffset;
+
+		DWORD bytesToRead = std::min(segment_blocks, count - done) * m_blocksize;
+
+		OVERLAPPED& context = asyncOperationContext[asyncSegments];
+		ZeroMemory(&context, sizeof(context));
+		context.hEvent = hEvent[asyncSegments];
+		context.Offset = offset.LowPart;
+		context.OffsetHigh = offset.HighPart;
 
-	ReadFile(hOverlappedFile, pBuffer, bytesToRead, NULL, &asyncOperationContext);
+		ReadFile(hOverlappedFile, static_cast<u8*>(pBuffer) + done * m_blocksize, bytesToRead, NULL, &context);
+	}
 	asyncInProgress = true;
 }
 
 int FlatFileReader::FinishRead(void)
 {
-	DWORD bytes;
-	
-	if(!GetOverlappedResult(hOverlappedFile, &asyncOperationContext, &bytes, TRUE))
+	// Segments complete in any order, but a short read can only come from the end of the file,
+	// so the sum is still the number of contiguous bytes read.
+	int total = 0;
+	bool failed = false;
+	for (uint i = 0; i < asyncSegments; i++)
 	{
-		asyncInProgress = false;
-		return -1;
+		DWORD bytes;
+		if (!GetOverlappedResult(hOverlappedFile, &asyncOperationContext[i], &bytes, TRUE))
+			failed = true;
+		else
+			total += bytes;
 	}
 
+	asyncSegments = 0;
 	asyncInProgress = false;
-	return bytes;
+	return failed ? -1 : total;
 }
 
 void FlatFileReader::CancelRead(void)
@@ -111,11 +127,14 @@ void FlatFileReader::Close(void)
 	if(hOverlappedFile != INVALID_HANDLE_VALUE)
 		CloseHandle(hOverlappedFile);
 
-	if(hEvent != INVALID_HANDLE_VALUE)
-		CloseHandle(hEvent);
+	for (HANDLE& event : hEvent)
+	{
+		if (event != INVALID_HANDLE_VALUE)
+			CloseHandle(event);
+		event = INVALID_HANDLE_VALUE;
+	}
 
 	hOverlappedFile = INVALID_HANDLE_VALUE;
-	hEvent = INVALID_HANDLE_VALUE;
 }
 
 uint FlatFileReader::GetBlockCount(void) const
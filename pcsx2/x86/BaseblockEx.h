@@ -37,11 +37,9 @@ struct BASEBLOCKEX
 	u16 size;    // The size in dwords (equivalent to the number of instructions)
 	u16 x86size; // The size in byte of the translated x86 instructions
 
-#ifdef PCSX2_DEVBUILD
-	// Could be useful to instrument the block
-	//u32 visited; // number of times called
-	//u64 ltime; // regs it assumes to have set already
-#endif
+	// Number of times the block was entered. Only set when the recompiler is profiling blocks;
+	// the counter lives outside the array since blocks get moved around on insert/erase.
+	u64* visits;
 };
 
 class BaseBlockArray
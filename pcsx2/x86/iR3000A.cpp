@@ -28,6 +28,7 @@
 #include "IopBios.h"
 #include "IopHw.h"
 #include "Common.h"
+#include "Elfheader.h"
 
 #include <time.h>
 
@@ -51,6 +52,10 @@
 
 #include "fmt/core.h"
 
+#define XXH_STATIC_LINKING_ONLY 1
+#define XXH_INLINE_ALL 1
+#include "xxhash.h"
+
 using namespace x86Emitter;
 
 extern u32 g_iopNextEventCycle;
@@ -752,10 +757,184 @@ static void recAlloc()
 	_DynGen_Dispatchers();
 }
 
+// --------------------------------------------------------------------------------------
+//  Persistent block list
+// --------------------------------------------------------------------------------------
+// Same idea as the EE rec's block list: remember the guest pc, length and code hash of the
+// blocks a game compiled, and compile them up front next time. IOP code mostly arrives as
+// modules the game loads long after its entry point, so instead of a single warm-up pass the
+// list is kept pending, and whenever one of its blocks gets compiled the normal way (the
+// module it belongs to has been loaded and started running) the rest of the pending blocks
+// whose code is now resident are compiled along with it.
+
+static constexpr u32 BLOCK_LIST_SIGNATURE = 0x4C425249; // IRBL
+static constexpr u32 BLOCK_LIST_VERSION = 1;
+static constexpr u32 BLOCK_LIST_MAX_ENTRIES = 0x20000;
+
+// The kernel and BIOS modules live below this, and the IRX injection hack patches them.
+static constexpr u32 BLOCK_LIST_MIN_ADDRESS = 0x10000;
+
+struct BlockListEntry
+{
+	u32 pc;
+	u32 size;
+	u64 hash;
+};
+
+static std::vector<BlockListEntry> s_blockList;
+static std::vector<BlockListEntry> s_blockListPending; // sorted by pc
+static u32 s_blockListCRC = 0;
+static bool s_blockListWarming = false;
+
+static std::string GetBlockListFilename(u32 crc)
+{
+	return Path::Combine(EmuFolders::Cache, fmt::format("ioprec_{:08X}.blocks", crc));
+}
+
+static const void* GetBlockListCode(u32 pc, u32 size)
+{
+	const u32 hwpc = HWADDR(pc);
+	if (hwpc < BLOCK_LIST_MIN_ADDRESS || hwpc >= Ps2MemSize::IopRam || size == 0 || (hwpc + size * 4) > Ps2MemSize::IopRam)
+		return nullptr;
+
+	return iopPhysMem(hwpc);
+}
+
+static bool LoadBlockList(u32 crc, std::vector<BlockListEntry>* entries)
+{
+	auto fp = FileSystem::OpenManagedCFile(GetBlockListFilename(crc).c_str(), "rb");
+	if (!fp)
+		return false;
+
+	u32 header[4];
+	if (std::fread(header, sizeof(header), 1, fp.get()) != 1 || header[0] != BLOCK_LIST_SIGNATURE ||
+		header[1] != BLOCK_LIST_VERSION || header[2] != crc || header[3] > BLOCK_LIST_MAX_ENTRIES)
+	{
+		return false;
+	}
+
+	entries->resize(header[3]);
+	if (header[3] > 0 && std::fread(entries->data(), sizeof(BlockListEntry), header[3], fp.get()) != header[3])
+	{
+		entries->clear();
+		return false;
+	}
+
+	return true;
+}
+
+static void SaveBlockList()
+{
+	if (s_blockListCRC == 0 || s_blockList.empty())
+		return;
+
+	std::vector<BlockListEntry> existing;
+	LoadBlockList(s_blockListCRC, &existing);
+
+	std::map<u32, BlockListEntry> merged;
+	for (const BlockListEntry& entry : existing)
+		merged.emplace(entry.pc, entry);
+
+	for (const BlockListEntry& entry : s_blockList)
+	{
+		const BASEBLOCKEX* block = recBlocks.Get(HWADDR(entry.pc));
+		if (block && block->startpc == HWADDR(entry.pc) && block->size == entry.size)
+			merged[entry.pc] = entry;
+	}
+
+	s_blockList.clear();
+
+	auto fp = FileSystem::OpenManagedCFile(GetBlockListFilename(s_blockListCRC).c_str(), "wb");
+	if (!fp)
+		return;
+
+	const u32 count = std::min<u32>(static_cast<u32>(merged.size()), BLOCK_LIST_MAX_ENTRIES);
+	const u32 header[4] = {BLOCK_LIST_SIGNATURE, BLOCK_LIST_VERSION, s_blockListCRC, count};
+	std::fwrite(header, sizeof(header), 1, fp.get());
+
+	u32 written = 0;
+	for (auto it = merged.begin(); it != merged.end() && written < count; ++it, ++written)
+		std::fwrite(&it->second, sizeof(BlockListEntry), 1, fp.get());
+
+	DevCon.WriteLn("IOP block list: saved %u blocks for CRC %08X", count, s_blockListCRC);
+}
+
+// Picks up the list of the game that's now running, once its ELF CRC is known.
+static void UpdateBlockListGame()
+{
+	const u32 crc = (EmuConfig.Cpu.Recompiler.EnableIOPBlockList && g_GameStarted) ? ElfCRC : 0;
+	if (crc == s_blockListCRC)
+		return;
+
+	SaveBlockList();
+	s_blockListPending.clear();
+	s_blockListCRC = crc;
+	if (crc == 0)
+		return;
+
+	if (LoadBlockList(crc, &s_blockListPending))
+	{
+		std::sort(s_blockListPending.begin(), s_blockListPending.end(),
+			[](const BlockListEntry& lhs, const BlockListEntry& rhs) { return lhs.pc < rhs.pc; });
+		DevCon.WriteLn("IOP block list: %zu blocks pending for CRC %08X", s_blockListPending.size(), crc);
+	}
+}
+
+static bool IsBlockListPending(u32 pc)
+{
+	const auto it = std::lower_bound(s_blockListPending.begin(), s_blockListPending.end(), pc,
+		[](const BlockListEntry& entry, u32 value) { return entry.pc < value; });
+	return (it != s_blockListPending.end() && it->pc == pc);
+}
+
+static void WarmBlockList(u32 trigger_pc)
+{
+	s_blockListWarming = true;
+
+	u32 compiled = 0;
+	auto out = s_blockListPending.begin();
+	for (auto it = s_blockListPending.begin(); it != s_blockListPending.end(); ++it)
+	{
+		const BlockListEntry& entry = *it;
+
+		// Leave enough room that warming never forces a cache reset on its own. Whatever is
+		// left stays pending for the next trigger.
+		const bool room = (recPtr < (recMem->GetPtrEnd() - _1mb));
+		if (room && entry.pc != trigger_pc)
+		{
+			const void* code = GetBlockListCode(entry.pc, entry.size);
+			if (!code || XXH3_64bits(code, entry.size * 4) != entry.hash)
+			{
+				*out++ = entry;
+				continue;
+			}
+
+			if (PSX_GETBLOCK(entry.pc)->GetFnptr() == (uptr)iopJITCompile)
+			{
+				iopRecRecompile(entry.pc);
+				compiled++;
+			}
+		}
+		else if (entry.pc != trigger_pc)
+		{
+			*out++ = entry;
+		}
+	}
+	s_blockListPending.erase(out, s_blockListPending.end());
+
+	s_blockListWarming = false;
+
+	if (compiled > 0)
+		DevCon.WriteLn("IOP block list: precompiled %u blocks, %zu still pending", compiled, s_blockListPending.size());
+}
+
 void recResetIOP()
 {
 	DevCon.WriteLn("iR3000A Recompiler reset.");
 
+	// A reset while the same game is still running keeps collecting into the same list.
+	SaveBlockList();
+
 	Perf::iop.reset();
 
 	recAlloc();
@@ -815,6 +994,10 @@ void recResetIOP()
 
 static void recShutdown()
 {
+	SaveBlockList();
+	s_blockListCRC = 0;
+	s_blockListPending.clear();
+
 	safe_delete(recMem);
 
 	safe_aligned_free(m_recBlockAlloc);
@@ -1442,18 +1625,95 @@ StartRecomp:
 	if (s_branchTo == startpc)
 	{
 		s_nBlockFF = true;
+
+		// Same rules as the EE: the loop may only load memory and compute on the loaded values,
+		// and must not modify any register it reads from before the loop, so every iteration
+		// does the same thing until an event/interrupt changes what it's polling.
+		u32 reads = 0, loads = 1;
+
 		for (i = startpc; i < s_nEndBlock; i += 4)
 		{
-			if (i != s_nEndBlock - 8)
+			if (i == s_nEndBlock - 8)
+				continue;
+			psxRegs.code = iopMemRead32(i);
+			const u32 op = psxRegs.code >> 26;
+			// nop
+			if (psxRegs.code == 0)
+				continue;
+			// imm arithmetic
+			else if ((op & 070) == 010)
 			{
-				switch (iopMemRead32(i))
+				if (loads & 1 << _Rs_)
+				{
+					loads |= 1 << _Rt_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rs_;
+				if (reads & 1 << _Rt_)
 				{
-					case 0: // nop
-						break;
-					default:
-						s_nBlockFF = false;
+					s_nBlockFF = false;
+					break;
 				}
 			}
+			// constant shifts
+			else if (op == 0 && (_Funct_ & 074) == 000 && (_Funct_ & 3) != 1)
+			{
+				if (loads & 1 << _Rt_)
+				{
+					loads |= 1 << _Rd_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rt_;
+				if (reads & 1 << _Rd_)
+				{
+					s_nBlockFF = false;
+					break;
+				}
+			}
+			// common register arithmetic instructions, variable shifts
+			else if (op == 0 && (((_Funct_ & 060) == 040 && (_Funct_ & 076) != 050) || ((_Funct_ & 074) == 004 && (_Funct_ & 3) != 1)))
+			{
+				if (loads & 1 << _Rs_ && loads & 1 << _Rt_)
+				{
+					loads |= 1 << _Rd_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rs_ | 1 << _Rt_;
+				if (reads & 1 << _Rd_)
+				{
+					s_nBlockFF = false;
+					break;
+				}
+			}
+			// loads
+			else if ((op & 070) == 040)
+			{
+				if (loads & 1 << _Rs_)
+				{
+					loads |= 1 << _Rt_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rs_;
+				if (reads & 1 << _Rt_)
+				{
+					s_nBlockFF = false;
+					break;
+				}
+			}
+			// mfc*, cfc*
+			else if ((op & 074) == 020 && _Rs_ < 4)
+			{
+				loads |= 1 << _Rt_;
+			}
+			else
+			{
+				s_nBlockFF = false;
+				break;
+			}
 		}
 	}
 
@@ -1557,8 +1817,22 @@ StartRecomp:
 
 	pxAssert((g_psxHasConstReg & g_psxFlushedConstReg) == g_psxHasConstReg);
 
+	const u32 blocksize = s_pCurBlockEx->size;
 	s_pCurBlock = NULL;
 	s_pCurBlockEx = NULL;
+
+	if (s_blockListWarming)
+		return;
+
+	UpdateBlockListGame();
+	if (s_blockListCRC != 0)
+	{
+		if (const void* code = GetBlockListCode(startpc, blocksize))
+			s_blockList.push_back({startpc, blocksize, XXH3_64bits(code, blocksize * 4)});
+
+		if (IsBlockListPending(startpc))
+			WarmBlockList(startpc);
+	}
 }
 
 static void recSetCacheReserve(uint reserveInMegs)
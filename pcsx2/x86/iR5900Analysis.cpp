@@ -70,7 +70,8 @@ void COP2FlagHackPass::Run(u32 start, u32 end, EEINST* inst_cache)
 	m_status_denormalized = false;
 	m_last_status_write = nullptr;
 	m_last_mac_write = nullptr;
-	m_last_clip_write = nullptr;
+	std::fill(std::begin(m_last_clip_writes), std::end(m_last_clip_writes), nullptr);
+	m_last_clip_write_pos = 0;
 	m_cfc2_pc = start;
 
 	ForEachInstruction(start, end, inst_cache, [this, end](u32 apc, EEINST* inst) {
@@ -167,10 +168,10 @@ void COP2FlagHackPass::Run(u32 start, u32 end, EEINST* inst_cache)
 		// CLIP
 		if (flags & 4)
 		{
-			// we don't track the clip flag yet..
-			// but it's unlikely that we'll have more than 4 clip flags in a row, because that would be pointless?
-			inst->info |= EEINST_COP2_CLIP_FLAG;
-			m_last_clip_write = inst;
+			// the clip flag is a shift register holding the last four results, so only
+			// the last four writes before a read can be observed.
+			m_last_clip_writes[m_last_clip_write_pos] = inst;
+			m_last_clip_write_pos = (m_last_clip_write_pos + 1) % std::size(m_last_clip_writes);
 		}
 
 		return true;
@@ -217,8 +218,11 @@ void COP2FlagHackPass::CommitMACFlag()
 
 void COP2FlagHackPass::CommitClipFlag()
 {
-	if (m_last_clip_write)
-		m_last_clip_write->info |= EEINST_COP2_CLIP_FLAG;
+	for (EEINST* inst : m_last_clip_writes)
+	{
+		if (inst)
+			inst->info |= EEINST_COP2_CLIP_FLAG;
+	}
 }
 
 void COP2FlagHackPass::CommitAllFlags()
@@ -272,3 +276,93 @@ void COP2MicroFinishPass::Run(u32 start, u32 end, EEINST* inst_cache)
 		return true;
 	});
 }
+
+DeadGPRWritePass::DeadGPRWritePass() = default;
+
+DeadGPRWritePass::~DeadGPRWritePass() = default;
+
+void DeadGPRWritePass::Run(u32 start, u32 end, EEINST* inst_cache)
+{
+	// Walk the block backwards, tracking GPRs which are overwritten before they are read.
+	// Anything we don't understand (memory ops, branches, MMI, COP*, ...) could read or expose
+	// any register, or raise an exception, so it makes everything live again.
+	u32 dead_regs = 0;
+
+	EEINST* eeinst = inst_cache + (end - start) / 4;
+	for (u32 apc = end; apc > start;)
+	{
+		apc -= 4;
+		eeinst--;
+		cpuRegs.code = memRead32(apc);
+
+		u32 dest, reads;
+		if (!GetSimpleALUInfo(&dest, &reads) || isBreakpointNeeded(apc) != 0)
+		{
+			dead_regs = 0;
+			continue;
+		}
+
+		if (dest == 0)
+			continue;
+
+		if (dead_regs & (1u << dest))
+		{
+			// The result is never observed, and since the instruction won't be emitted, neither are its sources.
+			eeinst->info |= EEINST_DEAD_GPR_WRITE;
+			continue;
+		}
+
+		dead_regs = (dead_regs | (1u << dest)) & ~reads;
+	}
+}
+
+bool DeadGPRWritePass::GetSimpleALUInfo(u32* dest, u32* reads)
+{
+	// Only instructions which write the low 64 bits of one GPR and can't raise an exception.
+	switch (_Opcode_)
+	{
+		case 000: // SPECIAL
+			switch (_Funct_)
+			{
+				case 000: case 002: case 003: // SLL/SRL/SRA
+				case 070: case 072: case 073: // DSLL/DSRL/DSRA
+				case 074: case 076: case 077: // DSLL32/DSRL32/DSRA32
+					*dest = _Rd_;
+					*reads = (1u << _Rt_);
+					return true;
+
+				case 004: case 006: case 007: // SLLV/SRLV/SRAV
+				case 024: case 026: case 027: // DSLLV/DSRLV/DSRAV
+				case 041: case 043: // ADDU/SUBU
+				case 044: case 045: case 046: case 047: // AND/OR/XOR/NOR
+				case 052: case 053: // SLT/SLTU
+				case 055: case 057: // DADDU/DSUBU
+					*dest = _Rd_;
+					*reads = (1u << _Rs_) | (1u << _Rt_);
+					return true;
+
+				case 020: case 022: // MFHI/MFLO
+					*dest = _Rd_;
+					*reads = 0;
+					return true;
+
+				default:
+					return false;
+			}
+
+		case 011: case 012: case 013: // ADDIU/SLTI/SLTIU
+		case 014: case 015: case 016: // ANDI/ORI/XORI
+		case 031: // DADDIU
+			*dest = _Rt_;
+			*reads = (1u << _Rs_);
+			return true;
+
+		case 017: // LUI
+			*dest = _Rt_;
+			*reads = 0;
+			return true;
+
+		default:
+			return false;
+	}
+}
@@ -58,7 +58,8 @@ namespace R5900
 		bool m_status_denormalized = false;
 		EEINST* m_last_status_write = nullptr;
 		EEINST* m_last_mac_write = nullptr;
-		EEINST* m_last_clip_write = nullptr;
+		EEINST* m_last_clip_writes[4] = {};
+		u32 m_last_clip_write_pos = 0;
 
 		u32 m_cfc2_pc = 0;
 	};
@@ -71,4 +72,16 @@ namespace R5900
 
 		void Run(u32 start, u32 end, EEINST* inst_cache) override;
 	};
+
+	class DeadGPRWritePass final : public AnalysisPass
+	{
+	public:
+		DeadGPRWritePass();
+		~DeadGPRWritePass();
+
+		void Run(u32 start, u32 end, EEINST* inst_cache) override;
+
+	private:
+		static bool GetSimpleALUInfo(u32* dest, u32* reads);
+	};
 } // namespace R5900
\ No newline at end of file
@@ -44,9 +44,16 @@
 
 #include "common/AlignedMalloc.h"
 #include "common/FastJmp.h"
+#include "common/FileSystem.h"
 #include "common/MemsetFast.inl"
+#include "common/Path.h"
 #include "common/Perf.h"
 
+#define XXH_STATIC_LINKING_ONLY 1
+#define XXH_INLINE_ALL 1
+#include "xxhash.h"
+
+#include <deque>
 
 using namespace x86Emitter;
 using namespace R5900;
@@ -83,7 +90,9 @@ eeProfiler EE::Profiler;
 // Static Private Variables - R5900 Dynarec
 
 #define X86
-static const int RECCONSTBUF_SIZE = 16384 * 2; // 64 bit consts in 32 bit units
+// 64 bit consts in 32 bit units. Running out of these resets the whole code cache just like running out
+// of code space does, and at 16K constants it used to fill up long before the 64MB of code did.
+static const int RECCONSTBUF_SIZE = 131072 * 2;
 
 static RecompiledCodeReserve* recMem = NULL;
 static u8* recRAMCopy = NULL;
@@ -117,6 +126,10 @@ static EEINST* s_psaveInstInfo = NULL;
 
 static u32 s_savenBlockCycles = 0;
 
+// Block cycle count at which HI/LO and HI1/LO1 results become available (EEPipelineStalls)
+static u32 s_nHiLoReady[2] = {};
+static u32 s_saveHiLoReady[2] = {};
+
 #ifdef PCSX2_DEBUG
 static u32 dumplog = 0;
 #else
@@ -300,7 +313,8 @@ u32* recGetImm64(u32 hi, u32 lo)
 {
 	u32* imm64; // returned pointer
 	static u32* imm64_cache[509];
-	int cacheidx = lo % (sizeof imm64_cache / sizeof *imm64_cache);
+	// mix in the high half, lots of constants share a low word and only differ in their upper bits
+	int cacheidx = (lo ^ (hi * 0x9E3779B1u)) % (sizeof imm64_cache / sizeof *imm64_cache);
 
 	imm64 = imm64_cache[cacheidx];
 	if (imm64 && imm64[0] == lo && imm64[1] == hi)
@@ -631,6 +645,226 @@ static void recAlloc()
 alignas(16) static u16 manual_page[Ps2MemSize::MainRam >> 12];
 alignas(16) static u8 manual_counter[Ps2MemSize::MainRam >> 12];
 
+// --------------------------------------------------------------------------------------
+//  Persistent block list
+// --------------------------------------------------------------------------------------
+// Recompiled code can't be written out as-is: it bakes in host addresses (cpuRegs, the
+// const buffer, memory handlers) and jumps which are patched in by block linking. What we
+// keep instead is the guest side of every block a game compiled -- its entry pc, length
+// and a hash of its code. When the same ELF reaches its entry point again, every block
+// whose code is already resident and unchanged gets compiled up front, so the JIT cost is
+// paid during boot instead of as a hitch the first time the code runs.
+
+static constexpr u32 BLOCK_LIST_SIGNATURE = 0x4C425245; // ERBL
+static constexpr u32 BLOCK_LIST_VERSION = 1;
+static constexpr u32 BLOCK_LIST_MAX_ENTRIES = 0x40000;
+
+// Kernel and EELOAD live below this; they have hooks attached at compile time.
+static constexpr u32 BLOCK_LIST_MIN_ADDRESS = 0x100000;
+
+struct BlockListEntry
+{
+	u32 pc;
+	u32 size;
+	u64 hash;
+};
+
+static std::vector<BlockListEntry> s_blockList;
+static u32 s_blockListCRC = 0;
+static bool s_blockListWarmPending = false;
+
+static std::string GetBlockListFilename(u32 crc)
+{
+	return Path::Combine(EmuFolders::Cache, fmt::format("eerec_{:08X}.blocks", crc));
+}
+
+static bool LoadBlockList(u32 crc, std::vector<BlockListEntry>* entries)
+{
+	auto fp = FileSystem::OpenManagedCFile(GetBlockListFilename(crc).c_str(), "rb");
+	if (!fp)
+		return false;
+
+	u32 header[4];
+	if (std::fread(header, sizeof(header), 1, fp.get()) != 1 || header[0] != BLOCK_LIST_SIGNATURE ||
+		header[1] != BLOCK_LIST_VERSION || header[2] != crc || header[3] > BLOCK_LIST_MAX_ENTRIES)
+	{
+		return false;
+	}
+
+	entries->resize(header[3]);
+	if (header[3] > 0 && std::fread(entries->data(), sizeof(BlockListEntry), header[3], fp.get()) != header[3])
+	{
+		entries->clear();
+		return false;
+	}
+
+	return true;
+}
+
+// Merges the blocks compiled since the last reset into the list on disk. Blocks which were
+// discarded (self-modifying code, overlays being replaced) are no longer in recBlocks, so
+// they drop out here instead of being revalidated on every boot.
+static void SaveBlockList()
+{
+	if (s_blockListCRC == 0 || s_blockList.empty())
+		return;
+
+	std::vector<BlockListEntry> existing;
+	LoadBlockList(s_blockListCRC, &existing);
+
+	std::map<u32, BlockListEntry> merged;
+	for (const BlockListEntry& entry : existing)
+		merged.emplace(entry.pc, entry);
+
+	for (const BlockListEntry& entry : s_blockList)
+	{
+		const BASEBLOCKEX* block = recBlocks.Get(HWADDR(entry.pc));
+		if (block && block->startpc == HWADDR(entry.pc) && block->size == entry.size)
+			merged[entry.pc] = entry;
+	}
+
+	s_blockList.clear();
+
+	auto fp = FileSystem::OpenManagedCFile(GetBlockListFilename(s_blockListCRC).c_str(), "wb");
+	if (!fp)
+		return;
+
+	const u32 count = std::min<u32>(static_cast<u32>(merged.size()), BLOCK_LIST_MAX_ENTRIES);
+	const u32 header[4] = {BLOCK_LIST_SIGNATURE, BLOCK_LIST_VERSION, s_blockListCRC, count};
+	std::fwrite(header, sizeof(header), 1, fp.get());
+
+	u32 written = 0;
+	for (auto it = merged.begin(); it != merged.end() && written < count; ++it, ++written)
+		std::fwrite(&it->second, sizeof(BlockListEntry), 1, fp.get());
+
+	DevCon.WriteLn("EE block list: saved %u blocks for CRC %08X", count, s_blockListCRC);
+}
+
+static void WarmBlockList()
+{
+	s_blockListCRC = ElfCRC;
+	if (s_blockListCRC == 0)
+		return;
+
+	std::vector<BlockListEntry> entries;
+	if (!LoadBlockList(s_blockListCRC, &entries))
+		return;
+
+	u32 compiled = 0;
+	for (const BlockListEntry& entry : entries)
+	{
+		// Leave enough room that the warm-up never triggers a cache reset on its own.
+		if (recPtr >= (recMem->GetPtrEnd() - _1mb) || (recConstBufPtr - recConstBuf) >= RECCONSTBUF_SIZE / 2 || eeRecNeedsReset)
+			break;
+
+		const u32 hwpc = HWADDR(entry.pc);
+		if (hwpc < BLOCK_LIST_MIN_ADDRESS || hwpc >= Ps2MemSize::MainRam || entry.size == 0 ||
+			(hwpc + entry.size * 4) > Ps2MemSize::MainRam || hwpc == ElfEntry)
+		{
+			continue;
+		}
+
+		if (PC_GETBLOCK(entry.pc)->GetFnptr() != (uptr)JITCompile)
+			continue;
+
+		const void* code = PSM(entry.pc);
+		if (!code || XXH3_64bits(code, entry.size * 4) != entry.hash)
+			continue;
+
+		recRecompile(entry.pc);
+		compiled++;
+	}
+
+	DevCon.WriteLn("EE block list: precompiled %u of %zu blocks for CRC %08X", compiled, entries.size(), s_blockListCRC);
+}
+
+// --------------------------------------------------------------------------------------
+//  Block profiling
+// --------------------------------------------------------------------------------------
+// Every block compiled while profiling is enabled bumps a 64-bit counter on entry. The
+// counters are folded into per-pc totals whenever the cache is reset, so blocks which are
+// invalidated and recompiled (overlays, self-modifying code) keep accumulating, and the
+// totals are written out as a plain text hot-block report.
+
+static constexpr u32 BLOCK_PROFILE_REPORT_ENTRIES = 1024;
+
+struct BlockProfileEntry
+{
+	u32 pc;
+	u32 size;
+	u64 visits;
+};
+
+struct BlockProfileTotal
+{
+	u32 size;
+	u32 compiles;
+	u64 visits;
+};
+
+// Compiled code holds pointers into this, so it must not relocate its elements on growth.
+static std::deque<BlockProfileEntry> s_blockProfile;
+static std::map<u32, BlockProfileTotal> s_blockProfileTotals;
+static u32 s_blockProfileCRC = 0;
+
+static void CollectBlockProfile()
+{
+	for (const BlockProfileEntry& entry : s_blockProfile)
+	{
+		BlockProfileTotal& total = s_blockProfileTotals[entry.pc];
+		total.size = std::max(total.size, entry.size);
+		total.compiles++;
+		total.visits += entry.visits;
+	}
+
+	s_blockProfile.clear();
+}
+
+static void SaveBlockProfile()
+{
+	CollectBlockProfile();
+	if (s_blockProfileTotals.empty())
+		return;
+
+	std::vector<std::pair<u32, const BlockProfileTotal*>> sorted;
+	sorted.reserve(s_blockProfileTotals.size());
+
+	u64 total_insts = 0;
+	for (const auto& it : s_blockProfileTotals)
+	{
+		total_insts += it.second.visits * it.second.size;
+		sorted.emplace_back(it.first, &it.second);
+	}
+
+	// Rank by guest instructions executed rather than entries, a long loop body entered
+	// a few times matters more than a three instruction stub entered often.
+	std::sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) {
+		return (lhs.second->visits * lhs.second->size) > (rhs.second->visits * rhs.second->size);
+	});
+
+	FileSystem::CreateDirectoryPath(EmuFolders::Logs.c_str(), false);
+	const std::string filename(Path::Combine(EmuFolders::Logs, fmt::format("eerec_hotblocks_{:08X}.txt", s_blockProfileCRC)));
+	auto fp = FileSystem::OpenManagedCFile(filename.c_str(), "wb");
+	if (!fp)
+		return;
+
+	std::fprintf(fp.get(), "# EE hot blocks for CRC %08X: %zu blocks, %llu instructions\n", s_blockProfileCRC,
+		sorted.size(), static_cast<unsigned long long>(total_insts));
+	std::fprintf(fp.get(), "# %-8s %6s %8s %16s %16s %8s\n", "pc", "size", "compiles", "visits", "instructions", "percent");
+
+	const size_t count = std::min<size_t>(sorted.size(), BLOCK_PROFILE_REPORT_ENTRIES);
+	for (size_t i = 0; i < count; i++)
+	{
+		const BlockProfileTotal& total = *sorted[i].second;
+		const u64 insts = total.visits * total.size;
+		std::fprintf(fp.get(), "  %08X %6u %8u %16llu %16llu %7.3f%%\n", sorted[i].first, total.size, total.compiles,
+			static_cast<unsigned long long>(total.visits), static_cast<unsigned long long>(insts),
+			total_insts ? (static_cast<double>(insts) * 100.0 / static_cast<double>(total_insts)) : 0.0);
+	}
+
+	DevCon.WriteLn("EE block profile: wrote %zu of %zu blocks to %s", count, sorted.size(), filename.c_str());
+}
+
 ////////////////////////////////////////////////////
 static void recResetRaw()
 {
@@ -646,6 +880,24 @@ static void recResetRaw()
 
 	Console.WriteLn(Color_StrongBlack, "EE/iR5900-32 Recompiler Reset");
 
+	// A reset while the same game is still running (code cache overflow, self-modifying code) keeps
+	// collecting into the same list; anything else starts over at the next entry point.
+	SaveBlockList();
+	if (!g_GameStarted || ElfCRC != s_blockListCRC)
+		s_blockListCRC = 0;
+
+	// Only the counters die with the code, the totals carry on until the game changes.
+	if (s_blockProfileCRC != ElfCRC)
+	{
+		SaveBlockProfile();
+		s_blockProfileTotals.clear();
+		s_blockProfileCRC = ElfCRC;
+	}
+	else
+	{
+		CollectBlockProfile();
+	}
+
 	recMem->Reset();
 	ClearRecLUT((BASEBLOCK*)recLutReserve_RAM, recLutSize);
 	memset(recRAMCopy, 0, Ps2MemSize::MainRam);
@@ -665,6 +917,7 @@ static void recResetRaw()
 	recPtr = *recMem;
 	recConstBufPtr = recConstBuf;
 
+
 	g_branch = 0;
 	g_resetEeScalingStats = true;
 #ifndef PCSX2_CORE
@@ -674,6 +927,13 @@ static void recResetRaw()
 
 static void recShutdown()
 {
+	SaveBlockList();
+	s_blockListCRC = 0;
+
+	SaveBlockProfile();
+	s_blockProfileTotals.clear();
+	s_blockProfileCRC = 0;
+
 	safe_delete(recMem);
 	safe_aligned_free(recRAMCopy);
 	safe_aligned_free(recLutReserve_RAM);
@@ -968,6 +1228,7 @@ void SetBranchImm(u32 imm)
 void SaveBranchState()
 {
 	s_savenBlockCycles = s_nBlockCycles;
+	memcpy(s_saveHiLoReady, s_nHiLoReady, sizeof(s_nHiLoReady));
 	memcpy(s_saveConstRegs, g_cpuConstRegs, sizeof(g_cpuConstRegs));
 	s_saveHasConstReg = g_cpuHasConstReg;
 	s_saveFlushedConstReg = g_cpuFlushedConstReg;
@@ -979,6 +1240,7 @@ void SaveBranchState()
 void LoadBranchState()
 {
 	s_nBlockCycles = s_savenBlockCycles;
+	memcpy(s_nHiLoReady, s_saveHiLoReady, sizeof(s_nHiLoReady));
 
 	memcpy(g_cpuConstRegs, s_saveConstRegs, sizeof(g_cpuConstRegs));
 	g_cpuHasConstReg = s_saveHasConstReg;
@@ -1302,12 +1564,15 @@ void dynarecCheckBreakpoint()
 	recExitExecution();
 }
 
-void dynarecMemcheck()
+void dynarecMemcheck(u32 block_cycles)
 {
 	u32 pc = cpuRegs.pc;
 	if (CBreakPoints::CheckSkipFirst(BREAKPOINT_EE, pc) != 0)
 		return;
 
+	// Memchecks don't split blocks, so charge the part of the block that already ran.
+	cpuRegs.cycle += block_cycles;
+
 	CBreakPoints::SetBreakpointTriggered(true);
 #ifndef PCSX2_CORE
 	GetCoreThread().PauseSelfDebug();
@@ -1323,12 +1588,60 @@ void dynarecMemLogcheck(u32 start, bool store)
 		DevCon.WriteLn("Hit load breakpoint @0x%x", start);
 }
 
+static void recMemcheckHit(const MemCheck& check, bool store)
+{
+	// ecx = access address
+	if (check.result & MEMCHECK_LOG)
+	{
+		xMOV(edx, store);
+		xFastCall((void*)dynarecMemLogcheck, ecx, edx);
+	}
+	if (check.result & MEMCHECK_BREAK)
+	{
+		xFastCall(dynarecMemcheck, scaleblockcycles());
+	}
+}
+
 void recMemcheck(u32 op, u32 bits, bool store)
 {
+	// Drop checks that can't fire for this kind of access before emitting anything,
+	// so loads or stores that no memcheck cares about run at full speed.
+	std::vector<MemCheck> checks = CBreakPoints::GetMemChecks();
+	checks.erase(std::remove_if(checks.begin(), checks.end(), [store](const MemCheck& check) {
+		return check.cpu != BREAKPOINT_EE || check.result == 0 ||
+			   (check.cond & (store ? MEMCHECK_WRITE : MEMCHECK_READ)) == 0;
+	}), checks.end());
+	if (checks.empty())
+		return;
+
+	const u32 rs = (op >> 21) & 0x1F;
+	if (GPR_IS_CONST1(rs))
+	{
+		// The address is known now, so resolve the checks at compile time.
+		u32 addr = g_cpuConstRegs[rs].UL[0] + (s16)op;
+		if (bits == 128)
+			addr &= ~0x0F;
+		addr = standardizeBreakpointAddress(addr);
+
+		checks.erase(std::remove_if(checks.begin(), checks.end(), [addr, bits](const MemCheck& check) {
+			return addr >= standardizeBreakpointAddress(check.end) || standardizeBreakpointAddress(check.start) >= addr + bits / 8;
+		}), checks.end());
+		if (checks.empty())
+			return;
+
+		iFlushCall(FLUSH_EVERYTHING | FLUSH_PC);
+		for (const MemCheck& check : checks)
+		{
+			xMOV(ecx, addr);
+			recMemcheckHit(check, store);
+		}
+		return;
+	}
+
 	iFlushCall(FLUSH_EVERYTHING | FLUSH_PC);
 
 	// compute accessed address
-	_eeMoveGPRtoR(ecx, (op >> 21) & 0x1F);
+	_eeMoveGPRtoR(ecx, rs);
 	if ((s16)op != 0)
 		xADD(ecx, (s16)op);
 	if (bits == 128)
@@ -1342,18 +1655,8 @@ void recMemcheck(u32 op, u32 bits, bool store)
 	// ecx = access address
 	// edx = access address+size
 
-	auto checks = CBreakPoints::GetMemChecks();
 	for (size_t i = 0; i < checks.size(); i++)
 	{
-		if (checks[i].cpu != BREAKPOINT_EE)
-			continue;
-		if (checks[i].result == 0)
-			continue;
-		if ((checks[i].cond & MEMCHECK_WRITE) == 0 && store)
-			continue;
-		if ((checks[i].cond & MEMCHECK_READ) == 0 && !store)
-			continue;
-
 		// logic: memAddress < bpEnd && bpStart < memAddress+memSize
 
 		xMOV(eax, standardizeBreakpointAddress(checks[i].end));
@@ -1365,15 +1668,7 @@ void recMemcheck(u32 op, u32 bits, bool store)
 		xForwardJGE8 next2; // if start >= address+size then goto next2
 
 		// hit the breakpoint
-		if (checks[i].result & MEMCHECK_LOG)
-		{
-			xMOV(edx, store);
-			xFastCall((void*)dynarecMemLogcheck, ecx, edx);
-		}
-		if (checks[i].result & MEMCHECK_BREAK)
-		{
-			xFastCall((void*)dynarecMemcheck);
-		}
+		recMemcheckHit(checks[i], store);
 
 		next1.SetTarget();
 		next2.SetTarget();
@@ -1419,6 +1714,50 @@ void encodeMemcheck()
 	}
 }
 
+// Which HI/LO pipe an instruction issues to (mult/div) or reads/writes (mfhi etc), -1 if neither.
+static int recHiLoPipe(bool* issue)
+{
+	const u32 funct = cpuRegs.code & 0x3f;
+	switch (cpuRegs.code >> 26)
+	{
+		case 000: // SPECIAL
+			*issue = (funct & 074) == 030; // MULT/MULTU/DIV/DIVU
+			return (*issue || (funct & 074) == 020) ? 0 : -1; // MFHI/MTHI/MFLO/MTLO
+		case 034: // MMI
+			*issue = funct <= 001 || funct == 040 || funct == 041 || (funct & 074) == 030; // MADD/MADDU, MADD1/MADDU1, MULT1..DIVU1
+			if (funct <= 001)
+				return 0;
+			return (*issue || (funct & 074) == 020) ? 1 : -1; // MFHI1/MTHI1/MFLO1/MTLO1
+		default:
+			return -1;
+	}
+}
+
+// Cycles charged for the current instruction, in s_nBlockCycles units.
+static u32 recInstructionCycles(const OPCODE& opcode)
+{
+	//If the COP0 DIE bit is disabled, cycles should be doubled.
+	const u32 scale = 2 - ((cpuRegs.CP0.n.Config >> 18) & 0x1);
+	if (!EmuConfig.Cpu.Recompiler.EEPipelineStalls)
+		return opcode.cycles * scale;
+
+	// Mult/div only occupy the issue slot; anything touching HI/LO on the same pipe waits for the result.
+	bool issue = false;
+	const int pipe = recHiLoPipe(&issue);
+	if (pipe < 0)
+		return opcode.cycles * scale;
+
+	const u32 stall = (s_nHiLoReady[pipe] > s_nBlockCycles) ? (s_nHiLoReady[pipe] - s_nBlockCycles) : 0;
+	const u32 cycles = stall + 9 * scale;
+	if (issue)
+	{
+		const u32 funct = cpuRegs.code & 0x3f;
+		const u32 latency = ((funct & 076) == 032) ? (37 * 8) : (4 * 8); // DIV/DIVU vs the multiplies
+		s_nHiLoReady[pipe] = s_nBlockCycles + cycles + latency * scale;
+	}
+	return cycles;
+}
+
 void recompileNextInstruction(int delayslot)
 {
 	u32 i;
@@ -1513,10 +1852,14 @@ void recompileNextInstruction(int delayslot)
 		// Note: Tests on a ps2 suggested more like 5 cycles for a NOP. But there's many factors in this..
 		s_nBlockCycles += 9 * (2 - ((cpuRegs.CP0.n.Config >> 18) & 0x1));
 	}
+	else if (g_pCurInstInfo->info & EEINST_DEAD_GPR_WRITE)
+	{
+		// Result is overwritten before it's read, so there's nothing to emit. Still costs cycles, though.
+		s_nBlockCycles += recInstructionCycles(opcode);
+	}
 	else
 	{
-		//If the COP0 DIE bit is disabled, cycles should be doubled.
-		s_nBlockCycles += opcode.cycles * (2 - ((cpuRegs.CP0.n.Config >> 18) & 0x1));
+		s_nBlockCycles += recInstructionCycles(opcode);
 		try
 		{
 			opcode.recompile();
@@ -1700,6 +2043,9 @@ static void memory_protect_recompiled_code(u32 startpc, u32 size)
 	// note: blocks are guaranteed to reside within the confines of a single page.
 	const vtlb_ProtectionMode PageType = contains_thread_stack ? ProtMode_Manual : mmap_GetRamPageInfo(inpage_ptr);
 
+	if (PageType != ProtMode_NotRequired)
+		mmap_MarkRamPageCode(inpage_ptr, inpage_sz);
+
 	switch (PageType)
 	{
 		case ProtMode_NotRequired:
@@ -1736,7 +2082,9 @@ static void memory_protect_recompiled_code(u32 startpc, u32 size)
 
 			// (ideally, perhaps, manual_counter should be reset to 0 every few minutes?)
 
-			if (!contains_thread_stack && manual_counter[inpage_ptr >> 12] <= 3)
+			// Pages which faulted more than once on writes outside of their code are data sharing a
+			// page with code; re-protecting them just buys another fault and a full page recompile.
+			if (!contains_thread_stack && manual_counter[inpage_ptr >> 12] <= 3 && mmap_GetRamPageDataFaults(inpage_ptr) < 2)
 			{
 				// Counted blocks add a weighted (by block size) value into manual_page each time they're
 				// run.  If the block gets run a lot, it resets and re-protects itself in the hope
@@ -1857,6 +2205,14 @@ static void recRecompile(const u32 startpc)
 
 	pxAssert(s_pCurBlockEx);
 
+	BlockProfileEntry* profile = nullptr;
+	if (EmuConfig.Cpu.Recompiler.EnableEEBlockProfile)
+	{
+		profile = &s_blockProfile.emplace_back(BlockProfileEntry{startpc, 0, 0});
+		xADD(ptr32[reinterpret_cast<u32*>(&profile->visits)], 1);
+		xADC(ptr32[reinterpret_cast<u32*>(&profile->visits) + 1], 0);
+	}
+
 	if (HWADDR(startpc) == EELOAD_START)
 	{
 		// The EELOAD _start function is the same across all BIOS versions
@@ -1911,6 +2267,8 @@ static void recRecompile(const u32 startpc)
 #else
 		VMManager::Internal::EntryPointCompilingOnCPUThread();
 #endif
+
+		s_blockListWarmPending = EmuConfig.Cpu.Recompiler.EnableEEBlockList;
 	}
 
 	g_branch = 0;
@@ -1918,6 +2276,7 @@ static void recRecompile(const u32 startpc)
 	// reset recomp state variables
 	s_nBlockCycles = 0;
 	s_nBlockInterlocked = false;
+	s_nHiLoReady[0] = s_nHiLoReady[1] = 0;
 	pc = startpc;
 	g_cpuHasConstReg = g_cpuFlushedConstReg = 1;
 	pxAssert(g_cpuConstRegs[0].UD[0] == 0);
@@ -1956,9 +2315,9 @@ static void recRecompile(const u32 startpc)
 	s_branchTo = -1;
 
 	// compile breakpoints as individual blocks
-	int n1 = isBreakpointNeeded(i);
-	int n2 = isMemcheckNeeded(i);
-	int n = std::max<int>(n1, n2);
+	// memchecks are checked inline by encodeMemcheck(), which flushes the pc and state,
+	// so they don't need a block of their own for every memory access.
+	int n = isBreakpointNeeded(i);
 	if (n != 0)
 	{
 		s_nEndBlock = i + n * 4;
@@ -1970,7 +2329,7 @@ static void recRecompile(const u32 startpc)
 		BASEBLOCK* pblock = PC_GETBLOCK(i);
 
 		// stop before breakpoints
-		if (isBreakpointNeeded(i) != 0 || isMemcheckNeeded(i) != 0)
+		if (isBreakpointNeeded(i) != 0)
 		{
 			s_nEndBlock = i;
 			break;
@@ -2117,8 +2476,24 @@ StartRecomp:
 					break;
 				}
 			}
-			// common register arithmetic instructions
-			else if (_Opcode_ == 0 && (_Funct_ & 060) == 040 && (_Funct_ & 076) != 050)
+			// constant shifts
+			else if (_Opcode_ == 0 && ((_Funct_ & 074) == 000 || (_Funct_ & 070) == 070) && (_Funct_ & 3) != 1)
+			{
+				if (loads & 1 << _Rt_)
+				{
+					loads |= 1 << _Rd_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rt_;
+				if (reads & 1 << _Rd_)
+				{
+					s_nBlockFF = false;
+					break;
+				}
+			}
+			// common register arithmetic instructions, variable shifts
+			else if (_Opcode_ == 0 && (((_Funct_ & 060) == 040 && (_Funct_ & 076) != 050) || ((_Funct_ & 054) == 004 && (_Funct_ & 3) != 1)))
 			{
 				if (loads & 1 << _Rs_ && loads & 1 << _Rt_)
 				{
@@ -2198,6 +2573,8 @@ StartRecomp:
 			COP2FlagHackPass().Run(startpc, s_nEndBlock, s_pInstCache + 1);
 	}
 
+	DeadGPRWritePass().Run(startpc, s_nEndBlock, s_pInstCache + 1);
+
 	// analyze instructions //
 	{
 		usecop2 = 0;
@@ -2363,6 +2740,12 @@ StartRecomp:
 	pxAssert(xGetPtr() - recPtr < _64kb);
 	s_pCurBlockEx->x86size = xGetPtr() - recPtr;
 
+	if (profile)
+	{
+		profile->size = s_pCurBlockEx->size;
+		s_pCurBlockEx->visits = &profile->visits;
+	}
+
 #if 0
 	// Example: Dump both x86/EE code
 	if (startpc == 0x456630) {
@@ -2375,8 +2758,21 @@ StartRecomp:
 
 	pxAssert((g_cpuHasConstReg & g_cpuFlushedConstReg) == g_cpuHasConstReg);
 
+	if (s_blockListCRC != 0 && s_pCurBlockEx->size > 0 && HWADDR(startpc) >= BLOCK_LIST_MIN_ADDRESS &&
+		(HWADDR(startpc) + s_pCurBlockEx->size * 4) <= Ps2MemSize::MainRam)
+	{
+		s_blockList.push_back({startpc, s_pCurBlockEx->size, XXH3_64bits(PSM(startpc), s_pCurBlockEx->size * 4)});
+	}
+
 	s_pCurBlock = NULL;
 	s_pCurBlockEx = NULL;
+
+	// Blocks are compiled one at a time, so the warm-up has to wait until the entry point is done.
+	if (s_blockListWarmPending)
+	{
+		s_blockListWarmPending = false;
+		WarmBlockList();
+	}
 }
 
 // The only *safe* way to throw exceptions from the context of recompiled code.
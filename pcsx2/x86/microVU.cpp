@@ -20,6 +20,11 @@
 
 #include "common/AlignedMalloc.h"
 #include "common/Perf.h"
+#include "common/Timer.h"
+
+#define XXH_STATIC_LINKING_ONLY 1
+#define XXH_INLINE_ALL 1
+#include "xxhash.h"
 
 //------------------------------------------------------------------
 // Micro VU - Main Functions
@@ -114,6 +119,12 @@ void mVUreset(microVU& mVU, bool resetReserve)
 	mVU.prog.cur      = NULL;
 	mVU.prog.total    =  0;
 	mVU.prog.curFrame =  0;
+	mVU.prog.chunkDirty = ~0ull;
+
+	if (!mVU.prog.hashed)
+		mVU.prog.hashed = new microProgramHashMap();
+	else
+		mVU.prog.hashed->clear();
 
 	// Setup Dynarec Cache Limits for Each Program
 	u8* z = mVU.cache;
@@ -164,11 +175,22 @@ void mVUclose(microVU& mVU)
 		}
 		safe_delete(mVU.prog.prog[i]);
 	}
+	safe_delete(mVU.prog.hashed);
 }
 
 // Clears Block Data in specified range
 __fi void mVUclear(mV, u32 addr, u32 size)
 {
+	if (size > 0)
+	{
+		const u32 first = addr >> mHashChunkShift;
+		const u32 last = (addr + size - 1) >> mHashChunkShift;
+		if (first > last || last >= mHashChunks)
+			mVU.prog.chunkDirty = ~0ull;
+		else
+			mVU.prog.chunkDirty |= (~0ull >> (63 - last)) & (~0ull << first);
+	}
+
 	if (!mVU.prog.cleared)
 	{
 		mVU.prog.cleared = 1; // Next execution searches/creates a new microprogram
@@ -214,6 +236,22 @@ __ri microProgram* mVUcreateProg(microVU& mVU, int startPC)
 	return prog;
 }
 
+// Hashes the current micro memory (seeded with startPC), only rehashing chunks written since the last call
+static u64 mVUmicroHash(microVU& mVU, u32 startPC)
+{
+	const u32 chunks = mVU.microMemSize >> mHashChunkShift;
+	if (mVU.prog.chunkDirty)
+	{
+		for (u32 i = 0; i < chunks; i++)
+		{
+			if (mVU.prog.chunkDirty & (1ull << i))
+				mVU.prog.chunkHash[i] = XXH3_64bits(mVU.regs().Micro + (i << mHashChunkShift), 1u << mHashChunkShift);
+		}
+		mVU.prog.chunkDirty = 0;
+	}
+	return XXH3_64bits_withSeed(mVU.prog.chunkHash, chunks * sizeof(u64), startPC);
+}
+
 // Caches Micro Program
 __ri void mVUcacheProg(microVU& mVU, microProgram& prog)
 {
@@ -221,6 +259,7 @@ __ri void mVUcacheProg(microVU& mVU, microProgram& prog)
 		memcpy(prog.data, mVU.regs().Micro, 0x1000);
 	else
 		memcpy(prog.data, mVU.regs().Micro, 0x4000);
+	(*mVU.prog.hashed)[mVUmicroHash(mVU, prog.startPC)] = &prog;
 	mVUdumpProg(mVU, prog);
 }
 
@@ -297,6 +336,16 @@ __fi bool mVUcmpProg(microVU& mVU, microProgram& prog, const bool cmpWholeProg)
 	return true;
 }
 
+// Looks up a program whose snapshot matches all of mVU.regs().Micro, without comparing every cached program.
+// Entries aren't removed when a program is recached, the full compare rejects those.
+static microProgram* mVUfindHashedProg(microVU& mVU, u32 startPC)
+{
+	auto it = mVU.prog.hashed->find(mVUmicroHash(mVU, startPC));
+	if (it == mVU.prog.hashed->end() || it->second->startPC != startPC || !mVUcmpProg(mVU, *it->second, 1))
+		return nullptr;
+	return it->second;
+}
+
 // Searches for Cached Micro Program and sets prog.cur to it (returns entry-point to program)
 _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 {
@@ -306,10 +355,12 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 
 	if (!quick.prog) // If null, we need to search for new program
 	{
+		// Exact matches are found through the hash, otherwise check the compiled ranges of each program
+		microProgram* hashed = mVUfindHashedProg(mVU, mVU.regs().start_pc / 8);
 		std::deque<microProgram*>::iterator it(list->begin());
 		for (; it != list->end(); ++it)
 		{
-			bool b = mVUcmpProg(mVU, *it[0], 0);
+			bool b = hashed ? (it[0] == hashed) : mVUcmpProg(mVU, *it[0], 0);
 
 			if (b)
 			{
@@ -328,7 +379,12 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 			}
 		}
 
-		// If cleared and program not found, make a new program instance
+		// If cleared and program not found, make a new program instance.
+		// The entry block is compiled right here on the thread running the VU; it can't be handed
+		// off to a worker with the interpreter running in the meantime, since the interpreter
+		// doesn't maintain the micro flag instances and lpState that recompiled code resumes from.
+		// Report the slow compiles instead so the stalls can at least be attributed.
+		Common::Timer compileTimer;
 		mVU.prog.cleared = 0;
 		mVU.prog.isSame  = 1;
 		mVU.prog.cur     = mVUcreateProg(mVU, mVU.regs().start_pc/8);
@@ -336,6 +392,10 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 		quick.block      = mVU.prog.cur->block[startPC/8];
 		quick.prog       = mVU.prog.cur;
 		list->push_front(mVU.prog.cur);
+
+		const double compileTime = compileTimer.GetTimeMilliseconds();
+		if (compileTime >= 1.0)
+			DevCon.Warning("microVU%d: Prog [%03d] [PC=%04x] entry compile took %.2f ms", mVU.index, mVU.prog.cur->idx, startPC, compileTime);
 		//mVUprintUniqueRatio(mVU);
 		return entryPoint;
 	}
@@ -23,6 +23,7 @@ using namespace x86Emitter;
 #include <deque>
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include "Common.h"
 #include "VU.h"
 #include "MTVU.h"
@@ -175,6 +176,11 @@ struct microProgram
 };
 
 typedef std::deque<microProgram*> microProgramList;
+typedef std::unordered_map<u64, microProgram*> microProgramHashMap;
+
+// Micro memory is hashed in 256 byte chunks, so VU1's 16kb micro memory fits a 64-bit dirty mask
+#define mHashChunkShift 8
+#define mHashChunks (0x4000 >> mHashChunkShift)
 
 struct microProgramQuick
 {
@@ -187,6 +193,9 @@ struct microProgManager
 	microIR<mProgSize> IRinfo;             // IR information
 	microProgramList*  prog [mProgSize/2]; // List of microPrograms indexed by startPC values
 	microProgramQuick  quick[mProgSize/2]; // Quick reference to valid microPrograms for current execution
+	microProgramHashMap* hashed;           // microPrograms indexed by startPC and the hash of their full micro memory snapshot
+	u64                chunkHash[mHashChunks]; // Hashes of each chunk of mVU.regs().Micro
+	u64                chunkDirty;         // Chunks which have been written since they were last hashed
 	microProgram*      cur;                // Pointer to currently running MicroProgram
 	int                total;              // Total Number of valid MicroPrograms
 	int                isSame;             // Current cached microProgram is Exact Same program as mVU.regs().Micro (-1 = unknown, 0 = No, 1 = Yes)
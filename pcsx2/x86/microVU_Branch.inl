@@ -313,10 +313,6 @@ void normJumpCompile(mV, microFlagCycles& mFC, bool isEvilJump)
 	}
 	else
 		xMOV(arg1regd, ptr32[&mVU.branch]);
-	if (doJumpCaching)
-		xLoadFarAddr(arg2reg, mVUpBlock);
-	else
-		xLoadFarAddr(arg2reg, &mVUpBlock->pStateEnd);
 
 	if (mVUup.eBit && isEvilJump) // E-bit EvilJump
 	{
@@ -329,10 +325,44 @@ void normJumpCompile(mV, microFlagCycles& mFC, bool isEvilJump)
 		xJMP(mVU.exitFunct);
 	}
 
-	if (!mVU.index)
-		xFastCall((void*)(void (*)())mVUcompileJIT<0>, arg1reg, arg2reg); //(u32 startPC, uptr pState)
+	auto callJIT = [&mVU]() {
+		if (!mVU.index)
+			xFastCall((void*)(void (*)())mVUcompileJIT<0>, arg1reg, arg2reg); //(u32 startPC, uptr pState)
+		else
+			xFastCall((void*)(void (*)())mVUcompileJIT<1>, arg1reg, arg2reg);
+	};
+
+	if (doJumpCaching)
+	{
+		// Inline version of the jump cache check in mVUcompileJIT(), so jumps to an already compiled
+		// target (i.e. subroutine returns) don't go through a function call every time.
+		// Entries are 16 bytes and indexed by pc / 8. arg2reg may alias gprT3, so it's loaded afterwards.
+		static_assert(sizeof(microJumpCache) == 16 && sizeof(microProgramQuick) == 16, "Jump cache index scale");
+
+		xLoadFarAddr(gprT3q, mVUpBlock->jumpCache);
+		xMOV(gprT1q, ptr64[arg1reg * 2 + gprT3q + static_cast<sptr>(offsetof(microJumpCache, prog))]);
+		xTEST(gprT1q, gprT1q);
+		xForwardJZ32 noProg;
+		xLoadFarAddr(gprT3q, &mVU.prog.quick[0].prog);
+		xCMP(gprT1q, ptr64[arg1reg * 2 + gprT3q]);
+		xForwardJNE32 oldProg;
+		xLoadFarAddr(gprT3q, mVUpBlock->jumpCache);
+		xMOV(gprT1q, ptr64[arg1reg * 2 + gprT3q + static_cast<sptr>(offsetof(microJumpCache, x86ptrStart))]);
+		if (!doJumpAsSameProgram)
+			xMOV(ptr32[&mVU.regs().start_pc], arg1regd);
+		xForwardJump32 cached;
+
+		noProg.SetTarget();
+		oldProg.SetTarget();
+		xLoadFarAddr(arg2reg, mVUpBlock);
+		callJIT();
+		cached.SetTarget();
+	}
 	else
-		xFastCall((void*)(void (*)())mVUcompileJIT<1>, arg1reg, arg2reg);
+	{
+		xLoadFarAddr(arg2reg, &mVUpBlock->pStateEnd);
+		callJIT();
+	}
 
 	mVUrestoreRegs(mVU);
 	xJMP(gprT1q); // Jump to rec-code address
@@ -25,6 +25,15 @@
 
 static void recReset(int idx)
 {
+	const HashBucket::Stats& stats = nVif[idx].vifBlocks.stats();
+	if (stats.lookups > 0)
+	{
+		DevCon.WriteLn("nVif%d: %llu unpacks, %llu routines compiled (%.3f%%), %.3f extra probes/unpack, %llu promotions", idx,
+			static_cast<unsigned long long>(stats.lookups), static_cast<unsigned long long>(stats.misses), static_cast<double>(stats.misses) * 100.0 / static_cast<double>(stats.lookups),
+			static_cast<double>(stats.probes) / static_cast<double>(stats.lookups), static_cast<unsigned long long>(stats.promotions));
+	}
+	nVif[idx].vifBlocks.reset_stats();
+
 	nVif[idx].vifBlocks.reset();
 
 	nVif[idx].recReserve->Reset();
@@ -255,6 +264,58 @@ void VifUnpackSSE_Dynarec::ModUnpack(int upknum, bool PostOp)
 	}
 }
 
+// --------------------------------------------------------------------------------------
+//  AVX2 pair unpacks
+// --------------------------------------------------------------------------------------
+// Unmasked V4-32/V4-16/V4-8 unpacks without a row mode are plain copies or widenings, so on
+// AVX2 hosts two consecutive QWs in the same write cycle are handled by a single 256-bit
+// load/extend and store. The emitter has no ymm operand types, so the few VEX forms needed
+// here are encoded by hand; the source and destination are always [argreg + disp].
+
+static void xVexYmmMem(u8 pp, u8 map, u8 opcode, int ymm, const xAddressVoid& addr)
+{
+	const xAddressReg& reg = addr.Base.IsEmpty() ? addr.Index : addr.Base;
+	pxAssert(addr.Base.IsEmpty() || addr.Index.IsEmpty());
+	pxAssert((reg.Id & 7) != 4); // no SIB forms
+
+	xWrite8(0xC4);
+	xWrite8(((ymm & 8) ? 0x00 : 0x80) | 0x40 | (reg.IsExtended() ? 0x00 : 0x20) | map);
+	xWrite8(0x78 | 0x04 | pp); // W0, vvvv unused, L=256
+	xWrite8(opcode);
+
+	const u8 modrm = ((ymm & 7) << 3) | (reg.Id & 7);
+	if (is_s8(addr.Displacement))
+	{
+		xWrite8(0x40 | modrm);
+		xWrite8(static_cast<u8>(addr.Displacement));
+	}
+	else
+	{
+		xWrite8(0x80 | modrm);
+		xWrite32(static_cast<u32>(addr.Displacement));
+	}
+}
+
+bool VifUnpackSSE_Dynarec::CanUnpackPairAVX2(int upknum, int cycleSize, uint vNum) const
+{
+	if (!x86caps.hasAVX2 || isFill || doMask || doMode)
+		return false;
+	if (upknum < 12 || upknum > 14)
+		return false;
+	return (vNum >= 2) && (vCL + 1 < cycleSize);
+}
+
+void VifUnpackSSE_Dynarec::xUnpackPairAVX2(int upknum) const
+{
+	switch (upknum)
+	{
+		case 12: xVexYmmMem(2, 1, 0x6F, destReg.Id, srcIndirect); break;              // vmovdqu ymm, m256
+		case 13: xVexYmmMem(1, 2, usn ? 0x33 : 0x23, destReg.Id, srcIndirect); break; // vpmov[zs]xwd ymm, m128
+		case 14: xVexYmmMem(1, 2, usn ? 0x31 : 0x21, destReg.Id, srcIndirect); break; // vpmov[zs]xbd ymm, m64
+	}
+	xVexYmmMem(2, 1, 0x7F, destReg.Id, dstIndirect); // vmovdqu m256, ymm
+}
+
 void VifUnpackSSE_Dynarec::CompileRoutine()
 {
 	const int wl        = vB.wl ? vB.wl : 256; // 0 is taken as 256 (KH2)
@@ -274,6 +335,7 @@ void VifUnpackSSE_Dynarec::CompileRoutine()
 	// Value passed determines # of col regs we need to load
 	SetMasks(isFill ? blockSize : cycleSize);
 
+	bool usedAVX2 = false;
 	while (vNum)
 	{
 
@@ -284,7 +346,20 @@ void VifUnpackSSE_Dynarec::CompileRoutine()
 			ShiftDisplacementWindow(srcIndirect, arg2reg); //Don't need to do this otherwise as we arent reading the source.
 
 
-		if (vCL < cycleSize)
+		if (CanUnpackPairAVX2(upkNum, cycleSize, vNum))
+		{
+			xUnpackPairAVX2(upkNum);
+			usedAVX2 = true;
+
+			dstIndirect += 32;
+			srcIndirect += vift * 2;
+
+			vNum -= 2;
+			vCL += 2;
+			if (vCL == blockSize)
+				vCL = 0;
+		}
+		else if (vCL < cycleSize)
 		{
 			ModUnpack(upkNum, false);
 			xUnpack(upkNum);
@@ -321,6 +396,13 @@ void VifUnpackSSE_Dynarec::CompileRoutine()
 
 	if (doMode >= 2)
 		writeBackRow();
+	if (usedAVX2)
+	{
+		// vzeroupper, avoids SSE/AVX transition stalls in the caller
+		xWrite8(0xC5);
+		xWrite8(0xF8);
+		xWrite8(0x77);
+	}
 	xRET();
 }
 
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <array>
+#include <utility>
 #include "fmt/core.h"
 #include "common/AlignedMalloc.h"
 
@@ -59,13 +60,27 @@ union nVifBlock
 // The hash function is determined by taking the first bytes of data and
 // performing a modulus the size of hSize. So the most diverse-data should
 // be in the first bytes of the struct. (hence why nVifBlock is specifically sorted)
+//
+// Chains are kept in rough most-recently-used order: a hit past the head of a chain swaps the
+// block one step forward, so the routines a game actually streams with end up first.
 class HashBucket
 {
+public:
+	struct Stats
+	{
+		u64 lookups;    // number of find() calls
+		u64 misses;     // lookups which had to compile a new routine
+		u64 probes;     // chain entries compared past the first one
+		u64 promotions; // hits moved up their chain
+	};
+
 protected:
 	std::array<nVifBlock*, hSize> m_bucket;
+	Stats m_stats;
 
 public:
 	HashBucket()
+		: m_stats()
 	{
 		m_bucket.fill(nullptr);
 	}
@@ -74,20 +89,39 @@ public:
 
 	__fi nVifBlock* find(const nVifBlock& dataPtr)
 	{
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
+		nVifBlock* chainhead = m_bucket[dataPtr.hash_key];
+		nVifBlock* chainpos = chainhead;
+
+		m_stats.lookups++;
 
 		while (true)
 		{
 			if (chainpos->key0 == dataPtr.key0 && chainpos->key1 == dataPtr.key1)
+			{
+				if (chainpos != chainhead && chainpos->startPtr != 0)
+				{
+					std::swap(chainpos[-1], chainpos[0]);
+					m_stats.promotions++;
+					chainpos--;
+				}
+
 				return chainpos;
+			}
 
 			if (chainpos->startPtr == 0)
+			{
+				m_stats.misses++;
 				return nullptr;
+			}
 
 			chainpos++;
+			m_stats.probes++;
 		}
 	}
 
+	const Stats& stats() const { return m_stats; }
+	void reset_stats() { m_stats = {}; }
+
 	void add(const nVifBlock& dataPtr)
 	{
 		u32 b = dataPtr.hash_key;
@@ -136,6 +136,8 @@ protected:
 	virtual void doMaskWrite(const xRegisterSSE& regX) const;
 	void SetMasks(int cS) const;
 	void writeBackRow() const;
+	bool CanUnpackPairAVX2(int upknum, int cycleSize, uint vNum) const;
+	void xUnpackPairAVX2(int upknum) const;
 
 	static VifUnpackSSE_Dynarec FillingWrite(const VifUnpackSSE_Dynarec& src)
 	{
@@ -17,6 +17,8 @@
 #include "GSBlock.h"
 #include "GSClut.h"
 #include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
 #include <string.h>
 
 static void swizzle(const u8* table, u8* dst, const u8* src, int bpp, bool deswizzle)
@@ -510,3 +512,92 @@ TEST(WriteTest, Write4HL)
 		assertEqual(expected, data, "Write4HL", 8, 8, 32);
 	});
 }
+
+// Throughput benchmarks. These are disabled so they don't slow down the normal test run, build
+// each swizzle_test_<isa> target and run it with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+// to compare the SSE4/AVX/AVX2 builds of the same kernel on the host machine.
+// Results are also recorded as test properties, so --gtest_output=json:<file> gives machine readable output.
+
+#if _M_SSE >= 0x501
+static constexpr const char* s_isa_name = "AVX2";
+#elif _M_SSE >= 0x500
+static constexpr const char* s_isa_name = "AVX";
+#else
+static constexpr const char* s_isa_name = "SSE4";
+#endif
+
+/// Stops the compiler from hoisting the kernel out of the benchmark loop
+static void clobber(void* p)
+{
+#ifdef _MSC_VER
+	_ReadWriteBarrier();
+#else
+	asm volatile("" : : "r"(p) : "memory");
+#endif
+}
+
+template <typename F>
+static void benchmark(const char* name, F fn, size_t bytes_per_call = sizeof(TestData::block))
+{
+	constexpr int iterations = 1 << 20;
+	TestData data = TestData::Random();
+
+	fn(data);
+
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; i++)
+	{
+		fn(data);
+		clobber(&data);
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	// Block kernels consume or produce exactly one 256 byte GS block per call.
+	const double gbps = static_cast<double>(iterations) * bytes_per_call / elapsed.count() / 1e9;
+	std::printf("%-24s %-5s %8.2f GB/s\n", name, s_isa_name, gbps);
+
+	char value[32];
+	std::snprintf(value, sizeof(value), "%.3f", gbps);
+	::testing::Test::RecordProperty(std::string(name) + "_" + s_isa_name + "_GBps", value);
+}
+
+TEST(BenchmarkTest, DISABLED_Read)
+{
+	benchmark("ReadBlock32", [](TestData& data) { GSBlock::ReadBlock32(data.block, data.output, 32); });
+	benchmark("ReadBlock16", [](TestData& data) { GSBlock::ReadBlock16(data.block, data.output, 32); });
+	benchmark("ReadBlock8", [](TestData& data) { GSBlock::ReadBlock8(data.block, data.output, 16); });
+	benchmark("ReadBlock4", [](TestData& data) { GSBlock::ReadBlock4(data.block, data.output, 16); });
+	benchmark("ReadBlock8HP", [](TestData& data) { GSBlock::ReadBlock8HP(data.block, data.output, 8); });
+	benchmark("ReadBlock4HHP", [](TestData& data) { GSBlock::ReadBlock4HHP(data.block, data.output, 8); });
+}
+
+TEST(BenchmarkTest, DISABLED_Write)
+{
+	benchmark("WriteBlock32", [](TestData& data) { GSBlock::WriteBlock32<32, 0xFFFFFFFF>(data.output, data.block, 32); });
+	benchmark("WriteBlock16", [](TestData& data) { GSBlock::WriteBlock16<32>(data.output, data.block, 32); });
+	benchmark("WriteBlock8", [](TestData& data) { GSBlock::WriteBlock8<32>(data.output, data.block, 16); });
+	benchmark("WriteBlock4", [](TestData& data) { GSBlock::WriteBlock4<32>(data.output, data.block, 16); });
+	benchmark("UnpackAndWriteBlock8H", [](TestData& data) { GSBlock::UnpackAndWriteBlock8H(data.block, 8, data.output); });
+}
+
+TEST(BenchmarkTest, DISABLED_ReadAndExpand)
+{
+	GIFRegTEXA texa = {0};
+	texa.TA0 = 1;
+	texa.TA1 = 2;
+
+	benchmark("ReadAndExpandBlock16", [&texa](TestData& data) { GSBlock::ReadAndExpandBlock16<false>(data.block, data.output, 64, texa); });
+	benchmark("ReadAndExpandBlock8_32", [](TestData& data) { GSBlock::ReadAndExpandBlock8_32(data.block, data.output, 64, data.clut32); });
+	benchmark("ReadAndExpandBlock4_32", [](TestData& data) { GSBlock::ReadAndExpandBlock4_32(data.block, data.output, 128, data.clut32); });
+	benchmark("ReadAndExpandBlock8H_32", [](TestData& data) { GSBlock::ReadAndExpandBlock8H_32(data.block, data.output, 32, data.clut32); });
+}
+
+TEST(BenchmarkTest, DISABLED_Clut)
+{
+	// The CLUT read/write kernels move a whole 256 entry palette per call, the 64-bit expand produces its table.
+	constexpr size_t palette_bytes = 256 * sizeof(u32);
+
+	benchmark("WriteCLUT_T32_I8_CSM1", [](TestData& data) { GSClut::WriteCLUT_T32_I8_CSM1(data.clut32, reinterpret_cast<u16*>(data.output), 0); }, palette_bytes);
+	benchmark("ReadCLUT_T32_I8", [](TestData& data) { GSClut::ReadCLUT_T32_I8(reinterpret_cast<const u16*>(data.output), data.clut32, 0); }, palette_bytes);
+	benchmark("ExpandCLUT64_T32_I8", [](TestData& data) { GSClut::ExpandCLUT64_T32_I8(data.clut32, data.clut64); }, sizeof(TestData::clut64));
+}
@@ -22,11 +22,13 @@
 #include "common/StringUtil.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 #include <memory>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 #ifdef _WIN32
@@ -39,10 +41,17 @@
 #include "7zCrc.h"
 #include "SZErrors.h"
 
+#include "zstd.h"
+
 static constexpr size_t kInputBufSize = ((size_t)1 << 18);
 static constexpr ISzAlloc g_Alloc = {SzAlloc, SzFree};
 #endif
 
+// Archive entries with this suffix are `zstd --patch-from=<installed file>` patches
+// for the file of the same name, rather than the file itself.
+static constexpr char DELTA_SUFFIX[] = ".zstpatch";
+static constexpr size_t DELTA_SUFFIX_LENGTH = sizeof(DELTA_SUFFIX) - 1;
+
 static std::FILE* s_file_console_stream;
 static constexpr IConsoleWriter s_file_console_writer = {
 	[](const char* fmt) { // WriteRaw
@@ -234,6 +243,13 @@ bool Updater::ParseZip()
 		while (entry.destination_filename[0] == FS_OSPATH_SEPARATOR_CHARACTER)
 			entry.destination_filename.erase(0, 1);
 
+		// patches stage and commit under the name of the file they produce
+		const size_t name_length = entry.destination_filename.length();
+		entry.is_delta = (name_length > DELTA_SUFFIX_LENGTH &&
+						  StringUtil::Strcasecmp(entry.destination_filename.c_str() + (name_length - DELTA_SUFFIX_LENGTH), DELTA_SUFFIX) == 0);
+		if (entry.is_delta)
+			entry.destination_filename.erase(name_length - DELTA_SUFFIX_LENGTH);
+
 		// skip directories (we sort them out later)
 		if (!entry.destination_filename.empty() && entry.destination_filename.back() != FS_OSPATH_SEPARATOR_CHARACTER)
 		{
@@ -242,7 +258,8 @@ bool Updater::ParseZip()
 			if (StringUtil::Strcasecmp(entry.destination_filename.c_str(), "updater.exe") != 0 &&
 				StringUtil::Strcasecmp(entry.destination_filename.c_str(), "portable.ini") != 0)
 			{
-				m_progress->DisplayFormattedInformation("Found file in zip: '%s'", entry.destination_filename.c_str());
+				m_progress->DisplayFormattedInformation("Found %s in zip: '%s'", entry.is_delta ? "delta" : "file",
+					entry.destination_filename.c_str());
 				m_update_paths.push_back(std::move(entry));
 			}
 		}
@@ -330,6 +347,8 @@ bool Updater::StageUpdate()
 			ISzAlloc_Free(&g_Alloc, out_buffer);
 	});
 
+	std::vector<DeltaToApply> deltas;
+
 	for (const FileToUpdate& ftu : m_update_paths)
 	{
 		m_progress->SetFormattedStatusText("Extracting '%s'...", ftu.destination_filename.c_str());
@@ -346,6 +365,16 @@ bool Updater::StageUpdate()
 			return false;
 		}
 
+		// 7z blocks are solid, so extraction stays sequential. Patches are applied together afterwards.
+		if (ftu.is_delta)
+		{
+			m_progress->DisplayFormattedInformation("Queueing delta for '%s' (%zu bytes)...", ftu.destination_filename.c_str(), extracted_size);
+			DeltaToApply& delta = deltas.emplace_back();
+			delta.ftu = &ftu;
+			delta.patch.assign(out_buffer + out_offset, out_buffer + out_offset + extracted_size);
+			continue;
+		}
+
 		m_progress->DisplayFormattedInformation("Writing '%s' to staging (%zu bytes)...", ftu.destination_filename.c_str(), extracted_size);
 
 		const std::string destination_file = StringUtil::StdStringFromFormat(
@@ -368,6 +397,108 @@ bool Updater::StageUpdate()
 		m_progress->IncrementProgressValue();
 	}
 
+	return deltas.empty() || ApplyDeltas(deltas);
+#else
+	return false;
+#endif
+}
+
+bool Updater::ApplyDeltas(std::vector<DeltaToApply>& deltas)
+{
+#ifdef _WIN32
+	m_progress->SetFormattedStatusText("Applying %zu delta patches...", deltas.size());
+
+	// Each patch reads its own installed file and writes its own staging file, so they can all run at once.
+	// The progress callback isn't thread safe, results are reported once the workers are done.
+	const size_t thread_count = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), deltas.size());
+	std::atomic<size_t> next_delta{0};
+	std::vector<std::thread> workers;
+	workers.reserve(thread_count);
+	for (size_t i = 0; i < thread_count; i++)
+	{
+		workers.emplace_back([this, &deltas, &next_delta]() {
+			for (size_t index = next_delta++; index < deltas.size(); index = next_delta++)
+				ApplyDelta(deltas[index]);
+		});
+	}
+	for (std::thread& worker : workers)
+		worker.join();
+
+	bool result = true;
+	for (const DeltaToApply& delta : deltas)
+	{
+		if (!delta.error.empty())
+		{
+			m_progress->DisplayFormattedError("Failed to apply delta for '%s': %s", delta.ftu->destination_filename.c_str(), delta.error.c_str());
+			result = false;
+			continue;
+		}
+
+		m_progress->DisplayFormattedInformation("Applied delta for '%s'", delta.ftu->destination_filename.c_str());
+		m_progress->IncrementProgressValue();
+	}
+
+	// Nothing has been committed yet, so the installation is untouched and the full update can still be used.
+	m_delta_mismatch = !result;
+	return result;
+#else
+	return false;
+#endif
+}
+
+bool Updater::ApplyDelta(DeltaToApply& delta) const
+{
+#ifdef _WIN32
+	const std::string& filename = delta.ftu->destination_filename;
+	const std::vector<u8>& patch = delta.patch;
+
+	// The frame checksum is what tells us the patch was made against the file that's installed,
+	// since decoding against the wrong base still "succeeds", it just produces garbage.
+	// Byte 4 is the frame header descriptor, bit 2 of which is the content checksum flag.
+	const unsigned long long output_size = ZSTD_getFrameContentSize(patch.data(), patch.size());
+	if (output_size == ZSTD_CONTENTSIZE_UNKNOWN || output_size == ZSTD_CONTENTSIZE_ERROR || patch.size() < 5 || !(patch[4] & 0x04))
+	{
+		delta.error = "patch is missing its content size or checksum";
+		return false;
+	}
+
+	const std::string installed_file = StringUtil::StdStringFromFormat(
+		"%s" FS_OSPATH_SEPARATOR_STR "%s", m_destination_directory.c_str(), filename.c_str());
+	std::optional<std::vector<u8>> base = FileSystem::ReadBinaryFile(installed_file.c_str());
+	if (!base.has_value())
+	{
+		delta.error = "installed file could not be read";
+		return false;
+	}
+
+	ZSTD_DCtx* dctx = ZSTD_createDCtx();
+	if (!dctx)
+	{
+		delta.error = "failed to create decompression context";
+		return false;
+	}
+	ScopedGuard dctx_guard([dctx]() { ZSTD_freeDCtx(dctx); });
+
+	std::vector<u8> output(static_cast<size_t>(output_size));
+	size_t ret = ZSTD_DCtx_refPrefix(dctx, base->data(), base->size());
+	if (!ZSTD_isError(ret))
+		ret = ZSTD_decompressDCtx(dctx, output.data(), output.size(), patch.data(), patch.size());
+	if (ZSTD_isError(ret) || ret != output.size())
+	{
+		delta.error = ZSTD_isError(ret) ? StringUtil::StdStringFromFormat("installed file does not match (%s)", ZSTD_getErrorName(ret)) :
+										  std::string("patch produced a short file");
+		return false;
+	}
+
+	const std::string destination_file = StringUtil::StdStringFromFormat(
+		"%s" FS_OSPATH_SEPARATOR_STR "%s", m_staging_directory.c_str(), filename.c_str());
+	if (!FileSystem::WriteBinaryFile(destination_file.c_str(), output.data(), output.size()))
+	{
+		FileSystem::DeleteFilePath(destination_file.c_str());
+		delta.error = StringUtil::StdStringFromFormat("failed to write staging file '%s'", destination_file.c_str());
+		return false;
+	}
+
 	return true;
 #else
 	return false;
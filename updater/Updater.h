@@ -42,6 +42,9 @@ public:
 	void CleanupStagingDirectory();
 	void RemoveUpdateZip();
 
+	/// True when staging failed because a delta patch didn't match the installed file.
+	bool HadDeltaMismatch() const { return m_delta_mismatch; }
+
 private:
 	static bool RecursiveDeleteDirectory(const char* path);
 
@@ -51,9 +54,19 @@ private:
 	{
 		u32 file_index;
 		std::string destination_filename;
+		bool is_delta;
+	};
+
+	struct DeltaToApply
+	{
+		const FileToUpdate* ftu;
+		std::vector<u8> patch;
+		std::string error;
 	};
 
 	bool ParseZip();
+	bool ApplyDeltas(std::vector<DeltaToApply>& deltas);
+	bool ApplyDelta(DeltaToApply& delta) const;
 
 	std::string m_zip_path;
 	std::string m_destination_directory;
@@ -64,6 +77,8 @@ private:
 
 	ProgressCallback* m_progress;
 
+	bool m_delta_mismatch = false;
+
 #ifdef _WIN32
 	CFileInStream m_archive_stream = {};
 	CLookToRead2 m_look_stream = {};
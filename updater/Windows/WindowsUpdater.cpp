@@ -489,7 +489,17 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 
 	if (!updater.StageUpdate())
 	{
-		progress.ModalError("Failed to stage update. Update not installed.");
+		if (updater.HadDeltaMismatch())
+		{
+			updater.CleanupStagingDirectory();
+			updater.RemoveUpdateZip();
+			progress.ModalError("The delta update does not match your installed files. Update not installed.\n\nPlease "
+								"check for updates again to download the full update.");
+		}
+		else
+		{
+			progress.ModalError("Failed to stage update. Update not installed.");
+		}
 		return 1;
 	}
 